@@ -8,6 +8,7 @@
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <string_view>
 #include <type_traits>
@@ -81,7 +82,7 @@ class OPENTXS_EXPORT Amount
 public:
     class Imp;
 
-    OPENTXS_NO_EXPORT auto Internal() const noexcept -> const internal::Amount&;
+    OPENTXS_NO_EXPORT auto Internal() const noexcept -> internal::Amount;
 
     auto operator==(const Amount& rhs) const noexcept -> bool;
     template <typename T, std::enable_if_t<std::is_integral<T>::value, int> = 0>
@@ -148,6 +149,15 @@ public:
     ~Amount();
 
 private:
+    /// Signed 64.64 fixed point value in two's complement
+    struct Small {
+        std::uint64_t low_;
+        std::int64_t high_;
+    };
+
+    /// Values which fit in Small are stored inline and imp_ is null. imp_ is
+    /// only allocated for values which do not fit.
     Imp* imp_;
+    Small small_;
 };
 }  // namespace opentxs
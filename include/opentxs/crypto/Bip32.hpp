@@ -7,6 +7,7 @@
 
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <tuple>
@@ -67,6 +68,16 @@ public:
         const EcdsaCurve& curve,
         const Secret& seed,
         const Path& path) const -> Key;
+    /// Derives the children [first, first + count) of parent. Private keys
+    /// are derived if the parent has one, otherwise public keys.
+    ///
+    /// throws std::runtime_error on invalid inputs
+    auto DeriveKeys(
+        const key::HD& parent,
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const noexcept(false)
+        -> UnallocatedVector<Key>;
     /// throws std::runtime_error on invalid inputs
     auto DerivePrivateKey(
         const key::HD& parent,
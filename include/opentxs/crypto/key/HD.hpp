@@ -7,6 +7,9 @@
 
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
+#include <memory>
+
 #include "opentxs/crypto/key/EllipticCurve.hpp"
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
@@ -51,6 +54,13 @@ public:
         -> ReadView = 0;
     virtual auto ChildKey(const Bip32Index index, const PasswordPrompt& reason)
         const noexcept -> std::unique_ptr<HD> = 0;
+    /// Derives the children [first, first + count). Returns an empty vector
+    /// on failure.
+    virtual auto ChildKeys(
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const noexcept
+        -> UnallocatedVector<std::unique_ptr<HD>> = 0;
     virtual auto Depth() const noexcept -> int = 0;
     virtual auto Fingerprint() const noexcept -> Bip32Fingerprint = 0;
     virtual auto Parent() const noexcept -> Bip32Fingerprint = 0;
@@ -73,6 +73,9 @@ public:
         const QString& memo,
         int scale = 0) const noexcept;
     Q_INVOKABLE QString getDepositAddress(const int chain = 0) const noexcept;
+    // Views which show part of the list should report the visible rows so
+    // distant rows are released. Every row is loaded until this is called.
+    Q_INVOKABLE void setViewport(int first, int count) const noexcept;
     Q_INVOKABLE bool validateAddress(const QString& address) const noexcept;
     Q_INVOKABLE QString validateAmount(const QString& amount) const noexcept;
     // NOLINTEND(modernize-use-trailing-return-type)
@@ -61,6 +61,9 @@ public:
         const QString& memo = "") const noexcept;
     Q_INVOKABLE QString paymentCode(const int currency) const noexcept;
     Q_INVOKABLE bool sendDraft() const noexcept;
+    // Views which show part of the list should report the visible rows so
+    // distant rows are released. Every row is loaded until this is called.
+    Q_INVOKABLE void setViewport(int first, int count) const noexcept;
     // NOLINTEND(modernize-use-trailing-return-type)
 
 public:
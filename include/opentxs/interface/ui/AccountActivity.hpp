@@ -7,6 +7,7 @@
 
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
 #include <tuple>
 
 #include "opentxs/blockchain/Types.hpp"
@@ -41,6 +42,8 @@ public:
     virtual auto Balance() const noexcept -> const Amount = 0;
     virtual auto BalancePolarity() const noexcept -> int = 0;
     virtual auto ContractID() const noexcept -> UnallocatedCString = 0;
+    /// Total number of items in the account including rows not yet loaded
+    virtual auto Count() const noexcept -> std::size_t = 0;
     virtual auto DepositAddress() const noexcept -> UnallocatedCString = 0;
     virtual auto DepositAddress(const blockchain::Type chain) const noexcept
         -> UnallocatedCString = 0;
@@ -73,6 +76,9 @@ public:
         const UnallocatedCString& amount,
         const UnallocatedCString& memo = {},
         Scale scale = 0) const noexcept -> bool = 0;
+    /// Load the rows near the visible range and release distant rows
+    virtual auto SetViewport(std::size_t first, std::size_t count)
+        const noexcept -> void = 0;
     virtual auto SyncPercentage() const noexcept -> double = 0;
     virtual auto SyncProgress() const noexcept -> std::pair<int, int> = 0;
     virtual auto Type() const noexcept -> AccountType = 0;
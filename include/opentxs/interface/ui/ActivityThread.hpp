@@ -7,6 +7,8 @@
 
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
+
 #include "opentxs/interface/ui/List.hpp"
 #include "opentxs/otx/client/Types.hpp"
 #include "opentxs/util/Container.hpp"
@@ -32,6 +34,8 @@ class OPENTXS_EXPORT ActivityThread : virtual public List
 {
 public:
     virtual auto CanMessage() const noexcept -> bool = 0;
+    /// Total number of items in the thread including rows not yet loaded
+    virtual auto Count() const noexcept -> std::size_t = 0;
     virtual auto DisplayName() const noexcept -> UnallocatedCString = 0;
     virtual auto First() const noexcept
         -> opentxs::SharedPimpl<opentxs::ui::ActivityThreadItem> = 0;
@@ -56,6 +60,9 @@ public:
     virtual auto SendDraft() const noexcept -> bool = 0;
     virtual auto SetDraft(const UnallocatedCString& draft) const noexcept
         -> bool = 0;
+    /// Load the rows near the visible range and release distant rows
+    virtual auto SetViewport(std::size_t first, std::size_t count)
+        const noexcept -> void = 0;
     virtual auto ThreadID() const noexcept -> UnallocatedCString = 0;
 
     ActivityThread(const ActivityThread&) = delete;
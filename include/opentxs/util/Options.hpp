@@ -25,6 +25,8 @@ class OPENTXS_EXPORT Options final
 public:
     auto BlockchainBindIpv4() const noexcept -> const Set<CString>&;
     auto BlockchainBindIpv6() const noexcept -> const Set<CString>&;
+    auto BlockchainBlockCacheBytes() const noexcept -> std::size_t;
+    auto BlockchainCfilterCacheBytes() const noexcept -> std::size_t;
     auto BlockchainProfile() const noexcept -> opentxs::BlockchainProfile;
     auto BlockchainWalletEnabled() const noexcept -> bool;
     auto DefaultMintKeyBytes() const noexcept -> std::size_t;
@@ -51,6 +53,7 @@ public:
     auto RemoteLogEndpoint() const noexcept -> std::string_view;
     auto StoragePrimaryPlugin() const noexcept -> std::string_view;
     auto TestMode() const noexcept -> bool;
+    auto ZMQWorkStealing() const noexcept -> bool;
 
     auto AddBlockchainIpv4Bind(std::string_view endpoint) noexcept -> Options&;
     auto AddBlockchainIpv6Bind(std::string_view endpoint) noexcept -> Options&;
@@ -65,6 +68,9 @@ public:
         std::string_view key,
         std::string_view value) noexcept -> Options&;
     auto ParseCommandLine(int argc, char** argv) noexcept -> Options&;
+    auto SetBlockchainBlockCacheBytes(std::size_t bytes) noexcept -> Options&;
+    auto SetBlockchainCfilterCacheBytes(std::size_t bytes) noexcept
+        -> Options&;
     auto SetBlockchainProfile(opentxs::BlockchainProfile value) noexcept
         -> Options&;
     auto SetBlockchainSyncEnabled(bool enabled) noexcept -> Options&;
@@ -85,6 +91,7 @@ public:
     auto SetQtRootObject(QObject*) noexcept -> Options&;
     auto SetStoragePlugin(std::string_view name) noexcept -> Options&;
     auto SetTestMode(bool test) noexcept -> Options&;
+    auto SetZMQWorkStealing(bool enabled) noexcept -> Options&;
 
     Options() noexcept;
     Options(int argc, char** argv) noexcept;
@@ -7,6 +7,7 @@
 
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
 #include <future>
 #include <memory>
 
@@ -17,6 +18,11 @@ namespace opentxs::storage
 class Driver
 {
 public:
+    /// Bytes occupied by the specified bucket
+    ///
+    /// Drivers which can not measure their buckets may keep this default,
+    /// in which case garbage collection reports no reclaimed space
+    virtual auto BucketSize(const bool) const -> std::size_t { return 0; }
     virtual auto EmptyBucket(const bool bucket) const -> bool = 0;
 
     virtual auto Load(
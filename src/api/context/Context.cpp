@@ -93,7 +93,7 @@ Context::Context(
     , task_list_lock_()
     , signal_handler_lock_()
     , config_()
-    , zmq_context_(opentxs::factory::ZMQContext())
+    , zmq_context_(opentxs::factory::ZMQContext(args_))
     , signal_handler_(nullptr)
     , log_(factory::Log(*zmq_context_, args_.RemoteLogEndpoint()))
     , asio_()
@@ -8,11 +8,14 @@
 #include "api/network/blockchain/Imp.hpp"  // IWYU pragma: associated
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
 #include "blockchain/database/common/Database.hpp"
+#include "internal/api/network/Asio.hpp"
 #include "internal/api/session/Endpoints.hpp"
 #include "internal/blockchain/Params.hpp"
 #include "internal/blockchain/node/Config.hpp"
@@ -22,6 +25,7 @@
 #include "internal/network/zeromq/Context.hpp"
 #include "internal/network/zeromq/socket/Raw.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "opentxs/api/network/Asio.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Endpoints.hpp"
 #include "opentxs/api/session/Session.hpp"
@@ -40,6 +44,7 @@
 #include "opentxs/util/Options.hpp"
 #include "opentxs/util/Pimpl.hpp"
 #include "opentxs/util/WorkType.hpp"
+#include "util/ScopeGuard.hpp"
 #include "util/Work.hpp"
 
 namespace opentxs::api::network
@@ -183,6 +188,8 @@ BlockchainImp::BlockchainImp(
     , init_promise_()
     , init_(init_promise_.get_future())
     , running_(true)
+    , compact_promise_()
+    , compacted_(compact_promise_.get_future())
 {
     OT_ASSERT(nullptr != thread_);
 }
@@ -195,6 +202,15 @@ auto BlockchainImp::AddSyncServer(
     return db_->AddSyncServer(endpoint);
 }
 
+auto BlockchainImp::compact() noexcept -> void
+{
+    if (running_ && db_->Compact()) {
+        post_compact();
+    } else {
+        compact_promise_.set_value();
+    }
+}
+
 auto BlockchainImp::ConnectedSyncServers() const noexcept -> Endpoints
 {
     return {};  // TODO
@@ -344,6 +360,10 @@ auto BlockchainImp::Init(
 
     OT_ASSERT(db_);
 
+    // NOTE bulk storage is compacted one batch at a time in the background so
+    // that readers and writers are never blocked for long
+    post_compact();
+
     const_cast<std::unique_ptr<Config>&>(base_config_) = [&] {
         auto out = std::make_unique<Config>();
         auto& output = *out;
@@ -422,6 +442,24 @@ auto BlockchainImp::IsEnabled(
     return false;
 }
 
+auto BlockchainImp::post_compact() noexcept -> void
+{
+    auto ran = std::make_shared<std::atomic_bool>(false);
+    // NOTE if the storage pool rejects the job, or destroys it unexecuted
+    // while shutting down, the last copy of the guard releases anything
+    // waiting on compacted_
+    auto guard = std::make_shared<ScopeGuard>([this, ran] {
+        if (false == ran->load()) { compact_promise_.set_value(); }
+    });
+    api_.Network().Asio().Internal().Post(
+        ThreadPool::Storage,
+        [this, ran, guard] {
+            ran->store(true);
+            compact();
+        },
+        compact_name_);
+}
+
 auto BlockchainImp::Profile() const noexcept -> BlockchainProfile
 {
     init_.get();
@@ -499,6 +537,8 @@ auto BlockchainImp::Shutdown() noexcept -> void
         for (auto& [chain, network] : networks_) { network->Shutdown().get(); }
 
         networks_.clear();
+
+        if (db_) { compacted_.wait(); }
     }
 
     Imp::Shutdown();
@@ -664,5 +704,12 @@ auto BlockchainImp::UpdatePeer(
     }());
 }
 
-BlockchainImp::~BlockchainImp() { batch_.ClearCallbacks(); }
+BlockchainImp::~BlockchainImp()
+{
+    running_ = false;
+
+    if (db_) { compacted_.wait(); }
+
+    batch_.ClearCallbacks();
+}
 }  // namespace opentxs::api::network
@@ -246,7 +246,12 @@ private:
     std::promise<void> init_promise_;
     std::shared_future<void> init_;
     std::atomic_bool running_;
+    std::promise<void> compact_promise_;
+    std::future<void> compacted_;
 
+    static constexpr auto compact_name_ = "bulk compaction";
+
+    auto compact() noexcept -> void;
     auto disable(const Lock& lock, const Chain type) const noexcept -> bool;
     auto enable(
         const Lock& lock,
@@ -254,6 +259,7 @@ private:
         const std::string_view seednode) const noexcept -> bool;
     auto hello(const Lock&, const Chains& chains, alloc::Default alloc)
         const noexcept -> opentxs::network::p2p::StateData;
+    auto post_compact() noexcept -> void;
     auto publish_chain_state(Chain type, bool state) const -> void;
     auto start(
         const Lock& lock,
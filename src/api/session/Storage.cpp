@@ -70,6 +70,7 @@
 #include "util/storage/tree/Root.hpp"
 #include "util/storage/tree/Seeds.hpp"
 #include "util/storage/tree/Servers.hpp"
+#include "util/storage/tree/Slicer.hpp"
 #include "util/storage/tree/Thread.hpp"
 #include "util/storage/tree/Threads.hpp"
 #include "util/storage/tree/Tree.hpp"
@@ -418,6 +419,12 @@ auto Storage::DeletePaymentWorkflow(
         .Delete(workflowID);
 }
 
+auto Storage::GarbageCollection() const noexcept
+    -> opentxs::storage::gc::Progress
+{
+    return Root().GarbageCollection();
+}
+
 auto Storage::HashType() const -> std::uint32_t { return HASH_TYPE; }
 
 void Storage::InitBackup() { multiplex_.InitBackup(); }
@@ -108,6 +108,11 @@ class Multiplex;
 }  // namespace internal
 }  // namespace driver
 
+namespace gc
+{
+struct Progress;
+}  // namespace gc
+
 class Config;
 class Root;
 }  // namespace storage
@@ -539,6 +544,8 @@ private:
     void Cleanup();
     void Cleanup_Storage();
     void CollectGarbage() const;
+    auto GarbageCollection() const noexcept
+        -> opentxs::storage::gc::Progress final;
     void InitBackup() final;
     void InitEncryptedBackup(opentxs::crypto::key::Symmetric& key) final;
     void InitPlugins();
@@ -8,6 +8,7 @@
 #include "blockchain/bitcoin/cfilter/GCS.hpp"  // IWYU pragma: associated
 
 #include <boost/endian/buffers.hpp>
+#include <boost/endian/conversion.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
 #include <algorithm>
 #include <cstddef>
@@ -32,8 +33,6 @@
 #include "internal/util/BoostPMR.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/P0330.hpp"
-#include "opentxs/api/crypto/Hash.hpp"
-#include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/FilterType.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/Hash.hpp"
@@ -42,7 +41,6 @@
 #include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/core/ByteArray.hpp"
 #include "opentxs/core/Data.hpp"
-#include "opentxs/crypto/HashType.hpp"
 #include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
 #include "opentxs/util/Allocator.hpp"
 #include "opentxs/util/Container.hpp"
@@ -145,6 +143,33 @@ auto GCS(
     }
 }
 
+auto GCS(
+    const api::Session& api,
+    const proto::GCS& in,
+    std::shared_ptr<const gcs::Elements> decoded,
+    alloc::Default alloc) noexcept -> blockchain::GCS
+{
+    using ReturnType = blockchain::implementation::GCS;
+
+    try {
+
+        return std::make_unique<ReturnType>(
+                   api,
+                   in.bits(),
+                   in.fprate(),
+                   in.count(),
+                   in.key(),
+                   in.filter(),
+                   std::move(decoded),
+                   alloc)
+            .release();
+    } catch (const std::exception& e) {
+        LogError()("opentxs::factory::")(__func__)(": ")(e.what()).Flush();
+
+        return std::make_unique<blockchain::GCS::Imp>(alloc).release();
+    }
+}
+
 auto GCS(
     const api::Session& api,
     const ReadView in,
@@ -279,20 +304,124 @@ auto GCS(
 
 namespace opentxs::gcs
 {
-using BitReader = blockchain::internal::BitReader;
 using BitWriter = blockchain::internal::BitWriter;
 
-static auto golomb_decode(const std::uint8_t P, BitReader& stream) noexcept(
-    false) -> Delta
-{
-    auto quotient = Delta{0};
+// NOTE GolombDecoder reads the bit stream eight bytes at a time into a left
+// aligned cache and resolves unary quotients one byte at a time via a lookup
+// table. Bits past the end of the stream read as zero, which matches the
+// behavior of BitReader.
+class GolombDecoder
+{
+public:
+    auto next() noexcept -> Delta
+    {
+        auto quotient = Delta{0};
+
+        while (true) {
+            refill();
+            const auto top = static_cast<std::uint8_t>(cache_ >> 56u);
+
+            if (0xff == top) {
+                quotient += 8u;
+                consume(8u);
+            } else {
+                const auto ones = leading_ones_[top];
+                quotient += ones;
+                consume(ones + 1u);
+
+                break;
+            }
+        }
+
+        return (quotient << p_) + read_remainder();
+    }
+
+    GolombDecoder(const std::uint8_t P, const ReadView encoded) noexcept(false)
+        : p_(P)
+        , data_(reinterpret_cast<const std::uint8_t*>(encoded.data()))
+        , end_(data_ + encoded.size())
+        , cache_(0u)
+        , bits_(0u)
+    {
+        if (p_ >= 32u) {
+            throw std::runtime_error(
+                "Invalid golomb parameter: " + std::to_string(p_));
+        }
+    }
+    GolombDecoder() = delete;
+    GolombDecoder(const GolombDecoder&) = delete;
+    GolombDecoder(GolombDecoder&&) = delete;
+    auto operator=(const GolombDecoder&) -> GolombDecoder& = delete;
+    auto operator=(GolombDecoder&&) -> GolombDecoder& = delete;
 
-    while (1 == stream.read(1)) { quotient++; }
+private:
+    static constexpr auto leading_ones_ = [] {
+        auto out = std::array<std::uint8_t, 256>{};
 
-    auto remainder = stream.read(P);
+        for (auto i = 0_uz; i < out.size(); ++i) {
+            auto count = std::uint8_t{0};
 
-    return Delta{(quotient << P) + remainder};
-}
+            for (auto mask = 0x80_uz; 0_uz != (i & mask); mask >>= 1u) {
+                ++count;
+            }
+
+            out[i] = count;
+        }
+
+        return out;
+    }();
+
+    const std::uint8_t p_;
+    const std::uint8_t* data_;
+    const std::uint8_t* const end_;
+    std::uint64_t cache_;
+    std::size_t bits_;
+
+    auto consume(const std::size_t bits) noexcept -> void
+    {
+        cache_ <<= bits;
+        bits_ -= bits;
+    }
+    auto read_remainder() noexcept -> Delta
+    {
+        if (0u == p_) { return 0u; }
+
+        refill();
+        const auto out = cache_ >> (64u - p_);
+        consume(p_);
+
+        return out;
+    }
+    auto refill() noexcept -> void
+    {
+        if (bits_ > 56u) { return; }
+
+        if (static_cast<std::size_t>(end_ - data_) >= sizeof(std::uint64_t)) {
+            auto word = std::uint64_t{};
+            std::memcpy(&word, data_, sizeof(word));
+            be::big_to_native_inplace(word);
+            const auto bytes = (64u - bits_) / 8u;
+            const auto total = bits_ + (bytes * 8u);
+            const auto keep = (64u == total) ? ~std::uint64_t{0}
+                                             : ~(~std::uint64_t{0} >> total);
+            cache_ |= (word >> bits_) & keep;
+            bits_ = total;
+            data_ += bytes;
+        } else {
+            while (bits_ <= 56u) {
+                if (data_ == end_) {
+                    // NOTE the unused low bits of the cache are always zero
+                    bits_ = 64u;
+
+                    break;
+                }
+
+                cache_ |= std::uint64_t{*data_++} << (56u - bits_);
+                bits_ += 8u;
+            }
+        }
+    }
+};
 
 static auto golomb_encode(
     const std::uint8_t P,
@@ -316,21 +445,60 @@ auto GolombDecode(
     const std::uint8_t P,
     const Vector<std::byte>& encoded,
     alloc::Default alloc) noexcept(false) -> Elements
+{
+    return GolombDecode(N, P, reader(encoded), alloc);
+}
+
+auto GolombDecode(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const ReadView encoded,
+    alloc::Default alloc) noexcept(false) -> Elements
 {
     auto output = Elements{alloc};
-    auto stream = BitReader{encoded};
+    output.reserve(N);
+    auto stream = GolombDecoder{P, encoded};
     auto last = Element{0};
 
     for (auto i = 0_uz; i < N; ++i) {
-        auto delta = golomb_decode(P, stream);
-        auto value = last + delta;
-        output.emplace_back(value);
-        last = value;
+        last += stream.next();
+        output.emplace_back(last);
     }
 
     return output;
 }
 
+auto GolombMatch(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const ReadView encoded,
+    const Elements& targets,
+    const bool first,
+    Elements& matches) noexcept(false) -> void
+{
+    auto target = targets.cbegin();
+    const auto stop = targets.cend();
+
+    if (target == stop) { return; }
+
+    auto stream = GolombDecoder{P, encoded};
+    auto value = Element{0};
+
+    for (auto i = 0_uz; i < N; ++i) {
+        value += stream.next();
+
+        while (*target < value) {
+            if (++target == stop) { return; }
+        }
+
+        if (*target == value) {
+            matches.emplace_back(value);
+
+            if (first || (++target == stop)) { return; }
+        }
+    }
+}
+
 auto GolombEncode(
     const std::uint8_t P,
     const Elements& hashedSet,
@@ -355,12 +523,12 @@ auto GolombEncode(
 }
 
 auto HashToRange(
-    const api::Session& api,
+    const api::Session&,
     const ReadView key,
     const Range range,
     const ReadView item) noexcept(false) -> Element
 {
-    return HashToRange(range, Siphash(api, key, item));
+    return HashToRange(range, Siphash(key, item));
 }
 
 auto HashToRange(const Range range, const Hash hash) noexcept(false) -> Element
@@ -370,7 +538,7 @@ auto HashToRange(const Range range, const Hash hash) noexcept(false) -> Element
 }
 
 auto HashedSetConstruct(
-    const api::Session& api,
+    const api::Session&,
     const ReadView key,
     const std::uint32_t N,
     const std::uint32_t M,
@@ -378,35 +546,18 @@ auto HashedSetConstruct(
     alloc::Default alloc) noexcept(false) -> Elements
 {
     auto output = Elements{alloc};
+    Siphash(key, items, output);
     std::transform(
-        std::begin(items),
-        std::end(items),
-        std::back_inserter(output),
-        [&](const auto& item) {
-            return HashToRange(api, key, range(N, M), item);
+        std::begin(output),
+        std::end(output),
+        std::begin(output),
+        [target = range(N, M)](const auto& hash) {
+            return HashToRange(target, hash);
         });
     std::sort(output.begin(), output.end());
 
     return output;
 }
-
-auto Siphash(
-    const api::Session& api,
-    const ReadView key,
-    const ReadView item) noexcept(false) -> Hash
-{
-    if (16 != key.size()) { throw std::runtime_error("Invalid key"); }
-
-    auto output = Hash{};
-    auto writer = preallocated(sizeof(output), &output);
-
-    if (false == api.Crypto().Hash().HMAC(
-                     crypto::HashType::SipHash24, key, item, writer)) {
-        throw std::runtime_error("siphash failed");
-    }
-
-    return output;
-}
 }  // namespace opentxs::gcs
 
 namespace opentxs::blockchain::implementation
@@ -418,6 +569,7 @@ GCS::GCS(
     const std::uint32_t fpRate,
     const std::uint32_t count,
     std::optional<gcs::Elements>&& elements,
+    std::shared_ptr<const gcs::Elements> decoded,
     Vector<std::byte>&& compressed,
     ReadView key,
     allocator_type alloc) noexcept(false)
@@ -430,6 +582,7 @@ GCS::GCS(
     , key_()
     , compressed_(std::move(compressed), alloc)
     , elements_(std::move(elements))
+    , decoded_(std::move(decoded))
 {
     static_assert(16u == sizeof(key_));
 
@@ -437,6 +590,12 @@ GCS::GCS(
         throw std::runtime_error(
             "Invalid key size: " + std::to_string(key.size()));
     }
+
+    if (decoded_ && (decoded_->size() != count_)) {
+        throw std::runtime_error(
+            "Decoded element count does not match filter: " +
+            std::to_string(decoded_->size()) + " vs " + std::to_string(count_));
+    }
 }
 
 GCS::GCS(
@@ -454,6 +613,35 @@ GCS::GCS(
           fpRate,
           count,
           std::nullopt,
+          nullptr,
+          [&] {
+              auto out = Vector<std::byte>{alloc};
+              copy(encoded, writer(out));
+
+              return out;
+          }(),
+          key,
+          alloc)
+{
+}
+
+GCS::GCS(
+    const api::Session& api,
+    const std::uint8_t bits,
+    const std::uint32_t fpRate,
+    const std::uint32_t count,
+    const ReadView key,
+    const ReadView encoded,
+    std::shared_ptr<const gcs::Elements> decoded,
+    allocator_type alloc) noexcept(false)
+    : GCS(
+          1,
+          api,
+          bits,
+          fpRate,
+          count,
+          std::nullopt,
+          std::move(decoded),
           [&] {
               auto out = Vector<std::byte>{alloc};
               copy(encoded, writer(out));
@@ -479,6 +667,7 @@ GCS::GCS(
           fpRate,
           count,
           std::nullopt,
+          nullptr,
           std::move(encoded),
           key,
           alloc)
@@ -500,6 +689,7 @@ GCS::GCS(
           fpRate,
           count,
           std::move(hashed),
+          nullptr,
           std::move(compressed),
           key,
           alloc)
@@ -522,6 +712,7 @@ GCS::GCS(const GCS& rhs, allocator_type alloc) noexcept
                   return std::nullopt;
               }
           }(),
+          rhs.decoded_,
           Vector<std::byte>{rhs.compressed_, alloc},
           reader(rhs.key_),
           alloc)
@@ -533,15 +724,36 @@ auto GCS::Compressed(AllocateOutput out) const noexcept -> bool
     return copy(reader(compressed_), out);
 }
 
-auto GCS::decompress() const noexcept -> const gcs::Elements&
+auto GCS::intersect(
+    const gcs::Elements& targets,
+    const bool first,
+    gcs::Elements& matches) const noexcept -> void
 {
-    if (false == elements_.has_value()) {
-        auto& set = elements_;
-        set = gcs::GolombDecode(count_, bits_, compressed_, alloc_);
-        std::sort(set.value().begin(), set.value().end());
-    }
+    const auto* set = [&]() -> const gcs::Elements* {
+        if (elements_.has_value()) {
+
+            return &elements_.value();
+        } else {
 
-    return elements_.value();
+            return decoded_.get();
+        }
+    }();
+
+    if (nullptr != set) {
+        std::set_intersection(
+            std::begin(targets),
+            std::end(targets),
+            std::begin(*set),
+            std::end(*set),
+            std::back_inserter(matches));
+    } else {
+        try {
+            gcs::GolombMatch(
+                count_, bits_, reader(compressed_), targets, first, matches);
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+        }
+    }
 }
 
 auto GCS::Encode(AllocateOutput cb) const noexcept -> bool
@@ -617,6 +829,7 @@ auto GCS::hashed_set_construct(const gcs::Hashes& targets, allocator_type alloc)
         targets.end(),
         std::back_inserter(out),
         [&](const auto& hash) { return gcs::HashToRange(range, hash); });
+    std::sort(out.begin(), out.end());
 
     return out;
 }
@@ -628,11 +841,6 @@ auto GCS::hashed_set_construct(const Targets& elements, allocator_type alloc)
         api_, reader(key_), count_, false_positive_rate_, elements, alloc);
 }
 
-auto GCS::hash_to_range(const ReadView in) const noexcept -> gcs::Range
-{
-    return gcs::HashToRange(api_, reader(key_), Range(), in);
-}
-
 auto GCS::Header(const cfilter::Header& previous) const noexcept
     -> cfilter::Header
 {
@@ -652,7 +860,6 @@ auto GCS::Match(const Targets& targets, allocator_type alloc) const noexcept
     static constexpr auto bytesPerTarget = (2 * sizeof(gcs::Element));
     auto allocHash = alloc::BoostMonotonic{targets.size() * bytesPerTarget};
     auto hashed = gcs::Elements{&allocHash};
-    hashed.reserve(targets.size());
     static constexpr auto bytesPerMatch =
         sizeof(gcs::Element) + sizeof(Map::value_type);
     auto buf = std::array<std::byte, reserveMatches * bytesPerMatch>{};
@@ -660,20 +867,17 @@ auto GCS::Match(const Targets& targets, allocator_type alloc) const noexcept
     auto matches = gcs::Elements{&allocMatches};
     matches.reserve(reserveMatches);
     auto map = Map{&allocMatches};
+    gcs::Siphash(reader(key_), targets, hashed);
+    const auto range = Range();
+    auto i = targets.cbegin();
 
-    for (auto i = targets.cbegin(); i != targets.cend(); ++i) {
-        const auto& hash = hashed.emplace_back(hash_to_range(*i));
-        map[hash].emplace_back(i);
+    for (auto& hash : hashed) {
+        hash = gcs::HashToRange(range, hash);
+        map[hash].emplace_back(i++);
     }
 
     dedup(hashed);
-    const auto& set = decompress();
-    std::set_intersection(
-        std::begin(hashed),
-        std::end(hashed),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+    intersect(hashed, false, matches);
 
     for (const auto& match : matches) {
         auto& values = map.at(match);
@@ -708,13 +912,7 @@ auto GCS::Match(const gcs::Hashes& prehashed) const noexcept -> PrehashedMatches
     }
 
     dedup(hashed);
-    const auto& set = decompress();
-    std::set_intersection(
-        std::begin(hashed),
-        std::end(hashed),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+    intersect(hashed, false, matches);
 
     for (const auto& match : matches) {
         auto& values = map.at(match);
@@ -772,19 +970,7 @@ auto GCS::Test(const ReadView target) const noexcept -> bool
 
     OT_ASSERT(1 == set.size());
 
-    const auto& hash = set.front();
-
-    for (const auto& element : decompress()) {
-        if (element == hash) {
-
-            return true;
-        } else if (element > hash) {
-
-            return false;
-        }
-    }
-
-    return false;
+    return test(set);
 }
 
 auto GCS::Test(const Vector<ByteArray>& targets) const noexcept -> bool
@@ -816,15 +1002,11 @@ auto GCS::Test(const gcs::Hashes& targets) const noexcept -> bool
 
 auto GCS::test(const gcs::Elements& targets) const noexcept -> bool
 {
-    const auto& set = decompress();
-    auto alloc = alloc::BoostMonotonic{1024};
-    auto matches = Vector<gcs::Element>{&alloc};
-    std::set_intersection(
-        std::begin(targets),
-        std::end(targets),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+    auto buf = std::array<std::byte, sizeof(gcs::Element)>{};
+    auto alloc = alloc::BoostMonotonic{buf.data(), buf.size()};
+    auto matches = gcs::Elements{&alloc};
+    matches.reserve(1u);
+    intersect(targets, true, matches);
 
     return 0 < matches.size();
 }
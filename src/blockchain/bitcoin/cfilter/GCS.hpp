@@ -163,6 +163,15 @@ public:
         const ReadView encoded,
         allocator_type alloc)
     noexcept(false);
+    GCS(const api::Session& api,
+        const std::uint8_t bits,
+        const std::uint32_t fpRate,
+        const std::uint32_t count,
+        const ReadView key,
+        const ReadView encoded,
+        std::shared_ptr<const gcs::Elements> decoded,
+        allocator_type alloc)
+    noexcept(false);
     GCS(const api::Session& api,
         const std::uint8_t bits,
         const std::uint32_t fpRate,
@@ -191,6 +200,7 @@ private:
     const Key key_;
     const Vector<std::byte> compressed_;
     mutable std::optional<gcs::Elements> elements_;
+    const std::shared_ptr<const gcs::Elements> decoded_;
 
     static auto transform(
         const Vector<ByteArray>& in,
@@ -199,7 +209,6 @@ private:
         const Vector<Space>& in,
         allocator_type alloc) noexcept -> Targets;
 
-    auto decompress() const noexcept -> const gcs::Elements&;
     auto hashed_set_construct(
         const Vector<ByteArray>& elements,
         allocator_type alloc) const noexcept -> gcs::Elements;
@@ -210,8 +219,11 @@ private:
         const noexcept -> gcs::Elements;
     auto hashed_set_construct(const Targets& elements, allocator_type alloc)
         const noexcept -> gcs::Elements;
+    auto intersect(
+        const gcs::Elements& targets,
+        const bool first,
+        gcs::Elements& matches) const noexcept -> void;
     auto test(const gcs::Elements& targetHashes) const noexcept -> bool;
-    auto hash_to_range(const ReadView in) const noexcept -> gcs::Range;
 
     GCS(const api::Session& api,
         const std::uint8_t bits,
@@ -227,6 +239,7 @@ private:
         const std::uint32_t fpRate,
         const std::uint32_t count,
         std::optional<gcs::Elements>&& elements,
+        std::shared_ptr<const gcs::Elements> decoded,
         Vector<std::byte>&& compressed,
         ReadView key,
         allocator_type alloc)
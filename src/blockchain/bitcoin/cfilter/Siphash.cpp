@@ -0,0 +1,438 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"  // IWYU pragma: associated
+
+#include <boost/endian/conversion.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "opentxs/util/Container.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__GNUC__) || defined(__clang__))
+#define OT_SIPHASH_X86 1
+#include <immintrin.h>
+#else
+#define OT_SIPHASH_X86 0
+#endif
+
+namespace be = boost::endian;
+
+// NOTE the kernels in this file implement SipHash-2-4 as specified in
+// https://www.aumasson.jp/siphash/siphash.pdf and produce the same output as
+// libsodium's crypto_shorthash. The vectorized kernels hash several
+// independent items in lockstep, one item per 64 bit lane, and mask off lanes
+// which have already consumed their final message word.
+
+namespace opentxs::gcs::siphash
+{
+struct Key {
+    std::uint64_t v0_;
+    std::uint64_t v1_;
+    std::uint64_t v2_;
+    std::uint64_t v3_;
+
+    Key(const ReadView key) noexcept(false)
+        : v0_()
+        , v1_()
+        , v2_()
+        , v3_()
+    {
+        if (16u != key.size()) { throw std::runtime_error("Invalid key"); }
+
+        auto k0 = std::uint64_t{};
+        auto k1 = std::uint64_t{};
+        std::memcpy(&k0, key.data(), sizeof(k0));
+        std::memcpy(&k1, key.data() + sizeof(k0), sizeof(k1));
+        be::little_to_native_inplace(k0);
+        be::little_to_native_inplace(k1);
+        v0_ = k0 ^ 0x736f6d6570736575ull;
+        v1_ = k1 ^ 0x646f72616e646f6dull;
+        v2_ = k0 ^ 0x6c7967656e657261ull;
+        v3_ = k1 ^ 0x7465646279746573ull;
+    }
+};
+
+using Kernel = void (*)(
+    const Key& key,
+    const ReadView* in,
+    std::size_t count,
+    Hash* out) noexcept;
+
+static constexpr auto word_bytes_ = sizeof(std::uint64_t);
+
+// NOTE every message is processed as size / 8 full words followed by one
+// final word containing the trailing bytes and the message length
+static auto words(const ReadView in) noexcept -> std::size_t
+{
+    return (in.size() / word_bytes_) + 1u;
+}
+
+static auto load(const ReadView in, const std::size_t word) noexcept
+    -> std::uint64_t
+{
+    const auto full = in.size() / word_bytes_;
+    auto out = std::uint64_t{};
+
+    if (word < full) {
+        std::memcpy(&out, in.data() + (word * word_bytes_), sizeof(out));
+        be::little_to_native_inplace(out);
+    } else {
+        const auto* tail = in.data() + (full * word_bytes_);
+        const auto remaining = in.size() % word_bytes_;
+        out = static_cast<std::uint64_t>(in.size()) << 56u;
+
+        for (auto i = std::size_t{0}; i < remaining; ++i) {
+            out |= static_cast<std::uint64_t>(
+                       static_cast<std::uint8_t>(tail[i]))
+                   << (8u * i);
+        }
+    }
+
+    return out;
+}
+
+static auto finish(const std::uint64_t hash) noexcept -> Hash
+{
+    // NOTE crypto_shorthash writes the result as little endian bytes which
+    // were previously copied directly into a Hash
+    return be::native_to_little(hash);
+}
+
+static constexpr auto rotl(const std::uint64_t x, const unsigned int b) noexcept
+    -> std::uint64_t
+{
+    return (x << b) | (x >> (64u - b));
+}
+
+static auto sipround(
+    std::uint64_t& v0,
+    std::uint64_t& v1,
+    std::uint64_t& v2,
+    std::uint64_t& v3) noexcept -> void
+{
+    v0 += v1;
+    v1 = rotl(v1, 13u);
+    v1 ^= v0;
+    v0 = rotl(v0, 32u);
+    v2 += v3;
+    v3 = rotl(v3, 16u);
+    v3 ^= v2;
+    v0 += v3;
+    v3 = rotl(v3, 21u);
+    v3 ^= v0;
+    v2 += v1;
+    v1 = rotl(v1, 17u);
+    v1 ^= v2;
+    v2 = rotl(v2, 32u);
+}
+
+static auto scalar(const Key& key, const ReadView in) noexcept -> Hash
+{
+    auto v0 = key.v0_;
+    auto v1 = key.v1_;
+    auto v2 = key.v2_;
+    auto v3 = key.v3_;
+
+    for (auto w = std::size_t{0}, end = words(in); w < end; ++w) {
+        const auto m = load(in, w);
+        v3 ^= m;
+        sipround(v0, v1, v2, v3);
+        sipround(v0, v1, v2, v3);
+        v0 ^= m;
+    }
+
+    v2 ^= 0xffu;
+    sipround(v0, v1, v2, v3);
+    sipround(v0, v1, v2, v3);
+    sipround(v0, v1, v2, v3);
+    sipround(v0, v1, v2, v3);
+
+    return finish(v0 ^ v1 ^ v2 ^ v3);
+}
+
+static auto scalar(
+    const Key& key,
+    const ReadView* in,
+    std::size_t count,
+    Hash* out) noexcept -> void
+{
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        out[i] = scalar(key, in[i]);
+    }
+}
+
+#if OT_SIPHASH_X86
+#define OT_SIPHASH_AVX2 __attribute__((target("avx2")))
+#define OT_SIPHASH_SSE41 __attribute__((target("sse4.1")))
+
+template <int B>
+OT_SIPHASH_AVX2 static inline auto rotl(const __m256i x) noexcept -> __m256i
+{
+    if constexpr (32 == B) {
+
+        return _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    } else {
+
+        return _mm256_or_si256(
+            _mm256_slli_epi64(x, B), _mm256_srli_epi64(x, 64 - B));
+    }
+}
+
+OT_SIPHASH_AVX2 static inline auto sipround(
+    __m256i& v0,
+    __m256i& v1,
+    __m256i& v2,
+    __m256i& v3) noexcept -> void
+{
+    v0 = _mm256_add_epi64(v0, v1);
+    v1 = rotl<13>(v1);
+    v1 = _mm256_xor_si256(v1, v0);
+    v0 = rotl<32>(v0);
+    v2 = _mm256_add_epi64(v2, v3);
+    v3 = rotl<16>(v3);
+    v3 = _mm256_xor_si256(v3, v2);
+    v0 = _mm256_add_epi64(v0, v3);
+    v3 = rotl<21>(v3);
+    v3 = _mm256_xor_si256(v3, v0);
+    v2 = _mm256_add_epi64(v2, v1);
+    v1 = rotl<17>(v1);
+    v1 = _mm256_xor_si256(v1, v2);
+    v2 = rotl<32>(v2);
+}
+
+OT_SIPHASH_AVX2 static auto avx2(
+    const Key& key,
+    const ReadView* in,
+    std::size_t count,
+    Hash* out) noexcept -> void
+{
+    static constexpr auto lanes = std::size_t{4};
+    auto i = std::size_t{0};
+
+    for (; (i + lanes) <= count; i += lanes) {
+        const auto* item = in + i;
+        const auto n = std::array<std::size_t, lanes>{
+            words(item[0]), words(item[1]), words(item[2]), words(item[3])};
+        const auto end = *std::max_element(n.begin(), n.end());
+        auto v0 = _mm256_set1_epi64x(static_cast<long long>(key.v0_));
+        auto v1 = _mm256_set1_epi64x(static_cast<long long>(key.v1_));
+        auto v2 = _mm256_set1_epi64x(static_cast<long long>(key.v2_));
+        auto v3 = _mm256_set1_epi64x(static_cast<long long>(key.v3_));
+
+        for (auto w = std::size_t{0}; w < end; ++w) {
+            const auto active = [&](std::size_t lane) -> long long {
+                return (w < n[lane]) ? -1 : 0;
+            };
+            const auto word = [&](std::size_t lane) -> long long {
+                if (w < n[lane]) {
+
+                    return static_cast<long long>(load(item[lane], w));
+                } else {
+
+                    return 0;
+                }
+            };
+            const auto mask =
+                _mm256_set_epi64x(active(3), active(2), active(1), active(0));
+            const auto m =
+                _mm256_set_epi64x(word(3), word(2), word(1), word(0));
+            auto t0 = v0;
+            auto t1 = v1;
+            auto t2 = v2;
+            auto t3 = _mm256_xor_si256(v3, m);
+            sipround(t0, t1, t2, t3);
+            sipround(t0, t1, t2, t3);
+            t0 = _mm256_xor_si256(t0, m);
+            v0 = _mm256_blendv_epi8(v0, t0, mask);
+            v1 = _mm256_blendv_epi8(v1, t1, mask);
+            v2 = _mm256_blendv_epi8(v2, t2, mask);
+            v3 = _mm256_blendv_epi8(v3, t3, mask);
+        }
+
+        v2 = _mm256_xor_si256(v2, _mm256_set1_epi64x(0xff));
+        sipround(v0, v1, v2, v3);
+        sipround(v0, v1, v2, v3);
+        sipround(v0, v1, v2, v3);
+        sipround(v0, v1, v2, v3);
+        const auto result = _mm256_xor_si256(
+            _mm256_xor_si256(v0, v1), _mm256_xor_si256(v2, v3));
+        auto hashes = std::array<std::uint64_t, lanes>{};
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(hashes.data()), result);
+
+        for (auto lane = std::size_t{0}; lane < lanes; ++lane) {
+            out[i + lane] = finish(hashes[lane]);
+        }
+    }
+
+    scalar(key, in + i, count - i, out + i);
+}
+
+template <int B>
+OT_SIPHASH_SSE41 static inline auto rotl(const __m128i x) noexcept -> __m128i
+{
+    if constexpr (32 == B) {
+
+        return _mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    } else {
+
+        return _mm_or_si128(_mm_slli_epi64(x, B), _mm_srli_epi64(x, 64 - B));
+    }
+}
+
+OT_SIPHASH_SSE41 static inline auto sipround(
+    __m128i& v0,
+    __m128i& v1,
+    __m128i& v2,
+    __m128i& v3) noexcept -> void
+{
+    v0 = _mm_add_epi64(v0, v1);
+    v1 = rotl<13>(v1);
+    v1 = _mm_xor_si128(v1, v0);
+    v0 = rotl<32>(v0);
+    v2 = _mm_add_epi64(v2, v3);
+    v3 = rotl<16>(v3);
+    v3 = _mm_xor_si128(v3, v2);
+    v0 = _mm_add_epi64(v0, v3);
+    v3 = rotl<21>(v3);
+    v3 = _mm_xor_si128(v3, v0);
+    v2 = _mm_add_epi64(v2, v1);
+    v1 = rotl<17>(v1);
+    v1 = _mm_xor_si128(v1, v2);
+    v2 = rotl<32>(v2);
+}
+
+OT_SIPHASH_SSE41 static auto sse41(
+    const Key& key,
+    const ReadView* in,
+    std::size_t count,
+    Hash* out) noexcept -> void
+{
+    static constexpr auto lanes = std::size_t{2};
+    auto i = std::size_t{0};
+
+    for (; (i + lanes) <= count; i += lanes) {
+        const auto* item = in + i;
+        const auto n =
+            std::array<std::size_t, lanes>{words(item[0]), words(item[1])};
+        const auto end = std::max(n[0], n[1]);
+        auto v0 = _mm_set1_epi64x(static_cast<long long>(key.v0_));
+        auto v1 = _mm_set1_epi64x(static_cast<long long>(key.v1_));
+        auto v2 = _mm_set1_epi64x(static_cast<long long>(key.v2_));
+        auto v3 = _mm_set1_epi64x(static_cast<long long>(key.v3_));
+
+        for (auto w = std::size_t{0}; w < end; ++w) {
+            const auto active = [&](std::size_t lane) -> long long {
+                return (w < n[lane]) ? -1 : 0;
+            };
+            const auto word = [&](std::size_t lane) -> long long {
+                if (w < n[lane]) {
+
+                    return static_cast<long long>(load(item[lane], w));
+                } else {
+
+                    return 0;
+                }
+            };
+            const auto mask = _mm_set_epi64x(active(1), active(0));
+            const auto m = _mm_set_epi64x(word(1), word(0));
+            auto t0 = v0;
+            auto t1 = v1;
+            auto t2 = v2;
+            auto t3 = _mm_xor_si128(v3, m);
+            sipround(t0, t1, t2, t3);
+            sipround(t0, t1, t2, t3);
+            t0 = _mm_xor_si128(t0, m);
+            v0 = _mm_blendv_epi8(v0, t0, mask);
+            v1 = _mm_blendv_epi8(v1, t1, mask);
+            v2 = _mm_blendv_epi8(v2, t2, mask);
+            v3 = _mm_blendv_epi8(v3, t3, mask);
+        }
+
+        v2 = _mm_xor_si128(v2, _mm_set1_epi64x(0xff));
+        sipround(v0, v1, v2, v3);
+        sipround(v0, v1, v2, v3);
+        sipround(v0, v1, v2, v3);
+        sipround(v0, v1, v2, v3);
+        const auto result =
+            _mm_xor_si128(_mm_xor_si128(v0, v1), _mm_xor_si128(v2, v3));
+        auto hashes = std::array<std::uint64_t, lanes>{};
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(hashes.data()), result);
+        out[i] = finish(hashes[0]);
+        out[i + 1u] = finish(hashes[1]);
+    }
+
+    scalar(key, in + i, count - i, out + i);
+}
+
+#undef OT_SIPHASH_SSE41
+#undef OT_SIPHASH_AVX2
+#endif  // OT_SIPHASH_X86
+
+static auto select() noexcept -> Kernel
+{
+#if OT_SIPHASH_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) {
+
+        return avx2;
+    } else if (__builtin_cpu_supports("sse4.1")) {
+
+        return sse41;
+    }
+#endif  // OT_SIPHASH_X86
+
+    return scalar;
+}
+
+static auto kernel() noexcept -> Kernel
+{
+    static const auto selected = select();
+
+    return selected;
+}
+}  // namespace opentxs::gcs::siphash
+
+#undef OT_SIPHASH_X86
+
+namespace opentxs::gcs
+{
+auto Siphash(const ReadView key, const ReadView item) noexcept(false) -> Hash
+{
+    return siphash::scalar(siphash::Key{key}, item);
+}
+
+auto Siphash(
+    const ReadView key,
+    const blockchain::GCS::Targets& items,
+    alloc::Default alloc) noexcept(false) -> Hashes
+{
+    auto output = Hashes{alloc};
+    Siphash(key, items, output);
+
+    return output;
+}
+
+auto Siphash(
+    const ReadView key,
+    const blockchain::GCS::Targets& items,
+    Hashes& out) noexcept(false) -> void
+{
+    const auto schedule = siphash::Key{key};
+    out.resize(items.size());
+
+    if (items.empty()) { return; }
+
+    siphash::kernel()(schedule, items.data(), items.size(), out.data());
+}
+}  // namespace opentxs::gcs
@@ -46,6 +46,11 @@ namespace opentxs::blockchain::p2p::bitcoin::message
 class Cmpctblock final : public implementation::Message
 {
 public:
+    auto getRawCmpctblock() const noexcept -> ReadView
+    {
+        return raw_cmpctblock_.Bytes();
+    }
+
     Cmpctblock(
         const api::Session& api,
         const blockchain::Type network,
@@ -280,6 +280,27 @@ auto Deterministic::check_lookahead(
 {
     auto needed = need_lookahead(lock, type);
 
+    if (0u == needed) { return; }
+
+    const auto first = generated_.at(type);
+
+    if (needed <= (max_index_ - first)) {
+        // NOTE derive the whole lookahead window under a single parent
+        // instead of one key at a time
+        auto keys = derive_keys(type, first, needed, reason);
+
+        if (keys.size() != needed) {
+            throw std::runtime_error("Failed to generate keys");
+        }
+
+        for (auto& key : keys) {
+            generated.emplace_back(
+                generate(lock, type, generated_.at(type), std::move(key)));
+        }
+
+        return;
+    }
+
     while (0u < needed) {
         generated.emplace_back(generate_next(lock, type, reason));
         --needed;
@@ -328,6 +349,26 @@ auto Deterministic::confirm(
     check_lookahead(lock, type, generated, reason);
 }
 
+auto Deterministic::derive_keys(
+    const Subchain type,
+    const Bip32Index first,
+    const std::size_t count,
+    const PasswordPrompt& reason) const noexcept -> UnallocatedVector<ECKey>
+{
+    auto out = UnallocatedVector<ECKey>{};
+    out.reserve(count);
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        auto key = PrivateKey(type, static_cast<Bip32Index>(first + i), reason);
+
+        if (false == bool(key)) { return {}; }
+
+        out.emplace_back(std::move(key));
+    }
+
+    return out;
+}
+
 auto Deterministic::element(
     const rLock&,
     const Subchain type,
@@ -462,6 +503,17 @@ auto Deterministic::generate(
     const Subchain type,
     const Bip32Index desired,
     const PasswordPrompt& reason) const noexcept(false) -> Bip32Index
+{
+    if (max_index_ <= desired) { throw std::runtime_error("Account is full"); }
+
+    return generate(lock, type, desired, PrivateKey(type, desired, reason));
+}
+
+auto Deterministic::generate(
+    const rLock&,
+    const Subchain type,
+    const Bip32Index desired,
+    ECKey&& pKey) const noexcept(false) -> Bip32Index
 {
     auto& addressMap = data_.Get(type).map_;
     auto& index = generated_.at(type);
@@ -471,8 +523,6 @@ auto Deterministic::generate(
 
     if (max_index_ <= index) { throw std::runtime_error("Account is full"); }
 
-    auto pKey = PrivateKey(type, index, reason);
-
     if (false == bool(pKey)) {
         throw std::runtime_error("Failed to generate key");
     }
@@ -262,6 +262,12 @@ private:
         const rLock& lock,
         const Subchain type,
         const Bip32Index index) noexcept -> void final;
+    virtual auto derive_keys(
+        const Subchain type,
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const noexcept
+        -> UnallocatedVector<ECKey>;
     [[nodiscard]] auto finish_allocation(
         const rLock& lock,
         const Subchain type,
@@ -275,6 +281,11 @@ private:
         const Subchain type,
         const Bip32Index index,
         const PasswordPrompt& reason) const noexcept(false) -> Bip32Index;
+    [[nodiscard]] auto generate(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index index,
+        ECKey&& key) const noexcept(false) -> Bip32Index;
     [[nodiscard]] auto generate_next(
         const rLock& lock,
         const Subchain type,
@@ -8,7 +8,12 @@
 #include "blockchain/crypto/HD.hpp"  // IWYU pragma: associated
 
 #include <robin_hood.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <future>
+#include <iterator>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
@@ -21,10 +26,14 @@
 #include "blockchain/crypto/Element.hpp"
 #include "blockchain/crypto/Subaccount.hpp"
 #include "internal/api/crypto/Seed.hpp"
+#include "internal/api/network/Asio.hpp"
 #include "internal/blockchain/crypto/Factory.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/api/crypto/Config.hpp"
 #include "opentxs/api/crypto/Seed.hpp"
+#include "opentxs/api/network/Asio.hpp"
+#include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/api/session/Storage.hpp"
@@ -211,6 +220,106 @@ auto HD::account_already_exists(const rLock&) const noexcept -> bool
     return 0 < existing.count(id_->str());
 }
 
+auto HD::chain_key(
+    const rLock&,
+    const Subchain type,
+    const PasswordPrompt& reason) const noexcept
+    -> const opentxs::crypto::key::HD*
+{
+    const auto change =
+        (internal_type_ == type) ? INTERNAL_CHAIN : EXTERNAL_CHAIN;
+    auto& pKey = (internal_type_ == type) ? cached_internal_ : cached_external_;
+
+    if (!pKey) {
+        pKey =
+            api_.Crypto().Seed().Internal().AccountKey(path_, change, reason);
+
+        if (!pKey) {
+            LogError()(OT_PRETTY_CLASS())("Failed to derive account key")
+                .Flush();
+
+            return nullptr;
+        }
+    }
+
+    return pKey.get();
+}
+
+auto HD::derive_keys(
+    const Subchain type,
+    const Bip32Index first,
+    const std::size_t count,
+    const PasswordPrompt& reason) const noexcept -> UnallocatedVector<ECKey>
+{
+    using Children =
+        UnallocatedVector<std::unique_ptr<opentxs::crypto::key::HD>>;
+
+    struct Jobs {
+        std::atomic<std::size_t> next_{};
+        UnallocatedVector<std::promise<Children>> results_{};
+    };
+
+    if (false == api::crypto::HaveHDKeys()) { return {}; }
+
+    auto lock = rLock{lock_};
+    const auto* key = chain_key(lock, type, reason);
+
+    if (nullptr == key) { return {}; }
+
+    // NOTE small batches are not worth the cost of posting jobs
+    const auto jobs = (count < parallel_threshold_) ? 1_uz : max_jobs_;
+    const auto step = (count + jobs - 1_uz) / jobs;
+    auto state = std::make_shared<Jobs>();
+    auto futures = UnallocatedVector<std::future<Children>>{};
+    state->results_.resize(jobs);
+    futures.reserve(jobs);
+
+    for (auto& promise : state->results_) {
+        futures.emplace_back(promise.get_future());
+    }
+
+    // NOTE the calling thread runs jobs too and only waits for jobs which a
+    // pool thread has already claimed, so this can not deadlock when it is
+    // called from the pool. Jobs which start after every range has been
+    // claimed return without touching key or reason.
+    const auto run = [=, &reason](Jobs& data) {
+        for (auto n = data.next_++; n < jobs; n = data.next_++) {
+            const auto begin = std::min(n * step, count);
+            const auto size = std::min(step, count - begin);
+            auto& promise = data.results_.at(n);
+
+            if (0_uz == size) {
+                promise.set_value(Children{});
+            } else {
+                promise.set_value(key->ChildKeys(
+                    static_cast<Bip32Index>(first + begin), size, reason));
+            }
+        }
+    };
+
+    for (auto n = 1_uz; n < jobs; ++n) {
+        const auto posted = api_.Network().Asio().Internal().Post(
+            ThreadPool::General,
+            [state, run] { run(*state); },
+            "HD lookahead");
+
+        if (false == posted) { break; }
+    }
+
+    run(*state);
+    auto out = UnallocatedVector<ECKey>{};
+    out.reserve(count);
+
+    for (auto& future : futures) {
+        auto children = future.get();
+        std::move(children.begin(), children.end(), std::back_inserter(out));
+    }
+
+    if (out.size() != count) { return {}; }
+
+    return out;
+}
+
 auto HD::Name() const noexcept -> UnallocatedCString
 {
     auto lock = rLock{lock_};
@@ -253,28 +362,12 @@ auto HD::PrivateKey(
 
     if (false == api::crypto::HaveHDKeys()) { return {}; }
 
-    const auto change =
-        (internal_type_ == type) ? INTERNAL_CHAIN : EXTERNAL_CHAIN;
-    auto& pKey = (internal_type_ == type) ? cached_internal_ : cached_external_;
     auto lock = rLock{lock_};
+    const auto* key = chain_key(lock, type, reason);
 
-    if (!pKey) {
-        pKey =
-            api_.Crypto().Seed().Internal().AccountKey(path_, change, reason);
-
-        if (!pKey) {
-            LogError()(OT_PRETTY_CLASS())("Failed to derive account key")
-                .Flush();
-
-            return {};
-        }
-    }
-
-    OT_ASSERT(pKey);
-
-    const auto& key = *pKey;
+    if (nullptr == key) { return {}; }
 
-    return key.ChildKey(index, reason);
+    return key->ChildKey(index, reason);
 }
 
 auto HD::save(const rLock& lock) const noexcept -> bool
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -109,6 +110,8 @@ private:
     static constexpr auto external_type_{Subchain::External};
     static constexpr VersionNumber DefaultVersion{1};
     static constexpr auto proto_hd_version_ = VersionNumber{1};
+    static constexpr auto parallel_threshold_ = std::size_t{64};
+    static constexpr auto max_jobs_ = std::size_t{8};
 
     const HDProtocol standard_;
     VersionNumber version_;
@@ -117,6 +120,17 @@ private:
     mutable std::optional<UnallocatedCString> name_;
 
     auto account_already_exists(const rLock& lock) const noexcept -> bool final;
+    auto chain_key(
+        const rLock& lock,
+        const Subchain type,
+        const PasswordPrompt& reason) const noexcept
+        -> const opentxs::crypto::key::HD*;
+    auto derive_keys(
+        const Subchain type,
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const noexcept
+        -> UnallocatedVector<ECKey> final;
     auto save(const rLock& lock) const noexcept -> bool final;
 };
 }  // namespace opentxs::blockchain::crypto::implementation
@@ -195,6 +195,13 @@ public:
     {
         return headers_.BestBlock(position);
     }
+    auto BestBlocks(
+        const block::Height start,
+        const std::size_t count,
+        alloc::Resource* alloc) const noexcept -> Vector<block::Hash> final
+    {
+        return headers_.BestBlocks(start, count, alloc);
+    }
     auto BlockExists(const block::Hash& block) const noexcept -> bool final
     {
         return common_.BlockExists(block);
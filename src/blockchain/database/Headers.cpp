@@ -11,6 +11,7 @@
 #include <cstring>
 #include <iterator>
 #include <memory>
+#include <numeric>
 #include <stdexcept>
 #include <string_view>
 #include <type_traits>
@@ -289,6 +290,49 @@ auto Headers::BestBlock(const block::Height position) const noexcept(false)
     return output;
 }
 
+auto Headers::BestBlocks(
+    const block::Height start,
+    const std::size_t count,
+    alloc::Resource* alloc) const noexcept -> Vector<block::Hash>
+{
+    auto output = Vector<block::Hash>{alloc};
+
+    if ((0 > start) || (0_uz == count)) { return output; }
+
+    const auto heights = [&] {
+        auto out = Vector<std::size_t>{alloc};
+        out.resize(count);
+        std::iota(out.begin(), out.end(), static_cast<std::size_t>(start));
+
+        return out;
+    }();
+    const auto keys = [&] {
+        auto out = Vector<ReadView>{alloc};
+        out.reserve(heights.size());
+        std::transform(
+            heights.begin(),
+            heights.end(),
+            std::back_inserter(out),
+            [](const auto& height) { return tsv(height); });
+
+        return out;
+    }();
+    output.resize(count);
+    lmdb_.LoadBatch(BlockHeaderBest, keys, [&](const auto i, const auto in) {
+        if (false == output[i].Assign(in.data(), in.size())) {
+            LogError()(OT_PRETTY_CLASS())("Database contains invalid hash")
+                .Flush();
+        }
+    });
+    const auto missing =
+        std::find_if(output.begin(), output.end(), [](const auto& hash) {
+            return hash.IsNull();
+        });
+    output.erase(missing, output.end());
+
+    return output;
+}
+
 auto Headers::best() const noexcept -> block::Position
 {
     Lock lock(lock_);
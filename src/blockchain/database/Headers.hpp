@@ -88,6 +88,10 @@ struct Headers {
 public:
     auto BestBlock(const block::Height position) const noexcept(false)
         -> block::Hash;
+    auto BestBlocks(
+        const block::Height start,
+        const std::size_t count,
+        alloc::Resource* alloc) const noexcept -> Vector<block::Hash>;
     auto CurrentBest() const noexcept -> std::unique_ptr<block::Header>
     {
         return load_header(best().hash_);
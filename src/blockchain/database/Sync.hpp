@@ -64,8 +64,12 @@ namespace network
 namespace p2p
 {
 class Block;
-class Data;
 }  // namespace p2p
+
+namespace zeromq
+{
+class Message;
+}  // namespace zeromq
 }  // namespace network
 
 namespace storage
@@ -84,7 +88,7 @@ namespace opentxs::blockchain::database::implementation
 class Sync
 {
 public:
-    using Message = network::p2p::Data;
+    using Message = network::zeromq::Message;
 
     auto Load(const block::Height height, Message& output) const noexcept
         -> bool;
@@ -8,6 +8,7 @@
 #include "blockchain/database/common/BlockFilter.hpp"  // IWYU pragma: associated
 
 #include <google/protobuf/arena.h>  // IWYU pragma: keep
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstring>
@@ -41,13 +42,20 @@ namespace opentxs::blockchain::database::common
 BlockFilter::BlockFilter(
     const api::Session& api,
     storage::lmdb::LMDB& lmdb,
-    Bulk& bulk) noexcept
+    Bulk& bulk,
+    std::size_t cacheBytes) noexcept
     : api_(api)
     , lmdb_(lmdb)
     , bulk_(bulk)
+    , cache_(cacheBytes)
 {
 }
 
+auto BlockFilter::CacheStats() const noexcept -> FilterCache::Stats
+{
+    return cache_.GetStats();
+}
+
 auto BlockFilter::HaveFilter(const cfilter::Type type, const ReadView blockHash)
     const noexcept -> bool
 {
@@ -73,6 +81,36 @@ auto BlockFilter::HaveFilterHeader(
     }
 }
 
+auto BlockFilter::instantiate(
+    const cfilter::Type type,
+    const block::Hash& blockHash,
+    const util::IndexData& index,
+    alloc::Default alloc) const noexcept(false) -> GCS
+{
+    const auto proto = proto::Factory<proto::GCS>(bulk_.ReadView(index));
+
+    if (false == cache_.Enabled()) {
+
+        return factory::GCS(api_, proto, alloc);
+    }
+
+    auto decoded = cache_.Find(type, blockHash);
+
+    if (!decoded) {
+        const auto& filter = proto.filter();
+        decoded = cache_.Insert(
+            type,
+            blockHash,
+            gcs::GolombDecode(
+                proto.count(),
+                static_cast<std::uint8_t>(proto.bits()),
+                ReadView{filter.data(), filter.size()},
+                alloc::System()));
+    }
+
+    return factory::GCS(api_, proto, std::move(decoded), alloc);
+}
+
 auto BlockFilter::load_filter_index(
     const cfilter::Type type,
     const ReadView blockHash,
@@ -111,8 +149,7 @@ auto BlockFilter::LoadFilter(
             return out;
         }();
 
-        return factory::GCS(
-            api_, proto::Factory<proto::GCS>(bulk_.ReadView(index)), alloc);
+        return instantiate(type, block::Hash{blockHash}, index, alloc);
     } catch (const std::exception& e) {
         LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
 
@@ -128,35 +165,57 @@ auto BlockFilter::LoadFilters(
     output.reserve(blocks.size());
     // TODO use a named constant for the cfilter scan batch size.
     constexpr auto allocBytes =
-        (1000u * sizeof(util::IndexData)) + sizeof(Vector<util::IndexData>);
+        (1000u * (sizeof(util::IndexData) + sizeof(ReadView))) +
+        (2u * sizeof(Vector<util::IndexData>));
     auto buf = std::array<std::byte, allocBytes>{};
     auto alloc = alloc::BoostMonotonic{buf.data(), buf.size()};
     const auto indices = [&] {
         auto out = Vector<util::IndexData>{&alloc};
-        out.reserve(1000u);
-        auto tx = lmdb_.TransactionRO();
-
-        for (const auto& hash : blocks) {
-            try {
-                auto& index = out.emplace_back();
-                load_filter_index(type, hash.Bytes(), tx, index);
-            } catch (const std::exception& e) {
-                LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
-                out.pop_back();
-
-                break;
-            }
+        out.resize(blocks.size());
+
+        try {
+            const auto keys = [&] {
+                auto k = Vector<ReadView>{&alloc};
+                k.reserve(blocks.size());
+
+                for (const auto& hash : blocks) {
+                    k.emplace_back(hash.Bytes());
+                }
+
+                return k;
+            }();
+            lmdb_.LoadBatch(
+                translate_filter(type),
+                keys,
+                [&](const auto i, const auto in) {
+                    if (sizeof(util::IndexData) != in.size()) { return; }
+
+                    std::memcpy(
+                        static_cast<void*>(&out[i]), in.data(), in.size());
+                });
+        } catch (const std::exception& e) {
+            LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
+            out.clear();
         }
 
+        // NOTE the result is truncated at the first missing filter
+        const auto missing = std::find_if(
+            out.begin(), out.end(), [](const auto& index) {
+                return 0 == index.size_;
+            });
+        out.erase(missing, out.end());
+
         return out;
     }();
 
+    // NOTE filters for consecutive blocks were stored in order
+    const auto sequential = bulk_.Sequential();
+    auto hash = blocks.cbegin();
+
     for (const auto& index : indices) {
         try {
-            output.emplace_back(factory::GCS(
-                api_,
-                proto::Factory<proto::GCS>(bulk_.ReadView(index)),
-                blocks.get_allocator()));
+            output.emplace_back(
+                instantiate(type, *(hash++), index, blocks.get_allocator()));
         } catch (const std::exception& e) {
             LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
 
@@ -409,6 +468,7 @@ auto BlockFilter::StoreFilters(
         }();
         const auto hTable = translate_header(type);
         const auto fTable = translate_filter(type);
+        const auto sequential = bulk_.Sequential();
         auto tx = lmdb_.TransactionRW();
         auto lock = Lock{bulk_.Mutex()};
 
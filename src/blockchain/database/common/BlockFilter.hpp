@@ -5,9 +5,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 
+#include "blockchain/database/common/FilterCache.hpp"
 #include "internal/blockchain/crypto/Crypto.hpp"
 #include "internal/blockchain/database/common/Common.hpp"
 #include "internal/util/Mutex.hpp"
@@ -69,6 +71,7 @@ namespace opentxs::blockchain::database::common
 class BlockFilter
 {
 public:
+    auto CacheStats() const noexcept -> FilterCache::Stats;
     auto HaveFilter(const cfilter::Type type, const ReadView blockHash)
         const noexcept -> bool;
     auto HaveFilterHeader(const cfilter::Type type, const ReadView blockHash)
@@ -102,7 +105,8 @@ public:
     BlockFilter(
         const api::Session& api,
         storage::lmdb::LMDB& lmdb,
-        Bulk& bulk) noexcept;
+        Bulk& bulk,
+        std::size_t cacheBytes) noexcept;
 
 private:
     static const std::uint32_t blockchain_filter_header_version_{1};
@@ -113,12 +117,18 @@ private:
     const api::Session& api_;
     storage::lmdb::LMDB& lmdb_;
     Bulk& bulk_;
+    mutable FilterCache cache_;
 
     static auto translate_filter(const cfilter::Type type) noexcept(false)
         -> Table;
     static auto translate_header(const cfilter::Type type) noexcept(false)
         -> Table;
 
+    auto instantiate(
+        const cfilter::Type type,
+        const block::Hash& blockHash,
+        const util::IndexData& index,
+        alloc::Default alloc) const noexcept(false) -> GCS;
     auto load_filter_index(
         const cfilter::Type type,
         const ReadView blockHash,
@@ -8,6 +8,7 @@
 #include "blockchain/database/common/Blocks.hpp"  // IWYU pragma: associated
 
 #include <cstring>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <type_traits>
@@ -98,6 +99,10 @@ struct Blocks::Imp {
 
             return true;
         };
+        // NOTE blocks are ingested in chain order and each one is appended
+        // to the end of bulk storage, so the advice is held until the caller
+        // has finished writing through the returned view
+        auto sequential = bulk_.Sequential();
         auto tx = lmdb_.TransactionRW();
         auto view = bulk_.WriteView(tx, index, std::move(cb), bytes);
 
@@ -115,7 +120,10 @@ struct Blocks::Imp {
             return {};
         }
 
-        return BlockWriter{std::move(view), block_locks_[block]};
+        return BlockWriter{
+            std::move(view),
+            block_locks_[block],
+            [sequential = std::move(sequential)] {}};
     }
 
     Imp(storage::lmdb::LMDB& lmdb, Bulk& bulk) noexcept
@@ -7,22 +7,77 @@
 #include "1_Internal.hpp"                       // IWYU pragma: associated
 #include "blockchain/database/common/Bulk.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
+#include <exception>
+#include <memory>
 #include <mutex>
 #include <utility>
 
 #include "blockchain/database/common/Database.hpp"
 #include "internal/blockchain/database/common/Common.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Log.hpp"
 #include "util/MappedFileStorage.hpp"
 
 namespace opentxs::blockchain::database::common
 {
 struct Bulk::Imp final : private util::MappedFileStorage {
+    auto BeginSequential() const noexcept -> void
+    {
+        auto lock = Lock{lock_};
+
+        if (0u == sequential_++) {
+            set_access_pattern(util::AccessPattern::sequential);
+        }
+    }
+    auto EndSequential() const noexcept -> void
+    {
+        auto lock = Lock{lock_};
+
+        OT_ASSERT(0u < sequential_);
+
+        if (0u == --sequential_) {
+            set_access_pattern(util::AccessPattern::random);
+        }
+    }
+    auto Compact() const noexcept -> bool
+    {
+        try {
+            auto compact = Lock{compact_lock_};
+
+            // NOTE the index tables are read in a read-only transaction
+            // without holding the mutex so writers are only blocked while a
+            // single batch is moved
+            if (false == compact_scan(IndexTables())) { return false; }
+
+            // NOTE the lmdb transaction must be opened before acquiring the
+            // mutex to match the lock order used by writers
+            auto tx = lmdb_.TransactionRW();
+            auto lock = Lock{lock_};
+
+            if (false == compact(tx, IndexTables())) { return false; }
+
+            return tx.Finalize(true);
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return false;
+        }
+    }
     auto Mutex() const noexcept -> std::mutex& { return lock_; }
     auto ReadView(const Lock&, const util::IndexData& index) const noexcept
         -> opentxs::ReadView
     {
         return get_read_view(index);
     }
+    auto Release(
+        const Lock&,
+        storage::lmdb::LMDB::Transaction& tx,
+        const util::IndexData& index) const noexcept -> bool
+    {
+        return release(tx, index);
+    }
     auto WriteView(
         const Lock&,
         storage::lmdb::LMDB::Transaction& tx,
@@ -40,13 +95,28 @@ struct Bulk::Imp final : private util::MappedFileStorage {
               path,
               "blk",
               Table::Config,
-              static_cast<std::size_t>(Database::Key::NextBlockAddress))
+              static_cast<std::size_t>(Database::Key::NextBlockAddress),
+              [] {
+                  // NOTE outside of bulk ingest and rescans most reads are
+                  // wallet lookups of individual items
+                  auto out = util::MappedFileParams{};
+                  out.free_table_ = Table::FreeSpace;
+                  out.pattern_ = util::AccessPattern::random;
+                  out.hugepages_ = true;
+
+                  return out;
+              }())
         , lock_()
+        , compact_lock_()
+        , sequential_(0u)
     {
     }
 
 private:
     mutable std::mutex lock_;
+    // NOTE serializes Compact() since the region scan runs without lock_
+    mutable std::mutex compact_lock_;
+    mutable std::size_t sequential_;
 };
 
 Bulk::Bulk(storage::lmdb::LMDB& lmdb, const UnallocatedCString& path) noexcept(
@@ -55,6 +125,22 @@ Bulk::Bulk(storage::lmdb::LMDB& lmdb, const UnallocatedCString& path) noexcept(
 {
 }
 
+auto Bulk::Compact() const noexcept -> bool { return imp_->Compact(); }
+
+auto Bulk::IndexTables() noexcept -> const UnallocatedVector<int>&
+{
+    static const auto tables = UnallocatedVector<int>{
+        Table::BlockIndex,
+        Table::HeaderIndex,
+        Table::FilterIndexBasic,
+        Table::FilterIndexBCH,
+        Table::FilterIndexES,
+        Table::TransactionIndex,
+    };
+
+    return tables;
+}
+
 auto Bulk::Mutex() const noexcept -> std::mutex& { return imp_->Mutex(); }
 
 auto Bulk::ReadView(const util::IndexData& index) const noexcept
@@ -71,6 +157,20 @@ auto Bulk::ReadView(const Lock& lock, const util::IndexData& index)
     return imp_->ReadView(lock, index);
 }
 
+auto Bulk::Release(
+    const Lock& lock,
+    storage::lmdb::LMDB::Transaction& tx,
+    const util::IndexData& index) const noexcept -> bool
+{
+    return imp_->Release(lock, tx, index);
+}
+
+auto Bulk::Sequential() const noexcept -> std::shared_ptr<const ScopeGuard>
+{
+    return std::make_shared<const ScopeGuard>(
+        [this] { imp_->BeginSequential(); }, [this] { imp_->EndSequential(); });
+}
+
 auto Bulk::WriteView(
     storage::lmdb::LMDB::Transaction& tx,
     util::IndexData& index,
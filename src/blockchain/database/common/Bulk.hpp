@@ -14,6 +14,7 @@
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 #include "util/LMDB.hpp"
+#include "util/ScopeGuard.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -44,11 +45,25 @@ public:
     using UpdateCallback =
         std::function<bool(storage::lmdb::LMDB::Transaction&)>;
 
+    // Tables whose values are the location of an item in bulk storage
+    static auto IndexTables() noexcept -> const UnallocatedVector<int>&;
+
+    // Compact one batch of items. Returns true if more work may remain.
+    auto Compact() const noexcept -> bool;
+
     auto Mutex() const noexcept -> std::mutex&;
     auto ReadView(const util::IndexData& index) const noexcept
         -> opentxs::ReadView;
     auto ReadView(const Lock& lock, const util::IndexData& index) const noexcept
         -> opentxs::ReadView;
+    auto Release(
+        const Lock& lock,
+        storage::lmdb::LMDB::Transaction& tx,
+        const util::IndexData& index) const noexcept -> bool;
+    // Advise the kernel that items will be accessed in order of storage
+    // position until every copy of the returned pointer is destroyed. Random
+    // access is assumed otherwise.
+    auto Sequential() const noexcept -> std::shared_ptr<const ScopeGuard>;
     auto WriteView(
         storage::lmdb::LMDB::Transaction& tx,
         util::IndexData& index,
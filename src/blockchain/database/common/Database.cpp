@@ -232,6 +232,7 @@ struct Database::Imp {
                       {Table::FilterIndexBCH, 0},
                       {Table::FilterIndexES, 0},
                       {Table::TransactionIndex, 0},
+                      {Table::FreeSpace, MDB_DUPSORT | MDB_INTEGERKEY},
                   };
 
                   for (const auto& [table, name] : SyncTables()) {
@@ -254,7 +255,7 @@ struct Database::Imp {
         , siphash_key_(siphash_key(lmdb_))
         , headers_(lmdb_, bulk_)
         , peers_(api_, lmdb_)
-        , filters_(api_, lmdb_, bulk_)
+        , filters_(api_, lmdb_, bulk_, args.BlockchainCfilterCacheBytes())
         , blocks_(lmdb_, bulk_)
         , sync_(api_, lmdb_, blocks_path_->Get())
         , wallet_(api_, blockchain, lmdb_, bulk_)
@@ -292,6 +293,7 @@ const storage::lmdb::TableNames Database::Imp::table_names_ = [] {
         {Table::FilterIndexBCH, "block_filters_bch_2"},
         {Table::FilterIndexES, "block_filters_opentxs_2"},
         {Table::TransactionIndex, "transactions"},
+        {Table::FreeSpace, "bulk_free_space"},
     };
 
     for (const auto& [table, name] : SyncTables()) {
@@ -357,6 +359,11 @@ auto Database::BlockStore(const BlockHash& block, const std::size_t bytes)
     return imp_.blocks_.Store(block, bytes);
 }
 
+auto Database::Compact() const noexcept -> bool
+{
+    return imp_.bulk_.Compact();
+}
+
 auto Database::DeleteSyncServer(std::string_view endpoint) const noexcept
     -> bool
 {
@@ -389,6 +396,11 @@ auto Database::Enable(const Chain type, std::string_view seednode)
     return imp_.lmdb_.Store(Enabled, key, reader(value)).first;
 }
 
+auto Database::FilterCacheStats() const noexcept -> FilterCache::Stats
+{
+    return imp_.filters_.CacheStats();
+}
+
 auto Database::Find(
     const Chain chain,
     const Protocol protocol,
@@ -486,7 +498,7 @@ auto Database::LookupContact(const Data& pubkeyHash) const noexcept
 auto Database::LoadSync(
     const Chain chain,
     const Height height,
-    opentxs::network::p2p::Data& output) const noexcept -> bool
+    opentxs::network::zeromq::Message& output) const noexcept -> bool
 {
     return imp_.sync_.Load(chain, height, output);
 }
@@ -14,6 +14,7 @@
 #include <utility>
 
 #include "Proto.hpp"
+#include "blockchain/database/common/FilterCache.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/crypto/Crypto.hpp"
 #include "internal/blockchain/database/Types.hpp"
@@ -72,8 +73,12 @@ namespace network
 namespace p2p
 {
 class Block;
-class Data;
 }  // namespace p2p
+
+namespace zeromq
+{
+class Message;
+}  // namespace zeromq
 }  // namespace network
 
 namespace proto
@@ -126,10 +131,14 @@ public:
     auto BlockLoad(const BlockHash& block) const noexcept -> BlockReader;
     auto BlockStore(const BlockHash& block, const std::size_t bytes)
         const noexcept -> BlockWriter;
+    // Reclaim space from the most fragmented bulk storage region one batch at
+    // a time. Returns true if more work may remain.
+    auto Compact() const noexcept -> bool;
     auto DeleteSyncServer(std::string_view endpoint) const noexcept -> bool;
     auto Disable(const Chain type) const noexcept -> bool;
     auto Enable(const Chain type, std::string_view seednode) const noexcept
         -> bool;
+    auto FilterCacheStats() const noexcept -> FilterCache::Stats;
     auto Find(
         const Chain chain,
         const Protocol protocol,
@@ -163,7 +172,7 @@ public:
     auto LoadSync(
         const Chain chain,
         const Height height,
-        opentxs::network::p2p::Data& output) const noexcept -> bool;
+        opentxs::network::zeromq::Message& output) const noexcept -> bool;
     auto LoadTransaction(const ReadView txid) const noexcept
         -> std::unique_ptr<bitcoin::block::Transaction>;
     auto LoadTransaction(const ReadView txid, proto::BlockchainTransaction& out)
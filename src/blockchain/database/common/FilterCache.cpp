@@ -0,0 +1,115 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "blockchain/database/common/FilterCache.hpp"  // IWYU pragma: associated
+
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "opentxs/util/Allocator.hpp"
+
+namespace opentxs::blockchain::database::common
+{
+FilterCache::FilterCache(std::size_t budget) noexcept
+    : budget_(budget)
+    , lock_()
+    , lru_()
+    , index_()
+    , bytes_(0u)
+    , hits_(0u)
+    , misses_(0u)
+    , evictions_(0u)
+{
+}
+
+auto FilterCache::Clear() noexcept -> void
+{
+    auto lock = std::lock_guard<std::mutex>{lock_};
+    index_.clear();
+    lru_.clear();
+    bytes_ = 0u;
+}
+
+auto FilterCache::evict(const std::lock_guard<std::mutex>&) noexcept -> void
+{
+    while ((bytes_ > budget_) && (false == lru_.empty())) {
+        const auto& oldest = lru_.back();
+        bytes_ -= oldest.bytes_;
+        index_.erase(oldest.key_);
+        lru_.pop_back();
+        ++evictions_;
+    }
+}
+
+auto FilterCache::Find(const cfilter::Type type, const block::Hash& block)
+    const noexcept -> Elements
+{
+    if (false == Enabled()) { return {}; }
+
+    auto lock = std::lock_guard<std::mutex>{lock_};
+
+    if (auto i = index_.find(Key{type, block}); index_.end() != i) {
+        ++hits_;
+        lru_.splice(lru_.begin(), lru_, i->second);
+
+        return i->second->elements_;
+    } else {
+        ++misses_;
+
+        return {};
+    }
+}
+
+auto FilterCache::GetStats() const noexcept -> Stats
+{
+    auto lock = std::lock_guard<std::mutex>{lock_};
+
+    return Stats{hits_, misses_, evictions_, index_.size(), bytes_, budget_};
+}
+
+auto FilterCache::Insert(
+    const cfilter::Type type,
+    const block::Hash& block,
+    gcs::Elements&& elements) noexcept -> Elements
+{
+    const auto bytes = size(elements);
+    // NOTE cached elements may outlive the allocator of whichever GCS caused
+    // them to be decoded so they are always copied to the system allocator
+    auto out = std::make_shared<const gcs::Elements>(
+        std::move(elements), alloc::System());
+
+    if ((false == Enabled()) || (bytes > budget_)) { return out; }
+
+    auto lock = std::lock_guard<std::mutex>{lock_};
+    auto key = Key{type, block};
+
+    if (auto i = index_.find(key); index_.end() != i) {
+        // NOTE another thread decoded the same filter first
+        lru_.splice(lru_.begin(), lru_, i->second);
+
+        return i->second->elements_;
+    }
+
+    lru_.push_front(Entry{key, out, bytes});
+    index_.emplace(std::move(key), lru_.begin());
+    bytes_ += bytes;
+    evict(lock);
+
+    return out;
+}
+
+auto FilterCache::size(const gcs::Elements& elements) noexcept -> std::size_t
+{
+    static constexpr auto overhead =
+        sizeof(Entry) + sizeof(Index::value_type) + sizeof(gcs::Elements);
+
+    return overhead + (elements.size() * sizeof(gcs::Element));
+}
+
+FilterCache::~FilterCache() = default;
+}  // namespace opentxs::blockchain::database::common
@@ -0,0 +1,85 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/FilterType.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::blockchain::database::common
+{
+/// Size-bounded least recently used cache of decoded cfilter elements
+///
+/// Entries are keyed by filter type and block hash and are shared between all
+/// chains in a session. A budget of zero bytes disables the cache.
+class FilterCache
+{
+public:
+    using Elements = std::shared_ptr<const gcs::Elements>;
+
+    struct Stats {
+        std::uint64_t hits_{};
+        std::uint64_t misses_{};
+        std::uint64_t evictions_{};
+        std::size_t entries_{};
+        std::size_t bytes_{};
+        std::size_t budget_{};
+    };
+
+    auto Enabled() const noexcept -> bool { return 0u < budget_; }
+    auto Find(const cfilter::Type type, const block::Hash& block) const noexcept
+        -> Elements;
+    auto GetStats() const noexcept -> Stats;
+
+    auto Clear() noexcept -> void;
+    auto Insert(
+        const cfilter::Type type,
+        const block::Hash& block,
+        gcs::Elements&& elements) noexcept -> Elements;
+
+    FilterCache(std::size_t budget) noexcept;
+    FilterCache() = delete;
+    FilterCache(const FilterCache&) = delete;
+    FilterCache(FilterCache&&) = delete;
+    auto operator=(const FilterCache&) -> FilterCache& = delete;
+    auto operator=(FilterCache&&) -> FilterCache& = delete;
+
+    ~FilterCache();
+
+private:
+    using Key = std::pair<cfilter::Type, block::Hash>;
+
+    struct Entry {
+        Key key_;
+        Elements elements_;
+        std::size_t bytes_;
+    };
+
+    using LRU = std::list<Entry>;
+    using Index = Map<Key, LRU::iterator>;
+
+    const std::size_t budget_;
+    mutable std::mutex lock_;
+    mutable LRU lru_;
+    Index index_;
+    std::size_t bytes_;
+    mutable std::uint64_t hits_;
+    mutable std::uint64_t misses_;
+    std::uint64_t evictions_;
+
+    static auto size(const gcs::Elements& elements) noexcept -> std::size_t;
+
+    auto evict(const std::lock_guard<std::mutex>&) noexcept -> void;
+};
+}  // namespace opentxs::blockchain::database::common
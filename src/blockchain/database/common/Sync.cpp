@@ -30,6 +30,7 @@ extern "C" {
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/Params.hpp"
 #include "internal/blockchain/database/common/Common.hpp"
+#include "internal/network/zeromq/message/Factory.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/P0330.hpp"
 #include "internal/util/TSV.hpp"
@@ -39,6 +40,8 @@ extern "C" {
 #include "opentxs/blockchain/bitcoin/cfilter/FilterType.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
 #include "opentxs/network/p2p/Block.hpp"
+#include "opentxs/network/zeromq/message/Frame.hpp"
+#include "opentxs/network/zeromq/message/Message.hpp"
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Log.hpp"
 #include "util/ByteLiterals.hpp"
@@ -51,71 +54,16 @@ struct Sync::Imp final : private util::MappedFileStorage {
     auto Load(const Chain chain, const Height height, Message& output)
         const noexcept -> bool
     {
-        const auto start = static_cast<std::size_t>(height + 1);
-        auto haveOne{false};
-        auto total = 0_uz;
         auto lock = SharedLock{lock_};
-        const auto cb = [&](const auto key, const auto value) {
-            if ((nullptr == key.data()) ||
-                (sizeof(std::size_t) != key.size())) {
-                throw std::runtime_error("Invalid key");
-            }
-
-            const auto height = [&] {
-                auto out = 0_uz;
-                std::memcpy(&out, key.data(), key.size());
-
-                return out;
-            }();
-
-            try {
-                const auto data = Data{value};
-                const auto view = get_read_view(data.index_);
-
-                if ((nullptr == view.data()) || (0 == view.size())) {
-                    throw std::runtime_error("Failed to load sync packet");
-                }
-
-                auto checksum = std::uint64_t{};
-
-                static_assert(sizeof(checksum) == crypto_shorthash_BYTES);
-
-                if (0 !=
-                    ::crypto_shorthash(
-                        reinterpret_cast<unsigned char*>(&checksum),
-                        reinterpret_cast<const unsigned char*>(view.data()),
-                        view.size(),
-                        checksum_key_.data())) {
-                    throw std::runtime_error("Failed to calculate checksum");
-                }
-
-                if (data.checksum_ != checksum) {
-                    auto exclusive = boost::upgrade_to_unique_lock<Mutex>{lock};
-                    reorg(chain, height - 1);
-                    throw std::runtime_error("checksum failure");
-                }
-
-                if (false == output.Add(view)) { return false; }
+        const auto& packets = load(lock, chain, height);
 
-                haveOne = true;
-                total += view.size();
-
-                return total < 4_MiB;
-            } catch (const std::exception& e) {
-                LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
-
-                return false;
-            }
-        };
+        if (packets.empty()) { return false; }
 
-        try {
-            using Dir = storage::lmdb::LMDB::Dir;
-            lmdb_.ReadFrom(ChainToSyncTable(chain), start, cb, Dir::Forward);
-        } catch (const std::exception& e) {
-            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+        for (const auto& [view, pin] : packets) {
+            output.AddFrame(factory::ZMQFrame(view, pin));
         }
 
-        return haveOne;
+        return true;
     }
 
     auto Reorg(const Chain chain, const Height height) const noexcept -> bool
@@ -147,6 +95,9 @@ struct Sync::Imp final : private util::MappedFileStorage {
 
         OT_ASSERT(-2 < previous);
 
+        invalidate(chain, items.front().Height());
+        auto& verified = verified_[chain];
+
         auto txn = lmdb_.TransactionRW();
         LogTrace()(OT_PRETTY_CLASS())("previous tip height: ")(previous)
             .Flush();
@@ -199,6 +150,10 @@ struct Sync::Imp final : private util::MappedFileStorage {
                 return false;
             }
 
+            // NOTE the checksum was just calculated from the mapped bytes
+            if (verified.size() <= dbKey) { verified.resize(dbKey + 1_uz); }
+
+            verified[dbKey] = true;
             const auto result =
                 lmdb_.Store(ChainToSyncTable(chain), dbKey, data, txn);
 
@@ -253,6 +208,9 @@ struct Sync::Imp final : private util::MappedFileStorage {
         , api_(api)
         , tip_table_(Table::SyncTips)
         , lock_()
+        , verified_()
+        , ranges_()
+        , counter_()
         , tips_([&] {
             auto output = Tips{};
 
@@ -297,12 +255,30 @@ private:
     using SharedLock = boost::upgrade_lock<Mutex>;
     using ExclusiveLock = boost::unique_lock<Mutex>;
     using Tips = UnallocatedMap<Chain, Height>;
+    using Pin = util::MappedFileStorage::Pin;
+    struct Packet {
+        ReadView view_{};
+        Pin pin_{};
+    };
+    using Packets = UnallocatedVector<Packet>;
+    struct Range {
+        std::uint64_t used_{};
+        Packets packets_{};
+    };
+    using RangeKey = std::pair<Chain, Height>;
 
+    static constexpr auto max_reply_bytes_ = 4_MiB;
+    static constexpr auto max_ranges_ = 64_uz;
     static const std::array<unsigned char, 16> checksum_key_;
 
     const api::Session& api_;
     const int tip_table_;
     mutable Mutex lock_;
+    // NOTE upgrade ownership is exclusive so the following members are only
+    // modified by one holder of a SharedLock at a time
+    mutable UnallocatedMap<Chain, UnallocatedVector<bool>> verified_;
+    mutable UnallocatedMap<RangeKey, Range> ranges_;
+    mutable std::uint64_t counter_;
     mutable Tips tips_;
 
     struct Data {
@@ -340,6 +316,23 @@ private:
         }
     };
 
+    auto checksum(const Data& data, const ReadView view) const noexcept(false)
+        -> bool
+    {
+        auto checksum = std::uint64_t{};
+
+        static_assert(sizeof(checksum) == crypto_shorthash_BYTES);
+
+        if (0 != ::crypto_shorthash(
+                     reinterpret_cast<unsigned char*>(&checksum),
+                     reinterpret_cast<const unsigned char*>(view.data()),
+                     view.size(),
+                     checksum_key_.data())) {
+            throw std::runtime_error("Failed to calculate checksum");
+        }
+
+        return data.checksum_ == checksum;
+    }
     auto import_genesis(const Chain chain) noexcept -> void
     {
         if (0 <= tips_.at(chain)) { return; }
@@ -388,6 +381,124 @@ private:
         Store(chain, items);
     }
     // WARNING make sure an exclusive lock is held
+    auto invalidate(const Chain chain, const Height from) const noexcept
+        -> void
+    {
+        for (auto i = ranges_.begin(); i != ranges_.end();) {
+            const auto& [key, range] = *i;
+            const auto last =
+                key.second + static_cast<Height>(range.packets_.size());
+
+            if ((key.first == chain) && ((last + 1) >= from)) {
+                i = ranges_.erase(i);
+            } else {
+                ++i;
+            }
+        }
+
+        if (auto i = verified_.find(chain); verified_.end() != i) {
+            auto& verified = i->second;
+            const auto size = static_cast<std::size_t>(std::max<Height>(
+                std::min<Height>(from, verified.size()), 0));
+            verified.resize(size);
+        }
+    }
+    // NOTE replies are assembled once per range and served to every client
+    // which asks for the same range until new data arrives or a reorg occurs.
+    // Each packet is checksummed the first time it is read.
+    auto load(SharedLock& lock, const Chain chain, const Height height)
+        const noexcept -> const Packets&
+    {
+        static const auto blank = Packets{};
+        const auto id = RangeKey{chain, height};
+
+        if (auto i = ranges_.find(id); ranges_.end() != i) {
+            auto& range = i->second;
+            range.used_ = ++counter_;
+
+            return range.packets_;
+        }
+
+        const auto start = static_cast<std::size_t>(height + 1);
+        auto packets = Packets{};
+        auto total = 0_uz;
+        const auto cb = [&](const auto key, const auto value) {
+            if ((nullptr == key.data()) ||
+                (sizeof(std::size_t) != key.size())) {
+                throw std::runtime_error("Invalid key");
+            }
+
+            const auto height = [&] {
+                auto out = 0_uz;
+                std::memcpy(&out, key.data(), key.size());
+
+                return out;
+            }();
+
+            try {
+                const auto data = Data{value};
+                auto [view, pin] = get_pinned_view(data.index_);
+
+                if ((nullptr == view.data()) || (0 == view.size())) {
+                    throw std::runtime_error("Failed to load sync packet");
+                }
+
+                auto& verified = verified_[chain];
+                const auto known =
+                    (height < verified.size()) && verified[height];
+
+                if (false == known) {
+                    if (false == checksum(data, view)) {
+                        auto exclusive =
+                            boost::upgrade_to_unique_lock<Mutex>{lock};
+                        reorg(chain, height - 1);
+                        throw std::runtime_error("checksum failure");
+                    }
+
+                    if (verified.size() <= height) {
+                        verified.resize(height + 1_uz);
+                    }
+
+                    verified[height] = true;
+                }
+
+                packets.emplace_back(Packet{view, std::move(pin)});
+                total += view.size();
+
+                return total < max_reply_bytes_;
+            } catch (const std::exception& e) {
+                LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+                return false;
+            }
+        };
+
+        try {
+            using Dir = storage::lmdb::LMDB::Dir;
+            lmdb_.ReadFrom(ChainToSyncTable(chain), start, cb, Dir::Forward);
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+        }
+
+        if (packets.empty()) { return blank; }
+
+        if (ranges_.size() >= max_ranges_) {
+            const auto lru = std::min_element(
+                ranges_.begin(),
+                ranges_.end(),
+                [](const auto& lhs, const auto& rhs) {
+                    return lhs.second.used_ < rhs.second.used_;
+                });
+            ranges_.erase(lru);
+        }
+
+        auto& range = ranges_[id];
+        range.used_ = ++counter_;
+        range.packets_ = std::move(packets);
+
+        return range.packets_;
+    }
+    // WARNING make sure an exclusive lock is held
     auto reorg(const Chain chain, const Height height) const noexcept -> bool
     {
         if (0 > height) {
@@ -424,6 +535,7 @@ private:
         }
 
         tip = height;
+        invalidate(chain, height + 1);
 
         return true;
     }
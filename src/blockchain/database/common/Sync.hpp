@@ -21,8 +21,8 @@
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/blockchain/block/Types.hpp"
 #include "opentxs/network/p2p/Block.hpp"
-#include "opentxs/network/p2p/Data.hpp"
 #include "opentxs/network/p2p/Types.hpp"
+#include "opentxs/network/zeromq/message/Message.hpp"
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 #include "util/LMDB.hpp"
@@ -42,8 +42,12 @@ namespace network
 namespace p2p
 {
 class Block;
-class Data;
 }  // namespace p2p
+
+namespace zeromq
+{
+class Message;
+}  // namespace zeromq
 }  // namespace network
 
 namespace storage
@@ -64,8 +68,10 @@ class Sync
 public:
     using Chain = opentxs::blockchain::Type;
     using Height = opentxs::blockchain::block::Height;
-    using Message = opentxs::network::p2p::Data;
+    using Message = opentxs::network::zeromq::Message;
 
+    // Append one frame per packet, starting at the block after the specified
+    // height. The frames reference the mapped storage directly.
     auto Load(const Chain chain, const Height height, Message& output)
         const noexcept -> bool;
     // Delete all entries with a height greater than specified
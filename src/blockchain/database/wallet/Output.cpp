@@ -1079,54 +1079,26 @@ private:
         const AccountID& account,
         const crypto::Key* key) const noexcept -> Balance
     {
-        auto output = Balance{};
-        auto& [confirmed, unconfirmed] = output;
-        const auto* pNym = owner.empty() ? nullptr : &owner;
-        const auto* pAcct = account.empty() ? nullptr : &account;
-        auto cb = [&](const auto previous, const auto& outpoint) -> auto
-        {
-            const auto& existing = cache.GetOutput(outpoint);
+        // NOTE as in match() only the most specific condition is tested
+        const auto output = [&] {
+            if (nullptr != key) {
 
-            return previous + existing.Value();
-        };
+                return cache.GetKeyBalance(*key);
+            } else if (false == account.empty()) {
 
-        const auto unconfirmedSpendTotal = [&] {
-            const auto txos = match(
-                cache,
-                {node::TxoState::UnconfirmedSpend},
-                pNym,
-                pAcct,
-                nullptr,
-                key);
+                return cache.GetAccountBalance(account);
+            } else if (false == owner.empty()) {
 
-            return std::accumulate(txos.begin(), txos.end(), Amount{0}, cb);
-        }();
+                return cache.GetNymBalance(owner);
+            } else {
 
-        {
-            const auto txos = match(
-                cache,
-                {node::TxoState::ConfirmedNew},
-                pNym,
-                pAcct,
-                nullptr,
-                key);
-            confirmed =
-                unconfirmedSpendTotal +
-                std::accumulate(txos.begin(), txos.end(), Amount{0}, cb);
-        }
+                return cache.GetWalletBalance();
+            }
+        }();
 
-        {
-            const auto txos = match(
-                cache,
-                {node::TxoState::UnconfirmedNew},
-                pNym,
-                pAcct,
-                nullptr,
-                key);
-            unconfirmed =
-                std::accumulate(txos.begin(), txos.end(), confirmed, cb) -
-                unconfirmedSpendTotal;
-        }
+#ifndef NDEBUG
+        OT_ASSERT(output == recount_balance(cache, owner, account, key));
+#endif
 
         return output;
     }
@@ -1268,6 +1240,63 @@ private:
             api.Internal().UpdateBalance(nym, chain_, balance);
         }
     }
+    [[nodiscard]] auto recount_balance(
+        const OutputCache& cache,
+        const identifier::Nym& owner,
+        const AccountID& account,
+        const crypto::Key* key) const noexcept -> Balance
+    {
+        auto output = Balance{};
+        auto& [confirmed, unconfirmed] = output;
+        const auto* pNym = owner.empty() ? nullptr : &owner;
+        const auto* pAcct = account.empty() ? nullptr : &account;
+        auto cb = [&](const auto previous, const auto& outpoint) -> auto
+        {
+            const auto& existing = cache.GetOutput(outpoint);
+
+            return previous + existing.Value();
+        };
+
+        const auto unconfirmedSpendTotal = [&] {
+            const auto txos = match(
+                cache,
+                {node::TxoState::UnconfirmedSpend},
+                pNym,
+                pAcct,
+                nullptr,
+                key);
+
+            return std::accumulate(txos.begin(), txos.end(), Amount{0}, cb);
+        }();
+
+        {
+            const auto txos = match(
+                cache,
+                {node::TxoState::ConfirmedNew},
+                pNym,
+                pAcct,
+                nullptr,
+                key);
+            confirmed =
+                unconfirmedSpendTotal +
+                std::accumulate(txos.begin(), txos.end(), Amount{0}, cb);
+        }
+
+        {
+            const auto txos = match(
+                cache,
+                {node::TxoState::UnconfirmedNew},
+                pNym,
+                pAcct,
+                nullptr,
+                key);
+            unconfirmed =
+                std::accumulate(txos.begin(), txos.end(), confirmed, cb) -
+                unconfirmedSpendTotal;
+        }
+
+        return output;
+    }
     [[nodiscard]] auto translate(Vector<UTXO>&& outputs) const noexcept
         -> UnallocatedVector<block::pTxid>
     {
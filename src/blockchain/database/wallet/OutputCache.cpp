@@ -87,12 +87,35 @@ auto OutputCache::load_output_index(const MapKeyType& key, MapType& map)
 
     return empty_outputs_;
 }
+
+template <typename MapKeyType, typename MapType>
+auto OutputCache::load_totals(const MapKeyType& key, MapType& map) noexcept
+    -> Totals&
+{
+    if (auto it = map.find(key); map.end() != it) { return it->second; }
+
+    auto [row, added] = map.try_emplace(key, Totals{});
+
+    OT_ASSERT(added);
+
+    return row->second;
+}
+
+template <typename MapKeyType, typename MapType>
+auto OutputCache::load_totals(const MapKeyType& key, const MapType& map)
+    const noexcept -> const Totals&
+{
+    if (auto it = map.find(key); map.end() != it) { return it->second; }
+
+    return empty_totals_;
+}
 }  // namespace opentxs::blockchain::database::wallet
 
 namespace opentxs::blockchain::database::wallet
 {
 const Outpoints OutputCache::empty_outputs_{};
 const Nyms OutputCache::empty_nyms_{};
+const OutputCache::Totals OutputCache::empty_totals_{};
 
 OutputCache::OutputCache(
     const api::Session& api,
@@ -112,6 +135,12 @@ OutputCache::OutputCache(
     , positions_()
     , states_()
     , subchains_()
+    , wallet_totals_()
+    , account_totals_()
+    , key_totals_()
+    , nym_totals_()
+    , subchain_totals_()
+    , contributions_()
     , populated_(false)
 {
     outputs_.reserve(reserve_);
@@ -175,7 +204,9 @@ auto OutputCache::AddToAccount(
             throw std::runtime_error{"Failed to update account index"};
         }
 
-        set.emplace(output);
+        if (set.emplace(output).second) {
+            join_scope(output, load_totals(id, account_totals_));
+        }
 
         return true;
     } catch (const std::exception& e) {
@@ -203,7 +234,9 @@ auto OutputCache::AddToKey(
             throw std::runtime_error{"Failed to update key index"};
         }
 
-        set.emplace(output);
+        if (set.emplace(output).second) {
+            join_scope(output, load_totals(id, key_totals_));
+        }
 
         return true;
     } catch (const std::exception& e) {
@@ -231,7 +264,10 @@ auto OutputCache::AddToNym(
             throw std::runtime_error{"Failed to update nym index"};
         }
 
-        index.emplace(output);
+        if (index.emplace(output).second) {
+            join_scope(output, load_totals(id, nym_totals_));
+        }
+
         list.emplace(id);
 
         return true;
@@ -294,7 +330,7 @@ auto OutputCache::AddToState(
             throw std::runtime_error{"Failed to update key index"};
         }
 
-        set.emplace(output);
+        if (set.emplace(output).second) { join_state(output, id); }
 
         return true;
     } catch (const std::exception& e) {
@@ -321,7 +357,9 @@ auto OutputCache::AddToSubchain(
             throw std::runtime_error{"Failed to update subchain index"};
         }
 
-        set.emplace(output);
+        if (set.emplace(output).second) {
+            join_scope(output, load_totals(id, subchain_totals_));
+        }
 
         return true;
     } catch (const std::exception& e) {
@@ -331,6 +369,40 @@ auto OutputCache::AddToSubchain(
     }
 }
 
+auto OutputCache::apply(
+    const std::uint32_t states,
+    const Amount& value,
+    const bool add,
+    Totals& totals) noexcept -> void
+{
+    const auto update = [&](Amount& total) {
+        if (add) {
+            total += value;
+        } else {
+            total -= value;
+        }
+    };
+
+    if (0u != (states & mask(node::TxoState::UnconfirmedNew))) {
+        update(totals.unconfirmed_new_);
+    }
+
+    if (0u != (states & mask(node::TxoState::UnconfirmedSpend))) {
+        update(totals.unconfirmed_spend_);
+    }
+
+    if (0u != (states & mask(node::TxoState::ConfirmedNew))) {
+        update(totals.confirmed_new_);
+    }
+}
+
+auto OutputCache::balance(const Totals& totals) noexcept -> Balance
+{
+    return {
+        totals.confirmed_new_ + totals.unconfirmed_spend_,
+        totals.confirmed_new_ + totals.unconfirmed_new_};
+}
+
 auto OutputCache::ChangePosition(
     const block::Position& oldPosition,
     const block::Position& newPosition,
@@ -425,14 +497,16 @@ auto OutputCache::ChangeState(
         for (const auto& state : all_states()) {
             if (auto it = states_.find(state); states_.end() != it) {
                 auto& from = it->second;
-                from.erase(id);
+
+                if (0u < from.erase(id)) { leave_state(id, state); }
 
                 if (0u == from.size()) { states_.erase(it); }
             }
         }
 
         auto& to = states_[newState];
-        to.emplace(id);
+
+        if (to.emplace(id).second) { join_state(id, newState); }
 
         return rc;
     } catch (const std::exception& e) {
@@ -453,9 +527,33 @@ auto OutputCache::Clear() noexcept -> void
     positions_.clear();
     states_.clear();
     subchains_.clear();
+    wallet_totals_ = {};
+    account_totals_.clear();
+    key_totals_.clear();
+    nym_totals_.clear();
+    subchain_totals_.clear();
+    contributions_.clear();
     populated_ = false;
 }
 
+auto OutputCache::contribution(const block::Outpoint& id) noexcept
+    -> Contribution&
+{
+    if (auto i = contributions_.find(id); contributions_.end() != i) {
+
+        return i->second;
+    }
+
+    auto& out = contributions_[id];
+
+    // NOTE write_output assigns the value of outputs which are not cached yet
+    if (auto i = outputs_.find(id); outputs_.end() != i) {
+        out.value_ = i->second->Value();
+    }
+
+    return out;
+}
+
 auto OutputCache::Exists(const block::Outpoint& id) const noexcept -> bool
 {
     return 0 < outputs_.count(id);
@@ -480,12 +578,24 @@ auto OutputCache::GetAccount(const AccountID& id) const noexcept
     return load_output_index(id, accounts_);
 }
 
+auto OutputCache::GetAccountBalance(const AccountID& id) const noexcept
+    -> Balance
+{
+    return balance(load_totals(id, account_totals_));
+}
+
 auto OutputCache::GetKey(const crypto::Key& id) const noexcept
     -> const Outpoints&
 {
     return load_output_index(id, keys_);
 }
 
+auto OutputCache::GetKeyBalance(const crypto::Key& id) const noexcept
+    -> Balance
+{
+    return balance(load_totals(id, key_totals_));
+}
+
 auto OutputCache::GetHeight() const noexcept -> block::Height
 {
     return get_position().Height();
@@ -497,6 +607,12 @@ auto OutputCache::GetNym(const identifier::Nym& id) const noexcept
     return load_output_index(id, nyms_);
 }
 
+auto OutputCache::GetNymBalance(const identifier::Nym& id) const noexcept
+    -> Balance
+{
+    return balance(load_totals(id, nym_totals_));
+}
+
 auto OutputCache::GetNyms() const noexcept -> const Nyms& { return nym_list_; }
 
 auto OutputCache::GetOutput(const block::Outpoint& id) const noexcept(false)
@@ -560,6 +676,61 @@ auto OutputCache::GetSubchain(const SubchainID& id) const noexcept
     return load_output_index(id, subchains_);
 }
 
+auto OutputCache::GetSubchainBalance(const SubchainID& id) const noexcept
+    -> Balance
+{
+    return balance(load_totals(id, subchain_totals_));
+}
+
+auto OutputCache::GetWalletBalance() const noexcept -> Balance
+{
+    return balance(wallet_totals_);
+}
+
+auto OutputCache::join_scope(const block::Outpoint& id, Totals& scope) noexcept
+    -> void
+{
+    auto& item = contribution(id);
+    item.scopes_.emplace_back(&scope);
+    apply(item.states_, item.value_, true, scope);
+}
+
+auto OutputCache::join_state(
+    const block::Outpoint& id,
+    const node::TxoState state) noexcept -> void
+{
+    const auto bit = mask(state);
+
+    if (0u == bit) { return; }
+
+    auto& item = contribution(id);
+
+    if (0u != (item.states_ & bit)) { return; }
+
+    item.states_ |= bit;
+    apply(bit, item.value_, true, wallet_totals_);
+
+    for (auto* scope : item.scopes_) { apply(bit, item.value_, true, *scope); }
+}
+
+auto OutputCache::leave_state(
+    const block::Outpoint& id,
+    const node::TxoState state) noexcept -> void
+{
+    const auto bit = mask(state);
+
+    if (0u == bit) { return; }
+
+    auto& item = contribution(id);
+
+    if (0u == (item.states_ & bit)) { return; }
+
+    item.states_ &= ~bit;
+    apply(bit, item.value_, false, wallet_totals_);
+
+    for (auto* scope : item.scopes_) { apply(bit, item.value_, false, *scope); }
+}
+
 auto OutputCache::load_output(const block::Outpoint& id) noexcept(false)
     -> bitcoin::block::internal::Output&
 {
@@ -584,6 +755,28 @@ auto OutputCache::load_output(const block::Outpoint& id) const noexcept(false)
     return const_cast<OutputCache*>(this)->load_output(id);
 }
 
+auto OutputCache::mask(const node::TxoState state) noexcept -> std::uint32_t
+{
+    switch (state) {
+        case node::TxoState::UnconfirmedNew: {
+
+            return 0x01;
+        }
+        case node::TxoState::UnconfirmedSpend: {
+
+            return 0x02;
+        }
+        case node::TxoState::ConfirmedNew: {
+
+            return 0x04;
+        }
+        default: {
+
+            return 0x00;
+        }
+    }
+}
+
 auto OutputCache::Populate() const noexcept -> void
 {
     const_cast<OutputCache*>(this)->populate();
@@ -715,6 +908,7 @@ auto OutputCache::populate() noexcept -> void
 
     OT_ASSERT(outputs_.size() == outputCount);
 
+    recount_totals();
     populated_ = true;
 }
 
@@ -882,6 +1076,45 @@ auto OutputCache::Print() const noexcept -> void
     log.Flush();
 }
 
+auto OutputCache::recount_totals() noexcept -> void
+{
+    wallet_totals_ = {};
+    account_totals_.clear();
+    key_totals_.clear();
+    nym_totals_.clear();
+    subchain_totals_.clear();
+    contributions_.clear();
+    contributions_.reserve(outputs_.size());
+
+    for (const auto& [id, set] : accounts_) {
+        auto& totals = load_totals(id, account_totals_);
+
+        for (const auto& outpoint : set) { join_scope(outpoint, totals); }
+    }
+
+    for (const auto& [id, set] : keys_) {
+        auto& totals = load_totals(id, key_totals_);
+
+        for (const auto& outpoint : set) { join_scope(outpoint, totals); }
+    }
+
+    for (const auto& [id, set] : nyms_) {
+        auto& totals = load_totals(id, nym_totals_);
+
+        for (const auto& outpoint : set) { join_scope(outpoint, totals); }
+    }
+
+    for (const auto& [id, set] : subchains_) {
+        auto& totals = load_totals(id, subchain_totals_);
+
+        for (const auto& outpoint : set) { join_scope(outpoint, totals); }
+    }
+
+    for (const auto& [state, set] : states_) {
+        for (const auto& outpoint : set) { join_state(outpoint, state); }
+    }
+}
+
 auto OutputCache::UpdateOutput(
     const block::Outpoint& id,
     const bitcoin::block::Output& output,
@@ -924,6 +1157,8 @@ auto OutputCache::write_output(
     MDB_txn* tx) noexcept -> bool
 {
     try {
+        contribution(id).value_ = output.Value();
+
         for (const auto& key : output.Keys()) {
             const auto sKey = serialize(key);
             auto rc =
@@ -944,7 +1179,10 @@ auto OutputCache::write_output(
 
                 return out;
             }();
-            cache.emplace(id);
+
+            if (cache.emplace(id).second) {
+                join_scope(id, load_totals(key, key_totals_));
+            }
         }
 
         const auto serialized = [&] {
@@ -12,6 +12,7 @@
 #include <robin_hood.h>
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <optional>
 
@@ -27,6 +28,7 @@
 #include "opentxs/blockchain/crypto/Types.hpp"
 #include "opentxs/blockchain/node/TxoState.hpp"
 #include "opentxs/blockchain/node/Types.hpp"
+#include "opentxs/core/Amount.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/util/Bytes.hpp"
@@ -102,9 +104,12 @@ public:
     auto Exists(const SubchainID& subchain, const block::Outpoint& id)
         const noexcept -> bool;
     auto GetAccount(const AccountID& id) const noexcept -> const Outpoints&;
+    auto GetAccountBalance(const AccountID& id) const noexcept -> Balance;
     auto GetKey(const crypto::Key& id) const noexcept -> const Outpoints&;
+    auto GetKeyBalance(const crypto::Key& id) const noexcept -> Balance;
     auto GetHeight() const noexcept -> block::Height;
     auto GetNym(const identifier::Nym& id) const noexcept -> const Outpoints&;
+    auto GetNymBalance(const identifier::Nym& id) const noexcept -> Balance;
     auto GetNyms() const noexcept -> const Nyms&;
     auto GetOutput(const block::Outpoint& id) const noexcept(false)
         -> const bitcoin::block::internal::Output&;
@@ -113,6 +118,8 @@ public:
         -> const Outpoints&;
     auto GetState(const node::TxoState id) const noexcept -> const Outpoints&;
     auto GetSubchain(const SubchainID& id) const noexcept -> const Outpoints&;
+    auto GetSubchainBalance(const SubchainID& id) const noexcept -> Balance;
+    auto GetWalletBalance() const noexcept -> Balance;
     auto Populate() const noexcept -> void;
     auto Print() const noexcept -> void;
 
@@ -184,9 +191,23 @@ public:
     ~OutputCache();
 
 private:
+    // NOTE running totals of the output states which contribute to a balance
+    struct Totals {
+        Amount confirmed_new_{};
+        Amount unconfirmed_new_{};
+        Amount unconfirmed_spend_{};
+    };
+    // NOTE the scopes and balance relevant states an output is counted in
+    struct Contribution {
+        Amount value_{};
+        std::uint32_t states_{};
+        UnallocatedVector<Totals*> scopes_{};
+    };
+
     static constexpr std::size_t reserve_{10000u};
     static const Outpoints empty_outputs_;
     static const Nyms empty_nyms_;
+    static const Totals empty_totals_;
 
     const api::Session& api_;
     const storage::lmdb::LMDB& lmdb_;
@@ -204,21 +225,49 @@ private:
     robin_hood::unordered_node_map<block::Position, Outpoints> positions_;
     robin_hood::unordered_node_map<node::TxoState, Outpoints> states_;
     robin_hood::unordered_node_map<OTIdentifier, Outpoints> subchains_;
+    Totals wallet_totals_;
+    robin_hood::unordered_node_map<OTIdentifier, Totals> account_totals_;
+    robin_hood::unordered_node_map<crypto::Key, Totals> key_totals_;
+    robin_hood::unordered_node_map<OTNymID, Totals> nym_totals_;
+    robin_hood::unordered_node_map<OTIdentifier, Totals> subchain_totals_;
+    robin_hood::unordered_node_map<block::Outpoint, Contribution>
+        contributions_;
     bool populated_;
 
+    static auto apply(
+        const std::uint32_t states,
+        const Amount& value,
+        const bool add,
+        Totals& totals) noexcept -> void;
+    static auto balance(const Totals& totals) noexcept -> Balance;
+    static auto mask(const node::TxoState state) noexcept -> std::uint32_t;
+
     auto get_position() const noexcept -> const db::Position&;
     auto load_output(const block::Outpoint& id) const noexcept(false)
         -> const bitcoin::block::internal::Output&;
     template <typename MapKeyType, typename MapType>
     auto load_output_index(const MapKeyType& key, MapType& map) const noexcept
         -> const Outpoints&;
+    template <typename MapKeyType, typename MapType>
+    auto load_totals(const MapKeyType& key, const MapType& map) const noexcept
+        -> const Totals&;
 
+    auto contribution(const block::Outpoint& id) noexcept -> Contribution&;
+    auto join_scope(const block::Outpoint& id, Totals& scope) noexcept
+        -> void;
+    auto join_state(const block::Outpoint& id, const node::TxoState state)
+        noexcept -> void;
+    auto leave_state(const block::Outpoint& id, const node::TxoState state)
+        noexcept -> void;
     auto load_output(const block::Outpoint& id) noexcept(false)
         -> bitcoin::block::internal::Output&;
     template <typename MapKeyType, typename MapType>
     auto load_output_index(const MapKeyType& key, MapType& map) noexcept
         -> Outpoints&;
+    template <typename MapKeyType, typename MapType>
+    auto load_totals(const MapKeyType& key, MapType& map) noexcept -> Totals&;
     auto populate() noexcept -> void;
+    auto recount_totals() noexcept -> void;
     auto write_output(
         const block::Outpoint& id,
         const bitcoin::block::Output& output,
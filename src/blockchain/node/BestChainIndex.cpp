@@ -0,0 +1,152 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                        // IWYU pragma: associated
+#include "1_Internal.hpp"                      // IWYU pragma: associated
+#include "blockchain/node/BestChainIndex.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include "internal/blockchain/database/Header.hpp"
+#include "internal/util/P0330.hpp"
+#include "opentxs/core/FixedByteArray.hpp"
+
+namespace opentxs::blockchain::node
+{
+auto BestChainIndex::Snapshot::Contains(
+    const block::Height height,
+    const block::Hash& hash) const noexcept -> bool
+{
+    if (const auto* best = Hash(height); nullptr != best) {
+
+        return hash == *best;
+    } else {
+
+        return false;
+    }
+}
+
+auto BestChainIndex::Snapshot::Hash(const block::Height height) const noexcept
+    -> const block::Hash*
+{
+    if ((0 > height) || (static_cast<std::size_t>(height) >= size_)) {
+
+        return nullptr;
+    }
+
+    const auto index = static_cast<std::size_t>(height);
+
+    return &(chunks_[index / chunk_size_]->at(index % chunk_size_));
+}
+
+auto BestChainIndex::Snapshot::Hashes(
+    const block::Height start,
+    const block::Hash& stop,
+    const std::size_t limit,
+    alloc::Resource* alloc) const noexcept -> Vector<block::Hash>
+{
+    auto output = Vector<block::Hash>{alloc};
+    const auto first =
+        static_cast<std::size_t>(std::max<block::Height>(start, 0));
+
+    if (first >= size_) { return output; }
+
+    const auto available = size_ - first;
+    const auto count = (0_uz == limit) ? available : std::min(limit, available);
+    output.reserve(count);
+    const auto checkStop = (false == stop.IsNull());
+
+    for (auto n = first, end = first + count; n < end; ++n) {
+        const auto& hash = chunks_[n / chunk_size_]->at(n % chunk_size_);
+        output.emplace_back(hash);
+
+        if (checkStop && (stop == hash)) { break; }
+    }
+
+    return output;
+}
+
+auto BestChainIndex::Snapshot::Tip() const noexcept -> block::Position
+{
+    if (0_uz == size_) { return {}; }
+
+    const auto height = static_cast<block::Height>(size_ - 1_uz);
+
+    return {height, *Hash(height)};
+}
+}  // namespace opentxs::blockchain::node
+
+namespace opentxs::blockchain::node
+{
+BestChainIndex::BestChainIndex(const database::Header& database) noexcept
+    : database_(database)
+    , snapshot_(std::make_shared<const Snapshot>())
+{
+    Update(0);
+}
+
+auto BestChainIndex::Get() const noexcept -> SnapshotPointer
+{
+    return std::atomic_load(&snapshot_);
+}
+
+auto BestChainIndex::Update(const block::Height start) noexcept -> void
+{
+    using Chunk = Snapshot::Chunk;
+    const auto current = Get();
+    auto next = std::make_shared<Snapshot>();
+    const auto from = std::min(
+        static_cast<std::size_t>(std::max<block::Height>(start, 0)),
+        current->size_);
+    const auto unchanged = from / chunk_size_;
+    auto& chunks = next->chunks_;
+    chunks.reserve(current->chunks_.size() + 1_uz);
+    std::copy(
+        current->chunks_.begin(),
+        std::next(
+            current->chunks_.begin(), static_cast<std::ptrdiff_t>(unchanged)),
+        std::back_inserter(chunks));
+    auto chunk = std::make_shared<Chunk>();
+    chunk->reserve(chunk_size_);
+
+    if (unchanged < current->chunks_.size()) {
+        const auto& old = *current->chunks_[unchanged];
+        const auto keep = from - (unchanged * chunk_size_);
+        std::copy(
+            old.begin(),
+            std::next(old.begin(), static_cast<std::ptrdiff_t>(keep)),
+            std::back_inserter(*chunk));
+    }
+
+    next->size_ = from;
+    auto height = static_cast<block::Height>(from);
+
+    while (true) {
+        const auto count = chunk_size_ - chunk->size();
+        auto hashes = database_.BestBlocks(height, count, alloc::System());
+        height += static_cast<block::Height>(hashes.size());
+        next->size_ += hashes.size();
+        std::move(hashes.begin(), hashes.end(), std::back_inserter(*chunk));
+
+        if (chunk->size() == chunk_size_) {
+            chunks.emplace_back(std::move(chunk));
+            chunk = std::make_shared<Chunk>();
+            chunk->reserve(chunk_size_);
+        }
+
+        if (hashes.size() < count) { break; }
+    }
+
+    if (false == chunk->empty()) { chunks.emplace_back(std::move(chunk)); }
+
+    std::atomic_store(&snapshot_, SnapshotPointer{std::move(next)});
+}
+
+BestChainIndex::~BestChainIndex() = default;
+}  // namespace opentxs::blockchain::node
@@ -0,0 +1,99 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/block/Position.hpp"
+#include "opentxs/blockchain/block/Types.hpp"
+#include "opentxs/util/Allocator.hpp"
+#include "opentxs/util/Container.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace blockchain
+{
+namespace database
+{
+class Header;
+}  // namespace database
+}  // namespace blockchain
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::blockchain::node
+{
+/// In-memory copy of the best chain indexed by height
+///
+/// Readers obtain an immutable snapshot and never wait for the header oracle
+/// lock. The writer builds a new version after every header update and
+/// publishes it atomically. Hashes are stored in fixed size chunks which are
+/// shared between versions so an update only copies the chunks at or above
+/// the lowest modified height.
+class BestChainIndex
+{
+public:
+    class Snapshot
+    {
+    public:
+        auto Contains(const block::Height height, const block::Hash& hash)
+            const noexcept -> bool;
+        auto Contains(const block::Position& position) const noexcept -> bool
+        {
+            return Contains(position.height_, position.hash_);
+        }
+        /// Returns nullptr if height is not in the best chain
+        auto Hash(const block::Height height) const noexcept
+            -> const block::Hash*;
+        /// Returns consecutive hashes beginning at start. A limit of zero
+        /// returns every hash up to the tip. If stop is not null the output
+        /// ends with the first hash equal to stop.
+        auto Hashes(
+            const block::Height start,
+            const block::Hash& stop,
+            const std::size_t limit,
+            alloc::Resource* alloc) const noexcept -> Vector<block::Hash>;
+        auto Tip() const noexcept -> block::Position;
+
+    private:
+        friend BestChainIndex;
+
+        using Chunk = UnallocatedVector<block::Hash>;
+        using Chunks = UnallocatedVector<std::shared_ptr<const Chunk>>;
+
+        Chunks chunks_{};
+        std::size_t size_{};
+    };
+
+    using SnapshotPointer = std::shared_ptr<const Snapshot>;
+
+    auto Get() const noexcept -> SnapshotPointer;
+
+    /// Writer only. Reloads every height from start through the current tip.
+    auto Update(const block::Height start) noexcept -> void;
+
+    BestChainIndex(const database::Header& database) noexcept;
+    BestChainIndex() = delete;
+    BestChainIndex(const BestChainIndex&) = delete;
+    BestChainIndex(BestChainIndex&&) = delete;
+    auto operator=(const BestChainIndex&) -> BestChainIndex& = delete;
+    auto operator=(BestChainIndex&&) -> BestChainIndex& = delete;
+
+    ~BestChainIndex();
+
+private:
+    static constexpr auto chunk_size_ = std::size_t{4096};
+
+    const database::Header& database_;
+    SnapshotPointer snapshot_;
+};
+}  // namespace opentxs::blockchain::node
@@ -61,9 +61,9 @@ HeaderOracle::HeaderOracle(
     , database_(database)
     , chain_(type)
     , lock_()
+    , best_(database_)
 {
-    auto lock = Lock{lock_};
-    const auto best = best_chain(lock);
+    const auto best = best_.Get()->Tip();
 
     OT_ASSERT(0 <= best.height_);
 }
@@ -73,16 +73,15 @@ auto HeaderOracle::Ancestors(
     const block::Position& target,
     const std::size_t limit) const noexcept(false) -> Positions
 {
-    auto lock = Lock{lock_};
+    const auto best = best_.Get();
     const auto check =
         std::max<block::Height>(std::min(start.height_, target.height_), 0);
-    const auto fast = is_in_best_chain(lock, target.hash_).first &&
-                      is_in_best_chain(lock, start.hash_).first &&
+    const auto fast = is_in_best_chain(*best, target.hash_).first &&
+                      is_in_best_chain(*best, start.hash_).first &&
                       (start.height_ < target.height_);
 
     if (fast) {
-        auto output = best_chain(lock, start, limit);
-        lock.unlock();
+        auto output = best_chain(*best, start, limit);
 
         while ((1 < output.size()) &&
                (output.back().height_ > target.height_)) {
@@ -166,7 +165,7 @@ auto HeaderOracle::AddCheckpoint(
 
     if (apply_checkpoint(lock, position, update)) {
 
-        return database_.ApplyUpdate(update);
+        return apply_update(lock, update);
     } else {
 
         return false;
@@ -187,15 +186,39 @@ auto HeaderOracle::AddHeaders(
 {
     if (0 == headers.size()) { return false; }
 
-    auto lock = Lock{lock_};
-    auto update = UpdateTransaction{api_, database_};
-
-    for (auto& header : headers) {
+    // NOTE hashes and proof of work were verified when the headers were
+    // instantiated so only the connection step must hold the lock
+    for (const auto& header : headers) {
         if (false == bool(header)) {
             LogError()(OT_PRETTY_CLASS())("Invalid header").Flush();
 
             return false;
         }
+    }
+
+    auto lock = Lock{lock_};
+    auto update = UpdateTransaction{api_, database_};
+    auto index = 0_uz;
+
+    // NOTE consecutive batches usually overlap
+    while ((index < headers.size()) &&
+           update.EffectiveHeaderExists(headers[index]->Hash())) {
+        ++index;
+    }
+
+    const auto extended = extend_best_chain(lock, update, headers, index);
+    index += extended;
+
+    if (0_uz < extended) {
+        LogVerbose()(OT_PRETTY_CLASS())("Extended best chain by ")(
+            extended)(" headers")
+            .Flush();
+    }
+
+    for (; index < headers.size(); ++index) {
+        auto& header = headers[index];
+
+        if (false == bool(header)) { continue; }
 
         if (false == add_header(lock, update, std::move(header))) {
 
@@ -203,7 +226,7 @@ auto HeaderOracle::AddHeaders(
         }
     }
 
-    return database_.ApplyUpdate(update);
+    return apply_update(lock, update);
 }
 
 auto HeaderOracle::add_header(
@@ -309,43 +332,56 @@ auto HeaderOracle::apply_checkpoint(
     }
 }
 
-auto HeaderOracle::best_chain(const Lock& lock) const noexcept
-    -> block::Position
+auto HeaderOracle::apply_update(const Lock&, UpdateTransaction& update) noexcept
+    -> bool
 {
-    return database_.CurrentBest()->Position();
+    if (false == database_.ApplyUpdate(update)) { return false; }
+
+    // NOTE only heights above the reorg parent or the lowest newly added
+    // block need to be reloaded
+    const auto start = [&] {
+        auto out = best_.Get()->Tip().height_ + 1;
+
+        if (update.HaveReorg()) {
+            out = std::min(out, update.ReorgParent().height_ + 1);
+        }
+
+        if (const auto& added = update.BestChain(); false == added.empty()) {
+            out = std::min(out, added.begin()->first);
+        }
+
+        return out;
+    }();
+    best_.Update(start);
+
+    return true;
 }
 
 auto HeaderOracle::BestChain() const noexcept -> block::Position
 {
-    auto lock = Lock{lock_};
-
-    return best_chain(lock);
+    return best_.Get()->Tip();
 }
 
 auto HeaderOracle::BestChain(
     const block::Position& tip,
     const std::size_t limit) const noexcept(false) -> Positions
 {
-    auto lock = Lock{lock_};
-
-    return best_chain(lock, tip, limit);
+    return best_chain(*best_.Get(), tip, limit);
 }
 
 auto HeaderOracle::best_chain(
-    const Lock& lock,
+    const Snapshot& best,
     const block::Position& tip,
     const std::size_t limit) const noexcept -> Positions
 {
-    const auto [youngest, best] = common_parent(lock, tip);
-    static const auto blank = block::Hash{};
+    const auto [youngest, current] = common_parent(best, tip);
     auto height = std::max<block::Height>(youngest.height_, 0);
     auto output = Positions{};
 
     // TODO allocator
-    for (auto& hash : best_hashes(lock, height, blank, 0, alloc::System())) {
+    for (auto& hash :
+         best.Hashes(height, blank_hash(), limit, alloc::System())) {
         output.emplace_back(height++, std::move(hash));
-
-        if ((0u < limit) && (output.size() == limit)) { break; }
     }
 
     OT_ASSERT(0 < output.size());
@@ -356,17 +392,17 @@ auto HeaderOracle::best_chain(
 auto HeaderOracle::BestHash(const block::Height height) const noexcept
     -> block::Hash
 {
-    auto lock = Lock{lock_};
-
-    return best_hash(lock, height);
+    return best_hash(*best_.Get(), height);
 }
 
-auto HeaderOracle::best_hash(const Lock& lock, const block::Height height)
+auto HeaderOracle::best_hash(const Snapshot& best, const block::Height height)
     const noexcept -> block::Hash
 {
-    try {
-        return database_.BestBlock(height);
-    } catch (...) {
+    if (const auto* hash = best.Hash(height); nullptr != hash) {
+
+        return *hash;
+    } else {
+
         return blank_hash();
     }
 }
@@ -375,11 +411,11 @@ auto HeaderOracle::BestHash(
     const block::Height height,
     const block::Position& check) const noexcept -> block::Hash
 {
-    auto lock = Lock{lock_};
+    const auto best = best_.Get();
 
-    if (is_in_best_chain(lock, check)) {
+    if (best->Contains(check)) {
 
-        return database_.BestBlock(height);
+        return best_hash(*best, height);
     } else {
 
         return blank_hash();
@@ -391,11 +427,7 @@ auto HeaderOracle::BestHashes(
     const std::size_t limit,
     alloc::Resource* alloc) const noexcept -> Hashes
 {
-    static const auto blank = block::Hash{};
-
-    auto lock = Lock{lock_};
-
-    return best_hashes(lock, start, blank, limit, alloc);
+    return best_.Get()->Hashes(start, blank_hash(), limit, alloc);
 }
 
 auto HeaderOracle::BestHashes(
@@ -404,9 +436,7 @@ auto HeaderOracle::BestHashes(
     const std::size_t limit,
     alloc::Resource* alloc) const noexcept -> Hashes
 {
-    auto lock = Lock{lock_};
-
-    return best_hashes(lock, start, stop, limit, alloc);
+    return best_.Get()->Hashes(start, stop, limit, alloc);
 }
 
 auto HeaderOracle::BestHashes(
@@ -415,59 +445,19 @@ auto HeaderOracle::BestHashes(
     const std::size_t limit,
     alloc::Resource* alloc) const noexcept -> Hashes
 {
-    auto lock = Lock{lock_};
-    auto start = 0_uz;
+    const auto best = best_.Get();
+    auto start = block::Height{0};
 
     for (const auto& hash : previous) {
-        const auto [best, height] = is_in_best_chain(lock, hash);
+        const auto [found, height] = is_in_best_chain(*best, hash);
 
-        if (best) {
+        if (found) {
             start = height;
             break;
         }
     }
 
-    return best_hashes(lock, start, stop, limit, alloc);
-}
-
-auto HeaderOracle::best_hashes(
-    const Lock& lock,
-    const block::Height start,
-    const block::Hash& stop,
-    const std::size_t limit,
-    alloc::Resource* alloc) const noexcept -> Hashes
-{
-    auto output = Hashes{alloc};
-    const auto limitIsZero = (0 == limit);
-    auto current{start};
-    const auto tip = best_chain(lock);
-    const auto last = [&] {
-        if (limitIsZero) {
-
-            return tip.height_;
-        } else {
-            const auto requestedEnd = block::Height{
-                current + static_cast<block::Height>(limit) -
-                static_cast<block::Height>(1)};
-
-            return std::min<block::Height>(requestedEnd, tip.height_);
-        }
-    }();
-
-    while (current <= last) {
-        auto hash = database_.BestBlock(current++);
-
-        // TODO this check shouldn't be necessary but BestBlock doesn't
-        // throw the exception documented in its declaration.
-        if (hash.IsNull()) { break; }
-
-        const auto stopHere = stop.IsNull() ? false : (stop == hash);
-        output.emplace_back(std::move(hash));
-
-        if (stopHere) { break; }
-    }
-
-    return output;
+    return best->Hashes(start, stop, limit, alloc);
 }
 
 auto HeaderOracle::blank_hash() const noexcept -> const block::Hash&
@@ -489,17 +479,16 @@ auto HeaderOracle::blank_position() const noexcept -> const block::Position&
 auto HeaderOracle::CalculateReorg(const block::Position& tip) const
     noexcept(false) -> Positions
 {
-    auto lock = Lock{lock_};
-
-    return calculate_reorg(lock, tip);
+    return calculate_reorg(*best_.Get(), tip);
 }
 
-auto HeaderOracle::calculate_reorg(const Lock& lock, const block::Position& tip)
-    const noexcept(false) -> Positions
+auto HeaderOracle::calculate_reorg(
+    const Snapshot& best,
+    const block::Position& tip) const noexcept(false) -> Positions
 {
     auto output = Positions{};
 
-    if (is_in_best_chain(lock, tip)) { return output; }
+    if (best.Contains(tip)) { return output; }
 
     output.emplace_back(tip);
 
@@ -524,7 +513,7 @@ auto HeaderOracle::calculate_reorg(const Lock& lock, const block::Position& tip)
 
         auto parent = block::Position{height - 1, header.ParentHash()};
 
-        if (is_in_best_chain(lock, parent)) { break; }
+        if (best.Contains(parent)) { break; }
 
         output.emplace_back(std::move(parent));
     }
@@ -617,27 +606,25 @@ auto HeaderOracle::choose_candidate(
 auto HeaderOracle::CommonParent(const block::Position& position) const noexcept
     -> std::pair<block::Position, block::Position>
 {
-    auto lock = Lock{lock_};
-
-    return common_parent(lock, position);
+    return common_parent(*best_.Get(), position);
 }
 
 auto HeaderOracle::common_parent(
-    const Lock& lock,
+    const Snapshot& best,
     const block::Position& position) const noexcept
     -> std::pair<block::Position, block::Position>
 {
     const auto& database = database_;
     std::pair<block::Position, block::Position> output{
-        {0, GenesisBlockHash(chain_)}, best_chain(lock)};
-    auto& [parent, best] = output;
+        {0, GenesisBlockHash(chain_)}, best.Tip()};
+    auto& [parent, tip] = output;
     auto test{position};
     auto pHeader = database.TryLoadHeader(test.hash_);
 
     if (false == bool(pHeader)) { return output; }
 
     while (0 < test.height_) {
-        if (is_in_best_chain(lock, test.hash_).first) {
+        if (is_in_best_chain(best, test.hash_).first) {
             parent = test;
 
             return output;
@@ -722,7 +709,7 @@ auto HeaderOracle::DeleteCheckpoint() noexcept -> bool
 
     if (apply_checkpoint(lock, position, update)) {
 
-        return database_.ApplyUpdate(update);
+        return apply_update(lock, update);
     } else {
 
         return false;
@@ -736,6 +723,45 @@ auto HeaderOracle::evaluate_candidate(
     return candidate.Work() > current.Work();
 }
 
+auto HeaderOracle::extend_best_chain(
+    const Lock& lock,
+    UpdateTransaction& update,
+    UnallocatedVector<std::unique_ptr<block::Header>>& headers,
+    std::size_t index) noexcept -> std::size_t
+{
+    // NOTE during initial sync nearly every batch extends the best chain.
+    // Such headers can be connected directly without building candidates.
+    // Anything which might create a fork, connect orphans, or be affected by
+    // the checkpoint is left for add_header.
+    const auto checkpoint = update.Checkpoint().height_;
+    const block::Header* parent = &update.Stage();
+    auto output = 0_uz;
+
+    for (; index < headers.size(); ++index, ++output) {
+        const auto& header = *headers[index];
+        const auto& hash = header.Hash();
+
+        if (header.ParentHash() != parent->Hash()) { break; }
+
+        if ((parent->Height() + 1) == checkpoint) { break; }
+
+        if (update.EffectiveHeaderExists(hash)) { break; }
+
+        if (update.EffectiveHasDisconnectedChildren(hash)) { break; }
+
+        auto& child = update.Stage(std::move(headers[index]));
+        const auto blacklisted =
+            connect_to_parent(lock, update, *parent, child);
+
+        OT_ASSERT(false == blacklisted);
+
+        update.ExtendBestChain(child.Position());
+        parent = &child;
+    }
+
+    return output;
+}
+
 auto HeaderOracle::GetDefaultCheckpoint() const noexcept -> CheckpointData
 {
     const auto& checkpoint = params::Chains().at(chain_).checkpoint_;
@@ -778,22 +804,19 @@ auto HeaderOracle::GetCheckpoint() const noexcept -> block::Position
 auto HeaderOracle::GetPosition(const block::Height height) const noexcept
     -> block::Position
 {
-    auto lock = Lock{lock_};
-
-    return get_position(lock, height);
+    return get_position(*best_.Get(), height);
 }
 
-auto HeaderOracle::get_position(const Lock& lock, const block::Height height)
-    const noexcept -> block::Position
+auto HeaderOracle::get_position(
+    const Snapshot& best,
+    const block::Height height) const noexcept -> block::Position
 {
-    auto hash = best_hash(lock, height);
+    if (const auto* hash = best.Hash(height); nullptr != hash) {
 
-    if (hash == blank_hash()) {
-
-        return blank_position();
+        return {height, *hash};
     } else {
 
-        return {height, std::move(hash)};
+        return blank_position();
     }
 }
 
@@ -877,17 +900,13 @@ auto HeaderOracle::initialize_candidate(
 
 auto HeaderOracle::IsInBestChain(const block::Hash& hash) const noexcept -> bool
 {
-    auto lock = Lock{lock_};
-
-    return is_in_best_chain(lock, hash).first;
+    return is_in_best_chain(*best_.Get(), hash).first;
 }
 
 auto HeaderOracle::IsInBestChain(const block::Position& position) const noexcept
     -> bool
 {
-    auto lock = Lock{lock_};
-
-    return is_in_best_chain(lock, position.height_, position.hash_);
+    return best_.Get()->Contains(position);
 }
 
 auto HeaderOracle::is_disconnected(
@@ -910,37 +929,17 @@ auto HeaderOracle::is_disconnected(
     }
 }
 
-auto HeaderOracle::is_in_best_chain(const Lock& lock, const block::Hash& hash)
-    const noexcept -> std::pair<bool, block::Height>
+auto HeaderOracle::is_in_best_chain(
+    const Snapshot& best,
+    const block::Hash& hash) const noexcept -> std::pair<bool, block::Height>
 {
     const auto pHeader = database_.TryLoadHeader(hash);
 
     if (false == bool(pHeader)) { return {false, -1}; }
 
-    const auto& header = *pHeader;
+    const auto height = pHeader->Height();
 
-    return {is_in_best_chain(lock, header.Height(), hash), header.Height()};
-}
-
-auto HeaderOracle::is_in_best_chain(
-    const Lock& lock,
-    const block::Position& position) const noexcept -> bool
-{
-    return is_in_best_chain(lock, position.height_, position.hash_);
-}
-
-auto HeaderOracle::is_in_best_chain(
-    const Lock& lock,
-    const block::Height height,
-    const block::Hash& hash) const noexcept -> bool
-{
-    try {
-        return hash == database_.BestBlock(height);
-
-    } catch (...) {
-
-        return false;
-    }
+    return {best.Contains(height, hash), height};
 }
 
 auto HeaderOracle::LoadBitcoinHeader(const block::Hash& hash) const noexcept
@@ -971,6 +970,7 @@ auto HeaderOracle::ProcessSyncData(
         }
 
         auto lock = Lock{lock_};
+        const auto best = best_.Get();
         auto previous = [&]() -> block::Hash {
             const auto& first = blocks.front();
             const auto height = first.Height();
@@ -979,7 +979,7 @@ auto HeaderOracle::ProcessSyncData(
 
                 return block::Hash{};
             } else {
-                const auto rc = prior.Assign(database_.BestBlock(height - 1));
+                const auto rc = prior.Assign(best_hash(*best, height - 1));
 
                 OT_ASSERT(rc);
 
@@ -1003,7 +1003,7 @@ auto HeaderOracle::ProcessSyncData(
 
             auto hash = block::Hash{header.Hash()};
 
-            if (false == is_in_best_chain(lock, hash).first) {
+            if (false == is_in_best_chain(*best, hash).first) {
                 if (false == add_header(lock, update, std::move(pHeader))) {
                     throw std::runtime_error{"Failed to process header"};
                 }
@@ -1017,7 +1017,7 @@ auto HeaderOracle::ProcessSyncData(
         LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
     }
 
-    if ((0u < output) && database_.ApplyUpdate(update)) {
+    if ((0u < output) && apply_update(Lock{lock_}, update)) {
         OT_ASSERT(output == hashes.size());
 
         return output;
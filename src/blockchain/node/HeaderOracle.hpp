@@ -13,6 +13,7 @@
 #include <tuple>
 #include <utility>
 
+#include "blockchain/node/BestChainIndex.hpp"
 #include "internal/blockchain/node/HeaderOracle.hpp"
 #include "internal/util/Mutex.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
@@ -111,10 +112,10 @@ public:
         alloc::Resource* alloc) const noexcept -> Hashes final;
     auto CalculateReorg(const block::Position& tip) const noexcept(false)
         -> Positions final;
-    auto CalculateReorg(const Lock& lock, const block::Position& tip) const
+    auto CalculateReorg(const Lock&, const block::Position& tip) const
         noexcept(false) -> Positions final
     {
-        return calculate_reorg(lock, tip);
+        return calculate_reorg(*best_.Get(), tip);
     }
     auto CommonParent(const block::Position& position) const noexcept
         -> std::pair<block::Position, block::Position> final;
@@ -123,10 +124,10 @@ public:
     auto GetMutex() const noexcept -> std::mutex& final { return lock_; }
     auto GetPosition(const block::Height height) const noexcept
         -> block::Position final;
-    auto GetPosition(const Lock& lock, const block::Height height)
-        const noexcept -> block::Position final
+    auto GetPosition(const Lock&, const block::Height height) const noexcept
+        -> block::Position final
     {
-        return get_position(lock, height);
+        return get_position(*best_.Get(), height);
     }
     auto Internal() const noexcept -> const internal::HeaderOracle& final
     {
@@ -176,50 +177,41 @@ private:
     };
 
     using Candidates = UnallocatedVector<Candidate>;
+    using Snapshot = BestChainIndex::Snapshot;
 
     const api::Session& api_;
     database::Header& database_;
     const blockchain::Type chain_;
     mutable std::mutex lock_;
+    BestChainIndex best_;
 
     static auto evaluate_candidate(
         const block::Header& current,
         const block::Header& candidate) noexcept -> bool;
 
-    auto best_chain(const Lock& lock) const noexcept -> block::Position;
     auto best_chain(
-        const Lock& lock,
+        const Snapshot& best,
         const block::Position& tip,
         const std::size_t limit) const noexcept -> Positions;
-    auto best_hash(const Lock& lock, const block::Height height) const noexcept
-        -> block::Hash;
-    auto best_hashes(
-        const Lock& lock,
-        const block::Height start,
-        const block::Hash& stop,
-        const std::size_t limit,
-        alloc::Resource* alloc) const noexcept -> Hashes;
+    auto best_hash(const Snapshot& best, const block::Height height)
+        const noexcept -> block::Hash;
     auto blank_hash() const noexcept -> const block::Hash&;
     auto blank_position() const noexcept -> const block::Position&;
-    auto calculate_reorg(const Lock& lock, const block::Position& tip) const
-        noexcept(false) -> Positions;
-    auto common_parent(const Lock& lock, const block::Position& position)
+    auto calculate_reorg(const Snapshot& best, const block::Position& tip)
+        const noexcept(false) -> Positions;
+    auto common_parent(const Snapshot& best, const block::Position& position)
         const noexcept -> std::pair<block::Position, block::Position>;
-    auto get_position(const Lock& lock, const block::Height height)
+    auto get_position(const Snapshot& best, const block::Height height)
         const noexcept -> block::Position;
-    auto is_in_best_chain(const Lock& lock, const block::Hash& hash)
+    auto is_in_best_chain(const Snapshot& best, const block::Hash& hash)
         const noexcept -> std::pair<bool, block::Height>;
-    auto is_in_best_chain(const Lock& lock, const block::Position& position)
-        const noexcept -> bool;
-    auto is_in_best_chain(
-        const Lock& lock,
-        const block::Height height,
-        const block::Hash& hash) const noexcept -> bool;
 
     auto add_header(
         const Lock& lock,
         UpdateTransaction& update,
         std::unique_ptr<block::Header> header) noexcept -> bool;
+    auto apply_update(const Lock& lock, UpdateTransaction& update) noexcept
+        -> bool;
     auto apply_checkpoint(
         const Lock& lock,
         const block::Height height,
@@ -240,6 +232,13 @@ private:
         const UpdateTransaction& update,
         const block::Header& parent,
         block::Header& child) noexcept -> bool;
+    // Returns the number of headers, beginning at the specified index, which
+    // were connected as a linear extension of the best chain
+    auto extend_best_chain(
+        const Lock& lock,
+        UpdateTransaction& update,
+        UnallocatedVector<std::unique_ptr<block::Header>>& headers,
+        std::size_t index) noexcept -> std::size_t;
     auto initialize_candidate(
         const Lock& lock,
         const block::Header& best,
@@ -54,6 +54,24 @@ struct Mempool::Imp {
             return {};
         }
     }
+    auto Snapshot() const noexcept
+        -> UnallocatedVector<std::shared_ptr<const bitcoin::block::Transaction>>
+    {
+        auto output = UnallocatedVector<
+            std::shared_ptr<const bitcoin::block::Transaction>>{};
+        auto lock = sLock{lock_};
+        output.reserve(active_.size());
+
+        for (const auto& txid : active_) {
+            const auto it = transactions_.find(txid);
+
+            if ((transactions_.end() != it) && it->second) {
+                output.emplace_back(it->second);
+            }
+        }
+
+        return output;
+    }
     auto Submit(ReadView txid) const noexcept -> bool
     {
         const auto input = UnallocatedVector<ReadView>{txid};
@@ -246,6 +264,12 @@ auto Mempool::Query(ReadView txid) const noexcept
     return imp_->Query(txid);
 }
 
+auto Mempool::Snapshot() const noexcept
+    -> UnallocatedVector<std::shared_ptr<const bitcoin::block::Transaction>>
+{
+    return imp_->Snapshot();
+}
+
 auto Mempool::Submit(ReadView txid) const noexcept -> bool
 {
     return imp_->Submit(txid);
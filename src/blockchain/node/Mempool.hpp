@@ -70,6 +70,8 @@ public:
     auto Dump() const noexcept -> UnallocatedSet<UnallocatedCString> final;
     auto Query(ReadView txid) const noexcept
         -> std::shared_ptr<const bitcoin::block::Transaction> final;
+    auto Snapshot() const noexcept -> UnallocatedVector<
+        std::shared_ptr<const bitcoin::block::Transaction>> final;
     auto Submit(ReadView txid) const noexcept -> bool final;
     auto Submit(const UnallocatedVector<ReadView>& txids) const noexcept
         -> UnallocatedVector<bool> final;
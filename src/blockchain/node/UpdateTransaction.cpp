@@ -163,6 +163,12 @@ auto UpdateTransaction::EffectiveHeaderExists(
     return db_.HeaderExists(hash);
 }
 
+auto UpdateTransaction::ExtendBestChain(const block::Position& position)
+    -> void
+{
+    best_.emplace(std::make_pair(position.height_, position.hash_));
+}
+
 auto UpdateTransaction::Header(const block::Hash& hash) noexcept(false)
     -> block::Header&
 {
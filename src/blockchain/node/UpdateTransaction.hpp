@@ -91,6 +91,10 @@ public:
     void ClearCheckpoint();
     void ConnectBlock(database::ChainSegment&& segment);
     void DisconnectBlock(const block::Header& header);
+    // Adds a newly staged header to the best chain. Unlike AddToBestChain
+    // this does not check the sibling list since a new header can not be in
+    // it.
+    void ExtendBestChain(const block::Position& position);
     // throws std::out_of_range if header does not exist
     auto Header(const block::Hash& hash) noexcept(false) -> block::Header&;
     void RemoveSibling(const block::Hash& hash);
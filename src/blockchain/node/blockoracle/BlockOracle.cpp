@@ -15,10 +15,13 @@
 
 #include "blockchain/node/blockoracle/BlockBatch.hpp"
 #include "blockchain/node/blockoracle/BlockDownloader.hpp"
+#include "internal/api/network/Blockchain.hpp"
 #include "internal/blockchain/node/Config.hpp"
 #include "internal/blockchain/node/Factory.hpp"
 #include "internal/network/zeromq/Context.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
+#include "opentxs/api/network/Blockchain.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/Types.hpp"
@@ -27,10 +30,13 @@
 #include "opentxs/network/zeromq/ZeroMQ.hpp"
 #include "opentxs/network/zeromq/message/FrameSection.hpp"
 #include "opentxs/network/zeromq/message/Message.hpp"
+#include "opentxs/network/zeromq/message/Message.tpp"
+#include "opentxs/network/zeromq/socket/SocketType.hpp"
 #include "opentxs/util/Allocator.hpp"
 #include "opentxs/util/BlockchainProfile.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
+#include "opentxs/util/Options.hpp"
 #include "opentxs/util/WorkType.hpp"
 #include "util/ScopeGuard.hpp"
 #include "util/Work.hpp"
@@ -156,7 +162,20 @@ BlockOracle::Imp::Imp(
             }
         }
     }())
-    , cache_(api, node, config, db, chain, alloc)
+    , chain_(chain)
+    , mem_(api.GetOptions().BlockchainBlockCacheBytes(), alloc)
+    , block_available_([&] {
+        using Type = opentxs::network::zeromq::socket::Type;
+        auto out = api.Network().ZeroMQ().Internal().RawSocket(Type::Push);
+        const auto endpoint = UnallocatedCString{
+            api.Network().Blockchain().Internal().BlockAvailableEndpoint()};
+        const auto rc = out.Connect(endpoint.c_str());
+
+        OT_ASSERT(rc);
+
+        return out;
+    }())
+    , cache_(api, node, config, db, mem_, chain, alloc)
 {
     OT_ASSERT(validator_);
 }
@@ -229,22 +248,44 @@ auto BlockOracle::Imp::Heartbeat() const noexcept -> void
 {
     trigger();
 
+    const auto& log = LogTrace();
+    auto shard = 0_uz;
+
+    for (const auto& stats : mem_.GetStats()) {
+        log(OT_PRETTY_CLASS())(name_)(" block cache shard ")(shard++)(": ")(
+            stats.hits_)(" hits, ")(stats.misses_)(" misses, ")(
+            stats.evictions_)(" evictions, ")(stats.entries_)(" entries (")(
+            stats.pinned_)(" pinned), ")(stats.bytes_)(" of ")(
+            stats.budget_)(" bytes")
+            .Flush();
+    }
+
     if (block_downloader_) { block_downloader_->Heartbeat(); }
 }
 
 auto BlockOracle::Imp::LoadBitcoin(const block::Hash& block) const noexcept
     -> BitcoinBlockResult
 {
-    auto output = cache_.lock()->Request(block);
-    trigger();
+    auto output = LoadBitcoin(Vector<block::Hash>{block});
 
-    return output;
+    OT_ASSERT(1 == output.size());
+
+    return output.at(0);
 }
 
 auto BlockOracle::Imp::LoadBitcoin(
     const Vector<block::Hash>& hashes) const noexcept -> BitcoinBlockResults
 {
-    auto output = cache_.lock()->Request(hashes);
+    auto output = BitcoinBlockResults{};
+
+    // NOTE requests which are satisfied entirely from memory do not need the
+    // cache lock
+    if (mem_.find(hashes, output)) {
+        publish(hashes);
+    } else {
+        output = cache_.lock()->Request(hashes);
+    }
+
     trigger();
 
     OT_ASSERT(hashes.size() == output.size());
@@ -292,6 +333,23 @@ auto BlockOracle::Imp::pipeline(const Work work, Message&& msg) noexcept -> void
     }
 }
 
+auto BlockOracle::Imp::publish(const Vector<block::Hash>& hashes) const noexcept
+    -> void
+{
+    auto handle = block_available_.lock();
+
+    for (const auto& hash : hashes) {
+        handle->SendDeferred([&] {
+            auto work = network::zeromq::tagged_message(
+                WorkType::BlockchainBlockAvailable);
+            work.AddFrame(chain_);
+            work.AddFrame(hash);
+
+            return work;
+        }());
+    }
+}
+
 auto BlockOracle::Imp::StartDownloader() noexcept -> void
 {
     pipeline_.Push(MakeWork(Work::start_downloader));
@@ -325,6 +383,12 @@ BlockOracle::BlockOracle(boost::shared_ptr<Imp>&& imp) noexcept
     imp_->Init(imp_);
 }
 
+auto BlockOracle::CacheStats() const noexcept
+    -> Vector<blockoracle::MemDB::Stats>
+{
+    return imp_->CacheStats();
+}
+
 auto BlockOracle::DownloadQueue() const noexcept -> std::size_t
 {
     return imp_->DownloadQueue();
@@ -8,6 +8,7 @@
 #include <boost/container/flat_map.hpp>
 #include <boost/container/vector.hpp>
 #include <boost/smart_ptr/shared_ptr.hpp>
+#include <cs_plain_guarded.h>
 #include <cs_shared_guarded.h>
 #include <chrono>
 #include <cstddef>
@@ -23,6 +24,7 @@
 #include <utility>
 
 #include "blockchain/node/blockoracle/Cache.hpp"
+#include "blockchain/node/blockoracle/MemDB.hpp"
 #include "core/Worker.hpp"
 #include "internal/blockchain/block/Validator.hpp"
 #include "internal/blockchain/database/Block.hpp"
@@ -30,6 +32,7 @@
 #include "internal/blockchain/node/BlockOracle.hpp"
 #include "internal/blockchain/node/Types.hpp"
 #include "internal/network/zeromq/Types.hpp"
+#include "internal/network/zeromq/socket/Raw.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/blockchain/Types.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
@@ -111,6 +114,10 @@ namespace opentxs::blockchain::node::internal
 class BlockOracle::Imp final : public Actor<Imp, BlockOracleJobs>
 {
 public:
+    auto CacheStats() const noexcept -> Vector<blockoracle::MemDB::Stats>
+    {
+        return mem_.GetStats();
+    }
     auto DownloadQueue() const noexcept -> std::size_t
     {
         return cache_.lock_shared()->DownloadQueue();
@@ -163,6 +170,8 @@ private:
     using Task = BlockOracleJobs;
     using Cache =
         libguarded::shared_guarded<blockoracle::Cache, std::shared_mutex>;
+    using Socket =
+        libguarded::plain_guarded<opentxs::network::zeromq::socket::Raw>;
 
     const api::Session& api_;
     const internal::Manager& node_;
@@ -170,6 +179,9 @@ private:
     const CString submit_endpoint_;
     const std::unique_ptr<const block::Validator> validator_;
     const std::unique_ptr<blockoracle::BlockDownloader> block_downloader_;
+    const blockchain::Type chain_;
+    mutable blockoracle::MemDB mem_;
+    mutable Socket block_available_;
     mutable Cache cache_;
 
     static auto get_validator(
@@ -177,6 +189,8 @@ private:
         const node::HeaderOracle& headers) noexcept
         -> std::unique_ptr<const block::Validator>;
 
+    auto publish(const Vector<block::Hash>& hashes) const noexcept -> void;
+
     auto do_shutdown() noexcept -> void;
     auto do_startup() noexcept -> void;
     auto pipeline(const Work work, Message&& msg) noexcept -> void;
@@ -43,11 +43,9 @@
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/WorkType.hpp"
-#include "util/ByteLiterals.hpp"
 
 namespace opentxs::blockchain::node::blockoracle
 {
-const std::size_t Cache::cache_limit_{8_MiB};
 const std::chrono::seconds Cache::download_timeout_{60};
 
 Cache::Cache(
@@ -55,6 +53,7 @@ Cache::Cache(
     const internal::Manager& node,
     const internal::Config& config,
     database::Block& db,
+    MemDB& mem,
     const blockchain::Type chain,
     allocator_type alloc) noexcept
     : api_(api)
@@ -105,7 +104,7 @@ Cache::Cache(
     , batch_index_(alloc)
     , hash_index_(alloc)
     , hash_cache_(alloc)
-    , mem_(cache_limit_, alloc)
+    , mem_(mem)
     , peer_target_(std::nullopt)
     , running_(true)
 {
@@ -368,7 +367,7 @@ auto Cache::Request(const Vector<block::Hash>& hashes) noexcept
         const auto start = Clock::now();
         auto found{false};
 
-        if (auto future = mem_.find(block.Bytes()); future.valid()) {
+        if (auto future = mem_.find(block); future.valid()) {
             output.emplace_back(std::move(future));
             ready.emplace_back(&block);
             found = true;
@@ -411,8 +410,9 @@ auto Cache::Request(const Vector<block::Hash>& hashes) noexcept
 
             auto promise = Promise{};
             promise.set_value(std::move(pBlock));
-            mem_.push(block::Hash{block}, promise.get_future());
-            output.emplace_back(mem_.find(block.Bytes()));
+            auto future = BitcoinBlockResult{promise.get_future()};
+            mem_.push(block::Hash{block}, BitcoinBlockResult{future});
+            output.emplace_back(std::move(future));
             ready.emplace_back(&block);
             found = true;
         }
@@ -109,6 +109,7 @@ public:
         const internal::Manager& node,
         const internal::Config& config,
         database::Block& db,
+        MemDB& mem,
         const blockchain::Type chain,
         allocator_type alloc) noexcept;
 
@@ -123,7 +124,6 @@ private:
     using HashIndex = Map<block::Hash, BatchID>;
     using HashCache = Set<block::Hash>;
 
-    static const std::size_t cache_limit_;
     static const std::chrono::seconds download_timeout_;
 
     const api::Session& api_;
@@ -138,7 +138,7 @@ private:
     BatchIndex batch_index_;
     HashIndex hash_index_;
     HashCache hash_cache_;
-    MemDB mem_;
+    MemDB& mem_;
     std::optional<std::size_t> peer_target_;
     bool running_;
 
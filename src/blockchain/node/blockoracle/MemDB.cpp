@@ -7,60 +7,216 @@
 #include "1_Internal.hpp"                         // IWYU pragma: associated
 #include "blockchain/node/blockoracle/MemDB.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
+#include <cstring>
 #include <future>
-#include <memory>
+#include <iterator>
 
 #include "internal/blockchain/block/Block.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/blockchain/bitcoin/block/Block.hpp"
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Log.hpp"
+#include "util/ByteLiterals.hpp"
 
 namespace opentxs::blockchain::node::blockoracle
 {
-MemDB::MemDB(const std::size_t limit, allocator_type alloc) noexcept
-    : limit_(limit)
-    , bytes_(0)
-    , queue_(alloc)
+MemDB::Shard::Shard(allocator_type alloc) noexcept
+    : lock_()
     , index_(alloc)
+    , clock_(alloc)
+    , hand_(0)
+    , bytes_(0)
+    , hits_(0)
+    , misses_(0)
+    , evictions_(0)
 {
 }
+}  // namespace opentxs::blockchain::node::blockoracle
+
+namespace opentxs::blockchain::node::blockoracle
+{
+const std::size_t MemDB::default_budget_{8_MiB};
+
+MemDB::MemDB(const std::size_t limit, allocator_type alloc) noexcept
+    : alloc_(alloc)
+    , budget_((0_uz < limit) ? limit : default_budget_)
+    , shard_budget_(budget_ / shard_count(budget_))
+    , shards_(alloc)
+{
+    const auto count = shard_count(budget_);
+    shards_.reserve(count);
+
+    for (auto n = 0_uz; n < count; ++n) {
+        shards_.emplace_back(std::make_unique<Shard>(alloc));
+    }
+}
 
 auto MemDB::clear() noexcept -> void
 {
-    index_.clear();
-    queue_.clear();
-    bytes_ = 0;
+    for (auto& pShard : shards_) {
+        auto& shard = *pShard;
+        auto lock = std::lock_guard<std::mutex>{shard.lock_};
+        shard.clock_.clear();
+        shard.index_.clear();
+        shard.hand_ = 0;
+        shard.bytes_ = 0;
+    }
 }
 
-auto MemDB::find(const ReadView id) const noexcept -> BitcoinBlockResult
+auto MemDB::evict(
+    const std::lock_guard<std::mutex>&,
+    Shard& shard,
+    const Index::iterator& keep) noexcept -> void
 {
-    if (false == valid(id)) {
+    auto& clock = shard.clock_;
+    // NOTE every entry is visited at most twice: once to clear its reference
+    // bit and once more to evict it. If that is not enough to get under budget
+    // then everything left is pinned.
+    auto remaining = 2_uz * clock.size();
+
+    while ((shard.bytes_ > shard_budget_) && (0_uz < remaining)) {
+        --remaining;
+
+        if (shard.hand_ >= clock.size()) { shard.hand_ = 0; }
+
+        auto i = clock[shard.hand_];
+        auto& entry = i->second;
+
+        if ((keep == i) || in_use(entry)) {
+            ++shard.hand_;
+
+            continue;
+        }
+
+        if (entry.referenced_) {
+            entry.referenced_ = false;
+            ++shard.hand_;
+
+            continue;
+        }
+
+        LogTrace()(OT_PRETTY_CLASS())("evicting block ")(i->first.asHex())(
+            " from cache due to exceeding byte limit")
+            .Flush();
+        shard.bytes_ -= entry.bytes_;
+        ++shard.evictions_;
+        clock.erase(std::next(clock.begin(), shard.hand_));
+        shard.index_.erase(i);
+    }
+}
+
+auto MemDB::find(const block::Hash& id) const noexcept -> BitcoinBlockResult
+{
+    if (id.IsNull()) {
         LogError()(OT_PRETTY_CLASS())("invalid block id").Flush();
 
         return {};
     }
 
-    if (auto i = index_.find(id); index_.end() != i) {
+    auto& shard = get(id);
+    auto lock = std::lock_guard<std::mutex>{shard.lock_};
+
+    if (auto i = shard.index_.find(id); shard.index_.end() != i) {
+        auto& entry = i->second;
+        entry.referenced_ = true;
+        ++shard.hits_;
 
-        return i->second->second;
+        return entry.future_;
     } else {
+        ++shard.misses_;
 
         return {};
     }
 }
 
-auto MemDB::push(block::Hash&& id, BitcoinBlockResult&& future) noexcept -> void
+auto MemDB::find(const Vector<block::Hash>& ids, BitcoinBlockResults& output)
+    const noexcept -> bool
 {
-    if (id.IsNull()) {
-        LogError()(OT_PRETTY_CLASS())("invalid block id").Flush();
+    auto found = BitcoinBlockResults{};
+    found.reserve(ids.size());
 
-        return;
+    for (const auto& id : ids) {
+        auto& shard = get(id);
+        auto lock = std::lock_guard<std::mutex>{shard.lock_};
+
+        if (auto i = shard.index_.find(id); shard.index_.end() != i) {
+            found.emplace_back(i->second.future_);
+        } else {
+
+            return false;
+        }
     }
 
-    if (0u < index_.count(id.Bytes())) {
-        LogError()(OT_PRETTY_CLASS())("block ")(id.asHex())(" already cached")
-            .Flush();
+    for (const auto& id : ids) {
+        auto& shard = get(id);
+        auto lock = std::lock_guard<std::mutex>{shard.lock_};
+
+        if (auto i = shard.index_.find(id); shard.index_.end() != i) {
+            i->second.referenced_ = true;
+        }
+
+        ++shard.hits_;
+    }
+
+    output = std::move(found);
+
+    return true;
+}
+
+auto MemDB::get(const block::Hash& id) const noexcept -> Shard&
+{
+    // NOTE block hashes are uniformly distributed so folding the bytes is
+    // sufficient to spread them across shards
+    const auto bytes = id.Bytes();
+    auto key = std::uint64_t{};
+
+    for (auto n = 0_uz; n < bytes.size(); n += sizeof(key)) {
+        auto word = std::uint64_t{};
+        const auto size = std::min(sizeof(word), bytes.size() - n);
+        std::memcpy(&word, std::next(bytes.data(), n), size);
+        key ^= word;
+    }
+
+    return *shards_[key % shards_.size()];
+}
+
+auto MemDB::GetStats() const noexcept -> Vector<Stats>
+{
+    auto out = Vector<Stats>{alloc_};
+    out.reserve(shards_.size());
+
+    for (const auto& pShard : shards_) {
+        const auto& shard = *pShard;
+        auto lock = std::lock_guard<std::mutex>{shard.lock_};
+        auto& stats = out.emplace_back();
+        stats.hits_ = shard.hits_;
+        stats.misses_ = shard.misses_;
+        stats.evictions_ = shard.evictions_;
+        stats.entries_ = shard.index_.size();
+        stats.pinned_ = static_cast<std::size_t>(std::count_if(
+            shard.index_.begin(), shard.index_.end(), [](const auto& i) {
+                return in_use(i.second);
+            }));
+        stats.bytes_ = shard.bytes_;
+        stats.budget_ = shard_budget_;
+    }
+
+    return out;
+}
+
+auto MemDB::in_use(const Entry& entry) noexcept -> bool
+{
+    // NOTE the shared state of the future holds one reference. Any additional
+    // references belong to jobs which are still working on the block.
+    return 1 < entry.future_.get().use_count();
+}
+
+auto MemDB::push(block::Hash&& id, BitcoinBlockResult&& future) noexcept -> void
+{
+    if (id.IsNull()) {
+        LogError()(OT_PRETTY_CLASS())("invalid block id").Flush();
 
         return;
     }
@@ -71,20 +227,36 @@ auto MemDB::push(block::Hash&& id, BitcoinBlockResult&& future) noexcept -> void
 
     OT_ASSERT(pBlock);
 
-    const auto& block = *pBlock;
-    const auto& item = queue_.emplace_back(std::move(id), std::move(future));
-    bytes_ += block.Internal().CalculateSize();
-    index_.try_emplace(item.first.Bytes(), &item);
+    const auto bytes = pBlock->Internal().CalculateSize();
+    auto& shard = get(id);
+    auto lock = std::lock_guard<std::mutex>{shard.lock_};
+    auto [i, added] = shard.index_.try_emplace(
+        std::move(id), Entry{std::move(future), bytes, false});
 
-    while ((bytes_ > limit_) && (0u < queue_.size())) {
-        const auto& item = queue_.front();
-        const auto& id = item.first;
-        LogTrace()(OT_PRETTY_CLASS())("dropping oldest block ")(id.asHex())(
-            " from cache due to exceeding byte limit")
+    if (false == added) {
+        LogError()(OT_PRETTY_CLASS())("block ")(i->first.asHex())(
+            " already cached")
             .Flush();
-        index_.erase(item.first.Bytes());
-        bytes_ -= item.second.get()->Internal().CalculateSize();
-        queue_.pop_front();
+
+        return;
     }
+
+    shard.clock_.emplace_back(i);
+    shard.bytes_ += bytes;
+    evict(lock, shard, i);
 }
+
+auto MemDB::shard_count(const std::size_t limit) noexcept -> std::size_t
+{
+    // NOTE each shard should be able to hold several full size blocks
+    static constexpr auto min_shard_bytes = std::size_t{4_MiB};
+    const auto target = std::clamp(limit / min_shard_bytes, 1_uz, max_shards_);
+    auto out = 1_uz;
+
+    while ((out * 2_uz) <= target) { out *= 2_uz; }
+
+    return out;
+}
+
+MemDB::~MemDB() = default;
 }  // namespace opentxs::blockchain::node::blockoracle
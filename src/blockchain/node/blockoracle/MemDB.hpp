@@ -5,19 +5,16 @@
 
 #pragma once
 
-#include <boost/container/flat_map.hpp>
-#include <boost/container/vector.hpp>
 #include <cstddef>
-#include <functional>
-#include <string_view>
-#include <tuple>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <utility>
 
 #include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/blockchain/block/Types.hpp"
 #include "opentxs/blockchain/node/Types.hpp"
 #include "opentxs/util/Allocated.hpp"
-#include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -27,14 +24,6 @@ namespace opentxs  // NOLINT
 // {
 namespace blockchain
 {
-namespace bitcoin
-{
-namespace block
-{
-class Block;
-}  // namespace block
-}  // namespace bitcoin
-
 namespace block
 {
 class Hash;
@@ -46,28 +35,95 @@ class Hash;
 
 namespace opentxs::blockchain::node::blockoracle
 {
+/// Byte-budgeted in-memory block cache
+///
+/// The cache is split into independently locked shards selected by block
+/// hash so concurrent lookups from wallet subchains do not contend with each
+/// other or with the download queue. Each shard evicts with the CLOCK
+/// algorithm: a lookup marks an entry as referenced and the eviction hand
+/// gives referenced entries a second chance.
+///
+/// Blocks which are still referenced outside the cache, for example by a
+/// scan or process job which has not finished, are pinned and never evicted
+/// since dropping them would release no memory and only force a reload from
+/// storage the next time they are requested.
 class MemDB final : public Allocated
 {
 public:
-    auto find(const ReadView id) const noexcept -> BitcoinBlockResult;
+    struct Stats {
+        std::uint64_t hits_{};
+        std::uint64_t misses_{};
+        std::uint64_t evictions_{};
+        std::size_t entries_{};
+        std::size_t pinned_{};
+        std::size_t bytes_{};
+        std::size_t budget_{};
+    };
+
+    /// Returns an invalid future if the block is not cached
+    auto find(const block::Hash& id) const noexcept -> BitcoinBlockResult;
+    /// Succeeds only if every block is cached, otherwise output is unchanged
+    /// and no statistics are recorded
+    auto find(const Vector<block::Hash>& ids, BitcoinBlockResults& output)
+        const noexcept -> bool;
     auto get_allocator() const noexcept -> allocator_type final
     {
-        return queue_.get_allocator();
+        return alloc_;
     }
+    auto GetStats() const noexcept -> Vector<Stats>;
 
     auto clear() noexcept -> void;
     auto push(block::Hash&& id, BitcoinBlockResult&& future) noexcept -> void;
 
+    /// A limit of zero selects the default budget
     MemDB(const std::size_t limit, allocator_type alloc) noexcept;
+    MemDB() = delete;
+    MemDB(const MemDB&) = delete;
+    MemDB(MemDB&&) = delete;
+    auto operator=(const MemDB&) -> MemDB& = delete;
+    auto operator=(MemDB&&) -> MemDB& = delete;
+
+    ~MemDB() final;
 
 private:
-    using CachedBlock = std::pair<block::Hash, BitcoinBlockResult>;
-    using Completed = Deque<CachedBlock>;
-    using Index = Map<ReadView, const CachedBlock*>;
-
-    const std::size_t limit_;
-    std::size_t bytes_;
-    Completed queue_;
-    Index index_;
+    struct Entry {
+        BitcoinBlockResult future_{};
+        std::size_t bytes_{};
+        bool referenced_{};
+    };
+
+    using Index = Map<block::Hash, Entry>;
+    using Clock = Vector<Index::iterator>;
+
+    struct Shard {
+        mutable std::mutex lock_;
+        Index index_;
+        Clock clock_;
+        std::size_t hand_;
+        std::size_t bytes_;
+        mutable std::uint64_t hits_;
+        mutable std::uint64_t misses_;
+        std::uint64_t evictions_;
+
+        Shard(allocator_type alloc) noexcept;
+    };
+
+    static constexpr auto max_shards_ = std::size_t{16};
+    static const std::size_t default_budget_;
+
+    allocator_type alloc_;
+    const std::size_t budget_;
+    const std::size_t shard_budget_;
+    Vector<std::unique_ptr<Shard>> shards_;
+
+    static auto in_use(const Entry& entry) noexcept -> bool;
+    static auto shard_count(const std::size_t limit) noexcept -> std::size_t;
+
+    auto get(const block::Hash& id) const noexcept -> Shard&;
+
+    auto evict(
+        const std::lock_guard<std::mutex>&,
+        Shard& shard,
+        const Index::iterator& keep) noexcept -> void;
 };
 }  // namespace opentxs::blockchain::node::blockoracle
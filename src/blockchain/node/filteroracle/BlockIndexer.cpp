@@ -17,10 +17,14 @@
 #include <memory>
 #include <mutex>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
+#include "internal/api/network/Asio.hpp"
 #include "internal/api/session/Endpoints.hpp"
+#include "internal/blockchain/Blockchain.hpp"
+#include "internal/blockchain/block/Block.hpp"
 #include "internal/blockchain/database/Cfilter.hpp"
 #include "internal/blockchain/node/Types.hpp"
 #include "internal/blockchain/node/filteroracle/FilterOracle.hpp"
@@ -29,6 +33,8 @@
 #include "internal/network/zeromq/Types.hpp"
 #include "internal/util/Future.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
+#include "opentxs/api/network/Asio.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Endpoints.hpp"
 #include "opentxs/api/session/Session.hpp"
@@ -57,6 +63,7 @@
 #include "opentxs/util/Allocator.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
+#include "opentxs/util/Time.hpp"
 #include "opentxs/util/Types.hpp"
 #include "opentxs/util/WorkType.hpp"
 #include "util/ScopeGuard.hpp"
@@ -64,6 +71,24 @@
 
 namespace opentxs::blockchain::node::filteroracle
 {
+auto IndexerStats::Stage::Add(
+    std::size_t blocks,
+    std::chrono::nanoseconds time) noexcept -> void
+{
+    blocks_ += blocks;
+    time_ += time;
+}
+
+auto IndexerStats::Stage::Rate() const noexcept -> double
+{
+    using Seconds = std::chrono::duration<double>;
+    const auto seconds = std::chrono::duration_cast<Seconds>(time_).count();
+
+    if (0.0 >= seconds) { return 0.0; }
+
+    return static_cast<double>(blocks_) / seconds;
+}
+
 auto print(BlockIndexerJob job) noexcept -> std::string_view
 {
     try {
@@ -136,78 +161,119 @@ BlockIndexer::Imp::Imp(
     , current_header_()
     , best_position_(block::Position{})
     , current_position_(block::Position{})
+    , job_count_(std::max(std::thread::hardware_concurrency(), 2u) - 1u)
+    , job_counter_()
+    , stats_()
 {
 }
 
-auto BlockIndexer::Imp::calculate_next_block() noexcept -> bool
+auto BlockIndexer::Imp::calculate_filters(
+    const Vector<BlockData>& blocks,
+    Vector<database::Cfilter::CFilterParams>& filters,
+    Vector<cfilter::Hash>& hashes) noexcept -> bool
 {
-    OT_ASSERT(0 <= current_position_.height_);
-
-    const auto& blockOracle = node_.BlockOracle();
-    const auto& headerOracle = node_.HeaderOracle();
-    auto position = headerOracle.GetPosition(current_position_.height_ + 1);
-    const auto& [height, hash] = position;
-
-    if (hash.empty()) {
-        log_(OT_PRETTY_CLASS())(name_)(": block hash not found for height ")(
-            height)
-            .Flush();
-
-        return true;
-    }
-
-    auto future = blockOracle.LoadBitcoin(hash);
-
-    if (false == IsReady(future)) {
-        log_(OT_PRETTY_CLASS())(name_)(": block ")
-            .asHex(hash)(" not yet downloaded")
-            .Flush();
-
-        return true;
-    }
-
-    const auto pBlock = future.get();
-
-    if (false == bool(pBlock)) {
-        // NOTE the only time the future should contain an uninitialized pointer
-        // is if the block oracle is shutting down
-        log_(OT_PRETTY_CLASS())(name_)(": block ")
-            .asHex(hash)(" unavailable")
-            .Flush();
+    const auto count = blocks.size();
+    filters.resize(count);
+    hashes.resize(count);
+    const auto job = [&](const std::size_t n, const std::size_t jobs) {
+        for (auto i = n; i < count; i += jobs) {
+            const auto& [position, pBlock] = blocks.at(i);
+            auto& [id, cfilter] = filters.at(i);
+            id = position.hash_;
+            // NOTE the actor allocator is not shared with the thread pool
+            cfilter =
+                parent_.Internal().ProcessBlock(filter_type_, *pBlock, {});
+
+            if (cfilter.IsValid()) { hashes.at(i) = cfilter.Hash(); }
+        }
+    };
+    const auto jobs = std::min(job_count_, count);
+
+    if (1u < jobs) {
+        auto counter = job_counter_.Allocate();
+
+        for (auto n = 0_uz; n < jobs; ++n) {
+            const auto posted = api_.Network().Asio().Internal().Post(
+                ThreadPool::General,
+                [&,
+                 n,
+                 post = std::make_shared<ScopeGuard>(
+                     [&counter] { ++counter; }, [&counter] { --counter; })] {
+                    job(n, jobs);
+                },
+                "BlockIndexer cfilter");
+
+            if (false == posted) {
+                log_(OT_PRETTY_CLASS())(name_)(
+                    ": failed to queue cfilter job, calculating inline")
+                    .Flush();
+                job(n, jobs);
+            }
+        }
 
-        return false;
+        counter.wait_for_finished();
+    } else {
+        job(0u, 1u);
     }
 
-    const auto& block = *pBlock;
-
-    OT_ASSERT(block.ID() == hash);
-
-    if (block.Header().ParentHash() != current_position_.hash_) {
-        log_(OT_PRETTY_CLASS())(name_)(": block ")
-            .asHex(hash)(" is not connected to current tip")
-            .Flush();
-        process_reorg(headerOracle.CommonParent(position).first);
+    for (auto i = 0_uz; i < count; ++i) {
+        if (false == filters.at(i).second.IsValid()) {
+            log_(OT_PRETTY_CLASS())(name_)(": failed to calculate gcs for ")(
+                blocks.at(i).first)
+                .Flush();
 
-        return true;
+            return false;
+        }
     }
 
-    auto alloc = get_allocator();
-    auto filters = Vector<database::Cfilter::CFilterParams>{alloc};
-    auto headers = Vector<database::Cfilter::CFHeaderParams>{alloc};
-    const auto& [ignore1, cfilter] = filters.emplace_back(
-        hash, parent_.Internal().ProcessBlock(filter_type_, block, alloc));
+    return true;
+}
 
-    if (false == cfilter.IsValid()) {
-        log_(OT_PRETTY_CLASS())(name_)(": failed to calculate gcs for ")(
-            position)
-            .Flush();
+auto BlockIndexer::Imp::calculate_next_batch() noexcept -> bool
+{
+    OT_ASSERT(0 <= current_position_.height_);
 
-        OT_FAIL;
+    auto start = Clock::now();
+    const auto elapsed = [&] {
+        const auto now = Clock::now();
+        const auto out =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now - start);
+        start = now;
+
+        return out;
+    };
+    auto blocks = Vector<BlockData>{};
+
+    if (false == load_blocks(blocks)) { return false; }
+
+    if (blocks.empty()) { return true; }
+
+    const auto count = blocks.size();
+    stats_.lock()->load_.Add(count, elapsed());
+    auto filters = Vector<database::Cfilter::CFilterParams>{};
+    auto hashes = Vector<cfilter::Hash>{};
+
+    // NOTE a job can be dropped by the thread pool during shutdown, in which
+    // case the batch is abandoned and calculated again on the next attempt
+    if (false == calculate_filters(blocks, filters, hashes)) { return false; }
+
+    stats_.lock()->cfilter_.Add(count, elapsed());
+    auto headers = Vector<database::Cfilter::CFHeaderParams>{};
+    headers.reserve(count);
+    auto previous = current_header_;
+    auto current = current_header_;
+
+    for (auto i = 0_uz; i < count; ++i) {
+        const auto& hash = hashes.at(i);
+        previous = std::move(current);
+        current = blockchain::internal::FilterHashToHeader(
+            api_, hash.Bytes(), previous.Bytes());
+        headers.emplace_back(blocks.at(i).first.hash_, current, hash);
     }
 
-    auto& [ignore2, cfheader, cfhash] = headers.emplace_back(
-        hash, cfilter.Header(current_header_), cfilter.Hash());
-    const auto rc = db_.StoreFilters(filter_type_, headers, filters, position);
+    stats_.lock()->cfheader_.Add(count, elapsed());
+    const auto& tip = blocks.back().first;
+    const auto rc = db_.StoreFilters(filter_type_, headers, filters, tip);
 
     if (false == rc) {
         log_(OT_PRETTY_CLASS())(name_)(": failed to update database").Flush();
@@ -215,10 +281,17 @@ auto BlockIndexer::Imp::calculate_next_block() noexcept -> bool
         OT_FAIL;
     }
 
-    previous_header_ = std::move(current_header_);
-    current_header_ = std::move(cfheader);
-    current_position_ = std::move(position);
+    {
+        auto handle = stats_.lock();
+        handle->store_.Add(count, elapsed());
+        ++handle->batches_;
+    }
+
+    previous_header_ = std::move(previous);
+    current_header_ = std::move(current);
+    current_position_ = tip;
     notify_(filter_type_, current_position_);
+    log_stats(count);
 
     return current_position_ != best_position_;
 }
@@ -304,6 +377,104 @@ auto BlockIndexer::Imp::find_best_position(block::Position candidate) noexcept
     }
 }
 
+auto BlockIndexer::Imp::load_blocks(Vector<BlockData>& out) noexcept -> bool
+{
+    const auto& headerOracle = node_.HeaderOracle();
+    auto parent = current_position_.hash_;
+    auto height = current_position_.height_;
+    auto bytes = 0_uz;
+
+    // NOTE blocks are requested from the block oracle a few at a time so a
+    // batch never holds more than one chunk beyond the byte limit
+    while ((out.size() < batch_size_) && (bytes < batch_bytes_)) {
+        const auto start = height + 1;
+        const auto remaining = std::max<block::Height>(
+            best_position_.height_ - height, out.empty() ? 1 : 0);
+
+        if (0 == remaining) { break; }
+
+        const auto limit = std::min(
+            {load_chunk_,
+             batch_size_ - out.size(),
+             static_cast<std::size_t>(remaining)});
+        const auto hashes = headerOracle.BestHashes(start, limit);
+
+        if (hashes.empty()) {
+            log_(OT_PRETTY_CLASS())(name_)(
+                ": block hash not found for height ")(start)
+                .Flush();
+
+            break;
+        }
+
+        const auto futures = node_.BlockOracle().LoadBitcoin(hashes);
+
+        OT_ASSERT(futures.size() == hashes.size());
+
+        for (auto i = 0_uz; i < hashes.size(); ++i) {
+            const auto& hash = hashes.at(i);
+            const auto& future = futures.at(i);
+
+            if (false == IsReady(future)) {
+                log_(OT_PRETTY_CLASS())(name_)(": block ")
+                    .asHex(hash)(" not yet downloaded")
+                    .Flush();
+
+                return true;
+            }
+
+            auto pBlock = future.get();
+
+            if (false == bool(pBlock)) {
+                // NOTE the only time the future should contain an
+                // uninitialized pointer is if the block oracle is shutting down
+                log_(OT_PRETTY_CLASS())(name_)(": block ")
+                    .asHex(hash)(" unavailable")
+                    .Flush();
+
+                return false == out.empty();
+            }
+
+            OT_ASSERT(pBlock->ID() == hash);
+
+            auto position = block::Position{height + 1, hash};
+
+            if (pBlock->Header().ParentHash() != parent) {
+                log_(OT_PRETTY_CLASS())(name_)(": block ")
+                    .asHex(hash)(" is not connected to current tip")
+                    .Flush();
+
+                // NOTE the blocks which were already accepted are indexed and
+                // the reorg is handled on the next pass
+                if (out.empty()) {
+                    process_reorg(headerOracle.CommonParent(position).first);
+                }
+
+                return true;
+            }
+
+            bytes += pBlock->Internal().CalculateSize();
+            parent = hash;
+            ++height;
+            out.emplace_back(std::move(position), std::move(pBlock));
+
+            if (bytes >= batch_bytes_) { break; }
+        }
+    }
+
+    return true;
+}
+
+auto BlockIndexer::Imp::log_stats(std::size_t blocks) const noexcept -> void
+{
+    const auto stats = Stats();
+    log_(OT_PRETTY_CLASS())(name_)(": indexed ")(blocks)(
+        " blocks. Blocks per second by stage: load: ")(stats.load_.Rate())(
+        ", cfilter: ")(stats.cfilter_.Rate())(", cfheader: ")(
+        stats.cfheader_.Rate())(", store: ")(stats.store_.Rate())
+        .Flush();
+}
+
 auto BlockIndexer::Imp::Init(boost::shared_ptr<Imp> me) noexcept -> void
 {
     signal_startup(me);
@@ -437,6 +608,11 @@ auto BlockIndexer::Imp::state_normal(const Work work, Message&& msg) noexcept
     }
 }
 
+auto BlockIndexer::Imp::Stats() const noexcept -> IndexerStats
+{
+    return *stats_.lock();
+}
+
 auto BlockIndexer::Imp::transition_state_shutdown() noexcept -> void
 {
     state_ = State::shutdown;
@@ -472,7 +648,7 @@ auto BlockIndexer::Imp::work() noexcept -> bool
 {
     if (current_position_ == best_position_) { return false; }
 
-    return calculate_next_block();
+    return calculate_next_batch();
 }
 
 BlockIndexer::Imp::~Imp() = default;
@@ -516,5 +692,10 @@ auto BlockIndexer::Reindex() noexcept -> void { imp_->Reindex(); }
 
 auto BlockIndexer::Start() noexcept -> void { imp_->Init(imp_); }
 
+auto BlockIndexer::Stats() const noexcept -> IndexerStats
+{
+    return imp_->Stats();
+}
+
 BlockIndexer::~BlockIndexer() { imp_->Shutdown(); }
 }  // namespace opentxs::blockchain::node::filteroracle
@@ -8,18 +8,25 @@
 #pragma once
 
 #include <boost/smart_ptr/shared_ptr.hpp>
+#include <cs_plain_guarded.h>
+#include <cstddef>
+#include <memory>
 #include <string_view>
+#include <utility>
 
+#include "internal/blockchain/database/Cfilter.hpp"
 #include "internal/blockchain/node/filteroracle/BlockIndexer.hpp"
 #include "internal/blockchain/node/filteroracle/Types.hpp"
 #include "internal/network/zeromq/Types.hpp"
 #include "opentxs/blockchain/Types.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/Hash.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/Header.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/Types.hpp"
 #include "opentxs/blockchain/block/Position.hpp"
 #include "opentxs/util/Allocated.hpp"
 #include "opentxs/util/Container.hpp"
 #include "util/Actor.hpp"
+#include "util/JobCounter.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -33,15 +40,18 @@ class Session;
 
 namespace blockchain
 {
+namespace bitcoin
+{
 namespace block
 {
-class Position;
+class Block;
 }  // namespace block
+}  // namespace bitcoin
 
-namespace database
+namespace block
 {
-class Cfilter;
-}  // namespace database
+class Position;
+}  // namespace block
 
 namespace node
 {
@@ -67,6 +77,8 @@ class BlockIndexer::Imp final : public Actor<Imp, BlockIndexerJob>
 {
 public:
     auto Init(boost::shared_ptr<Imp> me) noexcept -> void;
+    auto Stats() const noexcept -> IndexerStats;
+
     auto Reindex() noexcept -> void;
     auto Shutdown() noexcept -> void;
 
@@ -96,6 +108,17 @@ private:
         shutdown,
     };
 
+    using BlockData = std::pair<
+        block::Position,
+        std::shared_ptr<const bitcoin::block::Block>>;
+
+    static constexpr auto batch_size_ = std::size_t{500};
+    // NOTE deserialized blocks occupy several times their serialized size so
+    // a batch is closed once the serialized size of its blocks reaches this
+    // limit, regardless of how many blocks it contains
+    static constexpr auto batch_bytes_ = std::size_t{32} * 1024u * 1024u;
+    static constexpr auto load_chunk_ = std::size_t{16};
+
     const api::Session& api_;
     const node::Manager& node_;
     const node::FilterOracle& parent_;
@@ -108,11 +131,20 @@ private:
     cfilter::Header current_header_;
     block::Position best_position_;
     block::Position current_position_;
-
-    auto calculate_next_block() noexcept -> bool;
+    const std::size_t job_count_;
+    JobCounter job_counter_;
+    mutable libguarded::plain_guarded<IndexerStats> stats_;
+
+    auto calculate_filters(
+        const Vector<BlockData>& blocks,
+        Vector<database::Cfilter::CFilterParams>& filters,
+        Vector<cfilter::Hash>& hashes) noexcept -> bool;
+    auto calculate_next_batch() noexcept -> bool;
     auto do_shutdown() noexcept -> void;
     auto do_startup() noexcept -> void;
     auto find_best_position(block::Position candidate) noexcept -> void;
+    auto load_blocks(Vector<BlockData>& out) noexcept -> bool;
+    auto log_stats(std::size_t blocks) const noexcept -> void;
     auto pipeline(const Work work, Message&& msg) noexcept -> void;
     auto process_block(network::zeromq::Message&& in) noexcept -> void;
     auto process_block(block::Position&& position) noexcept -> void;
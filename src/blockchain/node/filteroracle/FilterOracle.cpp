@@ -380,6 +380,20 @@ auto FilterOracle::Heartbeat() const noexcept -> void
     }
 }
 
+auto FilterOracle::IndexerStats() const noexcept
+    -> filteroracle::IndexerStats
+{
+    auto lock = rLock{lock_};
+
+    if (block_indexer_) {
+
+        return block_indexer_->Stats();
+    } else {
+
+        return {};
+    }
+}
+
 auto FilterOracle::LoadFilter(
     const cfilter::Type type,
     const block::Hash& block,
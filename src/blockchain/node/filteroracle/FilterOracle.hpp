@@ -154,6 +154,7 @@ public:
     auto GetFilterJob() const noexcept -> CfilterJob final;
     auto GetHeaderJob() const noexcept -> CfheaderJob final;
     auto Heartbeat() const noexcept -> void final;
+    auto IndexerStats() const noexcept -> filteroracle::IndexerStats final;
     auto LoadFilter(
         const cfilter::Type type,
         const block::Hash& block,
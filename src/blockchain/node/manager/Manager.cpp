@@ -12,13 +12,17 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstddef>
+#include <future>
 #include <iomanip>
 #include <iosfwd>
 #include <iterator>
+#include <memory>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -42,6 +46,7 @@
 #include "internal/core/PaymentCode.hpp"
 #include "internal/identity/Nym.hpp"
 #include "internal/network/p2p/Factory.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/api/crypto/Blockchain.hpp"
 #include "opentxs/api/network/Asio.hpp"
 #include "opentxs/api/network/Blockchain.hpp"
@@ -546,6 +551,24 @@ auto Base::Disconnect() noexcept -> bool
     return false;
 }
 
+auto Base::FeeFilter() const noexcept -> Amount
+{
+    // NOTE the filter only limits which unconfirmed transactions peers
+    // announce. Transactions which pay less than the current estimate may
+    // still confirm eventually, so only a fraction of the estimate is used.
+    static constexpr auto divisor = 4;
+    const auto& fallback = params::Chains().at(chain_).default_fee_rate_;
+    const auto estimate = wallet_.FeeEstimate();
+
+    if (estimate.has_value()) {
+
+        return std::max<Amount>(fallback, estimate.value() / divisor);
+    } else {
+
+        return fallback;
+    }
+}
+
 auto Base::FeeRate() const noexcept -> Amount
 {
     // TODO in full node mode, calculate the fee network from the mempool and
@@ -627,6 +650,55 @@ auto Base::init() noexcept -> void
     reset_heartbeat();
 }
 
+auto Base::instantiate_headers(const UnallocatedVector<ReadView>& payloads)
+    const noexcept -> UnallocatedVector<std::unique_ptr<block::Header>>
+{
+    // NOTE instantiating a header calculates its hash and verifies the proof
+    // of work. Large batches are divided among the general thread pool so
+    // the header oracle only has to connect them.
+    static constexpr auto job_size = std::size_t{250};
+    const auto count = payloads.size();
+    auto output = UnallocatedVector<std::unique_ptr<block::Header>>(count);
+    const auto jobs = std::max<std::size_t>(
+        std::min<std::size_t>(
+            count / job_size,
+            std::max(std::thread::hardware_concurrency(), 2u) - 1u),
+        1u);
+    const auto run = [&](std::size_t job) {
+        const auto first = (count * job) / jobs;
+        const auto last = (count * (job + 1u)) / jobs;
+
+        for (auto i = first; i < last; ++i) {
+            output[i] = instantiate_header(payloads[i]);
+        }
+    };
+    auto futures = UnallocatedVector<std::future<void>>{};
+
+    for (auto job = 1_uz; job < jobs; ++job) {
+        auto promise = std::make_shared<std::promise<void>>();
+        auto future = promise->get_future();
+        const auto posted = api_.Network().Asio().Internal().Post(
+            ThreadPool::General,
+            [job, promise, &run] {
+                run(job);
+                promise->set_value();
+            },
+            "Headers");
+
+        if (posted) {
+            futures.emplace_back(std::move(future));
+        } else {
+            run(job);
+        }
+    }
+
+    run(0_uz);
+
+    for (auto& future : futures) { future.wait(); }
+
+    return output;
+}
+
 auto Base::IsWalletScanEnabled() const noexcept -> bool
 {
     switch (state_.load()) {
@@ -850,11 +922,7 @@ auto Base::process_header(network::zeromq::Message&& in) noexcept -> void
         promise = promiseFrame.as<int>();
     }
 
-    auto headers = UnallocatedVector<std::unique_ptr<block::Header>>{};
-
-    for (const auto& header : input) {
-        headers.emplace_back(instantiate_header(header));
-    }
+    auto headers = instantiate_headers(input);
 
     if (false == headers.empty()) { header_.AddHeaders(headers); }
 
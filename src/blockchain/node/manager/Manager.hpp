@@ -172,6 +172,7 @@ public:
         const bitcoin::block::Transaction& tx,
         const bool pushtx) const noexcept -> bool final;
     auto Chain() const noexcept -> Type final { return chain_; }
+    auto FeeFilter() const noexcept -> Amount final;
     auto FeeRate() const noexcept -> Amount final;
     auto FilterOracleInternal() const noexcept
         -> const node::internal::FilterOracle& final
@@ -393,6 +394,8 @@ private:
 
     virtual auto instantiate_header(const ReadView payload) const noexcept
         -> std::unique_ptr<block::Header> = 0;
+    auto instantiate_headers(const UnallocatedVector<ReadView>& payloads)
+        const noexcept -> UnallocatedVector<std::unique_ptr<block::Header>>;
     auto is_synchronized_blocks() const noexcept -> bool;
     auto is_synchronized_filters() const noexcept -> bool;
     auto is_synchronized_headers() const noexcept -> bool;
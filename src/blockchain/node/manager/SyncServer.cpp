@@ -287,17 +287,18 @@ auto SyncServer::process_zmq(const Lock& lock) noexcept -> void
         const auto& position = state.Position();
         auto [needSync, parent, data] = hello(lock, position);
         const auto& [height, hash] = parent;
-        auto reply = factory::BlockchainSyncData(
+        const auto reply = factory::BlockchainSyncData(
             WorkType::P2PBlockchainSyncReply, std::move(data), {}, {});
-        auto send{true};
+        auto out = network::zeromq::reply_to_message(incoming);
 
-        if (needSync) { send = db_.LoadSync(height, reply); }
+        if (false == reply.Serialize(out)) { return; }
 
-        auto out = network::zeromq::reply_to_message(incoming);
+        // NOTE the sync packets are stored in wire format so they are appended
+        // as frames which reference the mapped storage instead of being
+        // parsed into the reply and serialized again
+        if (needSync && (false == db_.LoadSync(height, out))) { return; }
 
-        if (send && reply.Serialize(out)) {
-            OTSocket::send_message(lock, socket_.get(), std::move(out));
-        }
+        OTSocket::send_message(lock, socket_.get(), std::move(out));
     } catch (const std::exception& e) {
         LogError()(OT_PRETTY_CLASS())(__func__)(": ")(e.what()).Flush();
     }
@@ -207,7 +207,6 @@ public:
     }
 
     PrehashData(
-        const api::Session& api,
         const BlockTargets& targets,
         const std::string_view name,
         wallet::MatchCache::Results& results,
@@ -215,7 +214,6 @@ public:
         std::size_t jobs,
         allocator_type alloc) noexcept
         : job_count_(jobs)
-        , api_(api)
         , targets_(targets)
         , name_(name)
         , data_(alloc)
@@ -258,7 +256,6 @@ private:
         TxoData>;
     using Data = Vector<BlockData>;
 
-    const api::Session& api_;
     const BlockTargets& targets_;
     const std::string_view name_;
     Data data_;
@@ -285,14 +282,10 @@ private:
             blockchain::internal::BlockHashToFilterKey(block.Bytes());
         const auto& [indices, bytes] = targets;
         auto& [hashes, map] = dest;
+        gcs::Siphash(key, bytes, hashes);
         auto i = indices.cbegin();
-        auto t = bytes.cbegin();
-        auto end = indices.cend();
 
-        for (; i < end; ++i, ++t) {
-            auto& hash = hashes.emplace_back(gcs::Siphash(api_, key, *t));
-            map[hash].emplace_back(&(*i));
-        }
+        for (const auto& hash : hashes) { map[hash].emplace_back(&(*i++)); }
 
         dedup(hashes);
     }
@@ -1214,7 +1207,6 @@ auto SubchainStateData::scan(
             select_targets(*handle, blocks, elements, startHeight, selected);
             auto results = wallet::MatchCache::Results{get_allocator()};
             auto prehash = PrehashData{
-                api_,
                 selected,
                 name_,
                 results,
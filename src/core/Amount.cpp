@@ -10,7 +10,9 @@
 
 #include <boost/endian/buffers.hpp>
 #include <boost/exception/exception.hpp>
+#include <cstdint>
 #include <memory>
+#include <utility>
 
 #include "core/Amount.hpp"
 #include "opentxs/network/zeromq/message/Frame.hpp"
@@ -22,12 +24,12 @@ namespace opentxs::factory
 auto Amount(std::string_view str, bool normalize) noexcept(false)
     -> opentxs::Amount
 {
-    return std::make_unique<opentxs::Amount::Imp>(str, normalize).release();
+    return opentxs::Amount::Imp{str, normalize};
 }
 
 auto Amount(const network::zeromq::Frame& in) noexcept(false) -> opentxs::Amount
 {
-    return std::make_unique<opentxs::Amount::Imp>(in.Bytes()).release();
+    return opentxs::Amount::Imp{in.Bytes()};
 }
 }  // namespace opentxs::factory
 
@@ -125,71 +127,115 @@ auto IntegerToFloat(const Integer& rhs) noexcept -> Float
 
 namespace opentxs::internal
 {
-// NOLINTBEGIN(clang-analyzer-core.StackAddressEscape)
 auto FloatToAmount(const amount::Float& rhs) noexcept(false)
-    -> opentxs::Amount::Imp*
+    -> opentxs::Amount
+{
+    return opentxs::Amount::Imp{amount::FloatToInteger(rhs)};
+}
+
+Amount::Amount(const opentxs::Amount& parent) noexcept
+    : parent_(parent)
+{
+    static_assert(amount::minimum_integer_bits_ == 128u);
+    static_assert(amount::maximum_integer_bits_ == 320u);
+}
+
+auto Amount::ExtractInt64() const noexcept(false) -> std::int64_t
+{
+    return opentxs::Amount::Imp::extract_int64(parent_);
+}
+
+auto Amount::ExtractUInt64() const noexcept(false) -> std::uint64_t
 {
-    return std::make_unique<opentxs::Amount::Imp>(amount::FloatToInteger(rhs))
-        .release();
+    return opentxs::Amount::Imp::extract_uint64(parent_);
+}
+
+auto Amount::SerializeBitcoin(const AllocateOutput dest) const noexcept -> bool
+{
+    return opentxs::Amount::Imp::serialize_bitcoin(parent_, dest);
 }
-// NOLINTEND(clang-analyzer-core.StackAddressEscape)
 
 auto Amount::SerializeBitcoinSize() noexcept -> std::size_t
 {
     return sizeof(be::little_int64_buf_t);
 }
+
+auto Amount::ToFloat() const noexcept -> amount::Float
+{
+    return opentxs::Amount::Imp::get(parent_).ToFloat();
+}
 }  // namespace opentxs::internal
 
 namespace opentxs
 {
 Amount::Amount(Imp* rhs) noexcept
     : imp_(rhs)
+    , small_()
 {
     OT_ASSERT(nullptr != imp_);
+
+    if (imp_->ToSmall(small_)) {
+        auto old = std::unique_ptr<Imp>{imp_};
+        imp_ = nullptr;
+    }
 }
 
 Amount::Amount(const Imp& rhs) noexcept
-    : Amount(std::make_unique<Imp>(rhs).release())
+    : imp_(nullptr)
+    , small_()
 {
+    if (false == rhs.ToSmall(small_)) {
+        imp_ = std::make_unique<Imp>(rhs).release();
+    }
 }
 
 Amount::Amount(int rhs)
-    : Amount(Imp::factory_signed(rhs))
+    : Amount(static_cast<long long>(rhs))
 {
 }
 
 Amount::Amount(long rhs)
-    : Amount(Imp::factory_signed(rhs))
+    : Amount(static_cast<long long>(rhs))
 {
 }
 
 Amount::Amount(long long rhs)
-    : Amount(Imp::factory_signed(rhs))
+    : imp_(nullptr)
+    , small_()
 {
+    Imp::to_small(rhs, small_);
 }
 
 Amount::Amount(unsigned rhs)
-    : Amount(Imp::factory_unsigned(rhs))
+    : Amount(static_cast<unsigned long long>(rhs))
 {
 }
 
 Amount::Amount(unsigned long rhs)
-    : Amount(Imp::factory_unsigned(rhs))
+    : Amount(static_cast<unsigned long long>(rhs))
 {
 }
 
 Amount::Amount(unsigned long long rhs)
-    : Amount(Imp::factory_unsigned(rhs))
+    : imp_(nullptr)
+    , small_()
 {
+    if (false == Imp::to_small(rhs, small_)) {
+        imp_ = std::make_unique<Imp>(rhs).release();
+    }
 }
 
 Amount::Amount() noexcept
-    : Amount(std::make_unique<Imp>().release())
+    : imp_(nullptr)
+    , small_()
 {
 }
 
 Amount::Amount(const Amount& rhs) noexcept
-    : Amount(std::make_unique<Imp>(*rhs.imp_).release())
+    : imp_(
+          (nullptr == rhs.imp_) ? nullptr
+                                : std::make_unique<Imp>(*rhs.imp_).release())
+    , small_(rhs.small_)
 {
 }
 
@@ -202,7 +248,9 @@ Amount::Amount(Amount&& rhs) noexcept
 auto Amount::operator=(const Amount& rhs) noexcept -> Amount&
 {
     auto old = std::unique_ptr<Imp>{imp_};
-    imp_ = std::make_unique<Imp>(*rhs.imp_).release();
+    imp_ = (nullptr == rhs.imp_) ? nullptr
+                                 : std::make_unique<Imp>(*rhs.imp_).release();
+    small_ = rhs.small_;
 
     return *this;
 }
@@ -216,147 +264,151 @@ auto Amount::operator=(Amount&& rhs) noexcept -> Amount&
 
 auto Amount::operator<(const Amount& rhs) const noexcept -> bool
 {
-    return *imp_ < *rhs.imp_;
+    return Imp::compare(*this, rhs) < 0;
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator<(const T rhs) const noexcept -> bool
 {
-    return *imp_ < rhs;
+    return Imp::compare(*this, Amount{rhs}) < 0;
 }
 
 auto Amount::operator>(const Amount& rhs) const noexcept -> bool
 {
-    return *imp_ > *rhs.imp_;
+    return Imp::compare(*this, rhs) > 0;
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator>(const T rhs) const noexcept -> bool
 {
-    return *imp_ > rhs;
+    return Imp::compare(*this, Amount{rhs}) > 0;
 }
 
 auto Amount::operator==(const Amount& rhs) const noexcept -> bool
 {
-    return *imp_ == *rhs.imp_;
+    return Imp::compare(*this, rhs) == 0;
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator==(const T rhs) const noexcept -> bool
 {
-    return *imp_ == rhs;
+    return Imp::compare(*this, Amount{rhs}) == 0;
 }
 
 auto Amount::operator!=(const Amount& rhs) const noexcept -> bool
 {
-    return *imp_ != *rhs.imp_;
+    return Imp::compare(*this, rhs) != 0;
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator!=(const T rhs) const noexcept -> bool
 {
-    return *imp_ != rhs;
+    return Imp::compare(*this, Amount{rhs}) != 0;
 }
 
 auto Amount::operator<=(const Amount& rhs) const noexcept -> bool
 {
-    return *imp_ <= *rhs.imp_;
+    return Imp::compare(*this, rhs) <= 0;
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator<=(const T rhs) const noexcept -> bool
 {
-    return *imp_ <= rhs;
+    return Imp::compare(*this, Amount{rhs}) <= 0;
 }
 
 auto Amount::operator>=(const Amount& rhs) const noexcept -> bool
 {
-    return *imp_ >= *rhs.imp_;
+    return Imp::compare(*this, rhs) >= 0;
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator>=(const T rhs) const noexcept -> bool
 {
-    return *imp_ >= rhs;
+    return Imp::compare(*this, Amount{rhs}) >= 0;
 }
 
 auto Amount::operator+(const Amount& rhs) const noexcept(false) -> Amount
 {
-    return *imp_ + *rhs.imp_;
+    return Imp::add(*this, rhs);
 }
 
 auto Amount::operator-(const Amount& rhs) const noexcept(false) -> Amount
 {
-    return *imp_ - *rhs.imp_;
+    return Imp::subtract(*this, rhs);
 }
 
 auto Amount::operator*(const Amount& rhs) const noexcept(false) -> Amount
 {
-    return *imp_ * *rhs.imp_;
+    return Imp::multiply(*this, rhs);
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator*(const T rhs) const noexcept(false) -> Amount
 {
-    return *imp_ * rhs;
+    return Imp::multiply(*this, rhs);
 }
 
 auto Amount::operator/(const Amount& rhs) const noexcept(false) -> Amount
 {
-    return *imp_ / *rhs.imp_;
+    return Imp::divide(*this, rhs);
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator/(const T rhs) const noexcept(false) -> Amount
 {
-    return *imp_ / rhs;
+    return Imp::divide(*this, rhs);
 }
 
 auto Amount::operator%(const Amount& rhs) const noexcept(false) -> Amount
 {
-    return *imp_ % *rhs.imp_;
+    return Imp::get(*this) % Imp::get(rhs);
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator%(const T rhs) const noexcept(false) -> Amount
 {
-    return *imp_ % rhs;
+    return Imp::get(*this) % rhs;
 }
 
 auto Amount::operator*=(const Amount& rhs) noexcept(false) -> Amount&
 {
-    *imp_ *= *rhs.imp_;
+    *this = Imp::multiply(*this, rhs);
 
     return *this;
 }
 
 auto Amount::operator+=(const Amount& rhs) noexcept(false) -> Amount&
 {
-    *imp_ += *rhs.imp_;
+    Imp::add_to(*this, rhs);
 
     return *this;
 }
 
 auto Amount::operator-=(const Amount& rhs) noexcept(false) -> Amount&
 {
-    *imp_ -= *rhs.imp_;
+    Imp::subtract_from(*this, rhs);
 
     return *this;
 }
 
-auto Amount::operator-() -> Amount { return -*imp_; }
+auto Amount::operator-() -> Amount { return Imp::negate(*this); }
 
-auto Amount::Internal() const noexcept -> const internal::Amount&
+auto Amount::Internal() const noexcept -> internal::Amount
 {
-    return *imp_;
+    return internal::Amount{*this};
 }
 
 auto Amount::Serialize(const AllocateOutput dest) const noexcept -> bool
 {
-    return imp_->Serialize(dest);
+    return Imp::get(*this).Serialize(dest);
 }
 
-auto Amount::swap(Amount& rhs) noexcept -> void { std::swap(imp_, rhs.imp_); }
+auto Amount::swap(Amount& rhs) noexcept -> void
+{
+    std::swap(imp_, rhs.imp_);
+    std::swap(small_, rhs.small_);
+}
 
 Amount::~Amount()
 {
@@ -8,11 +8,12 @@
 #include <boost/cstdint.hpp>
 #include <boost/endian/buffers.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <limits>
-#include <memory>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
 #include "internal/core/Amount.hpp"
@@ -26,25 +27,221 @@ namespace be = boost::endian;
 
 namespace opentxs
 {
-class Amount::Imp final : virtual public internal::Amount
+class Amount::Imp final
 {
 public:
-    static auto factory_signed(long long rhs) noexcept -> Imp*
+    using Small = Amount::Small;
+
+    static_assert(amount::fractional_bits_ == 64u);
+
+    // NOTE the static functions below use the inline representation when
+    // every operand has one and fall back to the backend otherwise, which also
+    // handles overflow out of the inline range
+    static auto add(const Amount& lhs, const Amount& rhs) noexcept(false)
+        -> Amount
     {
-        return std::make_unique<Imp>(rhs).release();
+        if ((nullptr == lhs.imp_) && (nullptr == rhs.imp_)) {
+            auto out = Amount{};
+
+            if (add(lhs.small_, rhs.small_, out.small_)) { return out; }
+        }
+
+        return get(lhs) + get(rhs);
     }
-    static auto factory_unsigned(unsigned long long rhs) noexcept -> Imp*
+    static auto add_to(Amount& lhs, const Amount& rhs) noexcept(false) -> void
     {
-        return std::make_unique<Imp>(rhs).release();
+        if ((nullptr == lhs.imp_) && (nullptr == rhs.imp_)) {
+            if (add(lhs.small_, rhs.small_, lhs.small_)) { return; }
+        }
+
+        lhs = get(lhs) + get(rhs);
     }
+    static auto compare(const Amount& lhs, const Amount& rhs) noexcept -> int
+    {
+        if ((nullptr == lhs.imp_) && (nullptr == rhs.imp_)) {
+
+            return compare(lhs.small_, rhs.small_);
+        }
+
+        if (nullptr == lhs.imp_) {
 
-    auto ExtractInt64() const noexcept(false) -> std::int64_t final
+            return -rhs.imp_->amount_.compare(to_integer(lhs.small_));
+        } else if (nullptr == rhs.imp_) {
+
+            return lhs.imp_->amount_.compare(to_integer(rhs.small_));
+        } else {
+
+            return lhs.imp_->amount_.compare(rhs.imp_->amount_);
+        }
+    }
+    static auto divide(const Amount& lhs, const Amount& rhs) noexcept(false)
+        -> Amount
     {
-        return extract_int<std::int64_t>();
+        if ((nullptr == lhs.imp_) && (nullptr == rhs.imp_)) {
+            auto out = Amount{};
+
+            if (divide(lhs.small_, rhs.small_, out.small_)) { return out; }
+        }
+
+        return get(lhs) / get(rhs);
     }
-    auto ExtractUInt64() const noexcept(false) -> std::uint64_t final
+    template <typename T>
+    static auto divide(const Amount& lhs, const T rhs) noexcept(false)
+        -> Amount
     {
-        return extract_int<std::uint64_t>();
+        // NOTE division by zero is left to the backend so the same exception
+        // is thrown
+        if ((nullptr == lhs.imp_) && (0 != rhs)) {
+            auto value = std::uint64_t{};
+            const auto negative = magnitude(rhs, value);
+            auto out = Amount{};
+
+            if (divide(lhs.small_, negative, value, out.small_)) { return out; }
+        }
+
+        return get(lhs) / rhs;
+    }
+    static auto extract_int64(const Amount& in) noexcept -> std::int64_t
+    {
+        if (nullptr == in.imp_) { return truncate(in.small_); }
+
+        return in.imp_->extract_int<std::int64_t>();
+    }
+    static auto extract_uint64(const Amount& in) noexcept -> std::uint64_t
+    {
+        if ((nullptr == in.imp_) && (0 <= in.small_.high_)) {
+
+            return static_cast<std::uint64_t>(truncate(in.small_));
+        }
+
+        return get(in).extract_int<std::uint64_t>();
+    }
+    /// Returns a copy of the value, converting from inline storage if needed
+    static auto get(const Amount& in) noexcept -> Imp
+    {
+        if (nullptr == in.imp_) { return to_integer(in.small_); }
+
+        return *in.imp_;
+    }
+    static auto multiply(const Amount& lhs, const Amount& rhs) noexcept(false)
+        -> Amount
+    {
+        if ((nullptr == lhs.imp_) && (nullptr == rhs.imp_)) {
+            auto out = Amount{};
+
+            if (multiply(lhs.small_, rhs.small_, out.small_)) { return out; }
+        }
+
+        return get(lhs) * get(rhs);
+    }
+    template <typename T>
+    static auto multiply(const Amount& lhs, const T rhs) noexcept(false)
+        -> Amount
+    {
+        if (nullptr == lhs.imp_) {
+            auto value = std::uint64_t{};
+            const auto negative = magnitude(rhs, value);
+            auto out = Amount{};
+
+            if (multiply(lhs.small_, negative, value, out.small_)) {
+
+                return out;
+            }
+        }
+
+        return get(lhs) * rhs;
+    }
+    static auto negate(const Amount& in) noexcept(false) -> Amount
+    {
+        if (nullptr == in.imp_) {
+            auto out = Amount{};
+
+            if (subtract(Small{}, in.small_, out.small_)) { return out; }
+        }
+
+        return -get(in);
+    }
+    static auto serialize_bitcoin(
+        const Amount& in,
+        const AllocateOutput dest) noexcept -> bool
+    {
+        if (nullptr == in.imp_) {
+            const auto amount = truncate(in.small_);
+
+            if (0 > amount) { return false; }
+
+            return write_bitcoin(amount, dest);
+        }
+
+        return in.imp_->SerializeBitcoin(dest);
+    }
+    static auto subtract(const Amount& lhs, const Amount& rhs) noexcept(false)
+        -> Amount
+    {
+        if ((nullptr == lhs.imp_) && (nullptr == rhs.imp_)) {
+            auto out = Amount{};
+
+            if (subtract(lhs.small_, rhs.small_, out.small_)) { return out; }
+        }
+
+        return get(lhs) - get(rhs);
+    }
+    static auto subtract_from(Amount& lhs, const Amount& rhs) noexcept(false)
+        -> void
+    {
+        if ((nullptr == lhs.imp_) && (nullptr == rhs.imp_)) {
+            if (subtract(lhs.small_, rhs.small_, lhs.small_)) { return; }
+        }
+
+        lhs = get(lhs) - get(rhs);
+    }
+    template <typename T>
+    static auto to_small(const T rhs, Small& out) noexcept -> bool
+    {
+        if constexpr (std::is_signed_v<T>) {
+            out = {0u, static_cast<std::int64_t>(rhs)};
+
+            return true;
+        } else {
+            if (std::numeric_limits<std::int64_t>::max() < rhs) {
+                out = {};
+
+                return false;
+            }
+
+            out = {0u, static_cast<std::int64_t>(rhs)};
+
+            return true;
+        }
+    }
+
+    /// Returns false if the value does not fit in inline storage
+    auto ToSmall(Small& out) const noexcept -> bool
+    {
+        // NOTE the backend stores the magnitude as little endian limbs
+        constexpr auto limbBits =
+            std::size_t{std::numeric_limits<bmp::limb_type>::digits};
+        const auto& backend = amount_.backend();
+        const auto size = std::size_t{backend.size()};
+
+        if ((size * limbBits) > 128u) { return false; }
+
+        const auto* limbs = backend.limbs();
+        auto high = std::uint64_t{0};
+        auto low = std::uint64_t{0};
+
+        for (auto i = std::size_t{0}; i < size; ++i) {
+            const auto limb = static_cast<std::uint64_t>(limbs[i]);
+            const auto offset = i * limbBits;
+
+            if (64u > offset) {
+                low |= limb << offset;
+            } else {
+                high |= limb << (offset - 64u);
+            }
+        }
+
+        return from_magnitude(backend.sign(), high, low, out);
     }
     auto operator<(const Imp& rhs) const { return amount_ < rhs.amount_; }
 
@@ -118,7 +315,7 @@ public:
 
     auto operator/(const Imp& rhs) const noexcept(false) -> Imp
     {
-        const auto total = amount_ / rhs.amount_;
+        const auto total = amount::Integer{amount_ / rhs.amount_};
         return Imp::shift_left(total);
     }
 
@@ -176,8 +373,7 @@ public:
         return copy(amount, dest);
     }
 
-    auto SerializeBitcoin(const AllocateOutput dest) const noexcept
-        -> bool final
+    auto SerializeBitcoin(const AllocateOutput dest) const noexcept -> bool
     {
         const auto backend = shift_right();
         if (backend < 0 || backend > std::numeric_limits<std::int64_t>::max()) {
@@ -193,17 +389,11 @@ public:
                 .Flush();
             return false;
         }
-        const auto buffer = be::little_int64_buf_t(amount);
 
-        const auto view =
-            ReadView(reinterpret_cast<const char*>(&buffer), sizeof(buffer));
-
-        copy(view, dest);
-
-        return true;
+        return write_bitcoin(amount, dest);
     }
 
-    auto ToFloat() const noexcept -> amount::Float final
+    auto ToFloat() const noexcept -> amount::Float
     {
         return amount::IntegerToFloat(amount_);
     }
@@ -298,9 +488,351 @@ public:
     }
     auto operator=(Imp&& rhs) -> Imp& = delete;
 
-    ~Imp() final = default;
+    ~Imp() = default;
 
 private:
     amount::Integer amount_;
+
+    static auto add(const Small& lhs, const Small& rhs, Small& out) noexcept
+        -> bool
+    {
+        const auto low = lhs.low_ + rhs.low_;
+        const auto carry = std::uint64_t{(low < lhs.low_) ? 1u : 0u};
+        const auto high = static_cast<std::int64_t>(
+            static_cast<std::uint64_t>(lhs.high_) +
+            static_cast<std::uint64_t>(rhs.high_) + carry);
+        const auto negative = (0 > lhs.high_);
+
+        // NOTE the sum of two numbers with the same sign must have that sign
+        if ((negative == (0 > rhs.high_)) && (negative != (0 > high))) {
+
+            return false;
+        }
+
+        out = {low, high};
+
+        return true;
+    }
+    // NOTE a magnitude of exactly 2^127 only fits when the value is negative
+    static auto from_magnitude(
+        const bool negative,
+        std::uint64_t high,
+        std::uint64_t low,
+        Small& out) noexcept -> bool
+    {
+        constexpr auto sign = std::uint64_t{1u} << 63u;
+
+        if (sign < high) { return false; }
+
+        if ((sign == high) && ((false == negative) || (0u != low))) {
+
+            return false;
+        }
+
+        if (negative) { twos_complement(high, low); }
+
+        out = {low, static_cast<std::int64_t>(high)};
+
+        return true;
+    }
+    static auto compare(const Small& lhs, const Small& rhs) noexcept -> int
+    {
+        if (lhs.high_ < rhs.high_) {
+
+            return -1;
+        } else if (lhs.high_ > rhs.high_) {
+
+            return 1;
+        } else if (lhs.low_ < rhs.low_) {
+
+            return -1;
+        } else if (lhs.low_ > rhs.low_) {
+
+            return 1;
+        } else {
+
+            return 0;
+        }
+    }
+    // NOTE returns the number of leading zero bits in a non-zero value
+    static auto leading_zeros(std::uint64_t value) noexcept -> unsigned
+    {
+        auto out = 0u;
+
+        for (auto bits = 32u; 0u < bits; bits >>= 1u) {
+            if (0u == (value >> (64u - bits))) {
+                out += bits;
+                value <<= bits;
+            }
+        }
+
+        return out;
+    }
+    // NOTE integer part of an amount divided by an amount with no fractional
+    // part, which is the only case shift_left(lhs / rhs) can be computed
+    // without a 128 bit divisor
+    static auto divide(const Small& lhs, const Small& rhs, Small& out) noexcept
+        -> bool
+    {
+        auto lh = std::uint64_t{};
+        auto ll = std::uint64_t{};
+        auto rh = std::uint64_t{};
+        auto rl = std::uint64_t{};
+        const auto negative =
+            magnitude(lhs, lh, ll) != magnitude(rhs, rh, rl);
+
+        if ((0u != rl) || (0u == rh)) { return false; }
+
+        return from_magnitude(negative, lh / rh, 0u, out);
+    }
+    // NOTE truncating division of the raw value, which matches the backend
+    static auto divide(
+        const Small& lhs,
+        const bool negative,
+        const std::uint64_t rhs,
+        Small& out) noexcept -> bool
+    {
+        auto high = std::uint64_t{};
+        auto low = std::uint64_t{};
+        const auto sign = magnitude(lhs, high, low) != negative;
+        auto remainder = std::uint64_t{};
+        const auto quotient = high / rhs;
+        low = divide(high % rhs, low, rhs, remainder);
+
+        return from_magnitude(sign, quotient, low, out);
+    }
+    // NOTE 128 / 64 -> 64 bit unsigned division from Hacker's Delight. The
+    // high word of the dividend must be less than the divisor.
+    static auto divide(
+        const std::uint64_t high,
+        const std::uint64_t low,
+        std::uint64_t divisor,
+        std::uint64_t& remainder) noexcept -> std::uint64_t
+    {
+        constexpr auto base = std::uint64_t{1} << 32u;
+        constexpr auto mask = base - 1u;
+        const auto shift = leading_zeros(divisor);
+        divisor <<= shift;
+        const auto dh = divisor >> 32u;
+        const auto dl = divisor & mask;
+        const auto nh =
+            (0u == shift) ? high : (high << shift) | (low >> (64u - shift));
+        const auto nl = low << shift;
+        const auto n1 = nl >> 32u;
+        const auto n0 = nl & mask;
+        auto q1 = nh / dh;
+        auto rhat = nh - (q1 * dh);
+
+        while ((q1 >= base) || ((q1 * dl) > ((base * rhat) + n1))) {
+            --q1;
+            rhat += dh;
+
+            if (rhat >= base) { break; }
+        }
+
+        const auto n21 = (nh * base) + n1 - (q1 * divisor);
+        auto q0 = n21 / dh;
+        rhat = n21 - (q0 * dh);
+
+        while ((q0 >= base) || ((q0 * dl) > ((base * rhat) + n0))) {
+            --q0;
+            rhat += dh;
+
+            if (rhat >= base) { break; }
+        }
+
+        remainder = ((n21 * base) + n0 - (q0 * divisor)) >> shift;
+
+        return (q1 * base) + q0;
+    }
+    template <typename T>
+    static auto magnitude(const T in, std::uint64_t& out) noexcept -> bool
+    {
+        out = static_cast<std::uint64_t>(in);
+
+        if constexpr (std::is_signed_v<T>) {
+            // NOTE negating as unsigned avoids overflow for the minimum value
+            if (0 > in) {
+                out = ~out + 1u;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+    static auto magnitude(
+        const Small& in,
+        std::uint64_t& high,
+        std::uint64_t& low) noexcept -> bool
+    {
+        const auto negative = (0 > in.high_);
+        high = static_cast<std::uint64_t>(in.high_);
+        low = in.low_;
+
+        if (negative) { twos_complement(high, low); }
+
+        return negative;
+    }
+    // NOTE 64 x 64 -> 128 bit unsigned multiplication
+    static auto multiply(
+        const std::uint64_t lhs,
+        const std::uint64_t rhs,
+        std::uint64_t& high) noexcept -> std::uint64_t
+    {
+        constexpr auto mask = std::uint64_t{0xffffffff};
+        const auto lh = lhs >> 32u;
+        const auto ll = lhs & mask;
+        const auto rh = rhs >> 32u;
+        const auto rl = rhs & mask;
+        const auto lowLow = ll * rl;
+        const auto highLow = lh * rl;
+        const auto lowHigh = ll * rh;
+        const auto middle =
+            (lowLow >> 32u) + (highLow & mask) + (lowHigh & mask);
+        high = (lh * rh) + (highLow >> 32u) + (lowHigh >> 32u) +
+               (middle >> 32u);
+
+        return (middle << 32u) | (lowLow & mask);
+    }
+    // NOTE fixed point multiplication which rounds toward zero in the same way
+    // as shift_right
+    static auto multiply(
+        const Small& lhs,
+        const Small& rhs,
+        Small& out) noexcept -> bool
+    {
+        auto lh = std::uint64_t{};
+        auto ll = std::uint64_t{};
+        auto rh = std::uint64_t{};
+        auto rl = std::uint64_t{};
+        const auto negative =
+            magnitude(lhs, lh, ll) != magnitude(rhs, rh, rl);
+        auto carry = std::uint64_t{};
+        const auto accumulate = [&](std::uint64_t& word, std::uint64_t value) {
+            word += value;
+            carry += (word < value) ? 1u : 0u;
+        };
+        // NOTE the 256 bit product is w3:w2:w1:w0 and the result is w2:w1
+        auto h00 = std::uint64_t{};
+        auto h01 = std::uint64_t{};
+        auto h10 = std::uint64_t{};
+        auto h11 = std::uint64_t{};
+        multiply(ll, rl, h00);
+        const auto l01 = multiply(ll, rh, h01);
+        const auto l10 = multiply(lh, rl, h10);
+        const auto l11 = multiply(lh, rh, h11);
+        auto w1 = h00;
+        accumulate(w1, l01);
+        accumulate(w1, l10);
+        auto w2 = carry;
+        carry = 0u;
+        accumulate(w2, h01);
+        accumulate(w2, h10);
+        accumulate(w2, l11);
+        const auto w3 = h11 + carry;
+
+        if (0u != w3) { return false; }
+
+        return from_magnitude(negative, w2, w1, out);
+    }
+    static auto multiply(
+        const Small& lhs,
+        const bool negative,
+        const std::uint64_t rhs,
+        Small& out) noexcept -> bool
+    {
+        auto high = std::uint64_t{};
+        auto low = std::uint64_t{};
+        const auto sign = magnitude(lhs, high, low) != negative;
+        auto h0 = std::uint64_t{};
+        auto h1 = std::uint64_t{};
+        const auto w0 = multiply(low, rhs, h0);
+        auto w1 = multiply(high, rhs, h1);
+        w1 += h0;
+        const auto w2 = h1 + ((w1 < h0) ? 1u : 0u);
+
+        if (0u != w2) { return false; }
+
+        return from_magnitude(sign, w1, w0, out);
+    }
+    static auto subtract(
+        const Small& lhs,
+        const Small& rhs,
+        Small& out) noexcept -> bool
+    {
+        const auto low = lhs.low_ - rhs.low_;
+        const auto borrow = std::uint64_t{(lhs.low_ < rhs.low_) ? 1u : 0u};
+        const auto high = static_cast<std::int64_t>(
+            static_cast<std::uint64_t>(lhs.high_) -
+            static_cast<std::uint64_t>(rhs.high_) - borrow);
+        const auto negative = (0 > lhs.high_);
+
+        // NOTE the difference of two numbers with opposite signs must have the
+        // sign of the minuend
+        if ((negative != (0 > rhs.high_)) && (negative != (0 > high))) {
+
+            return false;
+        }
+
+        out = {low, high};
+
+        return true;
+    }
+    static auto to_integer(const Small& in) noexcept -> amount::Integer
+    {
+        const auto negative = (0 > in.high_);
+        auto high = static_cast<std::uint64_t>(in.high_);
+        auto low = in.low_;
+
+        if (negative) { twos_complement(high, low); }
+
+        // NOTE writing the limbs directly is much faster than assembling the
+        // value with checked arithmetic
+        constexpr auto limbBits =
+            std::size_t{std::numeric_limits<bmp::limb_type>::digits};
+        constexpr auto count = std::size_t{128u / limbBits};
+        auto out = amount::Integer{};
+        auto& backend = out.backend();
+        backend.resize(count, count);
+        auto* limbs = backend.limbs();
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto offset = i * limbBits;
+            const auto word =
+                (64u > offset) ? (low >> offset) : (high >> (offset - 64u));
+            limbs[i] = static_cast<bmp::limb_type>(word);
+        }
+
+        backend.normalize();
+        backend.sign(negative);
+
+        return out;
+    }
+    // NOTE rounds toward zero in the same way as shift_right
+    static auto truncate(const Small& in) noexcept -> std::int64_t
+    {
+        if ((0 > in.high_) && (0u != in.low_)) { return in.high_ + 1; }
+
+        return in.high_;
+    }
+    static auto twos_complement(
+        std::uint64_t& high,
+        std::uint64_t& low) noexcept -> void
+    {
+        low = ~low + 1u;
+        high = ~high + ((0u == low) ? 1u : 0u);
+    }
+    static auto write_bitcoin(
+        const std::int64_t amount,
+        const AllocateOutput dest) noexcept -> bool
+    {
+        const auto buffer = be::little_int64_buf_t(amount);
+        const auto view =
+            ReadView(reinterpret_cast<const char*>(&buffer), sizeof(buffer));
+        copy(view, dest);
+
+        return true;
+    }
 };
 }  // namespace opentxs
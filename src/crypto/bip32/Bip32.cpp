@@ -84,6 +84,16 @@ auto Bip32::DeriveKey(
     return imp_->DeriveKey(curve, seed, path);
 }
 
+auto Bip32::DeriveKeys(
+    const key::HD& parent,
+    const Bip32Index first,
+    const std::size_t count,
+    const PasswordPrompt& reason) const noexcept(false)
+    -> UnallocatedVector<Key>
+{
+    return imp_->DeriveKeys(parent, first, count, reason);
+}
+
 auto Bip32::DerivePrivateKey(
     const key::HD& parent,
     const Path& pathAppend,
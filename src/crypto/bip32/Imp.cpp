@@ -36,6 +36,8 @@ namespace opentxs::crypto
 Bip32::Imp::Imp(const api::Crypto& crypto) noexcept
     : crypto_(crypto)
     , blank_()
+    , lock_()
+    , nodes_()
 {
 }
 
@@ -7,7 +7,10 @@
 
 #include <boost/endian/buffers.hpp>
 #include <boost/endian/conversion.hpp>
+#include <cstddef>
+#include <mutex>
 #include <optional>
+#include <utility>
 
 #include "crypto/HDNode.hpp"
 #include "internal/crypto/Crypto.hpp"
@@ -57,6 +60,12 @@ public:
         const EcdsaCurve& curve,
         const Secret& seed,
         const Path& path) const -> Key;
+    auto DeriveKeys(
+        const key::HD& parent,
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const noexcept(false)
+        -> UnallocatedVector<Key>;
     auto DerivePrivateKey(
         const key::HD& parent,
         const Path& pathAppend,
@@ -109,9 +118,16 @@ public:
 
 private:
     using HDNode = implementation::HDNode;
+    using NodeID = std::pair<OTIdentifier, Path>;
+
+    // NOTE purpose, coin type, account and chain levels of a BIP-44 path
+    static constexpr auto max_cached_depth_ = std::size_t{4};
+    static constexpr auto max_cached_nodes_ = std::size_t{1024};
 
     const api::Crypto& crypto_;
     const std::optional<Key> blank_;
+    mutable std::mutex lock_;
+    mutable UnallocatedMap<NodeID, Key> nodes_;
 
     static auto IsHard(const Bip32Index) noexcept -> bool;
 
@@ -133,6 +149,13 @@ private:
         HDNode& node,
         Bip32Fingerprint& parent,
         const Bip32Index child) const noexcept -> bool;
+    auto derive_range(
+        const EcdsaCurve& curve,
+        const ReadView privateKey,
+        const ReadView chainCode,
+        const ReadView publicKey,
+        const Bip32Index first,
+        UnallocatedVector<Key>& output) const noexcept -> bool;
     auto extract(
         const Data& input,
         Bip32Network& network,
@@ -140,6 +163,11 @@ private:
         Bip32Fingerprint& parent,
         Bip32Index& index,
         Data& chainCode) const noexcept -> bool;
+    auto load_node(
+        const Identifier& seed,
+        const Path& path,
+        HDNode& node,
+        Bip32Fingerprint& parent) const noexcept(false) -> std::size_t;
     auto provider(const EcdsaCurve& curve) const noexcept
         -> const crypto::EcdsaProvider&;
     auto root_node(
@@ -148,5 +176,11 @@ private:
         const AllocateOutput privateKey,
         const AllocateOutput code,
         const AllocateOutput publicKey) const noexcept -> bool;
+    auto save_node(
+        const Identifier& seed,
+        const Path& path,
+        const std::size_t depth,
+        const HDNode& node,
+        const Bip32Fingerprint parent) const noexcept(false) -> void;
 };
 }  // namespace opentxs::crypto
@@ -7,15 +7,19 @@
 #include "1_Internal.hpp"        // IWYU pragma: associated
 #include "crypto/bip32/Imp.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <iterator>
+#include <limits>
 #include <stdexcept>
 #include <tuple>
 
 #include "crypto/HDNode.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/Mutex.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/api/crypto/Crypto.hpp"
 #include "opentxs/api/crypto/Hash.hpp"
 #include "opentxs/core/Secret.hpp"
@@ -39,28 +43,30 @@ auto Bip32::Imp::DeriveKey(
     try {
         auto& [privateKey, chainCode, publicKey, pathOut, parent] = output;
         pathOut = path;
-        auto node = [&] {
-            auto ret = HDNode{crypto_};
+        const auto seedID = SeedID(seed.Bytes());
+        auto node = HDNode{crypto_};
+        node.check();
+        const auto cached = load_node(seedID, path, node, parent);
+
+        if (0_uz == cached) {
             const auto init = root_node(
                 EcdsaCurve::secp256k1,
                 seed.Bytes(),
-                ret.InitPrivate(),
-                ret.InitCode(),
-                ret.InitPublic());
+                node.InitPrivate(),
+                node.InitCode(),
+                node.InitPublic());
 
             if (false == init) {
                 throw std::runtime_error("Failed to derive root node");
             }
+        }
 
-            ret.check();
-
-            return ret;
-        }();
-
-        for (const auto& child : path) {
-            if (false == derive_private(node, parent, child)) {
+        for (auto i = cached; i < path.size(); ++i) {
+            if (false == derive_private(node, parent, path[i])) {
                 throw std::runtime_error("Failed to derive child node");
             }
+
+            save_node(seedID, path, i + 1_uz, node, parent);
         }
 
         node.Assign(curve, output);
@@ -71,6 +77,63 @@ auto Bip32::Imp::DeriveKey(
     return output;
 }
 
+auto Bip32::Imp::DeriveKeys(
+    const key::HD& key,
+    const Bip32Index first,
+    const std::size_t count,
+    const PasswordPrompt& reason) const noexcept(false)
+    -> UnallocatedVector<Key>
+{
+    const auto curve = [&] {
+        if (crypto::key::asymmetric::Algorithm::ED25519 == key.keyType()) {
+
+            return EcdsaCurve::ed25519;
+        } else {
+
+            return EcdsaCurve::secp256k1;
+        }
+    }();
+    static constexpr auto max = std::numeric_limits<Bip32Index>::max();
+
+    if ((0_uz == count) || ((max - first) < (count - 1_uz))) {
+        throw std::runtime_error("Invalid child index range");
+    }
+
+    auto output = UnallocatedVector<Key>{};
+    output.reserve(count);
+    const auto path = [&] {
+        auto out = Path{};
+        auto proto = proto::HDPath{};
+
+        if (key.Path(proto)) {
+            for (const auto& child : proto.child()) { out.emplace_back(child); }
+        }
+
+        return out;
+    }();
+
+    for (auto i = 0_uz; i < count; ++i) {
+        auto& item = output.emplace_back(blank_.value());
+        auto& pathOut = std::get<3>(item);
+        pathOut = path;
+        pathOut.emplace_back(static_cast<Bip32Index>(first + i));
+    }
+
+    // NOTE the parent is decrypted once for the entire range instead of once
+    // per child
+    const auto privateKey =
+        key.HasPrivate() ? key.PrivateKey(reason) : ReadView{};
+    const auto chainCode = key.Chaincode(reason);
+    const auto publicKey = key.PublicKey();
+
+    if (false ==
+        derive_range(curve, privateKey, chainCode, publicKey, first, output)) {
+        throw std::runtime_error("Failed to derive child node");
+    }
+
+    return output;
+}
+
 auto Bip32::Imp::DerivePrivateKey(
     const key::HD& key,
     const Path& pathAppend,
@@ -205,6 +268,103 @@ auto Bip32::Imp::DerivePublicKey(
     return output;
 }
 
+auto Bip32::Imp::derive_range(
+    const EcdsaCurve& curve,
+    const ReadView privateKey,
+    const ReadView chainCode,
+    const ReadView publicKey,
+    const Bip32Index first,
+    UnallocatedVector<Key>& output) const noexcept -> bool
+{
+    const auto hasPrivate = (false == privateKey.empty());
+
+    try {
+        auto node = HDNode{crypto_};
+        node.check();
+
+        for (auto i = 0_uz; i < output.size(); ++i) {
+            auto& item = output.at(i);
+            auto& parent = std::get<4>(item);
+            const auto child = static_cast<Bip32Index>(first + i);
+
+            if (hasPrivate && (false == copy(privateKey, node.InitPrivate()))) {
+                throw std::runtime_error("Failed to initialize private key");
+            }
+
+            if (false == copy(chainCode, node.InitCode())) {
+                throw std::runtime_error("Failed to initialize chain code");
+            }
+
+            if (false == copy(publicKey, node.InitPublic())) {
+                throw std::runtime_error("Failed to initialize public key");
+            }
+
+            const auto derived = hasPrivate
+                                     ? derive_private(node, parent, child)
+                                     : derive_public(node, parent, child);
+
+            if (false == derived) {
+                throw std::runtime_error("Failed to derive child node");
+            }
+
+            node.Assign(curve, item);
+        }
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto Bip32::Imp::load_node(
+    const Identifier& seed,
+    const Path& path,
+    HDNode& node,
+    Bip32Fingerprint& parent) const noexcept(false) -> std::size_t
+{
+    auto lock = Lock{lock_};
+    auto id = NodeID{seed, {}};
+    auto& prefix = id.second;
+    const auto limit = std::min(path.size(), max_cached_depth_);
+    auto depth = 0_uz;
+    const Key* found{nullptr};
+
+    for (auto i = 0_uz; i < limit; ++i) {
+        prefix.emplace_back(path[i]);
+
+        if (auto it = nodes_.find(id); nodes_.end() != it) {
+            depth = i + 1_uz;
+            found = &it->second;
+        } else {
+
+            break;
+        }
+    }
+
+    if (nullptr == found) { return 0_uz; }
+
+    const auto& [privateKey, chainCode, publicKey, unused, fingerprint] =
+        *found;
+
+    if (false == copy(privateKey->Bytes(), node.InitPrivate())) {
+        throw std::runtime_error("Failed to initialize private key");
+    }
+
+    if (false == copy(chainCode->Bytes(), node.InitCode())) {
+        throw std::runtime_error("Failed to initialize chain code");
+    }
+
+    if (false == copy(publicKey.Bytes(), node.InitPublic())) {
+        throw std::runtime_error("Failed to initialize public key");
+    }
+
+    parent = fingerprint;
+
+    return depth;
+}
+
 auto Bip32::Imp::root_node(
     const EcdsaCurve& curve,
     const ReadView entropy,
@@ -272,4 +432,28 @@ auto Bip32::Imp::root_node(
         return false;
     }
 }
+
+auto Bip32::Imp::save_node(
+    const Identifier& seed,
+    const Path& path,
+    const std::size_t depth,
+    const HDNode& node,
+    const Bip32Fingerprint parent) const noexcept(false) -> void
+{
+    // NOTE only the shallow levels are shared between the keys of a seed.
+    // Deeper nodes are cached by the callers which need them.
+    if (max_cached_depth_ < depth) { return; }
+
+    auto id = NodeID{seed, Path{path.begin(), std::next(path.begin(), depth)}};
+    auto lock = Lock{lock_};
+
+    if (0_uz < nodes_.count(id)) { return; }
+
+    if (max_cached_nodes_ <= nodes_.size()) { nodes_.clear(); }
+
+    auto value{blank_.value()};
+    node.Assign(EcdsaCurve::secp256k1, value);
+    std::get<4>(value) = parent;
+    nodes_.try_emplace(std::move(id), std::move(value));
+}
 }  // namespace opentxs::crypto
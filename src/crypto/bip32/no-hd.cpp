@@ -15,6 +15,15 @@ auto Bip32::Imp::DeriveKey(const EcdsaCurve&, const Secret&, const Path&) const
     return blank_.value();
 }
 
+auto Bip32::Imp::DeriveKeys(
+    const key::HD&,
+    const Bip32Index,
+    const std::size_t,
+    const PasswordPrompt&) const noexcept(false) -> UnallocatedVector<Key>
+{
+    return {};
+}
+
 auto Bip32::Imp::DerivePrivateKey(
     const key::HD&,
     const Path&,
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <tuple>
 
@@ -13,6 +14,7 @@
 #include "internal/util/Mutex.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/core/Secret.hpp"
+#include "opentxs/crypto/Bip32.hpp"
 #include "opentxs/crypto/Types.hpp"
 #include "opentxs/crypto/key/Asymmetric.hpp"
 #include "opentxs/crypto/key/HD.hpp"
@@ -66,6 +68,11 @@ public:
         -> ReadView final;
     auto ChildKey(const Bip32Index index, const PasswordPrompt& reason)
         const noexcept -> std::unique_ptr<key::HD> final;
+    auto ChildKeys(
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const noexcept
+        -> UnallocatedVector<std::unique_ptr<key::HD>> final;
     auto Depth() const noexcept -> int final;
     auto Fingerprint() const noexcept -> Bip32Fingerprint final;
     auto Parent() const noexcept -> Bip32Fingerprint final { return parent_; }
@@ -141,6 +148,12 @@ private:
 
     auto chaincode(const Lock& lock, const PasswordPrompt& reason)
         const noexcept -> ReadView;
+    auto child_key(
+        const Bip32::Key& serialized,
+        const Bip32Index index,
+        const bool hasPrivate,
+        const PasswordPrompt& reason) const noexcept(false)
+        -> std::unique_ptr<key::HD>;
     auto get_chain_code(const Lock& lock, const PasswordPrompt& reason) const
         noexcept(false) -> Secret&;
     auto get_params() const noexcept
@@ -7,10 +7,10 @@
 #include "1_Internal.hpp"                // IWYU pragma: associated
 #include "crypto/key/asymmetric/HD.hpp"  // IWYU pragma: associated
 
-#include <algorithm>
+#include <cstddef>
 #include <cstdint>
-#include <iterator>
 #include <stdexcept>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -35,26 +35,12 @@ auto HD::ChildKey(const Bip32Index index, const PasswordPrompt& reason)
     const noexcept -> std::unique_ptr<key::HD>
 {
     try {
-        static const auto blank = api_.Factory().Secret(0);
         const auto hasPrivate = [&] {
             auto lock = Lock{lock_};
 
             return has_private(lock);
         }();
         const auto serialized = [&] {
-            const auto path = [&] {
-                auto out = Bip32::Path{};
-
-                if (path_) {
-                    std::copy(
-                        path_->child().begin(),
-                        path_->child().end(),
-                        std::back_inserter(out));
-                }
-
-                return out;
-            }();
-
             if (hasPrivate) {
                 return api_.Crypto().BIP32().DerivePrivateKey(
                     *this, {index}, reason);
@@ -63,49 +49,96 @@ auto HD::ChildKey(const Bip32Index index, const PasswordPrompt& reason)
                     *this, {index}, reason);
             }
         }();
-        const auto& [privkey, ccode, pubkey, spath, parent] = serialized;
-        const auto path = [&] {
-            auto out = proto::HDPath{};
 
-            if (path_) {
-                out = *path_;
-                out.add_child(index);
-            }
+        return child_key(serialized, index, hasPrivate, reason);
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return {};
+    }
+}
+
+auto HD::child_key(
+    const Bip32::Key& serialized,
+    const Bip32Index index,
+    const bool hasPrivate,
+    const PasswordPrompt& reason) const noexcept(false)
+    -> std::unique_ptr<key::HD>
+{
+    static const auto blank = api_.Factory().Secret(0);
+    const auto& [privkey, ccode, pubkey, spath, parent] = serialized;
+    const auto path = [&] {
+        auto out = proto::HDPath{};
 
-            return out;
+        if (path_) {
+            out = *path_;
+            out.add_child(index);
+        }
+
+        return out;
+    }();
+
+    switch (type_) {
+        case crypto::key::asymmetric::Algorithm::ED25519: {
+            return factory::Ed25519Key(
+                api_,
+                api_.Crypto().Internal().EllipticProvider(type_),
+                hasPrivate ? privkey : blank,
+                ccode,
+                pubkey,
+                path,
+                parent,
+                role_,
+                version_,
+                reason);
+        }
+        case crypto::key::asymmetric::Algorithm::Secp256k1: {
+            return factory::Secp256k1Key(
+                api_,
+                api_.Crypto().Internal().EllipticProvider(type_),
+                hasPrivate ? privkey : blank,
+                ccode,
+                pubkey,
+                path,
+                parent,
+                role_,
+                version_,
+                reason);
+        }
+        default: {
+            throw std::runtime_error{"Unsupported key type"};
+        }
+    }
+}
+
+auto HD::ChildKeys(
+    const Bip32Index first,
+    const std::size_t count,
+    const PasswordPrompt& reason) const noexcept
+    -> UnallocatedVector<std::unique_ptr<key::HD>>
+{
+    try {
+        const auto hasPrivate = [&] {
+            auto lock = Lock{lock_};
+
+            return has_private(lock);
         }();
+        const auto serialized = api_.Crypto().BIP32().DeriveKeys(
+            *this, first, count, reason);
+        auto out = UnallocatedVector<std::unique_ptr<key::HD>>{};
+        out.reserve(serialized.size());
 
-        switch (type_) {
-            case crypto::key::asymmetric::Algorithm::ED25519: {
-                return factory::Ed25519Key(
-                    api_,
-                    api_.Crypto().Internal().EllipticProvider(type_),
-                    hasPrivate ? privkey : blank,
-                    ccode,
-                    pubkey,
-                    path,
-                    parent,
-                    role_,
-                    version_,
-                    reason);
-            }
-            case crypto::key::asymmetric::Algorithm::Secp256k1: {
-                return factory::Secp256k1Key(
-                    api_,
-                    api_.Crypto().Internal().EllipticProvider(type_),
-                    hasPrivate ? privkey : blank,
-                    ccode,
-                    pubkey,
-                    path,
-                    parent,
-                    role_,
-                    version_,
-                    reason);
-            }
-            default: {
-                throw std::runtime_error{"Unsupported key type"};
+        for (const auto& key : serialized) {
+            const auto index = std::get<3>(key).back();
+            auto& child =
+                out.emplace_back(child_key(key, index, hasPrivate, reason));
+
+            if (false == bool(child)) {
+                throw std::runtime_error{"Failed to instantiate child key"};
             }
         }
+
+        return out;
     } catch (const std::exception& e) {
         LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
 
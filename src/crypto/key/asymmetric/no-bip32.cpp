@@ -20,4 +20,15 @@ auto HD::ChildKey(const Bip32Index, const PasswordPrompt&) const noexcept
 
     return {};
 }
+
+auto HD::ChildKeys(
+    const Bip32Index,
+    const std::size_t,
+    const PasswordPrompt&) const noexcept
+    -> UnallocatedVector<std::unique_ptr<key::HD>>
+{
+    LogError()(OT_PRETTY_CLASS())("HD key support missing").Flush();
+
+    return {};
+}
 }  // namespace opentxs::crypto::key::implementation
@@ -14,6 +14,7 @@
 #include <QString>
 #include <QStringList>
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <memory>
@@ -211,6 +212,15 @@ auto AccountActivityQt::sendToContact(
     }
 }
 
+auto AccountActivityQt::setViewport(int first, int count) const noexcept
+    -> void
+{
+    if ((0 > first) || (0 > count)) { return; }
+
+    imp_->parent_.SetViewport(
+        static_cast<std::size_t>(first), static_cast<std::size_t>(count));
+}
+
 auto AccountActivityQt::syncPercentage() const noexcept -> double
 {
     return imp_->parent_.SyncPercentage();
@@ -11,6 +11,7 @@
 #include <QObject>
 #include <QString>
 #include <QVariant>
+#include <cstddef>
 #include <memory>
 
 #include "interface/qt/DraftValidator.hpp"
@@ -165,6 +166,15 @@ auto ActivityThreadQt::setDraft(QString draft) -> void
     imp_->parent_.SetDraft(draft.toStdString());
 }
 
+auto ActivityThreadQt::setViewport(int first, int count) const noexcept
+    -> void
+{
+    if ((0 > first) || (0 > count)) { return; }
+
+    imp_->parent_.SetViewport(
+        static_cast<std::size_t>(first), static_cast<std::size_t>(count));
+}
+
 auto ActivityThreadQt::threadID() const noexcept -> QString
 {
     return imp_->parent_.ThreadID().c_str();
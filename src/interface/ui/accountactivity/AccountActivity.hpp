@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <functional>
 #include <mutex>
 #include <utility>
@@ -144,6 +145,12 @@ public:
     {
         return contract_.get();
     }
+    auto Count() const noexcept -> std::size_t override
+    {
+        auto lock = rLock{recursive_lock_};
+
+        return size();
+    }
     auto DepositAddress() const noexcept -> UnallocatedCString override
     {
         return DepositAddress(blockchain::Type::Unknown);
@@ -222,6 +229,11 @@ public:
         return false;
     }
     auto SendMonitor() const noexcept -> implementation::SendMonitor& final;
+    auto SetViewport(
+        [[maybe_unused]] std::size_t first,
+        [[maybe_unused]] std::size_t count) const noexcept -> void override
+    {
+    }
     auto SyncPercentage() const noexcept -> double override { return 100; }
     auto SyncProgress() const noexcept -> std::pair<int, int> override
     {
@@ -7,9 +7,12 @@
 #include "1_Internal.hpp"  // IWYU pragma: associated
 #include "interface/ui/accountactivity/BlockchainAccountActivity.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <functional>
 #include <future>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <string_view>
@@ -17,6 +20,7 @@
 
 #include "Proto.tpp"
 #include "interface/ui/base/List.hpp"
+#include "interface/ui/base/Viewport.hpp"
 #include "interface/ui/base/Widget.hpp"
 #include "internal/api/crypto/blockchain/Types.hpp"
 #include "internal/blockchain/Blockchain.hpp"
@@ -56,6 +60,7 @@
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/Pimpl.hpp"
+#include "opentxs/util/Time.hpp"
 #include "serialization/protobuf/BlockchainTransaction.pb.h"
 #include "serialization/protobuf/PaymentEvent.pb.h"
 #include "serialization/protobuf/PaymentWorkflow.pb.h"
@@ -100,6 +105,10 @@ BlockchainAccountActivity::BlockchainAccountActivity(
           "BlockchainAccountActivity"))
     , progress_()
     , height_(0)
+    , viewport_(false)
+    , timestamps_()
+    , index_()
+    , count_(0)
 {
     const auto connected = balance_socket_->Start(
         Widget::api_.Endpoints().BlockchainBalance().data());
@@ -148,6 +157,43 @@ auto BlockchainAccountActivity::display_balance(
     return blockchain::internal::Format(chain_, value);
 }
 
+auto BlockchainAccountActivity::index_transaction(
+    const Data& txid,
+    const blockchain::bitcoin::block::Transaction& tx) noexcept -> bool
+{
+    const auto key = blockchain::block::pTxid{txid};
+    const auto time = timestamp(tx);
+
+    if (auto i = timestamps_.find(key); timestamps_.end() != i) {
+        if (const auto& previous = i->second; previous.has_value()) {
+            const auto item = std::make_pair(previous.value(), key);
+            const auto it = std::lower_bound(
+                index_.begin(), index_.end(), item, newest_first);
+
+            if ((index_.end() != it) && (it->second == key)) {
+                index_.erase(it);
+            }
+        }
+
+        timestamps_.erase(i);
+    }
+
+    timestamps_.emplace(key, time);
+
+    if (false == time.has_value()) { return false; }
+
+    const auto item = std::make_pair(time.value(), key);
+    const auto it =
+        std::lower_bound(index_.begin(), index_.end(), item, newest_first);
+    const auto position =
+        static_cast<std::size_t>(std::distance(index_.begin(), it));
+    index_.emplace(it, item);
+    viewport_.Resize(index_.size());
+    count_.store(index_.size());
+
+    return Viewport::Contains(viewport_.Load(), position);
+}
+
 auto BlockchainAccountActivity::load_thread() noexcept -> void
 {
     const auto transactions =
@@ -163,17 +209,67 @@ auto BlockchainAccountActivity::load_thread() noexcept -> void
             return {};
         }
     }();
-    auto active = UnallocatedSet<AccountActivityRowID>{};
+    auto index = decltype(index_){};
+    index.reserve(transactions.size());
 
     for (const auto& txid : transactions) {
-        if (const auto id = process_txid(txid); id.has_value()) {
-            active.emplace(id.value());
+        auto it = timestamps_.find(txid);
+
+        if (timestamps_.end() == it) {
+            // NOTE only transactions which have not been seen before must be
+            // loaded to place them in the index
+            const auto pTX =
+                Widget::api_.Crypto().Blockchain().LoadTransactionBitcoin(
+                    txid);
+
+            if (false == bool(pTX)) { continue; }
+
+            it = timestamps_.emplace(txid, timestamp(*pTX)).first;
+        }
+
+        if (const auto& time = it->second; time.has_value()) {
+            index.emplace_back(time.value(), txid);
         }
     }
 
+    std::sort(index.begin(), index.end(), newest_first);
+    index_.swap(index);
+    viewport_.Resize(index_.size());
+    count_.store(index_.size());
+    load_window(true);
+}
+
+auto BlockchainAccountActivity::load_window(bool refresh) noexcept -> void
+{
+    auto active = UnallocatedSet<AccountActivityRowID>{};
+    viewport_.Update(
+        refresh,
+        [&](auto i) {
+            const auto id = row_id(index_.at(i).second);
+
+            if (false == find_index(id).has_value()) { return false; }
+
+            active.emplace(id);
+
+            return true;
+        },
+        [&](auto i) {
+            const auto row = process_txid(index_.at(i).second);
+
+            if (row.has_value()) { active.emplace(row.value()); }
+        });
     delete_inactive(active);
 }
 
+auto BlockchainAccountActivity::newest_first(
+    const std::pair<Time, blockchain::block::pTxid>& lhs,
+    const std::pair<Time, blockchain::block::pTxid>& rhs) noexcept -> bool
+{
+    if (lhs.first != rhs.first) { return lhs.first > rhs.first; }
+
+    return lhs.second < rhs.second;
+}
+
 auto BlockchainAccountActivity::pipeline(const Message& in) noexcept -> void
 {
     if (false == running_.load()) { return; }
@@ -223,6 +319,9 @@ auto BlockchainAccountActivity::pipeline(const Message& in) noexcept -> void
         case Work::sync: {
             process_sync(in);
         } break;
+        case Work::viewport: {
+            process_viewport(in);
+        } break;
         case Work::init: {
             startup();
             finish_startup();
@@ -249,6 +348,7 @@ auto BlockchainAccountActivity::print(Work type) noexcept -> const char*
         {Work::reorg, "reorg"},
         {Work::statechange, "statechange"},
         {Work::sync, "sync"},
+        {Work::viewport, "viewport"},
         {Work::init, "init"},
         {Work::statemachine, "statemachine"},
     };
@@ -431,7 +531,11 @@ auto BlockchainAccountActivity::process_txid(const Message& in) noexcept -> void
     if (chain != chain_) { return; }
 
     const auto proto = proto::Factory<proto::BlockchainTransaction>(body.at(3));
-    process_txid(txid, factory::BitcoinTransaction(api, proto));
+    auto pTX = factory::BitcoinTransaction(api, proto);
+
+    if (false == bool(pTX)) { return; }
+
+    if (index_transaction(txid, *pTX)) { process_txid(txid, std::move(pTX)); }
 }
 
 auto BlockchainAccountActivity::process_txid(const Data& txid) noexcept
@@ -446,9 +550,7 @@ auto BlockchainAccountActivity::process_txid(
     std::unique_ptr<const blockchain::bitcoin::block::Transaction> pTX) noexcept
     -> std::optional<AccountActivityRowID>
 {
-    const auto rowID = AccountActivityRowID{
-        blockchain_thread_item_id(Widget::api_.Crypto(), chain_, txid),
-        proto::PAYMENTEVENTTYPE_COMPLETE};
+    const auto rowID = row_id(txid);
 
     if (false == bool(pTX)) { return std::nullopt; }
 
@@ -480,6 +582,27 @@ auto BlockchainAccountActivity::process_txid(
     return std::move(rowID);
 }
 
+auto BlockchainAccountActivity::process_viewport(const Message& in) noexcept
+    -> void
+{
+    const auto body = in.Body();
+
+    OT_ASSERT(2 < body.size());
+
+    const auto first = body.at(1).as<std::size_t>();
+    const auto count = body.at(2).as<std::size_t>();
+
+    if (viewport_.Set(first, count)) { load_window(false); }
+}
+
+auto BlockchainAccountActivity::row_id(const Data& txid) const noexcept
+    -> AccountActivityRowID
+{
+    return {
+        blockchain_thread_item_id(Widget::api_.Crypto(), chain_, txid),
+        proto::PAYMENTEVENTTYPE_COMPLETE};
+}
+
 auto BlockchainAccountActivity::Send(
     const UnallocatedCString& address,
     const Amount& amount,
@@ -520,8 +643,32 @@ auto BlockchainAccountActivity::Send(
     }
 }
 
+auto BlockchainAccountActivity::SetViewport(
+    std::size_t first,
+    std::size_t count) const noexcept -> void
+{
+    pipeline_.Push([&] {
+        auto out = network::zeromq::tagged_message(Work::viewport);
+        out.AddFrame(first);
+        out.AddFrame(count);
+
+        return out;
+    }());
+}
+
 auto BlockchainAccountActivity::startup() noexcept -> void { load_thread(); }
 
+auto BlockchainAccountActivity::timestamp(
+    const blockchain::bitcoin::block::Transaction& tx) const noexcept
+    -> std::optional<Time>
+{
+    const auto& internal = tx.Internal();
+
+    if (false == contains(internal.Chains(), chain_)) { return std::nullopt; }
+
+    return internal.Timestamp();
+}
+
 auto BlockchainAccountActivity::ValidateAddress(
     const UnallocatedCString& in) const noexcept -> bool
 {
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -20,6 +21,7 @@
 #include "interface/qt/SendMonitor.hpp"
 #include "interface/ui/accountactivity/AccountActivity.hpp"
 #include "interface/ui/base/List.hpp"
+#include "interface/ui/base/Viewport.hpp"
 #include "interface/ui/base/Widget.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/core/Core.hpp"
@@ -43,6 +45,7 @@
 #include "opentxs/network/zeromq/socket/Dealer.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/SharedPimpl.hpp"
+#include "opentxs/util/Time.hpp"
 #include "opentxs/util/Types.hpp"
 #include "opentxs/util/WorkType.hpp"
 #include "serialization/protobuf/PaymentWorkflowEnums.pb.h"
@@ -111,6 +114,10 @@ public:
     {
         return opentxs::blockchain::UnitID(Widget::api_, chain_).str();
     }
+    auto Count() const noexcept -> std::size_t final
+    {
+        return count_.load();
+    }
     using AccountActivity::DepositAddress;
     auto DepositAddress() const noexcept -> UnallocatedCString final
     {
@@ -155,6 +162,8 @@ public:
         const UnallocatedCString& memo,
         Scale scale,
         SendMonitor::Callback cb) const noexcept -> int final;
+    auto SetViewport(std::size_t first, std::size_t count) const noexcept
+        -> void final;
     auto SyncPercentage() const noexcept -> double final
     {
         return progress_.get_percentage();
@@ -231,6 +240,7 @@ private:
         reorg = value(WorkType::BlockchainReorg),
         statechange = value(WorkType::BlockchainStateChange),
         sync = value(WorkType::BlockchainSyncProgress),
+        viewport = OT_ZMQ_INTERNAL_SIGNAL + 0,
         init = OT_ZMQ_INIT_SIGNAL,
         statemachine = OT_ZMQ_STATE_MACHINE_SIGNAL,
     };
@@ -241,13 +251,29 @@ private:
     OTZMQDealerSocket balance_socket_;
     Progress progress_;
     blockchain::block::Height height_;
+    Viewport viewport_;
+    // NOTE transactions which do not belong to this chain have no timestamp
+    UnallocatedMap<blockchain::block::pTxid, std::optional<Time>> timestamps_;
+    UnallocatedVector<std::pair<Time, blockchain::block::pTxid>> index_;
+    std::atomic<std::size_t> count_;
 
+    static auto newest_first(
+        const std::pair<Time, blockchain::block::pTxid>& lhs,
+        const std::pair<Time, blockchain::block::pTxid>& rhs) noexcept
+        -> bool;
     static auto print(Work type) noexcept -> const char*;
 
     auto display_balance(opentxs::Amount value) const noexcept
         -> UnallocatedCString final;
+    auto row_id(const Data& txid) const noexcept -> AccountActivityRowID;
+    auto timestamp(const blockchain::bitcoin::block::Transaction& tx)
+        const noexcept -> std::optional<Time>;
 
+    auto index_transaction(
+        const Data& txid,
+        const blockchain::bitcoin::block::Transaction& tx) noexcept -> bool;
     auto load_thread() noexcept -> void;
+    auto load_window(bool refresh) noexcept -> void;
     auto pipeline(const Message& in) noexcept -> void final;
     auto process_balance(const Message& in) noexcept -> void;
     auto process_block(const Message& in) noexcept -> void;
@@ -264,6 +290,7 @@ private:
         const Data& txid,
         std::unique_ptr<const blockchain::bitcoin::block::Transaction>
             tx) noexcept -> std::optional<AccountActivityRowID>;
+    auto process_viewport(const Message& in) noexcept -> void;
     auto startup() noexcept -> void final;
 };
 }  // namespace opentxs::ui::implementation
@@ -7,8 +7,10 @@
 #include "1_Internal.hpp"  // IWYU pragma: associated
 #include "interface/ui/activitythread/ActivityThread.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <future>
@@ -20,6 +22,7 @@
 
 #include "Proto.hpp"
 #include "interface/ui/base/List.hpp"
+#include "interface/ui/base/Viewport.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/Mutex.hpp"
@@ -47,6 +50,7 @@
 #include "opentxs/network/zeromq/Pipeline.hpp"
 #include "opentxs/network/zeromq/message/Frame.hpp"
 #include "opentxs/network/zeromq/message/FrameSection.hpp"
+#include "opentxs/network/zeromq/message/Message.hpp"
 #include "opentxs/otx/LastReplyStatus.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
@@ -97,6 +101,9 @@ ActivityThread::ActivityThread(
     , draft_()
     , draft_tasks_()
     , callbacks_()
+    , viewport_(true)
+    , index_()
+    , count_(0)
 {
     init_executor({
         api.Activity().ThreadPublisher(primary_id_),
@@ -158,6 +165,14 @@ auto ActivityThread::ClearCallbacks() const noexcept -> void
     callbacks_ = std::nullopt;
 }
 
+auto ActivityThread::Count() const noexcept -> std::size_t
+{
+    wait_for_startup();
+    auto lock = rLock{recursive_lock_};
+
+    return count_.load() + draft_tasks_.size();
+}
+
 auto ActivityThread::comma(const UnallocatedSet<UnallocatedCString>& list)
     const noexcept -> UnallocatedCString
 {
@@ -252,16 +267,56 @@ auto ActivityThread::load_contacts(const proto::StorageThread& thread) noexcept
 auto ActivityThread::load_thread(const proto::StorageThread& thread) noexcept
     -> void
 {
-    LogDetail()(OT_PRETTY_CLASS())("Loading ")(thread.item().size())(" items.")
+    const auto key = [](const proto::StorageThreadItem& item) {
+        return ActivityThreadSortKey{
+            std::chrono::seconds(item.time()), item.index()};
+    };
+    index_.assign(thread.item().begin(), thread.item().end());
+    std::stable_sort(
+        index_.begin(), index_.end(), [&](const auto& lhs, const auto& rhs) {
+            return key(lhs) < key(rhs);
+        });
+    viewport_.Resize(index_.size());
+    count_.store(index_.size());
+}
+
+auto ActivityThread::load_window(bool refresh) noexcept -> void
+{
+    const auto load = viewport_.Load();
+    LogDetail()(OT_PRETTY_CLASS())("Loading items ")(load.first)(" to ")(
+        load.second)(" of ")(index_.size())
         .Flush();
+    auto active = UnallocatedSet<ActivityThreadRowID>{};
+    viewport_.Update(
+        refresh,
+        [&](auto i) {
+            const auto id = row_id(index_.at(i));
 
-    for (const auto& item : thread.item()) {
-        try {
-            process_item(item);
-        } catch (...) {
-            continue;
-        }
+            if (false == find_index(id).has_value()) { return false; }
+
+            active.emplace(id);
+
+            return true;
+        },
+        [&](auto i) {
+            try {
+                active.emplace(process_item(index_.at(i)));
+            } catch (...) {
+            }
+        });
+
+    const auto drafts = [&] {
+        auto lock = rLock{recursive_lock_};
+
+        return draft_tasks_;
+    }();
+
+    for (const auto& [taskID, job] : drafts) {
+        const auto& [rowid, future] = job;
+        active.emplace(rowid);
     }
+
+    delete_inactive(active);
 }
 
 auto ActivityThread::new_thread() noexcept -> void
@@ -411,6 +466,9 @@ auto ActivityThread::pipeline(Message&& in) noexcept -> void
         case Work::messagability: {
             process_messagability(in);
         } break;
+        case Work::viewport: {
+            process_viewport(in);
+        } break;
         case Work::init: {
             startup();
         } break;
@@ -461,10 +519,7 @@ auto ActivityThread::process_contact(const Message& in) noexcept -> void
 auto ActivityThread::process_item(
     const proto::StorageThreadItem& item) noexcept(false) -> ActivityThreadRowID
 {
-    const auto id = ActivityThreadRowID{
-        Widget::api_.Factory().Identifier(item.id()),
-        static_cast<otx::client::StorageBox>(item.box()),
-        Widget::api_.Factory().Identifier(item.account())};
+    const auto id = row_id(item);
     const auto& [itemID, box, account] = id;
     const auto key =
         ActivityThreadSortKey{std::chrono::seconds(item.time()), item.index()};
@@ -646,6 +701,19 @@ auto ActivityThread::process_thread(const Message& message) noexcept -> void
     refresh_thread();
 }
 
+auto ActivityThread::process_viewport(const Message& message) noexcept
+    -> void
+{
+    const auto body = message.Body();
+
+    OT_ASSERT(2 < body.size());
+
+    const auto first = body.at(1).as<std::size_t>();
+    const auto count = body.at(2).as<std::size_t>();
+
+    if (viewport_.Set(first, count)) { load_window(false); }
+}
+
 auto ActivityThread::refresh_thread() noexcept -> void
 {
     auto thread = proto::StorageThread{};
@@ -654,30 +722,17 @@ auto ActivityThread::refresh_thread() noexcept -> void
 
     OT_ASSERT(loaded)
 
-    auto active = UnallocatedSet<ActivityThreadRowID>{};
-
-    for (const auto& item : thread.item()) {
-        try {
-            const auto itemID = process_item(item);
-            active.emplace(itemID);
-        } catch (...) {
-
-            continue;
-        }
-    }
-
-    const auto drafts = [&] {
-        auto lock = rLock{recursive_lock_};
-
-        return draft_tasks_;
-    }();
-
-    for (const auto& [taskID, job] : drafts) {
-        const auto& [rowid, future] = job;
-        active.emplace(rowid);
-    }
+    load_thread(thread);
+    load_window(true);
+}
 
-    delete_inactive(active);
+auto ActivityThread::row_id(const proto::StorageThreadItem& item)
+    const noexcept -> ActivityThreadRowID
+{
+    return {
+        Widget::api_.Factory().Identifier(item.id()),
+        static_cast<otx::client::StorageBox>(item.box()),
+        Widget::api_.Factory().Identifier(item.account())};
 }
 
 auto ActivityThread::send_cheque(
@@ -827,6 +882,18 @@ auto ActivityThread::SetDraft(const UnallocatedCString& draft) const noexcept
     return true;
 }
 
+auto ActivityThread::SetViewport(std::size_t first, std::size_t count)
+    const noexcept -> void
+{
+    pipeline_.Push([&] {
+        auto out = zmq::tagged_message(Work::viewport);
+        out.AddFrame(first);
+        out.AddFrame(count);
+
+        return out;
+    }());
+}
+
 auto ActivityThread::set_participants() noexcept -> void
 {
     auto& participants = const_cast<UnallocatedCString&>(participants_);
@@ -849,7 +916,10 @@ auto ActivityThread::startup() noexcept -> void
     auto changed = update_display_name();
     changed |= update_payment_codes();
 
-    if (loaded) { load_thread(thread); }
+    if (loaded) {
+        load_thread(thread);
+        load_window(false);
+    }
 
     if (changed) { UpdateNotify(); }
 
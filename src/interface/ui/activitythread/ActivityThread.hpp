@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <functional>
 #include <future>
 #include <memory>
@@ -20,6 +22,7 @@
 #include "Proto.hpp"
 #include "core/Worker.hpp"
 #include "interface/ui/base/List.hpp"
+#include "interface/ui/base/Viewport.hpp"
 #include "interface/ui/base/Widget.hpp"
 #include "internal/interface/ui/UI.hpp"
 #include "opentxs/Version.hpp"
@@ -127,6 +130,7 @@ class ActivityThread final : public ActivityThreadList, Worker<ActivityThread>
 public:
     auto CanMessage() const noexcept -> bool final;
     auto ClearCallbacks() const noexcept -> void final;
+    auto Count() const noexcept -> std::size_t final;
     auto DisplayName() const noexcept -> UnallocatedCString final;
     auto GetDraft() const noexcept -> UnallocatedCString final;
     auto Participants() const noexcept -> UnallocatedCString final;
@@ -144,6 +148,8 @@ public:
         -> UnallocatedCString final;
     auto SendDraft() const noexcept -> bool final;
     auto SetDraft(const UnallocatedCString& draft) const noexcept -> bool final;
+    auto SetViewport(std::size_t first, std::size_t count) const noexcept
+        -> void final;
     auto ThreadID() const noexcept -> UnallocatedCString final;
 
     auto SetCallbacks(Callbacks&&) noexcept -> void final;
@@ -171,6 +177,7 @@ private:
         message_loaded = value(WorkType::MessageLoaded),
         otx = value(WorkType::OTXTaskComplete),
         messagability = value(WorkType::OTXMessagability),
+        viewport = OT_ZMQ_INTERNAL_SIGNAL + 0,
         init = OT_ZMQ_INIT_SIGNAL,
         statemachine = OT_ZMQ_STATE_MACHINE_SIGNAL,
     };
@@ -186,6 +193,9 @@ private:
     mutable UnallocatedCString draft_;
     mutable UnallocatedMap<api::session::OTX::TaskID, DraftTask> draft_tasks_;
     mutable std::optional<Callbacks> callbacks_;
+    Viewport viewport_;
+    UnallocatedVector<proto::StorageThreadItem> index_;
+    std::atomic<std::size_t> count_;
 
     auto calculate_display_name() const noexcept -> UnallocatedCString;
     auto calculate_participants() const noexcept -> UnallocatedCString;
@@ -197,6 +207,8 @@ private:
         const ActivityThreadSortKey& index,
         CustomData& custom) const noexcept -> RowPointer final;
     auto from(bool outgoing) const noexcept -> UnallocatedCString;
+    auto row_id(const proto::StorageThreadItem& item) const noexcept
+        -> ActivityThreadRowID;
     auto send_cheque(
         const Amount amount,
         const Identifier& sourceAccount,
@@ -206,6 +218,7 @@ private:
 
     auto load_contacts(const proto::StorageThread& thread) noexcept -> void;
     auto load_thread(const proto::StorageThread& thread) noexcept -> void;
+    auto load_window(bool refresh) noexcept -> void;
     auto new_thread() noexcept -> void;
     auto pipeline(Message&& in) noexcept -> void;
     auto process_contact(const Message& message) noexcept -> void;
@@ -215,6 +228,7 @@ private:
     auto process_message_loaded(const Message& message) noexcept -> void;
     auto process_otx(const Message& message) noexcept -> void;
     auto process_thread(const Message& message) noexcept -> void;
+    auto process_viewport(const Message& message) noexcept -> void;
     auto refresh_thread() noexcept -> void;
     auto set_participants() noexcept -> void;
     auto state_machine() noexcept -> bool final;
@@ -7,8 +7,11 @@
 
 #include <algorithm>
 #include <functional>
+#include <iterator>
 #include <optional>
+#include <stdexcept>
 
+#include "interface/ui/base/RankedList.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 
@@ -39,8 +42,8 @@ public:
         RowID id_;
         RowPointer item_;
     };
-    using Data = UnallocatedList<Row>;
-    using Iterator = typename Data::iterator;
+    using Data = RankedList<Row>;
+    using Iterator = typename Data::Iterator;
     using Index = UnallocatedMap<RowID, Iterator>;
     using Insert = std::pair<Iterator, internal::Row*>;
     using Position = std::pair<Iterator, std::size_t>;
@@ -80,14 +83,12 @@ public:
             throw std::out_of_range("Invalid position");
         }
 
-        auto output = data_.begin();
-        std::advance(output, eff);
-
-        return *output;
+        return *data_.at(eff);
     }
     auto get(const RowID& id) -> Row& { return *index_.at(id); }
     auto begin() noexcept -> Iterator { return data_.begin(); }
-    auto delete_row(const RowID& id, Iterator position) noexcept -> void
+    auto delete_row(const RowID& id, const Iterator& position) noexcept
+        -> void
     {
         data_.erase(position);
         index_.erase(id);
@@ -99,10 +100,7 @@ public:
         try {
             const auto it = index_.at(id);
 
-            return Position{
-                it,
-                static_cast<std::size_t>(std::distance(data_.begin(), it)) +
-                    offset_};
+            return Position{it, data_.rank(it) + offset_};
 
         } catch (...) {
 
@@ -112,22 +110,9 @@ public:
     auto find_insert_position(const SortKey& key, const RowID& id) noexcept
         -> Insert
     {
-        auto output = Insert{data_.end(), nullptr};
+        auto output = Insert{find(key, id), nullptr};
         auto& [it, before] = output;
 
-        for (auto i{data_.begin()}; i != data_.end(); ++i) {
-            const auto& [rKey, rId, item] = *i;
-
-            if (sort(key, id, rKey, rId)) {
-
-                continue;
-            } else {
-                it = i;
-
-                break;
-            }
-        }
-
         if (data_.begin() != it) {
             const auto& [rKey, rId, item] = *std::prev(it);
             before = item.get();
@@ -160,19 +145,9 @@ public:
             return std::nullopt;
         }
 
-        for (auto i{data_.begin()}; i != data_.end(); ++i) {
-            const auto& [rKey, rId, item] = *i;
+        it = find(newKey, newID);
 
-            if (sort(newKey, newID, rKey, rId)) {
-                before = item.get();
-
-                continue;
-            }
-
-            it = i;
-
-            break;
-        }
+        if (data_.begin() != it) { before = std::prev(it)->item_.get(); }
 
         return std::move(output);
     }
@@ -180,9 +155,7 @@ public:
     {
         try {
 
-            return static_cast<std::size_t>(
-                       std::distance(data_.begin(), index_.at(id))) +
-                   offset_;
+            return data_.rank(index_.at(id)) + offset_;
         } catch (...) {
 
             return std::nullopt;
@@ -195,21 +168,21 @@ public:
         const RowPointer& item) noexcept -> RowPointer
     {
         auto& index = index_[id];
-        index = data_.emplace(position, Row{key, id, item});
+        index = data_.insert(position, Row{key, id, item});
 
         return index->item_;
     }
     auto move_before(
         const RowID& oldId,
-        Iterator oldPosition,
+        const Iterator& oldPosition,
         const SortKey& newKey,
         const RowID& newID,
-        Iterator newPosition) noexcept -> void
+        const Iterator& newPosition) noexcept -> void
     {
         index_.erase(oldId);
         auto& oldData = *oldPosition;
         auto& index = index_[newID];
-        index = data_.emplace(newPosition, Row{newKey, newID, oldData.item_});
+        index = data_.insert(newPosition, Row{newKey, newID, oldData.item_});
         data_.erase(oldPosition);
     }
 
@@ -230,6 +203,14 @@ private:
     auto compare_id(const RowID& lhs, const RowID& rhs) const noexcept -> bool;
     auto compare_key(const SortKey& lhs, const SortKey& rhs) const noexcept
         -> bool;
+    // NOTE rows are kept in sort order so the insert position is the first
+    // row which the incoming row does not sort after
+    auto find(const SortKey& key, const RowID& id) const noexcept -> Iterator
+    {
+        return data_.partition_point([&](const auto& row) {
+            return sort(key, id, row.key_, row.id_);
+        });
+    }
 
     auto sort(
         const SortKey& incomingKey,
@@ -0,0 +1,354 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <utility>
+
+namespace opentxs::ui::implementation
+{
+/// Sequence container with O(log n) positional insert, erase, rank and
+/// random access
+///
+/// Elements are stored in a treap ordered by position and each node records
+/// the size of its subtree. Iterators remain valid until the element they
+/// refer to is erased.
+template <typename Value>
+class RankedList
+{
+    struct Node {
+        Value value_;
+        std::uint32_t priority_;
+        std::size_t size_;
+        Node* parent_;
+        Node* left_;
+        Node* right_;
+
+        Node(Value&& value, std::uint32_t priority) noexcept
+            : value_(std::move(value))
+            , priority_(priority)
+            , size_(1)
+            , parent_(nullptr)
+            , left_(nullptr)
+            , right_(nullptr)
+        {
+        }
+    };
+
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Value;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        auto operator*() const noexcept -> reference { return node_->value_; }
+        auto operator->() const noexcept -> pointer { return &node_->value_; }
+        auto operator==(const Iterator& rhs) const noexcept -> bool
+        {
+            return node_ == rhs.node_;
+        }
+        auto operator!=(const Iterator& rhs) const noexcept -> bool
+        {
+            return node_ != rhs.node_;
+        }
+
+        auto operator++() noexcept -> Iterator&
+        {
+            node_ = next(node_);
+
+            return *this;
+        }
+        auto operator++(int) noexcept -> Iterator
+        {
+            auto out{*this};
+            ++(*this);
+
+            return out;
+        }
+        auto operator--() noexcept -> Iterator&
+        {
+            if (nullptr == node_) {
+                node_ = rightmost(owner_->root_);
+            } else {
+                node_ = previous(node_);
+            }
+
+            return *this;
+        }
+        auto operator--(int) noexcept -> Iterator
+        {
+            auto out{*this};
+            --(*this);
+
+            return out;
+        }
+
+        Iterator() noexcept
+            : owner_(nullptr)
+            , node_(nullptr)
+        {
+        }
+
+    private:
+        friend RankedList;
+
+        const RankedList* owner_;
+        Node* node_;
+
+        Iterator(const RankedList* owner, Node* node) noexcept
+            : owner_(owner)
+            , node_(node)
+        {
+        }
+    };
+
+    /// Requires pos < size()
+    auto at(std::size_t pos) const noexcept -> Iterator
+    {
+        auto* node = root_;
+
+        while (nullptr != node) {
+            const auto left = size(node->left_);
+
+            if (pos < left) {
+                node = node->left_;
+            } else if (pos == left) {
+
+                break;
+            } else {
+                pos -= (left + 1);
+                node = node->right_;
+            }
+        }
+
+        return {this, node};
+    }
+    /// Requires 0 < size()
+    auto back() const noexcept -> Value& { return rightmost(root_)->value_; }
+    auto begin() const noexcept -> Iterator { return {this, leftmost(root_)}; }
+    auto end() const noexcept -> Iterator { return {this, nullptr}; }
+    /// Returns the first element for which the predicate is false. The
+    /// predicate must be true for some prefix of the sequence and false for
+    /// the remainder.
+    template <typename Predicate>
+    auto partition_point(const Predicate& predicate) const noexcept
+        -> Iterator
+    {
+        auto* node = root_;
+        auto* output = static_cast<Node*>(nullptr);
+
+        while (nullptr != node) {
+            if (predicate(std::as_const(node->value_))) {
+                node = node->right_;
+            } else {
+                output = node;
+                node = node->left_;
+            }
+        }
+
+        return {this, output};
+    }
+    auto rank(const Iterator& it) const noexcept -> std::size_t
+    {
+        if (nullptr == it.node_) { return size(); }
+
+        auto* node = it.node_;
+        auto output = size(node->left_);
+
+        for (; nullptr != node->parent_; node = node->parent_) {
+            if (node->parent_->right_ == node) {
+                output += size(node->parent_->left_) + 1;
+            }
+        }
+
+        return output;
+    }
+    auto size() const noexcept -> std::size_t { return size(root_); }
+
+    auto erase(const Iterator& it) noexcept -> void
+    {
+        auto* node = it.node_;
+
+        if (nullptr == node) { return; }
+
+        // NOTE rotate the node down until it becomes a leaf
+        while ((nullptr != node->left_) || (nullptr != node->right_)) {
+            if (nullptr == node->left_) {
+                rotate_up(node->right_);
+            } else if (nullptr == node->right_) {
+                rotate_up(node->left_);
+            } else if (node->left_->priority_ > node->right_->priority_) {
+                rotate_up(node->left_);
+            } else {
+                rotate_up(node->right_);
+            }
+        }
+
+        auto* parent = node->parent_;
+
+        if (nullptr == parent) {
+            root_ = nullptr;
+        } else if (parent->left_ == node) {
+            parent->left_ = nullptr;
+        } else {
+            parent->right_ = nullptr;
+        }
+
+        for (auto* i = parent; nullptr != i; i = i->parent_) { --i->size_; }
+
+        delete node;
+    }
+    /// Insert a new element immediately before the specified position
+    auto insert(const Iterator& position, Value&& value) noexcept -> Iterator
+    {
+        auto* node = new Node{std::move(value), priority()};
+        auto* next = position.node_;
+
+        if (nullptr == root_) {
+            root_ = node;
+
+            return {this, node};
+        } else if (nullptr == next) {
+            auto* parent = rightmost(root_);
+            parent->right_ = node;
+            node->parent_ = parent;
+        } else if (nullptr == next->left_) {
+            next->left_ = node;
+            node->parent_ = next;
+        } else {
+            auto* parent = rightmost(next->left_);
+            parent->right_ = node;
+            node->parent_ = parent;
+        }
+
+        for (auto* i = node->parent_; nullptr != i; i = i->parent_) {
+            ++i->size_;
+        }
+
+        while ((nullptr != node->parent_) &&
+               (node->parent_->priority_ < node->priority_)) {
+            rotate_up(node);
+        }
+
+        return {this, node};
+    }
+
+    RankedList() noexcept
+        : root_(nullptr)
+        , rng_()
+    {
+    }
+    RankedList(const RankedList&) = delete;
+    RankedList(RankedList&&) = delete;
+    auto operator=(const RankedList&) -> RankedList& = delete;
+    auto operator=(RankedList&&) -> RankedList& = delete;
+
+    ~RankedList() { destroy(root_); }
+
+private:
+    Node* root_;
+    std::minstd_rand rng_;
+
+    static auto destroy(Node* node) noexcept -> void
+    {
+        if (nullptr == node) { return; }
+
+        destroy(node->left_);
+        destroy(node->right_);
+        delete node;
+    }
+    static auto leftmost(Node* node) noexcept -> Node*
+    {
+        if (nullptr == node) { return nullptr; }
+
+        while (nullptr != node->left_) { node = node->left_; }
+
+        return node;
+    }
+    static auto next(Node* node) noexcept -> Node*
+    {
+        if (nullptr != node->right_) { return leftmost(node->right_); }
+
+        while ((nullptr != node->parent_) && (node->parent_->right_ == node)) {
+            node = node->parent_;
+        }
+
+        return node->parent_;
+    }
+    static auto previous(Node* node) noexcept -> Node*
+    {
+        if (nullptr != node->left_) { return rightmost(node->left_); }
+
+        while ((nullptr != node->parent_) && (node->parent_->left_ == node)) {
+            node = node->parent_;
+        }
+
+        return node->parent_;
+    }
+    static auto rightmost(Node* node) noexcept -> Node*
+    {
+        if (nullptr == node) { return nullptr; }
+
+        while (nullptr != node->right_) { node = node->right_; }
+
+        return node;
+    }
+    static auto size(const Node* node) noexcept -> std::size_t
+    {
+        return (nullptr == node) ? 0 : node->size_;
+    }
+    static auto update(Node* node) noexcept -> void
+    {
+        node->size_ = size(node->left_) + size(node->right_) + 1;
+    }
+
+    auto priority() noexcept -> std::uint32_t
+    {
+        return static_cast<std::uint32_t>(rng_());
+    }
+    // NOTE exchange a node with its parent while preserving the order
+    auto rotate_up(Node* node) noexcept -> void
+    {
+        auto* parent = node->parent_;
+        auto* grandparent = parent->parent_;
+
+        if (parent->left_ == node) {
+            parent->left_ = node->right_;
+
+            if (nullptr != node->right_) { node->right_->parent_ = parent; }
+
+            node->right_ = parent;
+        } else {
+            parent->right_ = node->left_;
+
+            if (nullptr != node->left_) { node->left_->parent_ = parent; }
+
+            node->left_ = parent;
+        }
+
+        parent->parent_ = node;
+        node->parent_ = grandparent;
+
+        if (nullptr == grandparent) {
+            root_ = node;
+        } else if (grandparent->left_ == parent) {
+            grandparent->left_ = node;
+        } else {
+            grandparent->right_ = node;
+        }
+
+        update(parent);
+        update(node);
+    }
+};
+}  // namespace opentxs::ui::implementation
@@ -0,0 +1,179 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace opentxs::ui::implementation
+{
+/// Selects which rows of a large list model should be constructed
+///
+/// The complete list is described by storage metadata which is cheap to keep
+/// in memory. Rows are only constructed near the visible range, prefetched
+/// in the direction of scrolling, and released once they fall outside the
+/// retention range. The retention range is wider than the prefetch range so
+/// small scroll reversals do not cause rows to be rebuilt.
+///
+/// Every row is loaded until the first call to Set, so models whose views
+/// never report a visible range behave as if the list was not windowed.
+///
+/// After that the visible range follows the anchored end of the list, which
+/// is the end for lists showing the newest row last and the beginning for
+/// lists showing the newest row first, whenever it is moved to that end.
+class Viewport
+{
+public:
+    /// Half open range of positions
+    using Range = std::pair<std::size_t, std::size_t>;
+
+    static constexpr auto default_rows_ = std::size_t{50};
+    static constexpr auto default_prefetch_ = std::size_t{100};
+    static constexpr auto default_retain_ = std::size_t{400};
+
+    static auto Contains(const Range& range, std::size_t position) noexcept
+        -> bool
+    {
+        return (range.first <= position) && (position < range.second);
+    }
+
+    /// Positions which must be constructed
+    auto Load() const noexcept -> Range
+    {
+        if (false == bounded_) { return {0, size_}; }
+
+        const auto ahead = prefetch_;
+        const auto behind = prefetch_ / 4;
+
+        if (forward_) {
+
+            return clamp(behind, ahead);
+        } else {
+
+            return clamp(ahead, behind);
+        }
+    }
+    /// Positions which may remain constructed
+    auto Retain() const noexcept -> Range
+    {
+        if (false == bounded_) { return {0, size_}; }
+
+        return clamp(retain_, retain_);
+    }
+    auto Size() const noexcept -> std::size_t { return size_; }
+    auto Visible() const noexcept -> Range
+    {
+        if (false == bounded_) { return {0, size_}; }
+
+        return clamp(0, 0);
+    }
+
+    /// Visit the positions of a list model which should contain a row
+    ///
+    /// keep is called for positions whose existing row may be used as it is
+    /// and must return false if the row does not exist. make is called for
+    /// positions in the load range which have no row or must be refreshed.
+    /// Rows at positions which are not visited should be removed.
+    template <typename Keep, typename Make>
+    auto Update(bool refresh, Keep keep, Make make) const noexcept -> void
+    {
+        const auto load = Load();
+        const auto retain = Retain();
+
+        for (auto i = retain.first; i < retain.second; ++i) {
+            const auto required = Contains(load, i);
+
+            // NOTE rows outside the load range are kept if they already exist
+            // but are not constructed or refreshed
+            if (((false == refresh) || (false == required)) && keep(i)) {
+                continue;
+            }
+
+            if (required) { make(i); }
+        }
+    }
+
+    /// Update the total number of rows
+    auto Resize(std::size_t size) noexcept -> void
+    {
+        size_ = size;
+
+        if (follow_) { anchor(); }
+    }
+    /// Move the visible range, returns true if the load range changed
+    auto Set(std::size_t first, std::size_t count) noexcept -> bool
+    {
+        const auto before = Load();
+        bounded_ = true;
+
+        if (first != first_) { forward_ = (first > first_); }
+
+        first_ = first;
+        count_ = count;
+
+        if (tail_) {
+            follow_ = ((first_ + count_) >= size_);
+        } else {
+            follow_ = (0 == first_);
+        }
+
+        return before != Load();
+    }
+
+    Viewport(
+        bool tail,
+        std::size_t prefetch = default_prefetch_,
+        std::size_t retain = default_retain_) noexcept
+        : tail_(tail)
+        , prefetch_(prefetch)
+        , retain_(std::max(retain, prefetch))
+        , size_(0)
+        , first_(0)
+        , count_(default_rows_)
+        , forward_(false == tail)
+        , follow_(true)
+        , bounded_(false)
+    {
+    }
+    Viewport() = delete;
+    Viewport(const Viewport&) = delete;
+    Viewport(Viewport&&) = delete;
+    auto operator=(const Viewport&) -> Viewport& = delete;
+    auto operator=(Viewport&&) -> Viewport& = delete;
+
+    ~Viewport() = default;
+
+private:
+    const bool tail_;
+    const std::size_t prefetch_;
+    const std::size_t retain_;
+    std::size_t size_;
+    std::size_t first_;
+    std::size_t count_;
+    bool forward_;
+    bool follow_;
+    bool bounded_;
+
+    auto anchor() noexcept -> void
+    {
+        if (tail_) {
+            first_ = (size_ > count_) ? size_ - count_ : 0;
+        } else {
+            first_ = 0;
+        }
+    }
+    auto clamp(std::size_t before, std::size_t after) const noexcept -> Range
+    {
+        const auto first = std::min(first_, size_);
+        const auto last = std::min(first + count_, size_);
+
+        return {
+            (first > before) ? first - before : 0,
+            std::min(last + std::min(after, size_), size_)};
+    }
+};
+}  // namespace opentxs::ui::implementation
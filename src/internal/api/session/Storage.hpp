@@ -19,6 +19,14 @@ namespace key
 class Symmetric;
 }  // namespace key
 }  // namespace crypto
+
+namespace storage
+{
+namespace gc
+{
+struct Progress;
+}  // namespace gc
+}  // namespace storage
 // }  // namespace v1
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
@@ -28,6 +36,8 @@ namespace opentxs::api::session::internal
 class Storage : virtual public session::Storage
 {
 public:
+    virtual auto GarbageCollection() const noexcept
+        -> opentxs::storage::gc::Progress = 0;
     virtual auto InitBackup() -> void = 0;
     virtual auto InitEncryptedBackup(opentxs::crypto::key::Symmetric& key)
         -> void = 0;
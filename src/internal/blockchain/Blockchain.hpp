@@ -17,6 +17,7 @@
 #include <utility>
 
 #include "Proto.hpp"
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"
 #include "internal/util/P0330.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
@@ -208,6 +209,11 @@ auto GCS(
     const api::Session& api,
     const proto::GCS& serialized,
     alloc::Default alloc) noexcept -> blockchain::GCS;
+auto GCS(
+    const api::Session& api,
+    const proto::GCS& serialized,
+    std::shared_ptr<const gcs::Elements> decoded,
+    alloc::Default alloc) noexcept -> blockchain::GCS;
 auto GCS(
     const api::Session& api,
     const ReadView serialized,
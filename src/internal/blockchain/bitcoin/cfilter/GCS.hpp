@@ -43,6 +43,22 @@ auto GolombDecode(
     const std::uint8_t P,
     const Vector<std::byte>& encoded,
     alloc::Default alloc) noexcept(false) -> Elements;
+auto GolombDecode(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const ReadView encoded,
+    alloc::Default alloc) noexcept(false) -> Elements;
+/// Decode the filter and append every element of targets which is present
+///
+/// targets must be sorted. Decoding stops as soon as every target has been
+/// passed, or after the first match if first is true.
+auto GolombMatch(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const ReadView encoded,
+    const Elements& targets,
+    const bool first,
+    Elements& matches) noexcept(false) -> void;
 auto GolombEncode(
     const std::uint8_t P,
     const Elements& hashedSet,
@@ -60,10 +76,19 @@ auto HashedSetConstruct(
     const std::uint32_t M,
     const blockchain::GCS::Targets& items,
     alloc::Default alloc) noexcept(false) -> Elements;
+auto Siphash(const ReadView key, const ReadView item) noexcept(false) -> Hash;
+/// Hash every item with the same key
+///
+/// The key schedule is computed once per call and items are hashed several at
+/// a time using the widest vector instructions supported by the cpu.
 auto Siphash(
-    const api::Session& api,
     const ReadView key,
-    const ReadView item) noexcept(false) -> Hash;
+    const blockchain::GCS::Targets& items,
+    alloc::Default alloc) noexcept(false) -> Hashes;
+auto Siphash(
+    const ReadView key,
+    const blockchain::GCS::Targets& items,
+    Hashes& out) noexcept(false) -> void;
 }  // namespace opentxs::gcs
 
 namespace opentxs::blockchain::internal
@@ -5,12 +5,14 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 #include "internal/blockchain/database/Types.hpp"
 #include "opentxs/blockchain/block/Position.hpp"
 #include "opentxs/blockchain/block/Types.hpp"
 #include "opentxs/util/Allocator.hpp"
+#include "opentxs/util/Container.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -50,6 +52,12 @@ public:
     // Throws std::out_of_range if no block at that position
     virtual auto BestBlock(const block::Height position) const noexcept(false)
         -> block::Hash = 0;
+    // Loads up to count consecutive best chain hashes starting from start in
+    // a single transaction. Stops early at the first missing height.
+    virtual auto BestBlocks(
+        const block::Height start,
+        const std::size_t count,
+        alloc::Resource* alloc) const noexcept -> Vector<block::Hash> = 0;
     virtual auto CurrentBest() const noexcept
         -> std::unique_ptr<block::Header> = 0;
     virtual auto CurrentCheckpoint() const noexcept -> block::Position = 0;
@@ -20,8 +20,12 @@ namespace network
 namespace p2p
 {
 class Block;
-class Data;
 }  // namespace p2p
+
+namespace zeromq
+{
+class Message;
+}  // namespace zeromq
 }  // namespace network
 // }  // namespace v1
 }  // namespace opentxs
@@ -33,10 +37,12 @@ class Sync
 {
 public:
     using Height = block::Height;
-    using Message = network::p2p::Data;
+    using Message = network::zeromq::Message;
 
     virtual auto SyncTip() const noexcept -> block::Position = 0;
 
+    /// Append the stored sync packets following the specified height to a
+    /// reply which already contains the sync data header frames
     virtual auto LoadSync(const Height height, Message& output) noexcept
         -> bool = 0;
     virtual auto ReorgSync(const Height height) noexcept -> bool = 0;
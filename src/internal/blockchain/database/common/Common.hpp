@@ -76,6 +76,7 @@ enum Table {
     FilterIndexBCH = 20,
     FilterIndexES = 21,
     TransactionIndex = 22,
+    FreeSpace = 23,
 };
 
 auto ChainToSyncTable(const opentxs::blockchain::Type chain) noexcept(false)
@@ -8,6 +8,7 @@
 #include <boost/smart_ptr/shared_ptr.hpp>
 #include <string_view>
 
+#include "blockchain/node/blockoracle/MemDB.hpp"
 #include "internal/blockchain/node/Types.hpp"
 #include "opentxs/blockchain/node/BlockOracle.hpp"
 #include "opentxs/util/Container.hpp"
@@ -39,6 +40,7 @@ class BlockOracle final : public node::BlockOracle
 public:
     class Imp;
 
+    auto CacheStats() const noexcept -> Vector<blockoracle::MemDB::Stats>;
     auto DownloadQueue() const noexcept -> std::size_t final;
     auto Endpoint() const noexcept -> std::string_view;
     auto GetBlockBatch() const noexcept -> BlockBatch;
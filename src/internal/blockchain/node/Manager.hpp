@@ -73,6 +73,9 @@ public:
     virtual auto Chain() const noexcept -> Type = 0;
     // amount represents satoshis per 1000 bytes
     virtual auto FeeRate() const noexcept -> Amount = 0;
+    // minimum fee rate of unconfirmed transactions worth downloading from
+    // peers, in satoshis per 1000 bytes
+    virtual auto FeeFilter() const noexcept -> Amount = 0;
     auto FilterOracle() const noexcept -> const node::FilterOracle& final;
     virtual auto FilterOracleInternal() const noexcept
         -> const internal::FilterOracle& = 0;
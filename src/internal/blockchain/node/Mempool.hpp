@@ -38,6 +38,9 @@ public:
         -> UnallocatedSet<UnallocatedCString> = 0;
     virtual auto Query(ReadView txid) const noexcept
         -> std::shared_ptr<const bitcoin::block::Transaction> = 0;
+    /// All transactions which have not yet expired
+    virtual auto Snapshot() const noexcept -> UnallocatedVector<
+        std::shared_ptr<const bitcoin::block::Transaction>> = 0;
     virtual auto Submit(ReadView txid) const noexcept -> bool = 0;
     virtual auto Submit(const UnallocatedVector<ReadView>& txids) const noexcept
         -> UnallocatedVector<bool> = 0;
@@ -44,6 +44,8 @@ namespace opentxs::blockchain::node::filteroracle
 class BlockIndexer
 {
 public:
+    auto Stats() const noexcept -> IndexerStats;
+
     auto Reindex() noexcept -> void;
     auto Start() noexcept -> void;
 
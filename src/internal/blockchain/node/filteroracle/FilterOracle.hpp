@@ -6,6 +6,7 @@
 #pragma once
 
 #include "internal/blockchain/node/Types.hpp"
+#include "internal/blockchain/node/filteroracle/Types.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/Types.hpp"
 #include "opentxs/blockchain/block/Position.hpp"
 #include "opentxs/blockchain/node/FilterOracle.hpp"
@@ -53,6 +54,9 @@ public:
     virtual auto GetFilterJob() const noexcept -> CfilterJob = 0;
     virtual auto GetHeaderJob() const noexcept -> CfheaderJob = 0;
     virtual auto Heartbeat() const noexcept -> void = 0;
+    /// Throughput of the block indexer, which only runs on sync servers
+    virtual auto IndexerStats() const noexcept
+        -> filteroracle::IndexerStats = 0;
     auto Internal() const noexcept -> const internal::FilterOracle& final
     {
         return *this;
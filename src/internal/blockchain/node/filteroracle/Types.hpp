@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <functional>
 #include <string_view>
 
@@ -18,6 +20,30 @@ namespace opentxs::blockchain::node::filteroracle
 using NotifyCallback =
     std::function<void(const cfilter::Type, const block::Position&)>;
 
+/// Cumulative throughput of the block indexer
+///
+/// Each batch of blocks passes through four stages: loading downloaded blocks
+/// from the block oracle, calculating cfilters on the general thread pool,
+/// chaining cfheaders in order, and writing the batch to the database in a
+/// single transaction.
+struct IndexerStats {
+    struct Stage {
+        std::size_t blocks_{};
+        std::chrono::nanoseconds time_{};
+
+        auto Add(std::size_t blocks, std::chrono::nanoseconds time) noexcept
+            -> void;
+        /// Blocks per second
+        auto Rate() const noexcept -> double;
+    };
+
+    Stage load_{};
+    Stage cfilter_{};
+    Stage cfheader_{};
+    Stage store_{};
+    std::size_t batches_{};
+};
+
 // WARNING update print function if new values are added or removed
 enum class BlockIndexerJob : OTZMQWorkType {
     shutdown = value(WorkType::Shutdown),
@@ -50,26 +50,28 @@ auto IntegerToFloat(const Integer& rhs) noexcept -> Float;
 namespace opentxs::internal
 {
 auto FloatToAmount(const amount::Float& rhs) noexcept(false)
-    -> opentxs::Amount::Imp*;
+    -> opentxs::Amount;
 
 class Amount
 {
 public:
     static auto SerializeBitcoinSize() noexcept -> std::size_t;
 
-    virtual auto ExtractInt64() const noexcept(false) -> std::int64_t = 0;
-    virtual auto ExtractUInt64() const noexcept(false) -> std::uint64_t = 0;
-    virtual auto SerializeBitcoin(const AllocateOutput dest) const noexcept
-        -> bool = 0;
-    virtual auto ToFloat() const noexcept -> amount::Float = 0;
+    auto ExtractInt64() const noexcept(false) -> std::int64_t;
+    auto ExtractUInt64() const noexcept(false) -> std::uint64_t;
+    auto SerializeBitcoin(const AllocateOutput dest) const noexcept -> bool;
+    auto ToFloat() const noexcept -> amount::Float;
 
-    Amount() noexcept
-    {
-        static_assert(amount::minimum_integer_bits_ == 128u);
-        static_assert(amount::maximum_integer_bits_ == 320u);
-    }
-    Amount(const Amount&) noexcept = default;
+    Amount(const opentxs::Amount& parent) noexcept;
+    Amount() = delete;
+    Amount(const Amount&) = delete;
+    Amount(Amount&&) = delete;
+    auto operator=(const Amount&) -> Amount& = delete;
+    auto operator=(Amount&&) -> Amount& = delete;
 
-    virtual ~Amount() = default;
+    ~Amount() = default;
+
+private:
+    const opentxs::Amount& parent_;
 };
 }  // namespace opentxs::internal
@@ -242,6 +242,14 @@ public:
     {
         return {};
     }
+    auto ChildKeys(
+        const Bip32Index,
+        const std::size_t,
+        const PasswordPrompt&) const noexcept
+        -> UnallocatedVector<std::unique_ptr<key::HD>> final
+    {
+        return {};
+    }
     auto Depth() const noexcept -> int final { return {}; }
     auto Fingerprint() const noexcept -> Bip32Fingerprint final { return {}; }
     auto Parent() const noexcept -> Bip32Fingerprint final { return {}; }
@@ -5,7 +5,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
+
 #include "Proto.hpp"
+#include "opentxs/util/Bytes.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -30,4 +34,8 @@ auto ZMQFrame(std::size_t size) noexcept -> network::zeromq::Frame;
 auto ZMQFrame(const void* data, const std::size_t size) noexcept
     -> network::zeromq::Frame;
 auto ZMQFrame(const ProtobufType& data) noexcept -> network::zeromq::Frame;
+/// Wrap externally owned memory without copying. The pin is released once
+/// zeromq no longer references the data.
+auto ZMQFrame(const ReadView data, std::shared_ptr<const void> pin) noexcept
+    -> network::zeromq::Frame;
 }  // namespace opentxs::factory
@@ -8,6 +8,7 @@
 #include <irrxml/irrXML.hpp>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <tuple>
 
 #include "internal/otx/Types.hpp"
@@ -275,10 +276,28 @@ private:  // Private prevents erroneous use by other classes.
     friend api::session::imp::Factory;
 
     using ot_super = OTTransactionType;
+    using Numbers = UnallocatedSet<TransactionNumber>;
+    using Index = UnallocatedMap<std::int64_t, Numbers>;
 
     mapOfTransactions m_mapTransactions;  // a ledger contains a map of
                                           // transactions.
-
+    // Secondary indices of m_mapTransactions. These must be updated by
+    // index() and unindex() whenever a transaction is added or removed.
+    Index by_reference_;
+    UnallocatedMap<transactionType, Numbers> by_type_;
+    // The number of origin of a transfer receipt and the cheque number of a
+    // cheque or voucher receipt are only known after instantiating the item
+    // in its reference string, so these are resolved on first lookup and
+    // remembered until the receipt is removed.
+    Numbers unresolved_;
+    UnallocatedMap<TransactionNumber, std::int64_t> resolved_;
+    Index transfers_;
+    Index cheques_;
+
+    auto cheque_number(const OTTransaction& receipt) const
+        -> std::optional<std::int64_t>;
+    auto index(const OTTransaction& transaction) -> void;
+    auto insert(std::shared_ptr<OTTransaction> transaction) -> void;
     auto make_filename(const ledgerType theType) -> std::
         tuple<bool, UnallocatedCString, UnallocatedCString, UnallocatedCString>;
 
@@ -288,10 +307,17 @@ private:  // Private prevents erroneous use by other classes.
         const identifier::Notary& theNotaryID,
         ledgerType theType,
         bool bCreateFile) -> bool;
+    auto resolve(
+        const TransactionNumber number,
+        const OTTransaction& receipt,
+        std::int64_t key) -> void;
     auto save_box(
         const ledgerType type,
         Identifier& hash,
         bool (Ledger::*calc)(Identifier&) const) -> bool;
+    auto transfer_origin(const OTTransaction& receipt) const
+        -> std::optional<std::int64_t>;
+    auto unindex(const OTTransaction& transaction) -> void;
 
     Ledger(const api::Session& api);
     Ledger(
@@ -0,0 +1,72 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Time.hpp"
+
+namespace opentxs
+{
+/// Cron items ordered by the time they are next due for processing
+///
+/// Items are identified by their official transaction number. Items which are
+/// due in the same round are returned in the order they were added to cron,
+/// which is the order a walk of every cron item would visit them in.
+///
+/// Not thread safe, except for Next() which may be read from any thread.
+class CronSchedule
+{
+public:
+    struct Item {
+        /// Time the item was added to cron
+        Time added_{};
+        /// Breaks ties between items added at the same time
+        std::uint64_t sequence_{};
+        std::int64_t number_{};
+    };
+
+    /// Remove and return every item which is due at or before now, in the
+    /// order the items were added
+    auto Due(const Time now) noexcept -> UnallocatedVector<Item>;
+    auto IsScheduled(const std::int64_t number) const noexcept -> bool;
+    /// Earliest deadline, or Time::max() if nothing is scheduled
+    auto Next() const noexcept -> Time;
+
+    /// Schedule a newly added item to be processed in the next round
+    auto Add(const std::int64_t number, const Time added) noexcept -> void;
+    auto Remove(const std::int64_t number) noexcept -> void;
+    /// Replace the deadline of an item, or schedule an item returned by Due()
+    auto Schedule(const Item& item, const Time deadline) noexcept -> void;
+    /// Called whenever an item is added which is due before the previous
+    /// earliest deadline, so a caller which is waiting for that deadline can
+    /// wake up early
+    auto SetWakeup(std::function<void()> callback) noexcept -> void;
+
+    CronSchedule() noexcept;
+    CronSchedule(const CronSchedule&) = delete;
+    CronSchedule(CronSchedule&&) = delete;
+    auto operator=(const CronSchedule&) -> CronSchedule& = delete;
+    auto operator=(CronSchedule&&) -> CronSchedule& = delete;
+
+    ~CronSchedule() = default;
+
+private:
+    using Deadlines = UnallocatedMultimap<Time, Item>;
+
+    Deadlines deadlines_;
+    UnallocatedMap<std::int64_t, Deadlines::iterator> index_;
+    std::uint64_t sequence_;
+    std::atomic<Time> next_;
+    std::function<void()> wakeup_;
+
+    auto unschedule(const std::int64_t number) noexcept -> void;
+    auto update() noexcept -> void;
+};
+}  // namespace opentxs
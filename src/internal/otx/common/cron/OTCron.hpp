@@ -8,9 +8,12 @@
 #include <irrxml/irrXML.hpp>
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <utility>
 
 #include "internal/otx/common/Contract.hpp"
+#include "internal/otx/common/cron/CronSchedule.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/core/identifier/Notary.hpp"
 #include "opentxs/identity/Types.hpp"
@@ -97,6 +100,14 @@ public:
     {
         _cron_max_items_per_nym = nMax;
     }
+    static auto GetEventDrivenMatching() -> bool
+    {
+        return _event_driven_matching;
+    }
+    static void SetEventDrivenMatching(bool bEnabled)
+    {
+        _event_driven_matching = bEnabled;
+    }
     inline auto IsActivated() const -> bool { return m_bIsActivated; }
     inline auto ActivateCron() -> bool
     {
@@ -159,8 +170,18 @@ public:
      * since it will not be replenished again at least until the call has
      * finished.) */
     void ProcessCronItems();
+    /** Called whenever a new item is due before the earliest deadline, so a
+     * caller which is waiting for computeTimeout() to elapse can wake up and
+     * check it again. */
+    void SetWakeup(std::function<void()> callback)
+    {
+        m_Schedule.SetWakeup(std::move(callback));
+    }
 
-    auto computeTimeout() -> std::chrono::milliseconds;
+    /** Time remaining until the next round of cron processing. This is never
+     * less than the time remaining until the next beat, and if no item is due
+     * before then it is the time remaining until the earliest item is due. */
+    auto computeTimeout() const -> std::chrono::milliseconds;
 
     inline void SetNotaryID(const identifier::Notary& NOTARY_ID)
     {
@@ -204,6 +225,9 @@ private:
     // Int. The maximum number of cron items any given Nym can have
     // active at the same time.
     static std::int32_t _cron_max_items_per_nym;
+    // If true, market offers are only matched again after the market has
+    // changed in a way which could allow them to trade.
+    static bool _event_driven_matching;
     static Time last_executed_;
 
     // A list of all valid markets.
@@ -211,6 +235,9 @@ private:
     // Cron Items are found on both lists.
     mapOfCronItems m_mapCronItems;
     multimapOfCronItems m_multimapCronItems;
+    // Cron Items are also ordered by when they are next due, so each round
+    // only visits the items which have something to do.
+    CronSchedule m_Schedule;
     // Always store this in any object that's associated with a specific server.
     OTNotaryID m_NOTARY_ID;
     // I can't put receipts in people's inboxes without a supply of these.
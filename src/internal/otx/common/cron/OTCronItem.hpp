@@ -178,6 +178,10 @@ public:
         return m_PROCESS_INTERVAL;
     }
 
+    /** The time at which ProcessCron should next be called. Items which have
+     * never been processed, or which do not throttle their own processing,
+     * are due immediately. */
+    auto GetCronDeadline() const -> Time;
     inline auto GetCron() const -> OTCron* { return m_pCron; }
     void setServerNym(Nym_p serverNym) { serverNym_ = serverNym; }
     void setNotaryID(const identifier::Notary& notaryID);
@@ -0,0 +1,300 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs
+{
+/// Price level order book for a single market
+///
+/// Offers are grouped into price levels. Within a level offers are kept in the
+/// order they were added, so the first offer at the best price is always the
+/// next one to trade. Both the best bid and the best ask are found in constant
+/// time.
+///
+/// The book maintains a revision number which changes whenever an offer is
+/// added at a price which crosses the top of the other side of the book, or
+/// when a trade executes. An offer which has been matched against the book
+/// does not need to be matched again until the revision changes, since no new
+/// counter offer can have become available to it.
+///
+/// The book does not own the offers.
+template <typename Offer>
+class OrderBook
+{
+public:
+    using Level = UnallocatedList<Offer*>;
+    /// Price levels in ascending price order
+    using Side = UnallocatedMap<Amount, Level>;
+    /// Called for each counter offer which can trade with the offer being
+    /// matched
+    using Fill = std::function<void(Offer&)>;
+    /// Returns true when the offer being matched can not trade any further
+    using Done = std::function<bool()>;
+
+    struct Entry {
+        Offer* offer_{};
+        bool bid_{};
+        typename Side::iterator level_{};
+        typename Level::iterator position_{};
+        std::uint64_t evaluated_{never_};
+    };
+
+    /// Offers indexed by transaction number
+    using Index = UnallocatedMap<std::int64_t, Entry>;
+
+    /// Asks in ascending price order, oldest first within each price
+    auto Asks() const noexcept -> UnallocatedVector<Offer*>
+    {
+        return flatten(asks_);
+    }
+    auto BestAsk() const noexcept -> Amount
+    {
+        // NOTE market orders have a zero price and must not be reported as the
+        // best ask
+        for (const auto& [price, level] : asks_) {
+            if (0 != price) { return price; }
+        }
+
+        return 0;
+    }
+    auto BestBid() const noexcept -> Amount
+    {
+        if (bids_.empty()) { return 0; }
+
+        return bids_.rbegin()->first;
+    }
+    /// Bids in ascending price order, oldest first within each price
+    auto Bids() const noexcept -> UnallocatedVector<Offer*>
+    {
+        return flatten(bids_);
+    }
+    auto Find(const std::int64_t number) const noexcept -> Offer*
+    {
+        if (auto it = index_.find(number); index_.end() != it) {
+
+            return it->second.offer_;
+        }
+
+        return nullptr;
+    }
+    auto AskCount() const noexcept -> std::size_t { return ask_count_; }
+    auto BidCount() const noexcept -> std::size_t { return bid_count_; }
+    auto Offers() const noexcept -> const Index& { return index_; }
+    auto Revision() const noexcept -> std::uint64_t { return revision_; }
+    /// Returns true if the offer must be matched against the book
+    ///
+    /// Market orders, offers which have never been matched, and offers which
+    /// were last matched before the top of the book changed are stale.
+    auto Stale(Offer& offer) const noexcept -> bool
+    {
+        if (offer.IsMarketOrder()) { return true; }
+
+        const auto it = index_.find(offer.GetTransactionNum());
+
+        if (index_.end() == it) { return true; }
+
+        return it->second.evaluated_ != revision_;
+    }
+
+    auto Add(Offer& offer) noexcept -> bool
+    {
+        const auto number = offer.GetTransactionNum();
+
+        if (index_.end() != index_.find(number)) { return false; }
+
+        const auto bid = offer.IsBid();
+        const auto& price = offer.GetPriceLimit();
+        auto& side = bid ? bids_ : asks_;
+        const auto crosses = crosses_book(bid, price);
+        auto level = side.try_emplace(price).first;
+        auto position = level->second.insert(level->second.end(), &offer);
+        index_.try_emplace(number, Entry{&offer, bid, level, position});
+        ++(bid ? bid_count_ : ask_count_);
+
+        if (crosses) { ++revision_; }
+
+        return true;
+    }
+    /// Remove every offer from the book and return them
+    auto Clear() noexcept -> UnallocatedVector<Offer*>
+    {
+        auto out = UnallocatedVector<Offer*>{};
+        out.reserve(index_.size());
+
+        for (const auto& [number, entry] : index_) {
+            out.emplace_back(entry.offer_);
+        }
+
+        index_.clear();
+        bids_.clear();
+        asks_.clear();
+        bid_count_ = 0;
+        ask_count_ = 0;
+        ++revision_;
+
+        return out;
+    }
+    /// Record that the offer has been matched against the current book
+    auto Evaluated(Offer& offer) noexcept -> void
+    {
+        if (auto it = index_.find(offer.GetTransactionNum());
+            index_.end() != it) {
+            it->second.evaluated_ = revision_;
+        }
+    }
+    /// Visit counter offers in priority order
+    ///
+    /// Bids are visited from the highest price down and asks from the lowest
+    /// price up. Counter offers which are market orders are never visited
+    /// since market orders only trade when they are the offer being matched.
+    ///
+    /// Returns false if the offer should be removed from the market.
+    auto Match(Offer& offer, const Fill& fill, const Done& done) -> bool
+    {
+        const auto visit = [&](Offer& counter) -> std::optional<bool> {
+            const auto inRange =
+                offer.IsBid()
+                    ? (counter.GetPriceLimit() <= offer.GetPriceLimit())
+                    : (counter.GetPriceLimit() >= offer.GetPriceLimit());
+
+            if (offer.IsMarketOrder() || inRange) {
+                if ((counter.GetAmountAvailable() >=
+                     offer.GetMinimumIncrement()) &&
+                    (offer.GetAmountAvailable() >=
+                     counter.GetMinimumIncrement())) {
+                    fill(counter);
+                }
+            } else if (offer.IsLimitOrder()) {
+                // NOTE the remaining counter offers are even further away
+                // from the price limit
+
+                return true;
+            }
+
+            if (done()) { return false; }
+
+            return std::nullopt;
+        };
+
+        if (offer.IsAsk()) {
+            for (auto level = bids_.rbegin(); bids_.rend() != level; ++level) {
+                // NOTE market order bids have the lowest possible price so
+                // no further bids can trade
+                if (0 == level->first) { break; }
+
+                for (auto* counter : level->second) {
+                    if (auto result = visit(*counter); result.has_value()) {
+
+                        return result.value();
+                    }
+                }
+            }
+        } else {
+            for (auto& [price, level] : asks_) {
+                if (0 == price) { continue; }
+
+                for (auto* counter : level) {
+                    if (auto result = visit(*counter); result.has_value()) {
+
+                        return result.value();
+                    }
+                }
+            }
+        }
+
+        // NOTE market orders only process once
+        return false == offer.IsMarketOrder();
+    }
+    /// Remove an offer from the book and return it
+    auto Remove(const std::int64_t number) noexcept -> Offer*
+    {
+        const auto it = index_.find(number);
+
+        if (index_.end() == it) { return nullptr; }
+
+        // NOTE removing an offer never allows any remaining offers to trade so
+        // the revision is not changed
+        auto& [offer, bid, level, position, evaluated] = it->second;
+        auto* out = offer;
+        const auto isBid = bid;
+        level->second.erase(position);
+
+        if (level->second.empty()) { (isBid ? bids_ : asks_).erase(level); }
+
+        index_.erase(it);
+        --(isBid ? bid_count_ : ask_count_);
+
+        return out;
+    }
+    /// Indicate the amount available on some offers has changed
+    auto Touch() noexcept -> void { ++revision_; }
+
+    OrderBook() noexcept
+        : bids_()
+        , asks_()
+        , index_()
+        , bid_count_(0)
+        , ask_count_(0)
+        , revision_(0)
+    {
+    }
+    OrderBook(const OrderBook&) = delete;
+    OrderBook(OrderBook&&) = delete;
+    auto operator=(const OrderBook&) -> OrderBook& = delete;
+    auto operator=(OrderBook&&) -> OrderBook& = delete;
+
+    ~OrderBook() = default;
+
+private:
+    static constexpr auto never_ = std::numeric_limits<std::uint64_t>::max();
+
+    Side bids_;
+    Side asks_;
+    Index index_;
+    std::size_t bid_count_;
+    std::size_t ask_count_;
+    std::uint64_t revision_;
+
+    static auto flatten(const Side& side) noexcept -> UnallocatedVector<Offer*>
+    {
+        auto out = UnallocatedVector<Offer*>{};
+
+        for (const auto& [price, level] : side) {
+            out.insert(out.end(), level.begin(), level.end());
+        }
+
+        return out;
+    }
+
+    // NOTE returns true if a new offer at the specified price could trade with
+    // an offer already on the other side of the book. Offers with a zero price
+    // are market orders which are always matched when they are processed.
+    auto crosses_book(const bool bid, const Amount& price) const noexcept
+        -> bool
+    {
+        if (0 == price) { return false; }
+
+        if (bid) {
+            const auto best = BestAsk();
+
+            return (0 != best) && (price >= best);
+        } else {
+            const auto best = BestBid();
+
+            return (0 != best) && (price <= best);
+        }
+    }
+};
+}  // namespace opentxs
@@ -5,6 +5,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
 {
@@ -26,6 +30,28 @@ namespace opentxs::server
 class MessageProcessor
 {
 public:
+    struct Stats {
+        /// requests waiting for a worker thread
+        std::size_t queued_{};
+        /// requests being executed
+        std::size_t active_{};
+        /// requests executed since startup
+        std::uint64_t processed_{};
+        /// requests executed on the socket thread because the queue was full
+        std::uint64_t overflow_{};
+        /// lock requests made by requests and cron
+        std::uint64_t locks_{};
+        /// lock requests which had to wait
+        std::uint64_t contended_{};
+        /// lock requests which locked the entire notary
+        std::uint64_t exclusive_{};
+        /// total time spent waiting for locks
+        std::chrono::microseconds lock_wait_{};
+        /// longest single wait for a lock
+        std::chrono::microseconds max_lock_wait_{};
+    };
+
+    auto GetStats() const noexcept -> Stats;
     auto DropIncoming(const int count) const noexcept -> void;
     auto DropOutgoing(const int count) const noexcept -> void;
 
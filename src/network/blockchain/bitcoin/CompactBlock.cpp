@@ -0,0 +1,588 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "network/blockchain/bitcoin/CompactBlock.hpp"  // IWYU pragma: associated
+
+#include <boost/endian/conversion.hpp>
+#include <robin_hood.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "internal/blockchain/Params.hpp"
+#include "internal/blockchain/bitcoin/Bitcoin.hpp"
+#include "internal/blockchain/bitcoin/block/Factory.hpp"
+#include "internal/blockchain/bitcoin/block/Transaction.hpp"
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
+#include "opentxs/api/session/Crypto.hpp"
+#include "opentxs/api/session/Session.hpp"
+#include "opentxs/blockchain/bitcoin/block/Block.hpp"
+#include "opentxs/blockchain/bitcoin/block/Header.hpp"
+#include "opentxs/blockchain/bitcoin/block/Transaction.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "opentxs/blockchain/block/Header.hpp"
+#include "opentxs/crypto/HashType.hpp"
+#include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
+#include "opentxs/util/Log.hpp"
+
+namespace opentxs::network::blockchain::bitcoin
+{
+CompactBlock::CompactBlock(
+    const api::Session& api,
+    const opentxs::blockchain::Type chain,
+    const std::uint64_t version,
+    const ReadView payload) noexcept(false)
+    : api_(api)
+    , chain_(chain)
+    , version_(version)
+    , header_()
+    , hash_()
+    , key_()
+    , short_ids_()
+    , positions_()
+    , transactions_()
+    , missing_()
+{
+    static constexpr auto header = 80_uz;
+    const auto total = payload.size();
+    auto* it = reinterpret_cast<ByteIterator>(payload.data());
+    auto expected = header + sizeof(std::uint64_t);
+
+    if (total < expected) {
+        throw std::runtime_error{"compact block too short (header)"};
+    }
+
+    header_ = space(ReadView{payload.data(), header});
+    const auto pHeader = factory::BitcoinBlockHeader(api_, chain_, Header());
+
+    if (false == pHeader.operator bool()) {
+        throw std::runtime_error{"invalid compact block header"};
+    }
+
+    hash_ = pHeader->Hash();
+    std::advance(it, header);
+    auto nonce = std::uint64_t{};
+    std::memcpy(&nonce, it, sizeof(nonce));
+    boost::endian::little_to_native_inplace(nonce);
+    std::advance(it, sizeof(nonce));
+    key_ = calculate_key(api_, Header(), nonce);
+    auto count = 0_uz;
+    ++expected;
+
+    if ((total < expected) ||
+        (false == DecodeSize(it, expected, total, count))) {
+        throw std::runtime_error{"failed to decode short id count"};
+    }
+
+    // NOTE count is supplied by the peer and must be checked before it is
+    // multiplied to avoid overflow
+    if (count > ((total - expected) / short_id_bytes_)) {
+        throw std::runtime_error{"compact block too short (short ids)"};
+    }
+
+    expected += count * short_id_bytes_;
+
+    short_ids_.reserve(count);
+
+    for (auto i = 0_uz; i < count; ++i) {
+        auto id = std::uint64_t{};
+        std::memcpy(&id, it, short_id_bytes_);
+        boost::endian::little_to_native_inplace(id);
+        short_ids_.emplace_back(id);
+        std::advance(it, short_id_bytes_);
+    }
+
+    auto prefilled = 0_uz;
+    ++expected;
+
+    if ((total < expected) ||
+        (false == DecodeSize(it, expected, total, prefilled))) {
+        throw std::runtime_error{"failed to decode prefilled count"};
+    }
+
+    // NOTE every prefilled transaction occupies more than one byte
+    if (prefilled > (total - expected)) {
+        throw std::runtime_error{"compact block too short (prefilled)"};
+    }
+
+    const auto size = count + prefilled;
+
+    if (0_uz == size) { throw std::runtime_error{"empty compact block"}; }
+
+    if (max_transactions_ < size) {
+        throw std::runtime_error{"too many transactions in compact block"};
+    }
+
+    transactions_.resize(size);
+    auto index = 0_uz;
+
+    for (auto i = 0_uz; i < prefilled; ++i) {
+        auto offset = 0_uz;
+        ++expected;
+
+        if ((total < expected) ||
+            (false == DecodeSize(it, expected, total, offset))) {
+            throw std::runtime_error{"failed to decode prefilled index"};
+        }
+
+        // NOTE indices are differentially encoded. The offset is supplied by
+        // the peer so it is checked before the sum is calculated.
+        if ((size - index) <= offset) {
+            throw std::runtime_error{"prefilled index out of range"};
+        }
+
+        index += offset;
+
+        const auto remaining =
+            ReadView{reinterpret_cast<const char*>(it), total - expected};
+        const auto tx = opentxs::blockchain::bitcoin::EncodedTransaction::
+            Deserialize(api_, chain_, remaining);
+        const auto bytes = tx.size();
+        transactions_[index] = space(ReadView{remaining.data(), bytes});
+        std::advance(it, bytes);
+        expected += bytes;
+        ++index;
+    }
+
+    positions_.reserve(count);
+
+    for (auto i = 0_uz; i < size; ++i) {
+        if (transactions_[i].empty()) { positions_.emplace_back(i); }
+    }
+
+    if (positions_.size() != count) {
+        throw std::runtime_error{"short id count mismatch"};
+    }
+
+    missing_ = count;
+    auto unique = robin_hood::unordered_flat_set<std::uint64_t>{};
+    unique.reserve(count);
+
+    for (const auto id : short_ids_) {
+        if (false == unique.emplace(id).second) {
+            // NOTE the block can not be reconstructed unambiguously
+            throw std::runtime_error{"duplicate short id"};
+        }
+    }
+}
+
+CompactBlock::CompactBlock(CompactBlock&&) noexcept = default;
+
+CompactBlock::Counters::Counters(
+    const opentxs::blockchain::Type chain) noexcept
+    : totals_(GetStats(chain))
+    , stats_()
+{
+}
+
+auto CompactBlock::Counters::Add(
+    const Counter counter,
+    const std::uint64_t value) noexcept -> void
+{
+    (stats_.*counter) += value;
+    (totals_.*counter) += value;
+}
+
+auto CompactBlock::ClaimHighBandwidth(
+    const opentxs::blockchain::Type chain) noexcept -> bool
+{
+    auto& count = GetStats(chain).high_bandwidth_;
+    auto current = count.load();
+
+    do {
+        if (max_high_bandwidth_ <= current) { return false; }
+    } while (false == count.compare_exchange_weak(current, current + 1_uz));
+
+    return true;
+}
+
+auto CompactBlock::DecodeIndices(
+    const Indices& encoded,
+    const std::size_t transactions) noexcept(false) -> Indices
+{
+    auto out = Indices{};
+    out.reserve(encoded.size());
+    auto next = 0_uz;
+
+    for (const auto offset : encoded) {
+        // NOTE offsets are supplied by the peer so the sum is checked before
+        // it is calculated
+        if ((transactions <= next) || ((transactions - next) <= offset)) {
+            throw std::runtime_error{"transaction index out of range"};
+        }
+
+        const auto index = next + offset;
+        out.emplace_back(index);
+        next = index + 1_uz;
+    }
+
+    return out;
+}
+
+auto CompactBlock::EncodeIndices(const Indices& indices) noexcept -> Indices
+{
+    auto out = Indices{};
+    out.reserve(indices.size());
+    auto next = 0_uz;
+
+    for (const auto index : indices) {
+        OT_ASSERT(next <= index);
+
+        out.emplace_back(index - next);
+        next = index + 1_uz;
+    }
+
+    return out;
+}
+
+auto CompactBlock::calculate_key(
+    const api::Session& api,
+    const ReadView header,
+    const std::uint64_t nonce) noexcept(false) -> Space
+{
+    auto preimage = space(header);
+    const auto le = boost::endian::native_to_little(nonce);
+    const auto* n = reinterpret_cast<const std::byte*>(&le);
+    preimage.insert(preimage.end(), n, std::next(n, sizeof(le)));
+    auto digest = Space{};
+
+    if (false == api.Crypto().Hash().Digest(
+                     opentxs::crypto::HashType::Sha256,
+                     reader(preimage),
+                     writer(digest))) {
+        throw std::runtime_error{"failed to calculate short id key"};
+    }
+
+    // NOTE siphash keys are the first two little endian words of the digest
+    digest.resize(16_uz);
+
+    return digest;
+}
+
+auto CompactBlock::Encode(
+    const api::Session& api,
+    const opentxs::blockchain::bitcoin::block::Block& block,
+    const std::uint64_t version,
+    const std::uint64_t nonce,
+    AllocateOutput out) noexcept -> bool
+{
+    try {
+        if (0_uz == block.size()) { throw std::runtime_error{"empty block"}; }
+
+        auto header = Space{};
+
+        if (false == block.Header().Serialize(writer(header))) {
+            throw std::runtime_error{"failed to serialize header"};
+        }
+
+        const auto key = calculate_key(api, reader(header), nonce);
+        const auto& coinbase = block.at(0_uz);
+
+        OT_ASSERT(coinbase);
+
+        auto prefilled = Space{};
+        const auto serialized =
+            coinbase->Internal().Serialize(writer(prefilled));
+
+        if (false == serialized.has_value()) {
+            throw std::runtime_error{"failed to serialize coinbase"};
+        }
+
+        const auto count = block.size() - 1_uz;
+        const auto cs = CompactSize(count).Encode();
+        const auto bytes = header.size() + sizeof(nonce) + cs.size() +
+                           (count * short_id_bytes_) + 2_uz + prefilled.size();
+        auto output = out(bytes);
+
+        if (false == output.valid(bytes)) {
+            throw std::runtime_error{"failed to allocate output space"};
+        }
+
+        auto* i = output.as<std::byte>();
+        const auto append = [&](const void* data, std::size_t size) {
+            std::memcpy(i, data, size);
+            std::advance(i, size);
+        };
+        append(header.data(), header.size());
+        const auto le = boost::endian::native_to_little(nonce);
+        append(&le, sizeof(le));
+        append(cs.data(), cs.size());
+
+        for (auto n = 1_uz; n < block.size(); ++n) {
+            const auto& tx = block.at(n);
+
+            OT_ASSERT(tx);
+
+            const auto id = boost::endian::native_to_little(
+                short_id(reader(key), *tx, version));
+            append(&id, short_id_bytes_);
+        }
+
+        // NOTE one prefilled transaction at index zero
+        static constexpr auto one = std::byte{0x01};
+        static constexpr auto zero = std::byte{0x00};
+        append(&one, sizeof(one));
+        append(&zero, sizeof(zero));
+        append(prefilled.data(), prefilled.size());
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_STATIC(CompactBlock))(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto CompactBlock::EncodeTransactions(
+    const opentxs::blockchain::bitcoin::block::Block& block,
+    const Indices& indices,
+    AllocateOutput out) noexcept -> bool
+{
+    try {
+        const auto& hash = block.ID();
+        auto transactions = UnallocatedVector<Space>{};
+        transactions.reserve(indices.size());
+        auto bytes = hash.size();
+
+        for (const auto index : indices) {
+            if (block.size() <= index) {
+                throw std::runtime_error{"transaction index out of range"};
+            }
+
+            const auto& tx = block.at(index);
+
+            OT_ASSERT(tx);
+
+            auto& serialized = transactions.emplace_back();
+
+            if (false ==
+                tx->Internal().Serialize(writer(serialized)).has_value()) {
+                throw std::runtime_error{"failed to serialize transaction"};
+            }
+
+            bytes += serialized.size();
+        }
+
+        const auto cs = CompactSize(transactions.size()).Encode();
+        bytes += cs.size();
+        auto output = out(bytes);
+
+        if (false == output.valid(bytes)) {
+            throw std::runtime_error{"failed to allocate output space"};
+        }
+
+        auto* i = output.as<std::byte>();
+        std::memcpy(i, hash.data(), hash.size());
+        std::advance(i, hash.size());
+        std::memcpy(i, cs.data(), cs.size());
+        std::advance(i, cs.size());
+
+        for (const auto& tx : transactions) {
+            std::memcpy(i, tx.data(), tx.size());
+            std::advance(i, tx.size());
+        }
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_STATIC(CompactBlock))(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto CompactBlock::Fill(const ReadView blocktxn) noexcept(false) -> void
+{
+    const auto total = blocktxn.size();
+    auto* it = reinterpret_cast<ByteIterator>(blocktxn.data());
+    auto expected = hash_.size();
+
+    if (total < expected) {
+        throw std::runtime_error{"blocktxn too short (hash)"};
+    }
+
+    if (hash_.Bytes() != ReadView{blocktxn.data(), hash_.size()}) {
+        throw std::runtime_error{"blocktxn for wrong block"};
+    }
+
+    std::advance(it, hash_.size());
+    auto count = 0_uz;
+    ++expected;
+
+    if ((total < expected) ||
+        (false == DecodeSize(it, expected, total, count))) {
+        throw std::runtime_error{"failed to decode transaction count"};
+    }
+
+    if (count != missing_) {
+        throw std::runtime_error{"blocktxn transaction count mismatch"};
+    }
+
+    for (auto& slot : transactions_) {
+        if (false == slot.empty()) { continue; }
+
+        const auto remaining =
+            ReadView{reinterpret_cast<const char*>(it), total - expected};
+        const auto tx = opentxs::blockchain::bitcoin::EncodedTransaction::
+            Deserialize(api_, chain_, remaining);
+        const auto bytes = tx.size();
+        slot = space(ReadView{remaining.data(), bytes});
+        std::advance(it, bytes);
+        expected += bytes;
+        --missing_;
+    }
+
+    OT_ASSERT(0_uz == missing_);
+}
+
+auto CompactBlock::GetStats(const opentxs::blockchain::Type chain) noexcept
+    -> Stats&
+{
+    static auto map = [] {
+        auto out = UnallocatedMap<opentxs::blockchain::Type, Stats>{};
+
+        for (const auto& [type, data] : opentxs::blockchain::params::Chains()) {
+            out.try_emplace(type);
+        }
+
+        return out;
+    }();
+
+    return map.at(chain);
+}
+
+auto CompactBlock::Missing() const noexcept -> Indices
+{
+    auto out = Indices{};
+    out.reserve(missing_);
+
+    for (auto i = 0_uz; i < transactions_.size(); ++i) {
+        if (transactions_[i].empty()) { out.emplace_back(i); }
+    }
+
+    return out;
+}
+
+auto CompactBlock::Reconstruct(const Transactions& mempool) noexcept(false)
+    -> std::size_t
+{
+    if (short_ids_.empty() || mempool.empty()) { return 0_uz; }
+
+    auto index = robin_hood::unordered_flat_map<std::uint64_t, std::size_t>{};
+    index.reserve(short_ids_.size());
+
+    for (auto i = 0_uz; i < short_ids_.size(); ++i) {
+        index.emplace(short_ids_[i], i);
+    }
+
+    const auto ids = [&] {
+        auto out = opentxs::blockchain::GCS::Targets{};
+        out.reserve(mempool.size());
+
+        for (const auto& tx : mempool) {
+            OT_ASSERT(tx);
+
+            if (1u == version_) {
+                out.emplace_back(tx->ID().Bytes());
+            } else {
+                out.emplace_back(tx->WTXID().Bytes());
+            }
+        }
+
+        return out;
+    }();
+    // NOTE hash the whole mempool with a single key schedule
+    const auto hashes = gcs::Siphash(reader(key_), ids, {});
+    auto matches = UnallocatedVector<std::size_t>(short_ids_.size(), 0_uz);
+    auto found = UnallocatedVector<const Transaction*>(short_ids_.size());
+
+    for (auto i = 0_uz; i < hashes.size(); ++i) {
+        const auto id = hashes[i] & short_id_mask_;
+
+        if (auto it = index.find(id); index.end() != it) {
+            const auto slot = it->second;
+            ++matches[slot];
+            found[slot] = mempool[i].get();
+        }
+    }
+
+    auto out = 0_uz;
+
+    for (auto i = 0_uz; i < short_ids_.size(); ++i) {
+        // NOTE colliding mempool transactions are requested from the peer
+        if (1_uz != matches[i]) { continue; }
+
+        auto& slot = transactions_[positions_[i]];
+
+        if (false ==
+            found[i]->Internal().Serialize(writer(slot)).has_value()) {
+            slot.clear();
+
+            continue;
+        }
+
+        --missing_;
+        ++out;
+    }
+
+    return out;
+}
+
+auto CompactBlock::ReleaseHighBandwidth(
+    const opentxs::blockchain::Type chain) noexcept -> void
+{
+    auto& count = GetStats(chain).high_bandwidth_;
+
+    OT_ASSERT(0_uz < count.load());
+
+    --count;
+}
+
+auto CompactBlock::Serialize(AllocateOutput out) const noexcept -> bool
+{
+    if (false == IsComplete()) { return false; }
+
+    const auto cs = CompactSize(transactions_.size()).Encode();
+    auto bytes = header_.size() + cs.size();
+
+    for (const auto& tx : transactions_) { bytes += tx.size(); }
+
+    auto output = out(bytes);
+
+    if (false == output.valid(bytes)) { return false; }
+
+    auto* i = output.as<std::byte>();
+    std::memcpy(i, header_.data(), header_.size());
+    std::advance(i, header_.size());
+    std::memcpy(i, cs.data(), cs.size());
+    std::advance(i, cs.size());
+
+    for (const auto& tx : transactions_) {
+        std::memcpy(i, tx.data(), tx.size());
+        std::advance(i, tx.size());
+    }
+
+    return true;
+}
+
+auto CompactBlock::short_id(
+    const ReadView key,
+    const Transaction& tx,
+    const std::uint64_t version) noexcept(false) -> std::uint64_t
+{
+    const auto& id = (1u == version) ? tx.ID() : tx.WTXID();
+
+    return gcs::Siphash(key, id.Bytes()) & short_id_mask_;
+}
+
+CompactBlock::~CompactBlock() = default;
+}  // namespace opentxs::network::blockchain::bitcoin
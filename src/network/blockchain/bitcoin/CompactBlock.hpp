@@ -0,0 +1,204 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "internal/util/P0330.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace api
+{
+class Session;
+}  // namespace api
+
+namespace blockchain
+{
+namespace bitcoin
+{
+namespace block
+{
+class Block;
+class Transaction;
+}  // namespace block
+}  // namespace bitcoin
+}  // namespace blockchain
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::network::blockchain::bitcoin
+{
+/// BIP152 block reconstruction
+///
+/// A compact block carries the block header, a six byte short id for most
+/// transactions and a few prefilled transactions. Slots are filled from the
+/// mempool by short id and the remainder is requested from the peer with
+/// getblocktxn. The reconstructed block must still pass the merkle check
+/// before it is used since short ids may collide.
+class CompactBlock
+{
+public:
+    using Transaction = opentxs::blockchain::bitcoin::block::Transaction;
+    using Transactions = UnallocatedVector<std::shared_ptr<const Transaction>>;
+    using Indices = UnallocatedVector<std::size_t>;
+
+    /// Reconstruction counters, shared by all peers of a chain
+    struct Stats {
+        /// compact blocks received
+        std::atomic<std::uint64_t> received_{};
+        /// blocks completed without a round trip
+        std::atomic<std::uint64_t> reconstructed_{};
+        /// blocks completed after getblocktxn
+        std::atomic<std::uint64_t> completed_{};
+        /// blocks downloaded in full instead
+        std::atomic<std::uint64_t> fallback_{};
+        /// transactions found in the mempool
+        std::atomic<std::uint64_t> mempool_{};
+        /// transactions prefilled by the peer
+        std::atomic<std::uint64_t> prefilled_{};
+        /// transactions requested with getblocktxn
+        std::atomic<std::uint64_t> requested_{};
+        /// peers currently asked to announce blocks in high bandwidth mode
+        std::atomic<std::size_t> high_bandwidth_{};
+    };
+
+    /// Reconstruction counters for one peer
+    ///
+    /// Every update is also applied to the totals for the chain.
+    class Counters
+    {
+    public:
+        using Counter = std::atomic<std::uint64_t> Stats::*;
+
+        auto Peer() const noexcept -> const Stats& { return stats_; }
+        auto Totals() const noexcept -> const Stats& { return totals_; }
+
+        auto Add(const Counter counter, const std::uint64_t value = 1u) noexcept
+            -> void;
+
+        Counters(const opentxs::blockchain::Type chain) noexcept;
+        Counters() = delete;
+        Counters(const Counters&) = delete;
+        Counters(Counters&&) = delete;
+        auto operator=(const Counters&) -> Counters& = delete;
+        auto operator=(Counters&&) -> Counters& = delete;
+
+        ~Counters() = default;
+
+    private:
+        Stats& totals_;
+        Stats stats_;
+    };
+
+    static constexpr auto short_id_bytes_ = 6_uz;
+    /// BIP152 limits high bandwidth mode to three peers
+    static constexpr auto max_high_bandwidth_ = 3_uz;
+    /// Upper bound on the number of transactions accepted in a compact block
+    ///
+    /// Larger than any block permitted by a supported chain. Limits the memory
+    /// allocated in response to counts supplied by a peer.
+    static constexpr auto max_transactions_ = 1_uz << 20_uz;
+
+    /// Convert differentially encoded getblocktxn indices to absolute indices
+    ///
+    /// Throws if an index is not less than the number of transactions in the
+    /// block.
+    static auto DecodeIndices(
+        const Indices& encoded,
+        const std::size_t transactions) noexcept(false) -> Indices;
+    /// Serialize a cmpctblock payload for a block, prefilling the coinbase
+    static auto Encode(
+        const api::Session& api,
+        const opentxs::blockchain::bitcoin::block::Block& block,
+        const std::uint64_t version,
+        const std::uint64_t nonce,
+        AllocateOutput out) noexcept -> bool;
+    /// Convert ascending absolute indices to the getblocktxn encoding
+    static auto EncodeIndices(const Indices& indices) noexcept -> Indices;
+    /// Serialize a blocktxn payload for the requested absolute indices
+    static auto EncodeTransactions(
+        const opentxs::blockchain::bitcoin::block::Block& block,
+        const Indices& indices,
+        AllocateOutput out) noexcept -> bool;
+    static auto GetStats(const opentxs::blockchain::Type chain) noexcept
+        -> Stats&;
+    /// Returns true if the caller may request high bandwidth mode
+    ///
+    /// A successful claim must be returned with ReleaseHighBandwidth.
+    static auto ClaimHighBandwidth(
+        const opentxs::blockchain::Type chain) noexcept -> bool;
+    static auto ReleaseHighBandwidth(
+        const opentxs::blockchain::Type chain) noexcept -> void;
+
+    auto Hash() const noexcept -> const opentxs::blockchain::block::Hash&
+    {
+        return hash_;
+    }
+    auto Header() const noexcept -> ReadView { return reader(header_); }
+    auto IsComplete() const noexcept -> bool { return 0_uz == missing_; }
+    auto Missing() const noexcept -> Indices;
+    auto Prefilled() const noexcept -> std::size_t
+    {
+        return transactions_.size() - short_ids_.size();
+    }
+    auto Serialize(AllocateOutput out) const noexcept -> bool;
+    auto Size() const noexcept -> std::size_t { return transactions_.size(); }
+
+    /// Fill the missing slots from a blocktxn payload
+    auto Fill(const ReadView blocktxn) noexcept(false) -> void;
+    /// Fill slots from the supplied transactions, returns the number matched
+    auto Reconstruct(const Transactions& mempool) noexcept(false)
+        -> std::size_t;
+
+    CompactBlock(
+        const api::Session& api,
+        const opentxs::blockchain::Type chain,
+        const std::uint64_t version,
+        const ReadView payload) noexcept(false);
+    CompactBlock() = delete;
+    CompactBlock(const CompactBlock&) = delete;
+    CompactBlock(CompactBlock&&) noexcept;
+    auto operator=(const CompactBlock&) -> CompactBlock& = delete;
+    auto operator=(CompactBlock&&) -> CompactBlock& = delete;
+
+    ~CompactBlock();
+
+private:
+    static constexpr auto short_id_mask_ = std::uint64_t{0xffffffffffff};
+
+    const api::Session& api_;
+    const opentxs::blockchain::Type chain_;
+    const std::uint64_t version_;
+    Space header_;
+    opentxs::blockchain::block::Hash hash_;
+    Space key_;
+    UnallocatedVector<std::uint64_t> short_ids_;
+    Indices positions_;
+    UnallocatedVector<Space> transactions_;
+    std::size_t missing_;
+
+    static auto calculate_key(
+        const api::Session& api,
+        const ReadView header,
+        const std::uint64_t nonce) noexcept(false) -> Space;
+    static auto short_id(
+        const ReadView key,
+        const Transaction& tx,
+        const std::uint64_t version) noexcept(false) -> std::uint64_t;
+};
+}  // namespace opentxs::network::blockchain::bitcoin
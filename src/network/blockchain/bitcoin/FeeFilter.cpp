@@ -0,0 +1,110 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "network/blockchain/bitcoin/FeeFilter.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+
+#include "internal/blockchain/Params.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::network::blockchain::bitcoin
+{
+FeeFilter::FeeFilter(const opentxs::blockchain::Type chain) noexcept
+    : totals_(GetStats(chain))
+    , stats_()
+    , local_(0)
+    , remote_(0)
+    , sent_(std::nullopt)
+{
+}
+
+auto FeeFilter::GetStats(const opentxs::blockchain::Type chain) noexcept
+    -> Stats&
+{
+    static auto map = [] {
+        auto out = UnallocatedMap<opentxs::blockchain::Type, Stats>{};
+
+        for (const auto& [type, data] : opentxs::blockchain::params::Chains()) {
+            out.try_emplace(type);
+        }
+
+        return out;
+    }();
+
+    return map.at(chain);
+}
+
+auto FeeFilter::Permits(const std::optional<std::uint64_t>& rate) noexcept
+    -> bool
+{
+    if (false == rate.has_value()) {
+        ++stats_.unknown_;
+        ++totals_.unknown_;
+        ++stats_.announced_;
+        ++totals_.announced_;
+
+        return true;
+    } else if (rate.value() < remote_) {
+        ++stats_.suppressed_;
+        ++totals_.suppressed_;
+
+        return false;
+    } else {
+        ++stats_.announced_;
+        ++totals_.announced_;
+
+        return true;
+    }
+}
+
+auto FeeFilter::Rate(std::uint64_t fee, std::size_t vbytes) noexcept
+    -> std::uint64_t
+{
+    return (fee * 1000u) / std::max<std::uint64_t>(vbytes, 1u);
+}
+
+auto FeeFilter::SetRemote(std::uint64_t rate) noexcept -> void
+{
+    ++stats_.received_;
+    ++totals_.received_;
+    remote_ = rate;
+}
+
+auto FeeFilter::significant(std::uint64_t from, std::uint64_t to) noexcept
+    -> bool
+{
+    // NOTE changes of up to a quarter of the current rate in either
+    // direction are not worth a message of their own and wait for the resend
+    // interval
+    const auto delta = (to > from) ? (to - from) : (from - to);
+
+    return (delta * 4u) > from;
+}
+
+auto FeeFilter::Update(std::uint64_t rate, Time now) noexcept
+    -> std::optional<std::uint64_t>
+{
+    if (sent_.has_value()) {
+        if (rate == local_) { return std::nullopt; }
+
+        const auto due = (now - sent_.value()) >= resend_interval_;
+
+        if ((false == due) && (false == significant(local_, rate))) {
+
+            return std::nullopt;
+        }
+    }
+
+    ++stats_.sent_;
+    ++totals_.sent_;
+    local_ = rate;
+    sent_ = now;
+
+    return rate;
+}
+}  // namespace opentxs::network::blockchain::bitcoin
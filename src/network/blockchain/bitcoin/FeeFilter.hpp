@@ -0,0 +1,84 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/util/Time.hpp"
+
+namespace opentxs::network::blockchain::bitcoin
+{
+/// BIP133 fee rate filtering for a single peer
+///
+/// All fee rates are expressed in satoshis per 1000 virtual bytes. The local
+/// filter is sent to the peer so it stops announcing transactions which are
+/// not worth downloading. The remote filter is the value the peer sent to us
+/// and suppresses announcements of transactions it has asked not to receive.
+/// Transactions for which the fee can not be calculated are always announced.
+class FeeFilter
+{
+public:
+    /// Filtering counters, also accumulated for all peers of a chain
+    struct Stats {
+        /// feefilter messages sent
+        std::atomic<std::uint64_t> sent_{};
+        /// feefilter messages received
+        std::atomic<std::uint64_t> received_{};
+        /// transaction announcements permitted by the remote filter
+        std::atomic<std::uint64_t> announced_{};
+        /// transaction announcements suppressed by the remote filter
+        std::atomic<std::uint64_t> suppressed_{};
+        /// transaction announcements for which the fee was unknown
+        std::atomic<std::uint64_t> unknown_{};
+    };
+
+    /// Minimum interval between updates of an insignificant change
+    static constexpr auto resend_interval_ = std::chrono::minutes{10};
+
+    static auto GetStats(const opentxs::blockchain::Type chain) noexcept
+        -> Stats&;
+    /// Calculate the fee rate of a transaction, rounding down
+    static auto Rate(std::uint64_t fee, std::size_t vbytes) noexcept
+        -> std::uint64_t;
+
+    /// Counters for this peer
+    auto Counters() const noexcept -> const Stats& { return stats_; }
+    auto Local() const noexcept -> std::uint64_t { return local_; }
+    auto Remote() const noexcept -> std::uint64_t { return remote_; }
+
+    /// Returns true if a transaction should be announced to the peer
+    auto Permits(const std::optional<std::uint64_t>& rate) noexcept -> bool;
+    /// Record the filter advertised by the peer
+    auto SetRemote(std::uint64_t rate) noexcept -> void;
+    /// Returns the value to send if the local filter should be updated
+    auto Update(std::uint64_t rate, Time now) noexcept
+        -> std::optional<std::uint64_t>;
+
+    FeeFilter(const opentxs::blockchain::Type chain) noexcept;
+    FeeFilter() = delete;
+    FeeFilter(const FeeFilter&) = delete;
+    FeeFilter(FeeFilter&&) = delete;
+    auto operator=(const FeeFilter&) -> FeeFilter& = delete;
+    auto operator=(FeeFilter&&) -> FeeFilter& = delete;
+
+    ~FeeFilter() = default;
+
+private:
+    Stats& totals_;
+    Stats stats_;
+    std::uint64_t local_;
+    std::uint64_t remote_;
+    std::optional<Time> sent_;
+
+    static auto significant(std::uint64_t from, std::uint64_t to) noexcept
+        -> bool;
+};
+}  // namespace opentxs::network::blockchain::bitcoin
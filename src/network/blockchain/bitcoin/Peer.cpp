@@ -13,7 +13,10 @@
 #include <chrono>
 #include <future>
 #include <iterator>
+#include <optional>
 #include <stdexcept>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -29,6 +32,9 @@
 #include "blockchain/bitcoin/p2p/message/Sendcmpct.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/Params.hpp"
+#include "internal/blockchain/bitcoin/block/Factory.hpp"
+#include "internal/blockchain/bitcoin/block/Input.hpp"
+#include "internal/blockchain/bitcoin/block/Output.hpp"
 #include "internal/blockchain/bitcoin/block/Transaction.hpp"
 #include "internal/blockchain/database/Peer.hpp"
 #include "internal/blockchain/node/BlockBatch.hpp"
@@ -40,21 +46,30 @@
 #include "internal/blockchain/p2p/P2P.hpp"
 #include "internal/blockchain/p2p/bitcoin/Factory.hpp"
 #include "internal/blockchain/p2p/bitcoin/message/Message.hpp"
+#include "internal/core/Amount.hpp"
 #include "internal/network/blockchain/ConnectionManager.hpp"
 #include "internal/network/blockchain/bitcoin/Factory.hpp"
 #include "internal/network/zeromq/Context.hpp"
 #include "internal/util/Future.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/P0330.hpp"
+#include "network/blockchain/bitcoin/CompactBlock.hpp"
+#include "network/blockchain/bitcoin/FeeFilter.hpp"
 #include "network/blockchain/bitcoin/Peer.tpp"
 #include "opentxs/OT.hpp"
+#include "opentxs/api/crypto/Util.hpp"
 #include "opentxs/api/network/Network.hpp"
+#include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/blockchain/Types.hpp"
 #include "opentxs/blockchain/bitcoin/block/Block.hpp"
 #include "opentxs/blockchain/bitcoin/block/Header.hpp"
+#include "opentxs/blockchain/bitcoin/block/Input.hpp"
+#include "opentxs/blockchain/bitcoin/block/Inputs.hpp"
+#include "opentxs/blockchain/bitcoin/block/Output.hpp"
+#include "opentxs/blockchain/bitcoin/block/Outputs.hpp"
 #include "opentxs/blockchain/bitcoin/block/Transaction.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/FilterType.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
@@ -66,6 +81,7 @@
 #include "opentxs/blockchain/node/FilterOracle.hpp"
 #include "opentxs/blockchain/node/HeaderOracle.hpp"
 #include "opentxs/blockchain/node/Types.hpp"
+#include "opentxs/core/Amount.hpp"
 #include "opentxs/core/ByteArray.hpp"
 #include "opentxs/core/FixedByteArray.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
@@ -78,6 +94,7 @@
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Iterator.hpp"
 #include "opentxs/util/Log.hpp"
+#include "opentxs/util/Time.hpp"
 #include "opentxs/util/Types.hpp"
 #include "util/ScopeGuard.hpp"
 #include "util/Work.hpp"
@@ -228,9 +245,22 @@ Peer::Peer(
             return Type::MsgTx;
         }
     }())
+    , cmpct_version_([&] {
+        const auto& segwit =
+            opentxs::blockchain::params::Chains().at(chain_).segwit_;
+
+        return segwit ? std::uint64_t{2} : std::uint64_t{1};
+    }())
+    , cmpct_want_high_bandwidth_(BlockchainProfile::server == config.profile_)
     , protocol_((0 == protocol) ? default_protocol_version_ : protocol)
     , local_services_(get_local_services(protocol_, chain_, config))
     , relay_(true)
+    , cmpct_high_bandwidth_(false)
+    , peer_cmpct_(false)
+    , peer_cmpct_announce_(false)
+    , cmpct_pending_()
+    , cmpct_stats_(chain_)
+    , fee_filter_(chain_)
     , handshake_()
     , verification_()
 {
@@ -252,6 +282,104 @@ auto Peer::check_verification() noexcept -> void
     if (verified) { transition_state_run(); }
 }
 
+auto Peer::cmpct_eligible(
+    const opentxs::blockchain::block::Position& position) const noexcept
+    -> bool
+{
+    // NOTE only blocks near the tip are likely to be in the mempool
+    if (false == peer_cmpct_) { return false; }
+
+    const auto best = header_oracle_.BestChain();
+
+    return (position.height_ + cmpct_tip_distance_) >= best.height_;
+}
+
+auto Peer::cmpct_expire() noexcept -> void
+{
+    if (cmpct_pending_.empty()) { return; }
+
+    const auto limit = Clock::now() - cmpct_timeout_;
+    auto expired = UnallocatedVector<opentxs::blockchain::block::Hash>{};
+
+    for (const auto& [hash, data] : cmpct_pending_) {
+        if (data.first < limit) { expired.emplace_back(hash); }
+    }
+
+    for (const auto& hash : expired) {
+        cmpct_fallback(hash, "getblocktxn timed out");
+    }
+}
+
+auto Peer::cmpct_fallback(
+    const opentxs::blockchain::block::Hash& hash,
+    std::string_view reason) noexcept -> void
+{
+    using Inv = opentxs::blockchain::bitcoin::Inventory;
+    cmpct_stats_.Add(&CompactBlock::Stats::fallback_);
+    log_(OT_PRETTY_CLASS())(name_)(": downloading full block ")
+        .asHex(hash)(" since ")(reason)
+        .Flush();
+    transmit_protocol_getdata(Inv{inv_block_, hash});
+    cmpct_pending_.erase(hash);
+}
+
+auto Peer::cmpct_finish(CompactBlock& block, bool roundTrip) noexcept -> void
+{
+    const auto& hash = block.Hash();
+    auto bytes = Space{};
+
+    if (false == block.Serialize(writer(bytes))) {
+        cmpct_fallback(hash, "serialization failed");
+
+        return;
+    }
+
+    // NOTE a short id collision produces a block which fails the merkle check
+    const auto valid = api_.Factory().BitcoinBlock(chain_, reader(bytes));
+
+    if (false == valid.operator bool()) {
+        cmpct_fallback(hash, "the reconstructed block is invalid");
+
+        return;
+    }
+
+    cmpct_stats_.Add(
+        roundTrip ? &CompactBlock::Stats::completed_
+                  : &CompactBlock::Stats::reconstructed_);
+    log_(OT_PRETTY_CLASS())(name_)(": reconstructed block ")
+        .asHex(hash)
+        .Flush();
+    const auto& stats = cmpct_stats_.Totals();
+    log_(OT_PRETTY_CLASS())("compact blocks: ")(stats.received_.load())(
+        " received, ")(stats.reconstructed_.load())(" from mempool, ")(
+        stats.completed_.load())(" after getblocktxn, ")(
+        stats.fallback_.load())(" downloaded in full")
+        .Flush();
+
+    if (update_block_job(reader(bytes))) {
+
+        return;
+    } else {
+        using Task = opentxs::blockchain::node::ManagerJobs;
+        network_.Submit([&] {
+            auto work = MakeWork(Task::SubmitBlock);
+            work.AddFrame(bytes.data(), bytes.size());
+
+            return work;
+        }());
+    }
+}
+
+auto Peer::cmpct_nonce() const noexcept -> std::uint64_t
+{
+    auto out = std::uint64_t{};
+    const auto rc = api_.Crypto().Util().RandomizeMemory(&out, sizeof(out));
+
+    OT_ASSERT(rc);
+
+    return out;
+}
+
 auto Peer::commands() noexcept -> const CommandMap&
 {
     static const auto map = CommandMap{
@@ -312,6 +440,32 @@ auto Peer::extract_body_size(const zeromq::Frame& header) const noexcept
     }
 }
 
+auto Peer::fee_rate(const Txid& txid) const noexcept
+    -> std::optional<std::uint64_t>
+{
+    const auto tx = mempool_.Query(txid.Bytes());
+
+    if (!tx) { return std::nullopt; }
+
+    // NOTE the fee is only known if every input has its previous output
+    // attached, which is normally only true for our own transactions
+    try {
+        auto fee = opentxs::Amount{};
+
+        for (const auto& input : tx->Inputs()) {
+            fee += input.Internal().Spends().Value();
+        }
+
+        for (const auto& output : tx->Outputs()) { fee -= output.Value(); }
+
+        return FeeFilter::Rate(
+            fee.Internal().ExtractUInt64(), tx->vBytes(chain_));
+    } catch (...) {
+
+        return std::nullopt;
+    }
+}
+
 auto Peer::get_local_services(
     const opentxs::blockchain::p2p::bitcoin::ProtocolVersion version,
     const opentxs::blockchain::Type network,
@@ -504,6 +658,9 @@ auto Peer::process_protocol(Message&& message) noexcept -> void
             default: {
                 log_(OT_PRETTY_CLASS())(name_)(": received ")(print(command))
                     .Flush();
+                // NOTE pending getblocktxn requests are checked whenever the
+                // peer sends anything, and by transmit_ping when it is idle
+                cmpct_expire();
             }
         }
 
@@ -572,8 +729,34 @@ auto Peer::process_protocol_blocktxn(
     using Type = opentxs::blockchain::p2p::bitcoin::message::internal::Blocktxn;
     const auto pMessage = instantiate<Type>(
         std::move(header), protocol_, payload.data(), payload.size());
-    [[maybe_unused]] const auto& message = *pMessage;
-    // TODO
+    const auto& message = *pMessage;
+    const auto transactions = message.BlockTransactions();
+    const auto bytes = transactions.Bytes();
+    using Hash = opentxs::blockchain::block::Hash;
+    const auto hash = Hash{bytes.substr(0_uz, Hash{}.size())};
+    auto it = cmpct_pending_.find(hash);
+
+    if (cmpct_pending_.end() == it) {
+        log_(OT_PRETTY_CLASS())(name_)(": ignoring unrequested ")(
+            print(Command::blocktxn))(" for block ")
+            .asHex(hash)
+            .Flush();
+
+        return;
+    }
+
+    auto block = std::move(it->second.second);
+    cmpct_pending_.erase(it);
+
+    try {
+        block.Fill(bytes);
+    } catch (const std::exception& e) {
+        cmpct_fallback(hash, e.what());
+
+        return;
+    }
+
+    cmpct_finish(block, true);
 }
 
 auto Peer::process_protocol_cfcheckpt(
@@ -764,8 +947,74 @@ auto Peer::process_protocol_cmpctblock(
     using Type = opentxs::blockchain::p2p::bitcoin::message::Cmpctblock;
     const auto pMessage = instantiate<Type>(
         std::move(header), protocol_, payload.data(), payload.size());
-    [[maybe_unused]] const auto& message = *pMessage;
-    // TODO
+    const auto& message = *pMessage;
+    const auto bytes = message.getRawCmpctblock();
+    cmpct_stats_.Add(&CompactBlock::Stats::received_);
+    auto error = UnallocatedCString{};
+    auto block = [&]() -> std::optional<CompactBlock> {
+        try {
+
+            return CompactBlock{api_, chain_, cmpct_version_, bytes};
+        } catch (const std::exception& e) {
+            error = e.what();
+
+            return std::nullopt;
+        }
+    }();
+    const auto pHeader = factory::BitcoinBlockHeader(
+        api_, chain_, bytes.substr(0_uz, std::min(bytes.size(), 80_uz)));
+
+    if (false == pHeader.operator bool()) {
+        throw std::runtime_error{"invalid compact block header"};
+    }
+
+    const auto& hash = pHeader->Hash();
+
+    if (false == header_oracle_.LoadHeader(hash).operator bool()) {
+        // NOTE high bandwidth peers announce new blocks with cmpctblock
+        using Task = opentxs::blockchain::node::ManagerJobs;
+        network_.Submit([&] {
+            auto work = MakeWork(Task::SubmitBlockHeader);
+            pHeader->Serialize(work.AppendBytes(), false);
+
+            return work;
+        }());
+    }
+
+    if (false == block.has_value()) {
+        cmpct_fallback(hash, error);
+
+        return;
+    }
+
+    const auto matched = block->Reconstruct(mempool_.Snapshot());
+    cmpct_stats_.Add(&CompactBlock::Stats::mempool_, matched);
+    cmpct_stats_.Add(&CompactBlock::Stats::prefilled_, block->Prefilled());
+
+    if (block->IsComplete()) {
+        cmpct_finish(*block, false);
+
+        return;
+    }
+
+    if (max_pending_cmpct_ <= cmpct_pending_.size()) {
+        cmpct_fallback(hash, "too many compact blocks are pending");
+
+        return;
+    }
+
+    auto missing = block->Missing();
+    cmpct_stats_.Add(&CompactBlock::Stats::requested_, missing.size());
+    log_(OT_PRETTY_CLASS())(name_)(": requesting ")(missing.size())(
+        " of ")(block->Size())(" transactions for block ")
+        .asHex(hash)
+        .Flush();
+    transmit_protocol_getblocktxn(hash, missing);
+    cmpct_pending_.erase(hash);
+    cmpct_pending_.emplace(
+        std::piecewise_construct,
+        std::forward_as_tuple(hash),
+        std::forward_as_tuple(Clock::now(), std::move(*block)));
 }
 
 auto Peer::process_protocol_feefilter(
@@ -775,8 +1024,11 @@ auto Peer::process_protocol_feefilter(
     using Type = opentxs::blockchain::p2p::bitcoin::message::Feefilter;
     const auto pMessage = instantiate<Type>(
         std::move(header), protocol_, payload.data(), payload.size());
-    [[maybe_unused]] const auto& message = *pMessage;
-    // TODO
+    const auto& message = *pMessage;
+    fee_filter_.SetRemote(message.feeRate());
+    log_(OT_PRETTY_CLASS())(name_)(" requested a minimum fee rate of ")(
+        message.feeRate())(" satoshis per kilobyte for announcements")
+        .Flush();
 }
 
 auto Peer::process_protocol_filteradd(
@@ -842,8 +1094,33 @@ auto Peer::process_protocol_getblocktxn(
     using Type = opentxs::blockchain::p2p::bitcoin::message::Getblocktxn;
     const auto pMessage = instantiate<Type>(
         std::move(header), protocol_, payload.data(), payload.size());
-    [[maybe_unused]] const auto& message = *pMessage;
-    // TODO
+    const auto& message = *pMessage;
+    const auto hash =
+        opentxs::blockchain::block::Hash{message.getBlockHash().Bytes()};
+    auto future = block_oracle_.LoadBitcoin(hash);
+
+    if (false == IsReady(future)) {
+        log_(OT_PRETTY_CLASS())(name_)(": block ")
+            .asHex(hash)(" is not available")
+            .Flush();
+
+        return;
+    }
+
+    const auto pBlock = future.get();
+
+    if (false == pBlock.operator bool()) { return; }
+
+    const auto indices =
+        CompactBlock::DecodeIndices(message.getIndices(), pBlock->size());
+    auto output = api_.Factory().Data();
+
+    if (CompactBlock::EncodeTransactions(
+            *pBlock, indices, output.WriteInto())) {
+        transmit_protocol_blocktxn(output);
+    } else {
+        throw std::runtime_error{"invalid getblocktxn request"};
+    }
 }
 
 auto Peer::process_protocol_getcfcheckpt(
@@ -1060,9 +1337,34 @@ auto Peer::process_protocol_getdata(
                     notFound.emplace_back(inv);
                 }
             } break;
+            case Inv::MsgCmpctBlock: {
+                auto future = block_oracle_.LoadBitcoin(
+                    opentxs::blockchain::block::Hash{inv.hash_.Bytes()});
+
+                if (IsReady(future)) {
+                    const auto pBlock = future.get();
+
+                    OT_ASSERT(pBlock);
+
+                    auto output = api_.Factory().Data();
+                    const auto encoded = CompactBlock::Encode(
+                        api_,
+                        *pBlock,
+                        cmpct_version_,
+                        cmpct_nonce(),
+                        output.WriteInto());
+
+                    if (encoded) {
+                        transmit_protocol_cmpctblock(output);
+                    } else {
+                        notFound.emplace_back(inv);
+                    }
+                } else {
+                    notFound.emplace_back(inv);
+                }
+            } break;
             case Inv::None:
             case Inv::MsgFilteredBlock:
-            case Inv::MsgCmpctBlock:
             case Inv::MsgFilteredWitnessBlock:
             default: {
                 notFound.emplace_back(inv);
@@ -1350,8 +1652,16 @@ auto Peer::process_protocol_sendcmpct(
     using Type = opentxs::blockchain::p2p::bitcoin::message::Sendcmpct;
     const auto pMessage = instantiate<Type>(
         std::move(header), protocol_, payload.data(), payload.size());
-    [[maybe_unused]] const auto& message = *pMessage;
-    // TODO
+    const auto& message = *pMessage;
+
+    // NOTE peers announce every version they support, only ours matters
+    if (cmpct_version_ != message.version()) { return; }
+
+    peer_cmpct_ = true;
+    peer_cmpct_announce_ = message.announce();
+    log_(OT_PRETTY_CLASS())(name_)(" supports compact blocks in ")(
+        peer_cmpct_announce_ ? "high" : "low")(" bandwidth mode")
+        .Flush();
 }
 
 auto Peer::process_protocol_sendheaders(
@@ -1462,7 +1772,11 @@ auto Peer::reconcile_mempool() noexcept -> void
     transmit_protocol_inv([&] {
         auto out = UnallocatedVector<Inv>{};
 
-        for (const auto& hash : missing) { out.emplace_back(inv_tx_, hash); }
+        for (const auto& hash : missing) {
+            if (fee_filter_.Permits(fee_rate(hash))) {
+                out.emplace_back(inv_tx_, hash);
+            }
+        }
 
         return out;
     }());
@@ -1494,6 +1808,12 @@ auto Peer::transition_state_verify() noexcept -> void
 {
     Imp::transition_state_verify();
 
+    if (cmpct_protocol_version_ <= protocol_) {
+        transmit_protocol_sendcmpct();
+    }
+
+    transmit_protocol_feefilter();
+
     if (Dir::incoming == dir_) {
         log_(OT_PRETTY_CLASS())(name_)(
             " is not required to validate checkpoints")
@@ -1517,10 +1837,39 @@ auto Peer::transmit_block_hash(opentxs::blockchain::block::Hash&& hash) noexcept
 {
     using Inv = opentxs::blockchain::bitcoin::Inventory;
 
+    if (peer_cmpct_announce_) {
+        auto future = block_oracle_.LoadBitcoin(hash);
+
+        if (IsReady(future)) {
+            const auto pBlock = future.get();
+
+            OT_ASSERT(pBlock);
+
+            auto output = api_.Factory().Data();
+            const auto encoded = CompactBlock::Encode(
+                api_,
+                *pBlock,
+                cmpct_version_,
+                cmpct_nonce(),
+                output.WriteInto());
+
+            if (encoded) {
+                transmit_protocol_cmpctblock(output);
+
+                return;
+            }
+        }
+    }
+
     transmit_protocol_inv(Inv{inv_block_, std::move(hash)});
 }
 
-auto Peer::transmit_ping() noexcept -> void { transmit_protocol_ping(); }
+auto Peer::transmit_ping() noexcept -> void
+{
+    cmpct_expire();
+    transmit_protocol_ping();
+    transmit_protocol_feefilter();
+}
 
 auto Peer::transmit_protocol_block(const Data& serialized) noexcept -> void
 {
@@ -1528,6 +1877,13 @@ auto Peer::transmit_protocol_block(const Data& serialized) noexcept -> void
     transmit_protocol<Type>(serialized);
 }
 
+auto Peer::transmit_protocol_blocktxn(const Data& serialized) noexcept -> void
+{
+    using Type =
+        opentxs::blockchain::p2p::bitcoin::message::internal::Blocktxn;
+    transmit_protocol<Type>(serialized);
+}
+
 auto Peer::transmit_protocol_cfheaders(
     opentxs::blockchain::cfilter::Type type,
     const opentxs::blockchain::block::Hash& stop,
@@ -1548,12 +1904,54 @@ auto Peer::transmit_protocol_cfilter(
     transmit_protocol<Type>(type, hash, filter);
 }
 
+auto Peer::transmit_protocol_cmpctblock(const Data& serialized) noexcept
+    -> void
+{
+    using Type = opentxs::blockchain::p2p::bitcoin::message::Cmpctblock;
+    transmit_protocol<Type>(serialized);
+}
+
+auto Peer::transmit_protocol_feefilter() noexcept -> void
+{
+    if (feefilter_protocol_version_ > protocol_) { return; }
+
+    const auto complete = handshake_.got_version_ && handshake_.got_verack_;
+
+    if (false == complete) { return; }
+
+    const auto rate = [this]() -> std::uint64_t {
+        try {
+
+            return network_.FeeFilter().Internal().ExtractUInt64();
+        } catch (...) {
+
+            return 0;
+        }
+    }();
+
+    if (const auto send = fee_filter_.Update(rate, Clock::now()); send) {
+        log_(OT_PRETTY_CLASS())(name_)(" requesting a minimum fee rate of ")(
+            send.value())(" satoshis per kilobyte for announcements")
+            .Flush();
+        using Type = opentxs::blockchain::p2p::bitcoin::message::Feefilter;
+        transmit_protocol<Type>(send.value());
+    }
+}
+
 auto Peer::transmit_protocol_getaddr() noexcept -> void
 {
     using Type = opentxs::blockchain::p2p::bitcoin::message::internal::Getaddr;
     transmit_protocol<Type>();
 }
 
+auto Peer::transmit_protocol_getblocktxn(
+    const opentxs::blockchain::block::Hash& block,
+    const CompactBlock::Indices& indices) noexcept -> void
+{
+    using Type = opentxs::blockchain::p2p::bitcoin::message::Getblocktxn;
+    transmit_protocol<Type>(block, CompactBlock::EncodeIndices(indices));
+}
+
 auto Peer::transmit_protocol_getcfheaders(
     const opentxs::blockchain::block::Height start,
     const opentxs::blockchain::block::Hash& stop) noexcept -> void
@@ -1685,6 +2083,17 @@ auto Peer::transmit_protocol_pong(
     transmit_protocol<Type>(nonce);
 }
 
+auto Peer::transmit_protocol_sendcmpct() noexcept -> void
+{
+    using Type = opentxs::blockchain::p2p::bitcoin::message::Sendcmpct;
+    // NOTE a slot is only claimed once per connection
+    if (cmpct_want_high_bandwidth_ && (false == cmpct_high_bandwidth_)) {
+        cmpct_high_bandwidth_ = CompactBlock::ClaimHighBandwidth(chain_);
+    }
+
+    transmit_protocol<Type>(cmpct_high_bandwidth_, cmpct_version_);
+}
+
 auto Peer::transmit_protocol_tx(ReadView serialized) noexcept -> void
 {
     using Type = opentxs::blockchain::p2p::bitcoin::message::internal::Tx;
@@ -1746,9 +2155,15 @@ auto Peer::transmit_request_blocks(
         auto out = UnallocatedVector<Inv>{};
 
         for (const auto& task : job.data_) {
-            const auto& hash = task->position_.hash_;
+            const auto& position = task->position_;
+            const auto& hash = position.hash_;
             log_(OT_PRETTY_CLASS())("requesting block ").asHex(hash).Flush();
-            out.emplace_back(inv_block_, hash);
+
+            if (cmpct_eligible(position)) {
+                out.emplace_back(Inv::Type::MsgCmpctBlock, hash);
+            } else {
+                out.emplace_back(inv_block_, hash);
+            }
         }
 
         return out;
@@ -1789,9 +2204,35 @@ auto Peer::transmit_request_peers() noexcept -> void
 
 auto Peer::transmit_txid(const Txid& txid) noexcept -> void
 {
+    if (false == fee_filter_.Permits(fee_rate(txid))) { return; }
+
     using Inv = opentxs::blockchain::bitcoin::Inventory;
     transmit_protocol_inv(Inv{inv_tx_, txid});
 }
 
-Peer::~Peer() = default;
+Peer::~Peer()
+{
+    if (cmpct_high_bandwidth_) { CompactBlock::ReleaseHighBandwidth(chain_); }
+
+    const auto& stats = fee_filter_.Counters();
+
+    if (0u < stats.suppressed_.load()) {
+        log_(OT_PRETTY_CLASS())(name_)(" fee filter suppressed ")(
+            stats.suppressed_.load())(" of ")(
+            stats.suppressed_.load() + stats.announced_.load())(
+            " transaction announcements")
+            .Flush();
+    }
+
+    const auto& cmpct = cmpct_stats_.Peer();
+
+    if (0u < cmpct.received_.load()) {
+        log_(OT_PRETTY_CLASS())(name_)(" compact blocks: ")(
+            cmpct.received_.load())(" received, ")(
+            cmpct.reconstructed_.load())(" from mempool, ")(
+            cmpct.completed_.load())(" after getblocktxn, ")(
+            cmpct.fallback_.load())(" downloaded in full")
+            .Flush();
+    }
+}
 }  // namespace opentxs::network::blockchain::bitcoin
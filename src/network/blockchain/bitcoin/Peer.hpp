@@ -6,9 +6,13 @@
 #pragma once
 
 #include <robin_hood.h>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string_view>
+#include <utility>
 
 #include "blockchain/bitcoin/Inventory.hpp"
 #include "internal/blockchain/node/Types.hpp"
@@ -16,6 +20,8 @@
 #include "internal/network/blockchain/Peer.hpp"
 #include "internal/network/zeromq/Types.hpp"
 #include "internal/util/P0330.hpp"
+#include "network/blockchain/bitcoin/CompactBlock.hpp"
+#include "network/blockchain/bitcoin/FeeFilter.hpp"
 #include "network/blockchain/peer/Imp.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/blockchain/Types.hpp"
@@ -23,12 +29,14 @@
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/Header.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/block/Position.hpp"
 #include "opentxs/blockchain/block/Types.hpp"
 #include "opentxs/blockchain/p2p/Types.hpp"
 #include "opentxs/network/zeromq/message/Frame.hpp"
 #include "opentxs/util/Allocated.hpp"
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
+#include "opentxs/util/Time.hpp"
 #include "util/Actor.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -178,7 +186,15 @@ private:
 
     static constexpr auto default_protocol_version_ =
         opentxs::blockchain::p2p::bitcoin::ProtocolVersion{70015};
+    static constexpr auto cmpct_protocol_version_ =
+        opentxs::blockchain::p2p::bitcoin::ProtocolVersion{70014};
+    static constexpr auto feefilter_protocol_version_ =
+        opentxs::blockchain::p2p::bitcoin::ProtocolVersion{70013};
     static constexpr auto max_inv_ = 50000_uz;
+    static constexpr auto max_pending_cmpct_ = 8_uz;
+    static constexpr auto cmpct_tip_distance_ =
+        opentxs::blockchain::block::Height{2};
+    static constexpr auto cmpct_timeout_ = std::chrono::seconds{30};
 
     const opentxs::blockchain::node::internal::Mempool& mempool_;
     const CString user_agent_;
@@ -186,9 +202,20 @@ private:
     const opentxs::blockchain::p2p::bitcoin::Nonce nonce_;
     const opentxs::blockchain::bitcoin::Inventory::Type inv_block_;
     const opentxs::blockchain::bitcoin::Inventory::Type inv_tx_;
+    const std::uint64_t cmpct_version_;
+    const bool cmpct_want_high_bandwidth_;
     opentxs::blockchain::p2p::bitcoin::ProtocolVersion protocol_;
     UnallocatedSet<opentxs::blockchain::p2p::Service> local_services_;
     bool relay_;
+    bool cmpct_high_bandwidth_;
+    bool peer_cmpct_;
+    bool peer_cmpct_announce_;
+    UnallocatedMap<
+        opentxs::blockchain::block::Hash,
+        std::pair<Time, CompactBlock>>
+        cmpct_pending_;
+    CompactBlock::Counters cmpct_stats_;
+    FeeFilter fee_filter_;
     Handshake handshake_;
     Verification verification_;
 
@@ -205,8 +232,19 @@ private:
 
     auto check_handshake() noexcept -> void final;
     auto check_verification() noexcept -> void;
+    auto cmpct_eligible(
+        const opentxs::blockchain::block::Position& position) const noexcept
+        -> bool;
+    auto cmpct_expire() noexcept -> void;
+    auto cmpct_fallback(
+        const opentxs::blockchain::block::Hash& hash,
+        std::string_view reason) noexcept -> void;
+    auto cmpct_finish(CompactBlock& block, bool roundTrip) noexcept -> void;
+    auto cmpct_nonce() const noexcept -> std::uint64_t;
     auto extract_body_size(const zeromq::Frame& header) const noexcept
         -> std::size_t final;
+    auto fee_rate(const Txid& txid) const noexcept
+        -> std::optional<std::uint64_t>;
     auto not_implemented(
         std::unique_ptr<HeaderType> header,
         zeromq::Frame&&) noexcept(false) -> void;
@@ -333,6 +371,7 @@ private:
     template <typename Outgoing, typename... Args>
     auto transmit_protocol(Args&&... args) noexcept -> void;
     auto transmit_protocol_block(const Data& serialized) noexcept -> void;
+    auto transmit_protocol_blocktxn(const Data& serialized) noexcept -> void;
     auto transmit_protocol_cfheaders(
         opentxs::blockchain::cfilter::Type type,
         const opentxs::blockchain::block::Hash& stop,
@@ -342,7 +381,12 @@ private:
         opentxs::blockchain::cfilter::Type type,
         const opentxs::blockchain::block::Hash& hash,
         const opentxs::blockchain::GCS& filter) noexcept -> void;
+    auto transmit_protocol_cmpctblock(const Data& serialized) noexcept -> void;
+    auto transmit_protocol_feefilter() noexcept -> void;
     auto transmit_protocol_getaddr() noexcept -> void;
+    auto transmit_protocol_getblocktxn(
+        const opentxs::blockchain::block::Hash& block,
+        const CompactBlock::Indices& indices) noexcept -> void;
     auto transmit_protocol_getcfheaders(
         const opentxs::blockchain::block::Height start,
         const opentxs::blockchain::block::Hash& stop) noexcept -> void;
@@ -379,6 +423,7 @@ private:
     auto transmit_protocol_ping() noexcept -> void;
     auto transmit_protocol_pong(
         const opentxs::blockchain::p2p::bitcoin::Nonce& nonce) noexcept -> void;
+    auto transmit_protocol_sendcmpct() noexcept -> void;
     auto transmit_protocol_tx(ReadView serialized) noexcept -> void;
     auto transmit_protocol_verack() noexcept -> void;
     auto transmit_protocol_version() noexcept -> void;
@@ -29,14 +29,16 @@
 #include "opentxs/network/zeromq/socket/Request.hpp"
 #include "opentxs/network/zeromq/socket/Router.hpp"
 #include "opentxs/network/zeromq/socket/Subscribe.hpp"
+#include "opentxs/util/Options.hpp"
 
 namespace opentxs::factory
 {
-auto ZMQContext() noexcept -> std::unique_ptr<network::zeromq::Context>
+auto ZMQContext(const Options& args) noexcept
+    -> std::unique_ptr<network::zeromq::Context>
 {
     using ReturnType = network::zeromq::implementation::Context;
 
-    return std::make_unique<ReturnType>();
+    return std::make_unique<ReturnType>(args);
 }
 }  // namespace opentxs::factory
 
@@ -59,9 +61,9 @@ auto GetSocketID() noexcept -> SocketID
 
 namespace opentxs::network::zeromq::implementation
 {
-Context::Context() noexcept
+Context::Context(const Options& args) noexcept
     : context_(::zmq_ctx_new())
-    , pool_(*this)
+    , pool_(*this, args.ZMQWorkStealing())
 {
     assert(nullptr != context_);
     assert(1 == ::zmq_has("curve"));
@@ -76,6 +76,7 @@ class ReplyCallback;
 }  // namespace network
 
 class Factory;
+class Options;
 // }  // namespace v1
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
@@ -172,7 +173,8 @@ public:
     auto Thread(BatchID id) const noexcept -> internal::Thread* final;
     auto ThreadID(BatchID id) const noexcept -> std::thread::id final;
 
-    Context() noexcept;
+    Context(const Options& args) noexcept;
+    Context() = delete;
     Context(const Context&) = delete;
     Context(Context&&) = delete;
     auto operator=(const Context&) -> Context& = delete;
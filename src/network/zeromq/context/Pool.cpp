@@ -23,17 +23,20 @@
 
 namespace opentxs::network::zeromq::context
 {
-Pool::Pool(const Context& parent) noexcept
+Pool::Pool(const Context& parent, bool scheduled) noexcept
     : parent_(parent)
     , count_(std::thread::hardware_concurrency())
     , running_(true)
     , gate_()
+    , scheduler_(scheduled ? std::make_unique<Scheduler>(count_) : nullptr)
     , threads_()
     , batches_()
     , batch_index_()
     , socket_index_()
 {
-    for (unsigned int n{0}; n < count_; ++n) { threads_.try_emplace(n, *this); }
+    for (unsigned int n{0}; n < count_; ++n) {
+        threads_.try_emplace(n, *this, scheduler_.get());
+    }
 }
 
 auto Pool::Alloc(BatchID id) noexcept -> alloc::Resource*
@@ -48,7 +51,9 @@ auto Pool::BelongsToThreadPool(const std::thread::id id) const noexcept -> bool
 
     for (const auto& [tid, thread] : threads_) { threads.emplace(thread.ID()); }
 
-    return 0 < threads.count(id);
+    if (0 < threads.count(id)) { return true; }
+
+    return scheduler_ && scheduler_->BelongsToThreadPool(id);
 }
 
 auto Pool::DoModify(SocketID id, const ModifyCallback& cb) noexcept -> bool
@@ -187,6 +192,8 @@ auto Pool::stop() noexcept -> void
 
         for (auto& [id, thread] : threads_) { thread.Shutdown(); }
 
+        if (scheduler_) { scheduler_->Shutdown(); }
+
         batches_.modify([](auto& map) { map.clear(); });
         batch_index_.modify([](auto& map) { map.clear(); });
         socket_index_.modify([](auto& map) { map.clear(); });
@@ -7,6 +7,7 @@
 #include <robin_hood.h>
 #include <atomic>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string_view>
@@ -20,6 +21,7 @@
 #include "internal/network/zeromq/Pool.hpp"
 #include "internal/network/zeromq/Thread.hpp"
 #include "internal/network/zeromq/Types.hpp"
+#include "network/zeromq/context/Scheduler.hpp"
 #include "network/zeromq/context/Thread.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/socket/Types.hpp"
@@ -98,7 +100,9 @@ public:
     auto UpdateIndex(BatchID id, StartArgs&& sockets) noexcept -> void final;
     auto UpdateIndex(BatchID id) noexcept -> void final;
 
-    Pool(const Context& parent) noexcept;
+    /// When scheduled is true received messages are handled by a work
+    /// stealing scheduler instead of the thread which polls the socket
+    Pool(const Context& parent, bool scheduled) noexcept;
     Pool() = delete;
     Pool(const Pool&) = delete;
     Pool(Pool&&) = delete;
@@ -112,6 +116,7 @@ private:
     const unsigned int count_;
     std::atomic<bool> running_;
     Gatekeeper gate_;
+    std::unique_ptr<Scheduler> scheduler_;
     robin_hood::unordered_node_map<unsigned int, context::Thread> threads_;
     libguarded::ordered_guarded<Batches, std::shared_mutex> batches_;
     libguarded::ordered_guarded<BatchIndex, std::shared_mutex> batch_index_;
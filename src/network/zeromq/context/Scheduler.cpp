@@ -0,0 +1,381 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                          // IWYU pragma: associated
+#include "1_Internal.hpp"                        // IWYU pragma: associated
+#include "network/zeromq/context/Scheduler.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+
+#include "internal/util/Mutex.hpp"
+#include "internal/util/Signals.hpp"
+#include "network/zeromq/message/FramePool.hpp"
+#include "util/Thread.hpp"
+
+namespace opentxs::network::zeromq::context
+{
+Strand::Strand(
+    BatchID id,
+    Vector<ReceiveCallback>&& callbacks,
+    Task&& onIdle) noexcept
+    : id_(id)
+    , callbacks_(std::move(callbacks))
+    , on_idle_(std::move(onIdle))
+    , state_(idle)
+    , self_()
+    , pending_()
+    , empty_(true)
+    , on_retire_()
+    , deferred_lock_()
+    , deferred_()
+    , next_(nullptr)
+{
+}
+
+auto Strand::Abandon() noexcept -> void
+{
+    pending_.clear();
+    empty_ = true;
+    finish();
+}
+
+auto Strand::Defer(Task&& task) noexcept -> bool
+{
+    auto lock = Lock{deferred_lock_};
+    const auto state = state_.load();
+
+    if ((idle == state) || (retired == state)) { return false; }
+
+    deferred_.emplace_back(std::move(task));
+
+    return true;
+}
+
+auto Strand::finish() noexcept -> void
+{
+    // NOTE this may be the last reference
+    auto self = std::move(self_);
+
+    while (true) {
+        auto tasks = Vector<Task>{};
+
+        {
+            auto lock = Lock{deferred_lock_};
+
+            if (deferred_.empty()) {
+                auto expected = int{busy};
+
+                if (state_.compare_exchange_strong(expected, idle)) {
+                    lock.unlock();
+
+                    if (on_idle_) { on_idle_(); }
+
+                    return;
+                }
+
+                break;
+            }
+
+            tasks.swap(deferred_);
+        }
+
+        for (auto& task : tasks) {
+            try {
+                task();
+            } catch (...) {
+            }
+        }
+    }
+
+    // NOTE the poller retired this strand while it was running
+    state_.store(retired);
+
+    if (on_retire_) { on_retire_(); }
+}
+
+auto Strand::Push(std::size_t callback, Message&& message) noexcept -> void
+{
+    pending_.emplace_back(callback, std::move(message));
+    empty_ = false;
+}
+
+auto Strand::Retire(Task&& cb) noexcept -> void
+{
+    on_retire_ = std::move(cb);
+    auto expected = int{idle};
+
+    if (state_.compare_exchange_strong(expected, retired)) {
+        if (on_retire_) { on_retire_(); }
+
+        return;
+    }
+
+    expected = busy;
+
+    if (state_.compare_exchange_strong(expected, retiring)) { return; }
+
+    // NOTE the worker became idle between the two attempts
+    state_.store(retired);
+
+    if (on_retire_) { on_retire_(); }
+}
+
+auto Strand::Run() noexcept -> void
+{
+    for (auto& [callback, message] : pending_) {
+        try {
+            callbacks_.at(callback)(std::move(message));
+        } catch (...) {
+        }
+    }
+
+    pending_.clear();
+    empty_ = true;
+    finish();
+}
+
+auto Strand::Submit(Scheduler& scheduler) noexcept -> void
+{
+    state_.store(busy);
+    self_ = shared_from_this();
+    scheduler.Submit(this);
+}
+
+Strand::~Strand() = default;
+}  // namespace opentxs::network::zeromq::context
+
+namespace opentxs::network::zeromq::context
+{
+Scheduler::Deque::Deque() noexcept
+    : top_(0)
+    , bottom_(0)
+    , buffer_()
+{
+}
+
+auto Scheduler::Deque::Pop() noexcept -> Strand*
+{
+    const auto b = bottom_.load(std::memory_order_relaxed) - 1;
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto t = top_.load(std::memory_order_relaxed);
+
+    if (t > b) {
+        bottom_.store(b + 1, std::memory_order_relaxed);
+
+        return nullptr;
+    }
+
+    auto* out = buffer_[b & mask_].load(std::memory_order_relaxed);
+
+    if (t == b) {
+        // NOTE last item, race against thieves
+        if (false == top_.compare_exchange_strong(
+                         t,
+                         t + 1,
+                         std::memory_order_seq_cst,
+                         std::memory_order_relaxed)) {
+            out = nullptr;
+        }
+
+        bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+
+    return out;
+}
+
+auto Scheduler::Deque::Push(Strand* item) noexcept -> bool
+{
+    const auto b = bottom_.load(std::memory_order_relaxed);
+    const auto t = top_.load(std::memory_order_acquire);
+
+    if ((b - t) >= capacity_) { return false; }
+
+    buffer_[b & mask_].store(item, std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_release);
+
+    return true;
+}
+
+auto Scheduler::Deque::Steal() noexcept -> Strand*
+{
+    auto t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto b = bottom_.load(std::memory_order_acquire);
+
+    if (t >= b) { return nullptr; }
+
+    auto* out = buffer_[t & mask_].load(std::memory_order_acquire);
+
+    if (top_.compare_exchange_strong(
+            t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+
+        return out;
+    }
+
+    return nullptr;
+}
+}  // namespace opentxs::network::zeromq::context
+
+namespace opentxs::network::zeromq::context
+{
+Scheduler::Scheduler(unsigned int workers) noexcept
+    : count_(std::max(workers, 1u))
+    , running_(true)
+    , workers_(std::make_unique<Worker[]>(count_))
+    , epoch_(0)
+    , sleeping_(0)
+    , lock_()
+    , cv_()
+{
+    for (auto n = 0u; n < count_; ++n) {
+        workers_[n].handle_ = std::thread{&Scheduler::run, this, n};
+    }
+}
+
+auto Scheduler::BelongsToThreadPool(const std::thread::id id) const noexcept
+    -> bool
+{
+    for (auto n = 0u; n < count_; ++n) {
+        if (workers_[n].handle_.get_id() == id) { return true; }
+    }
+
+    return false;
+}
+
+auto Scheduler::next(unsigned int index) noexcept -> Strand*
+{
+    auto& self = workers_[index];
+    const auto enqueue = [&](Strand* list, std::atomic<Strand*>& overflow) {
+        for (auto* i = list; nullptr != i;) {
+            auto* next = i->next_;
+
+            if (false == self.deque_.Push(i)) {
+                i->next_ = overflow.load();
+
+                while (false == overflow.compare_exchange_weak(i->next_, i)) {
+                }
+            }
+
+            i = next;
+        }
+    };
+
+    if (auto* out = self.deque_.Pop(); nullptr != out) { return out; }
+
+    enqueue(take(self.inbox_), self.inbox_);
+
+    if (auto* out = self.deque_.Pop(); nullptr != out) { return out; }
+
+    for (auto n = 1u; n < count_; ++n) {
+        auto& victim = workers_[(index + n) % count_];
+
+        if (auto* out = victim.deque_.Steal(); nullptr != out) { return out; }
+
+        if (auto* out = take(victim.inbox_); nullptr != out) {
+            enqueue(out->next_, victim.inbox_);
+
+            return out;
+        }
+    }
+
+    return nullptr;
+}
+
+auto Scheduler::run(unsigned int index) noexcept -> void
+{
+    Signals::Block();
+    SetThisThreadsName("zmq worker");
+    const auto pool = FramePool::Binding{};
+
+    while (running_) {
+        const auto epoch = epoch_.load();
+
+        if (auto* strand = next(index); nullptr != strand) {
+            strand->Run();
+
+            continue;
+        }
+
+        auto lock = Lock{lock_};
+        ++sleeping_;
+        cv_.wait(lock, [&] {
+            return (epoch != epoch_.load()) || (false == running_.load());
+        });
+        --sleeping_;
+    }
+}
+
+auto Scheduler::Shutdown() noexcept -> void
+{
+    if (auto running = running_.exchange(false); running) {
+        {
+            auto lock = Lock{lock_};
+            cv_.notify_all();
+        }
+
+        for (auto n = 0u; n < count_; ++n) {
+            auto& worker = workers_[n];
+
+            if (worker.handle_.joinable()) { worker.handle_.join(); }
+        }
+
+        for (auto n = 0u; n < count_; ++n) {
+            auto& worker = workers_[n];
+
+            while (auto* strand = worker.deque_.Pop()) { strand->Abandon(); }
+
+            for (auto* i = take(worker.inbox_); nullptr != i;) {
+                auto* next = i->next_;
+                i->Abandon();
+                i = next;
+            }
+        }
+    }
+}
+
+auto Scheduler::Submit(Strand* strand) noexcept -> void
+{
+    // NOTE batches are assigned to a home worker for cache locality. Idle
+    // workers steal from the others.
+    auto& inbox = workers_[strand->id_ % count_].inbox_;
+    strand->next_ = inbox.load();
+
+    while (false == inbox.compare_exchange_weak(strand->next_, strand)) {}
+
+    wake();
+}
+
+auto Scheduler::take(std::atomic<Strand*>& inbox) noexcept -> Strand*
+{
+    // NOTE the inbox is a stack so reverse it to restore submission order
+    auto* list = inbox.exchange(nullptr);
+    auto* out = static_cast<Strand*>(nullptr);
+
+    while (nullptr != list) {
+        auto* next = list->next_;
+        list->next_ = out;
+        out = list;
+        list = next;
+    }
+
+    return out;
+}
+
+auto Scheduler::wake() noexcept -> void
+{
+    ++epoch_;
+
+    // NOTE a worker increments sleeping_ before checking epoch_ for the last
+    // time, so if no worker is counted here then every worker which is about
+    // to sleep will see the new epoch instead
+    if (0u == sleeping_.load()) { return; }
+
+    auto lock = Lock{lock_};
+    cv_.notify_one();
+}
+
+Scheduler::~Scheduler() { Shutdown(); }
+}  // namespace opentxs::network::zeromq::context
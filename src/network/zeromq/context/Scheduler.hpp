@@ -0,0 +1,149 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "internal/network/zeromq/Types.hpp"
+#include "opentxs/network/zeromq/message/Message.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::network::zeromq::context
+{
+class Scheduler;
+
+/// All sockets belonging to one batch share a strand. The poller thread
+/// queues received messages on an idle strand and submits it to the
+/// scheduler. While a strand is busy its sockets are excluded from polling
+/// and belong exclusively to the worker running it, which preserves both the
+/// order of messages and the single threaded socket access the handlers
+/// expect. The poller is notified through on_idle each time the strand becomes
+/// idle so that it can resume polling the strand's sockets.
+class Strand : public std::enable_shared_from_this<Strand>
+{
+public:
+    using Task = std::function<void()>;
+
+    /// Poller thread only
+    auto Defer(Task&& task) noexcept -> bool;
+    auto HasPending() const noexcept -> bool { return false == empty_; }
+    auto Idle() const noexcept -> bool { return idle == state_.load(); }
+    auto Push(std::size_t callback, Message&& message) noexcept -> void;
+    auto Retire(Task&& cb) noexcept -> void;
+    auto Submit(Scheduler& scheduler) noexcept -> void;
+
+    /// Worker thread only
+    auto Abandon() noexcept -> void;
+    auto Run() noexcept -> void;
+
+    Strand(
+        BatchID id,
+        Vector<ReceiveCallback>&& callbacks,
+        Task&& onIdle) noexcept;
+    Strand() = delete;
+    Strand(const Strand&) = delete;
+    Strand(Strand&&) = delete;
+    auto operator=(const Strand&) -> Strand& = delete;
+    auto operator=(Strand&&) -> Strand& = delete;
+
+    ~Strand();
+
+private:
+    friend Scheduler;
+
+    enum State : int { idle, busy, retiring, retired };
+
+    const BatchID id_;
+    const Vector<ReceiveCallback> callbacks_;
+    const Task on_idle_;
+    std::atomic<int> state_;
+    std::shared_ptr<Strand> self_;
+    Vector<std::pair<std::size_t, Message>> pending_;
+    bool empty_;
+    Task on_retire_;
+    std::mutex deferred_lock_;
+    Vector<Task> deferred_;
+    Strand* next_;
+
+    auto finish() noexcept -> void;
+};
+
+/// Executes strands on a fixed set of worker threads. Each worker owns a
+/// bounded Chase-Lev deque and a lock-free inbox which pollers push to.
+/// Idle workers steal from the other deques and inboxes, and sleep on a
+/// condition variable when there is nothing to steal.
+class Scheduler
+{
+public:
+    /// Only the owning worker may call Pop and Push. Any thread may Steal.
+    class Deque
+    {
+    public:
+        static constexpr auto capacity_ = std::int64_t{4096};
+
+        auto Pop() noexcept -> Strand*;
+        auto Push(Strand* item) noexcept -> bool;
+        auto Steal() noexcept -> Strand*;
+
+        Deque() noexcept;
+
+    private:
+        static constexpr auto mask_ = capacity_ - 1;
+
+        static_assert(0 == (capacity_ & mask_));
+
+        alignas(64) std::atomic<std::int64_t> top_;
+        alignas(64) std::atomic<std::int64_t> bottom_;
+        std::array<std::atomic<Strand*>, capacity_> buffer_;
+    };
+
+    auto BelongsToThreadPool(const std::thread::id) const noexcept -> bool;
+
+    auto Shutdown() noexcept -> void;
+    auto Submit(Strand* strand) noexcept -> void;
+
+    Scheduler(unsigned int workers) noexcept;
+    Scheduler() = delete;
+    Scheduler(const Scheduler&) = delete;
+    Scheduler(Scheduler&&) = delete;
+    auto operator=(const Scheduler&) -> Scheduler& = delete;
+    auto operator=(Scheduler&&) -> Scheduler& = delete;
+
+    ~Scheduler();
+
+private:
+    struct Worker {
+        Deque deque_{};
+        alignas(64) std::atomic<Strand*> inbox_{nullptr};
+        std::thread handle_{};
+    };
+
+    const unsigned int count_;
+    std::atomic<bool> running_;
+    std::unique_ptr<Worker[]> workers_;
+    // NOTE incremented by every submission so a worker which found nothing to
+    // run can detect work which arrived before it went to sleep
+    std::atomic<std::uint64_t> epoch_;
+    std::atomic<unsigned int> sleeping_;
+    std::mutex lock_;
+    std::condition_variable cv_;
+
+    static auto take(std::atomic<Strand*>& inbox) noexcept -> Strand*;
+
+    auto next(unsigned int index) noexcept -> Strand*;
+    auto run(unsigned int index) noexcept -> void;
+    auto wake() noexcept -> void;
+};
+}  // namespace opentxs::network::zeromq::context
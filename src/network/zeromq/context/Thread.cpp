@@ -27,9 +27,15 @@
 #include "internal/network/zeromq/socket/Factory.hpp"
 #include "internal/network/zeromq/socket/Raw.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
+#include "internal/util/Mutex.hpp"
 #include "internal/util/Signals.hpp"
+#include "network/zeromq/message/FramePool.hpp"
+#include "opentxs/network/zeromq/ZeroMQ.hpp"
 #include "opentxs/network/zeromq/message/Frame.hpp"
 #include "opentxs/network/zeromq/message/Message.hpp"
+#include "opentxs/network/zeromq/socket/SocketType.hpp"
+#include "opentxs/network/zeromq/socket/Types.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Time.hpp"
 #include "opentxs/util/Types.hpp"
@@ -38,8 +44,9 @@
 
 namespace opentxs::network::zeromq::context
 {
-Thread::Thread(zeromq::internal::Pool& parent) noexcept
+Thread::Thread(zeromq::internal::Pool& parent, Scheduler* scheduler) noexcept
     : parent_(parent)
+    , scheduler_(scheduler)
     , shutdown_(false)
     , null_(factory::ZMQSocketNull())
     , alloc_()
@@ -48,7 +55,27 @@ Thread::Thread(zeromq::internal::Pool& parent) noexcept
     , data_(&alloc_)
     , idle_(true)
     , thread_name_()
+    , wake_([&] {
+        if (nullptr == scheduler_) { return factory::ZMQSocketNull(); }
+
+        return factory::ZMQSocket(parent_.Parent(), socket::Type::Pair);
+    }())
+    , waker_([&] {
+        if (nullptr == scheduler_) { return factory::ZMQSocketNull(); }
+
+        return factory::ZMQSocket(parent_.Parent(), socket::Type::Pair);
+    }())
+    , waker_lock_()
+    , woken_(false)
 {
+    if (nullptr != scheduler_) {
+        const auto endpoint = MakeArbitraryInproc();
+        const auto bound = wake_.Bind(endpoint.c_str());
+        const auto connected = waker_.Connect(endpoint.c_str());
+
+        OT_ASSERT(bound);
+        OT_ASSERT(connected);
+    }
 }
 
 auto Thread::Add(
@@ -71,25 +98,67 @@ auto Thread::Add(
 
         return out;
     }();
-    parent_.UpdateIndex(id, std::move(args));
-    data_.modify_detach([data = std::move(sockets)](auto& guarded) {
-        for (auto [socket, cb] : data) {
-            assert(cb);
+    auto ids = [&] {
+        auto out = Vector<SocketID>{};
+        out.reserve(args.size());
 
-            guarded.data_.emplace_back(std::move(cb));
-            auto& s = guarded.items_.emplace_back();
-            s.socket = socket->Native();
-            s.events = ZMQ_POLLIN;
+        for (const auto& [sID, socket, cb] : args) { out.emplace_back(sID); }
 
-            assert(guarded.items_.size() == guarded.data_.size());
-        }
-    });
+        return out;
+    }();
+    parent_.UpdateIndex(id, std::move(args));
+    data_.modify_detach(
+        [this, id, ids = std::move(ids), data = std::move(sockets)](
+            auto& guarded) { add(guarded, id, ids, data); });
     thread_name_ = threadname;
     start();
 
     return true;
 }
 
+auto Thread::add(
+    Items& data,
+    BatchID id,
+    const Vector<SocketID>& ids,
+    const ThreadStartArgs& sockets) noexcept -> void
+{
+    auto strand = std::shared_ptr<Strand>{};
+
+    if (nullptr != scheduler_) {
+        auto callbacks = Vector<ReceiveCallback>{};
+        callbacks.reserve(sockets.size());
+
+        for (const auto& [socket, cb] : sockets) { callbacks.emplace_back(cb); }
+
+        strand = std::make_shared<Strand>(
+            id, std::move(callbacks), [this] { wakeup(); });
+        data.batches_[id] = strand;
+    }
+
+    auto index = 0_uz;
+
+    for (const auto& [socket, cb] : sockets) {
+        assert(cb);
+
+        if (strand) {
+            data.data_.emplace_back([s = strand.get(), index](auto&& message) {
+                s->Push(index, std::move(message));
+            });
+            data.strand_.emplace_back(strand.get());
+            data.sockets_[ids.at(index)] = strand.get();
+        } else {
+            data.data_.emplace_back(cb);
+        }
+
+        auto& item = data.items_.emplace_back();
+        item.socket = socket->Native();
+        item.events = ZMQ_POLLIN;
+        ++index;
+
+        assert(data.items_.size() == data.data_.size());
+    }
+}
+
 auto Thread::join() noexcept -> void
 {
     if (thread_.handle_.joinable()) { thread_.handle_.join(); }
@@ -118,7 +187,17 @@ auto Thread::Modify(SocketID socket, ModifyCallback cb) noexcept -> AsyncResult
                 promise->set_value(false);
             }
         } else {
-            promise->set_value(parent_.DoModify(socket, cb));
+            auto modify = [=] {
+                promise->set_value(parent_.DoModify(socket, cb));
+            };
+
+            // NOTE a busy strand owns its sockets until the worker is
+            // finished with it
+            if (auto i = data.sockets_.find(socket); data.sockets_.end() != i) {
+                if (i->second->Defer(modify)) { return; }
+            }
+
+            modify();
         }
     });
 
@@ -135,11 +214,60 @@ auto Thread::poll(Items& data) noexcept -> void
         return;
     }
 
+    if (nullptr != scheduler_) {
+        poll_scheduled(data);
+
+        return;
+    }
+
+    static constexpr auto timeout = 100ms;
+    const auto events = ::zmq_poll(
+        data.items_.data(),
+        static_cast<int>(data.items_.size()),
+        timeout.count());
+
+    if (0 > events) {
+        std::cout << OT_PRETTY_CLASS() << ::zmq_strerror(::zmq_errno())
+                  << std::endl;
+
+        return;
+    } else if (0 == events) {
+
+        return;
+    }
+
+    dispatch(data);
+}
+
+auto Thread::poll_scheduled(Items& data) noexcept -> void
+{
+    auto s = data.items_.begin();
+
+    for (const auto* strand : data.strand_) {
+        auto& item = *(s++);
+        item.events = strand->Idle() ? ZMQ_POLLIN : 0;
+    }
+
+    // NOTE the wake socket is only polled for the duration of this call so
+    // that items_ remains parallel to data_ and strand_
     static constexpr auto timeout = 100ms;
+    auto& wake = data.items_.emplace_back();
+    wake.socket = wake_.Native();
+    wake.events = ZMQ_POLLIN;
     const auto events = ::zmq_poll(
         data.items_.data(),
         static_cast<int>(data.items_.size()),
         timeout.count());
+    const auto woken = (ZMQ_POLLIN == data.items_.back().revents);
+    data.items_.pop_back();
+
+    if (woken) {
+        woken_.store(false);
+        auto* socket = wake_.Native();
+        auto buf = char{};
+
+        while (-1 != ::zmq_recv(socket, &buf, 0, ZMQ_DONTWAIT)) {}
+    }
 
     if (0 > events) {
         std::cout << OT_PRETTY_CLASS() << ::zmq_strerror(::zmq_errno())
@@ -151,6 +279,18 @@ auto Thread::poll(Items& data) noexcept -> void
         return;
     }
 
+    // NOTE received messages are queued on the strand rather than handled
+    dispatch(data);
+
+    for (auto* strand : data.strand_) {
+        if (strand->Idle() && strand->HasPending()) {
+            strand->Submit(*scheduler_);
+        }
+    }
+}
+
+auto Thread::dispatch(Items& data) noexcept -> void
+{
     const auto& v = data.items_;
     auto c = data.data_.begin();
 
@@ -239,8 +379,10 @@ auto Thread::Remove(BatchID id, UnallocatedVector<socket::Raw*>&& data) noexcept
 
                 return out;
             }();
+            const auto scheduled = nullptr != scheduler_;
             auto s = guarded.items_.begin();
             auto c = guarded.data_.begin();
+            auto t = guarded.strand_.begin();
 
             while ((s != guarded.items_.end()) && (c != guarded.data_.end())) {
                 auto* socket = s->socket;
@@ -248,16 +390,38 @@ auto Thread::Remove(BatchID id, UnallocatedVector<socket::Raw*>&& data) noexcept
                 if (0u == set.count(socket)) {
                     ++s;
                     ++c;
+
+                    if (scheduled) { ++t; }
                 } else {
                     s = guarded.items_.erase(s);
                     c = guarded.data_.erase(c);
+
+                    if (scheduled) { t = guarded.strand_.erase(t); }
                 }
             }
 
             assert(guarded.items_.size() == guarded.data_.size());
 
-            parent_.UpdateIndex(id);
-            promise->set_value(true);
+            auto finish = [this, id, promise] {
+                parent_.UpdateIndex(id);
+                promise->set_value(true);
+            };
+
+            if (auto i = guarded.batches_.find(id);
+                guarded.batches_.end() != i) {
+                auto strand = std::move(i->second);
+                guarded.batches_.erase(i);
+
+                for (auto* socket : sockets) {
+                    guarded.sockets_.erase(socket->ID());
+                }
+
+                // NOTE the batch must not be destroyed while a worker is
+                // still handling its messages
+                strand->Retire(std::move(finish));
+            } else {
+                finish();
+            }
         });
 
     return future;
@@ -269,6 +433,8 @@ auto Thread::run() noexcept -> void
 
     if (!thread_name_.empty()) { SetThisThreadsName(thread_name_); }
 
+    const auto pool = FramePool::Binding{};
+
     while (thread_.running_) {
         if (auto idle = idle_.exchange(false); idle) {
             data_.modify_detach([this](auto& data) { poll(data); });
@@ -281,10 +447,17 @@ auto Thread::run() noexcept -> void
 
 auto Thread::Shutdown() noexcept -> void
 {
-    shutdown_ = true;
+    {
+        auto lock = Lock{waker_lock_};
+        shutdown_ = true;
+    }
+
     data_.modify_detach([](auto& data) {
         data.items_.clear();
         data.data_.clear();
+        data.strand_.clear();
+        data.batches_.clear();
+        data.sockets_.clear();
     });
     wait();
 }
@@ -303,6 +476,20 @@ auto Thread::wait() noexcept -> void
     join();
 }
 
+auto Thread::wakeup() noexcept -> void
+{
+    // NOTE one message is enough to interrupt zmq_poll no matter how many
+    // strands became idle
+    if (woken_.exchange(true)) { return; }
+
+    auto lock = Lock{waker_lock_};
+
+    if (shutdown_) { return; }
+
+    auto buf = char{};
+    ::zmq_send(waker_.Native(), &buf, 0, ZMQ_DONTWAIT);
+}
+
 Thread::Items::~Items() = default;
 
 Thread::~Thread() { wait(); }
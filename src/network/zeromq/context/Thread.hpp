@@ -9,6 +9,7 @@
 #include <zmq.h>
 #include <atomic>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <shared_mutex>
@@ -22,6 +23,7 @@
 #include "internal/network/zeromq/Types.hpp"
 #include "internal/network/zeromq/socket/Raw.hpp"
 #include "internal/util/BoostPMR.hpp"
+#include "network/zeromq/context/Scheduler.hpp"
 #include "opentxs/util/Allocator.hpp"
 #include "opentxs/util/Container.hpp"
 #include "util/Gatekeeper.hpp"
@@ -75,7 +77,7 @@ public:
         -> std::future<bool>;
     auto Shutdown() noexcept -> void final;
 
-    Thread(zeromq::internal::Pool& parent) noexcept;
+    Thread(zeromq::internal::Pool& parent, Scheduler* scheduler) noexcept;
     Thread() = delete;
     Thread(const Thread&) = delete;
     Thread(Thread&&) = delete;
@@ -92,13 +94,24 @@ private:
     struct Items {
         using ItemVector = Vector<::zmq_pollitem_t>;
         using DataVector = Vector<ReceiveCallback>;
+        using StrandVector = Vector<Strand*>;
+        using StrandMap = Map<BatchID, std::shared_ptr<Strand>>;
+        using SocketMap = Map<SocketID, Strand*>;
 
         ItemVector items_;
         DataVector data_;
+        // NOTE the following are only populated when a scheduler is in use.
+        // strand_ is parallel to items_ and data_.
+        StrandVector strand_;
+        StrandMap batches_;
+        SocketMap sockets_;
 
         Items(alloc::Resource* alloc) noexcept
             : items_(alloc)
             , data_(alloc)
+            , strand_(alloc)
+            , batches_(alloc)
+            , sockets_(alloc)
         {
         }
 
@@ -108,6 +121,7 @@ private:
     using Data = libguarded::deferred_guarded<Items, std::shared_mutex>;
 
     zeromq::internal::Pool& parent_;
+    Scheduler* const scheduler_;
     std::atomic_bool shutdown_;
     socket::Raw null_;
     alloc::BoostPoolSync alloc_;
@@ -116,12 +130,27 @@ private:
     Data data_;
     std::atomic<bool> idle_;
     CString thread_name_;
-
+    // NOTE only used with a scheduler. Workers send an empty message to
+    // wake_ through waker_ when a strand becomes idle, which interrupts
+    // zmq_poll so the strand's sockets are polled again without delay.
+    socket::Raw wake_;
+    socket::Raw waker_;
+    std::mutex waker_lock_;
+    std::atomic<bool> woken_;
+
+    auto add(
+        Items& data,
+        BatchID id,
+        const Vector<SocketID>& ids,
+        const ThreadStartArgs& sockets) noexcept -> void;
+    auto dispatch(Items& data) noexcept -> void;
     auto join() noexcept -> void;
     auto poll(Items& data) noexcept -> void;
+    auto poll_scheduled(Items& data) noexcept -> void;
     auto receive_message(void* socket, Message& message) noexcept -> bool;
     auto run() noexcept -> void;
     auto start() noexcept -> void;
     auto wait() noexcept -> void;
+    auto wakeup() noexcept -> void;
 };
 }  // namespace opentxs::network::zeromq::context
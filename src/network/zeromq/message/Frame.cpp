@@ -16,6 +16,7 @@
 
 #include "internal/network/zeromq/message/Factory.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "network/zeromq/message/FramePool.hpp"
 
 namespace opentxs::factory
 {
@@ -40,6 +41,14 @@ auto ZMQFrame(const ProtobufType& data) noexcept -> network::zeromq::Frame
 
     return std::make_unique<ReturnType::Imp>(data).release();
 }
+
+auto ZMQFrame(const ReadView data, std::shared_ptr<const void> pin) noexcept
+    -> network::zeromq::Frame
+{
+    using ReturnType = network::zeromq::Frame;
+
+    return std::make_unique<ReturnType::Imp>(data, std::move(pin)).release();
+}
 }  // namespace opentxs::factory
 
 namespace opentxs::network::zeromq
@@ -83,11 +92,53 @@ Frame::Imp::Imp(const ProtobufType& input) noexcept
     input.SerializeToArray(data(), static_cast<int>(size()));
 }
 
+Frame::Imp::Imp(const ReadView data, std::shared_ptr<const void> pin) noexcept
+    : message_()
+{
+    OT_ASSERT(data.size() <= std::numeric_limits<int>::max());
+
+    if (false == bool(pin)) {
+        const auto init = ::zmq_msg_init_size(&message_, data.size());
+
+        OT_ASSERT(0 == init);
+
+        if (0u < data.size()) {
+            std::memcpy(::zmq_msg_data(&message_), data.data(), data.size());
+        }
+
+        return;
+    }
+
+    // NOTE zeromq calls release_pin exactly once, possibly from an io thread,
+    // after the last copy of the message has been sent or closed
+    auto* hint = new std::shared_ptr<const void>{std::move(pin)};
+    const auto init = ::zmq_msg_init_data(
+        &message_,
+        const_cast<char*>(data.data()),
+        data.size(),
+        &Imp::release_pin,
+        hint);
+
+    if (0 != init) { delete hint; }
+
+    OT_ASSERT(0 == init);
+}
+
 Frame::Imp::Imp(const Imp& rhs) noexcept
     : Imp(rhs.data(), rhs.size())
 {
 }
 
+auto Frame::Imp::operator new(std::size_t size) -> void*
+{
+    return FramePool::New(size);
+}
+
+auto Frame::Imp::operator delete(void* pointer) -> void
+{
+    FramePool::Delete(pointer);
+}
+
 auto Frame::Imp::operator<(const zeromq::Frame& rhs) const noexcept -> bool
 {
     const auto cmp =
@@ -111,6 +162,11 @@ auto Frame::Imp::operator==(const zeromq::Frame& rhs) const noexcept -> bool
            (0 == std::memcmp(data(), rhs.data(), std::min(size(), rhs.size())));
 }
 
+auto Frame::Imp::release_pin(void*, void* hint) noexcept -> void
+{
+    delete static_cast<std::shared_ptr<const void>*>(hint);
+}
+
 Frame::Imp::~Imp() { ::zmq_msg_close(&message_); }
 }  // namespace opentxs::network::zeromq
 
@@ -8,6 +8,7 @@
 #include <zmq.h>
 #include <cstddef>
 #include <iosfwd>
+#include <memory>
 
 #include "Proto.hpp"
 #include "internal/network/Factory.hpp"
@@ -21,6 +22,9 @@ namespace opentxs::network::zeromq
 class Frame::Imp final : public internal::Frame
 {
 public:
+    static auto operator new(std::size_t size) -> void*;
+    static auto operator delete(void* pointer) -> void;
+
     auto operator<(const zeromq::Frame& rhs) const noexcept -> bool;
     auto operator==(const zeromq::Frame& rhs) const noexcept -> bool;
 
@@ -47,11 +51,15 @@ public:
     Imp(std::size_t size) noexcept;
     Imp() noexcept;
     Imp(const ProtobufType& input) noexcept;
+    Imp(const ReadView data, std::shared_ptr<const void> pin) noexcept;
     Imp(const Imp&) noexcept;
     Imp(Imp&&) = delete;
     auto operator=(const Imp&) -> Imp& = delete;
     auto operator=(Imp&&) -> Imp& = delete;
 
     ~Imp() final;
+
+private:
+    static auto release_pin(void* data, void* hint) noexcept -> void;
 };
 }  // namespace opentxs::network::zeromq
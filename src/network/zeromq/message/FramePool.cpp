@@ -0,0 +1,217 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                          // IWYU pragma: associated
+#include "1_Internal.hpp"                        // IWYU pragma: associated
+#include "network/zeromq/message/FramePool.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <mutex>
+#include <new>
+
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::network::zeromq
+{
+namespace
+{
+thread_local FramePool* current_{nullptr};
+
+struct Pools {
+    std::mutex lock_{};
+    UnallocatedVector<FramePool*> all_{};
+    UnallocatedVector<FramePool*> retired_{};
+};
+
+// NOTE intentionally leaked since frames may be released during static
+// destruction
+auto pools() noexcept -> Pools&
+{
+    static auto* out = new Pools{};
+
+    return *out;
+}
+}  // namespace
+
+FramePool::Binding::Binding() noexcept
+    : pool_((nullptr == current_) ? acquire() : nullptr)
+{
+    if (nullptr != pool_) { current_ = pool_; }
+}
+
+FramePool::Binding::~Binding()
+{
+    if (nullptr != pool_) {
+        current_ = nullptr;
+        release(pool_);
+    }
+}
+
+FramePool::FramePool() noexcept
+    : free_()
+    , remote_()
+    , counters_()
+{
+    free_.fill(nullptr);
+
+    for (auto& stack : remote_) { stack.store(nullptr); }
+}
+
+auto FramePool::acquire() noexcept -> FramePool*
+{
+    auto& data = pools();
+    auto lock = std::lock_guard<std::mutex>{data.lock_};
+
+    if (data.retired_.empty()) {
+
+        return data.all_.emplace_back(new FramePool{});
+    }
+
+    auto* out = data.retired_.back();
+    data.retired_.pop_back();
+
+    return out;
+}
+
+auto FramePool::allocate(std::size_t size) noexcept -> Slot*
+{
+    const auto index = size_class(size);
+    auto& free = free_[index];
+
+    if (nullptr == free) {
+        free = remote_[index].exchange(nullptr, std::memory_order_acquire);
+    }
+
+    counters_.pooled_.fetch_add(1u, std::memory_order_relaxed);
+
+    if (nullptr == free) { return carve(index); }
+
+    counters_.recycled_.fetch_add(1u, std::memory_order_relaxed);
+    auto* out = free;
+    free = out->next_;
+
+    return out;
+}
+
+auto FramePool::carve(std::size_t index) noexcept -> Slot*
+{
+    const auto bytes = sizeof(Slot) + (min_class_size_ << index);
+    const auto count = std::max(slab_size_ / bytes, 1_uz);
+    auto* slab = static_cast<std::byte*>(::operator new(count * bytes));
+    counters_.reserved_.fetch_add(count * bytes, std::memory_order_relaxed);
+    auto* next = static_cast<Slot*>(nullptr);
+
+    for (auto n = count; n > 0_uz; --n) {
+        next = new (slab + ((n - 1_uz) * bytes)) Slot{next, this, index};
+    }
+
+    free_[index] = next->next_;
+
+    return next;
+}
+
+auto FramePool::Delete(void* pointer) noexcept -> void
+{
+    if (nullptr == pointer) { return; }
+
+    auto* slot = FramePool::slot(pointer);
+
+    if (unpooled_ == slot->class_) {
+        ::operator delete(slot);
+    } else {
+        slot->owner_->free(slot);
+    }
+}
+
+auto FramePool::free(Slot* slot) noexcept -> void
+{
+    const auto index = slot->class_;
+
+    if (this == current_) {
+        slot->next_ = free_[index];
+        free_[index] = slot;
+    } else {
+        counters_.remote_.fetch_add(1u, std::memory_order_relaxed);
+        auto& stack = remote_[index];
+        auto* head = stack.load(std::memory_order_relaxed);
+
+        do {
+            slot->next_ = head;
+        } while (false == stack.compare_exchange_weak(
+                              head,
+                              slot,
+                              std::memory_order_release,
+                              std::memory_order_relaxed));
+    }
+}
+
+auto FramePool::GetStats() noexcept -> Stats
+{
+    auto out = Stats{};
+    out.unpooled_ = unpooled().load();
+    auto& data = pools();
+    auto lock = std::lock_guard<std::mutex>{data.lock_};
+
+    for (const auto* pool : data.all_) {
+        const auto& counters = pool->counters_;
+        out.pooled_ += counters.pooled_.load();
+        out.recycled_ += counters.recycled_.load();
+        out.remote_ += counters.remote_.load();
+        out.reserved_ += counters.reserved_.load();
+    }
+
+    return out;
+}
+
+auto FramePool::New(std::size_t size) noexcept -> void*
+{
+    auto* pool = current_;
+
+    if ((nullptr == pool) || (max_size_ < size)) {
+        unpooled().fetch_add(1u, std::memory_order_relaxed);
+        auto* out = ::operator new(sizeof(Slot) + size);
+
+        return payload(new (out) Slot{nullptr, nullptr, unpooled_});
+    }
+
+    return payload(pool->allocate(size));
+}
+
+auto FramePool::payload(Slot* slot) noexcept -> void*
+{
+    return reinterpret_cast<std::byte*>(slot) + sizeof(Slot);
+}
+
+auto FramePool::release(FramePool* pool) noexcept -> void
+{
+    auto& data = pools();
+    auto lock = std::lock_guard<std::mutex>{data.lock_};
+    data.retired_.emplace_back(pool);
+}
+
+auto FramePool::size_class(std::size_t size) noexcept -> std::size_t
+{
+    auto out = 0_uz;
+
+    for (auto capacity = min_class_size_; capacity < size; capacity <<= 1u) {
+        ++out;
+    }
+
+    return out;
+}
+
+auto FramePool::slot(void* pointer) noexcept -> Slot*
+{
+    return reinterpret_cast<Slot*>(
+        static_cast<std::byte*>(pointer) - sizeof(Slot));
+}
+
+auto FramePool::unpooled() noexcept -> std::atomic<std::uint64_t>&
+{
+    static auto out = std::atomic<std::uint64_t>{};
+
+    return out;
+}
+}  // namespace opentxs::network::zeromq
@@ -0,0 +1,120 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "internal/util/P0330.hpp"
+
+namespace opentxs::network::zeromq
+{
+/// Slab allocator for message frame objects
+///
+/// Each zeromq context thread binds a pool while it runs, so the frames of the
+/// messages created by the actors of a batch are allocated from the pool of
+/// the thread which executes that batch. Frames usually are destroyed by a
+/// different thread than the one which created them, since messages are
+/// passed between actors.
+/// Memory released by other threads is pushed onto a lock free stack and
+/// reclaimed by the owning thread the next time its local free list for that
+/// size class is empty.
+///
+/// Frame payloads are not pooled. zmq_msg_init_size places the payload and
+/// its reference count in a single allocation, while attaching external
+/// storage with zmq_msg_init_data still allocates the reference count, so
+/// pooling the payload would not save an allocation.
+///
+/// Threads which have not bound a pool, and requests larger than the biggest
+/// size class, fall back to the global allocator. Pools are never destroyed;
+/// when a thread exits its pool is handed to the next thread which binds one.
+class FramePool
+{
+public:
+    /// Allocation counters summed over all pools
+    struct Stats {
+        /// allocations served by a pool
+        std::uint64_t pooled_{};
+        /// pooled allocations which reused released memory
+        std::uint64_t recycled_{};
+        /// pooled allocations released by a thread other than the owner
+        std::uint64_t remote_{};
+        /// allocations which fell back to the global allocator
+        std::uint64_t unpooled_{};
+        /// bytes reserved for slabs
+        std::uint64_t reserved_{};
+    };
+
+    /// Binds a pool to the calling thread for the lifetime of the object
+    class Binding
+    {
+    public:
+        Binding() noexcept;
+        Binding(const Binding&) = delete;
+        Binding(Binding&&) = delete;
+        auto operator=(const Binding&) -> Binding& = delete;
+        auto operator=(Binding&&) -> Binding& = delete;
+
+        ~Binding();
+
+    private:
+        FramePool* pool_;
+    };
+
+    static constexpr auto max_size_ = 4096_uz;
+
+    /// Allocate memory which must be released with Delete
+    static auto New(std::size_t size) noexcept -> void*;
+    /// Release memory obtained from New
+    static auto Delete(void* pointer) noexcept -> void;
+    static auto GetStats() noexcept -> Stats;
+
+    FramePool(const FramePool&) = delete;
+    FramePool(FramePool&&) = delete;
+    auto operator=(const FramePool&) -> FramePool& = delete;
+    auto operator=(FramePool&&) -> FramePool& = delete;
+
+private:
+    struct alignas(std::max_align_t) Slot {
+        Slot* next_;
+        FramePool* owner_;
+        std::size_t class_;
+    };
+
+    struct Counters {
+        std::atomic<std::uint64_t> pooled_{};
+        std::atomic<std::uint64_t> recycled_{};
+        std::atomic<std::uint64_t> remote_{};
+        std::atomic<std::uint64_t> reserved_{};
+    };
+
+    static constexpr auto min_class_size_ = 64_uz;
+    static constexpr auto classes_ = 7_uz;
+    static constexpr auto slab_size_ = 65536_uz;
+    static constexpr auto unpooled_ = classes_;
+
+    std::array<Slot*, classes_> free_;
+    std::array<std::atomic<Slot*>, classes_> remote_;
+    Counters counters_;
+
+    static auto acquire() noexcept -> FramePool*;
+    static auto payload(Slot* slot) noexcept -> void*;
+    static auto release(FramePool* pool) noexcept -> void;
+    static auto size_class(std::size_t size) noexcept -> std::size_t;
+    static auto slot(void* pointer) noexcept -> Slot*;
+    static auto unpooled() noexcept -> std::atomic<std::uint64_t>&;
+
+    auto allocate(std::size_t size) noexcept -> Slot*;
+    auto carve(std::size_t index) noexcept -> Slot*;
+    auto free(Slot* slot) noexcept -> void;
+
+    FramePool() noexcept;
+
+    ~FramePool() = default;
+};
+}  // namespace opentxs::network::zeromq
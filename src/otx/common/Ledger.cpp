@@ -10,7 +10,9 @@
 #include <irrxml/irrXML.hpp>
 #include <cstdint>
 #include <cstdlib>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <type_traits>
 #include <utility>
 
@@ -83,6 +85,12 @@ Ledger::Ledger(
     , m_Type(ledgerType::message)
     , m_bLoadedLegacyData(false)
     , m_mapTransactions()
+    , by_reference_()
+    , by_type_()
+    , unresolved_()
+    , resolved_()
+    , transfers_()
+    , cheques_()
 {
     InitLedger();
 }
@@ -100,6 +108,12 @@ Ledger::Ledger(
     , m_Type(ledgerType::message)
     , m_bLoadedLegacyData(false)
     , m_mapTransactions()
+    , by_reference_()
+    , by_type_()
+    , unresolved_()
+    , resolved_()
+    , transfers_()
+    , cheques_()
 {
     InitLedger();
     SetRealAccountID(theAccountID);
@@ -112,6 +126,12 @@ Ledger::Ledger(const api::Session& api)
     , m_Type(ledgerType::message)
     , m_bLoadedLegacyData(false)
     , m_mapTransactions()
+    , by_reference_()
+    , by_type_()
+    , unresolved_()
+    , resolved_()
+    , transfers_()
+    , cheques_()
 {
     InitLedger();
 }
@@ -1058,7 +1078,9 @@ auto Ledger::GetTransactionMap() const -> const mapOfTransactions&
 ///
 auto Ledger::RemoveTransaction(const TransactionNumber number) -> bool
 {
-    if (0 == m_mapTransactions.erase(number)) {
+    auto it = m_mapTransactions.find(number);
+
+    if (m_mapTransactions.end() == it) {
         LogError()(OT_PRETTY_CLASS())(
             "Attempt to remove Transaction from ledger, when "
             "not already there: ")(number)(".")
@@ -1067,6 +1089,11 @@ auto Ledger::RemoveTransaction(const TransactionNumber number) -> bool
         return false;
     }
 
+    OT_ASSERT(it->second);
+
+    unindex(*it->second);
+    m_mapTransactions.erase(it);
+
     return true;
 }
 
@@ -1085,6 +1112,8 @@ auto Ledger::AddTransaction(std::shared_ptr<OTTransaction> theTransaction)
         return false;
     }
 
+    index(*theTransaction);
+
     return true;
 }
 
@@ -1092,13 +1121,10 @@ auto Ledger::AddTransaction(std::shared_ptr<OTTransaction> theTransaction)
 auto Ledger::GetTransaction(transactionType theType)
     -> std::shared_ptr<OTTransaction>
 {
-    // loop through the items that make up this transaction
+    if (auto it = by_type_.find(theType); by_type_.end() != it) {
+        OT_ASSERT(false == it->second.empty());
 
-    for (auto& it : m_mapTransactions) {
-        auto pTransaction = it.second;
-        OT_ASSERT(pTransaction);
-
-        if (theType == pTransaction->GetType()) { return pTransaction; }
+        return GetTransaction(*it->second.begin());
     }
 
     return nullptr;
@@ -1107,21 +1133,12 @@ auto Ledger::GetTransaction(transactionType theType)
 // if not found, returns -1
 auto Ledger::GetTransactionIndex(const TransactionNumber target) -> std::int32_t
 {
-    // loop through the transactions inside this ledger
-    // If a specific transaction is found, returns its index inside the ledger
-    //
-    std::int32_t output{0};
+    const auto it = m_mapTransactions.find(target);
 
-    for (const auto& [number, pTransaction] : m_mapTransactions) {
-        if (target == number) {
-
-            return output;
-        } else {
-            ++output;
-        }
-    }
+    if (m_mapTransactions.end() == it) { return -1; }
 
-    return -1;
+    return static_cast<std::int32_t>(
+        std::distance(m_mapTransactions.begin(), it));
 }
 
 // Look up a transaction by transaction number and see if it is in the ledger.
@@ -1149,16 +1166,13 @@ auto Ledger::GetTransaction(const TransactionNumber number) const
 auto Ledger::GetTransactionCountInRefTo(std::int64_t lReferenceNum) const
     -> std::int32_t
 {
-    std::int32_t nCount{0};
+    if (auto it = by_reference_.find(lReferenceNum);
+        by_reference_.end() != it) {
 
-    for (const auto& it : m_mapTransactions) {
-        const auto pTransaction = it.second;
-        OT_ASSERT(pTransaction);
-
-        if (pTransaction->GetReferenceToNum() == lReferenceNum) { nCount++; }
+        return static_cast<std::int32_t>(it->second.size());
     }
 
-    return nCount;
+    return 0;
 }
 
 // Look up a transaction by transaction number and see if it is in the ledger.
@@ -1191,15 +1205,13 @@ auto Ledger::GetTransactionByIndex(std::int32_t nIndex) const
 auto Ledger::GetReplyNotice(const std::int64_t& lRequestNum)
     -> std::shared_ptr<OTTransaction>
 {
-    // loop through the transactions that make up this ledger.
-    for (auto& it : m_mapTransactions) {
-        auto pTransaction = it.second;
-        OT_ASSERT(pTransaction);
+    const auto notices = by_type_.find(transactionType::replyNotice);
 
-        if (transactionType::replyNotice !=
-            pTransaction->GetType()) {  // <=======
-            continue;
-        }
+    if (by_type_.end() == notices) { return nullptr; }
+
+    for (const auto number : notices->second) {
+        auto pTransaction = GetTransaction(number);
+        OT_ASSERT(pTransaction);
 
         if (pTransaction->GetRequestNum() == lRequestNum) {
             return pTransaction;
@@ -1212,62 +1224,67 @@ auto Ledger::GetReplyNotice(const std::int64_t& lRequestNum)
 auto Ledger::GetTransferReceipt(std::int64_t lNumberOfOrigin)
     -> std::shared_ptr<OTTransaction>
 {
-    // loop through the transactions that make up this ledger.
-    for (auto& it : m_mapTransactions) {
-        auto pTransaction = it.second;
-        OT_ASSERT(pTransaction);
+    if (auto it = transfers_.find(lNumberOfOrigin); transfers_.end() != it) {
 
-        if (transactionType::transferReceipt == pTransaction->GetType()) {
-            auto strReference = String::Factory();
-            pTransaction->GetReferenceString(strReference);
+        return GetTransaction(*it->second.begin());
+    }
 
-            auto pOriginalItem{api_.Factory().InternalSession().Item(
-                strReference,
-                pTransaction->GetPurportedNotaryID(),
-                pTransaction->GetReferenceToNum())};
-            OT_ASSERT(pOriginalItem);
+    // Note: the acceptPending USED to be "in reference to" whatever the
+    // pending was in reference to. (i.e. the original transfer.) But since the
+    // KacTech bug fix (for accepting multiple transfer receipts) the
+    // acceptPending is now "in reference to" the pending itself, instead of
+    // the original transfer.
+    //
+    // Therefore it is necessary to compare the NumberOfOrigin of the
+    // acceptPending item to find the match, which means instantiating the item
+    // from each receipt. That is only done the first time each receipt is
+    // examined.
+    //
+    // NOTE resolve() removes the current element from unresolved_
+    for (auto it = unresolved_.begin(); unresolved_.end() != it;) {
+        const auto number = *(it++);
+        auto pTransaction = GetTransaction(number);
+        OT_ASSERT(pTransaction);
 
-            if (pOriginalItem->GetType() != itemType::acceptPending) {
-                LogError()(OT_PRETTY_CLASS())(
-                    "Wrong item type attached to transferReceipt!")
-                    .Flush();
-                return nullptr;
-            } else {
-                // Note: the acceptPending USED to be "in reference to" whatever
-                // the pending
-                // was in reference to. (i.e. the original transfer.) But since
-                // the KacTech
-                // bug fix (for accepting multiple transfer receipts) the
-                // acceptPending is now
-                // "in reference to" the pending itself, instead of the original
-                // transfer.
-                //
-                // It used to be that a caller of GetTransferReceipt would pass
-                // in the InRefTo
-                // expected from the pending in the outbox, and match it to the
-                // InRefTo found
-                // on the acceptPending (inside the transferReceipt) in the
-                // inbox.
-                // But this is no longer possible, since the acceptPending is no
-                // longer InRefTo
-                // whatever the pending is InRefTo.
-                //
-                // Therefore, in this place, it is now necessary to pass in the
-                // NumberOfOrigin,
-                // and compare it to the NumberOfOrigin, to find the match.
-                //
-                if (pOriginalItem->GetNumberOfOrigin() == lNumberOfOrigin) {
-                    //              if (pOriginalItem->GetReferenceToNum() ==
-                    // lTransactionNum)
-                    return pTransaction;  // FOUND IT!
-                }
-            }
+        if (transactionType::transferReceipt != pTransaction->GetType()) {
+            continue;
         }
+
+        const auto origin = transfer_origin(*pTransaction);
+
+        if (false == origin.has_value()) { return nullptr; }
+
+        resolve(number, *pTransaction, origin.value());
+
+        if (origin.value() == lNumberOfOrigin) { return pTransaction; }
     }
 
     return nullptr;
 }
 
+auto Ledger::transfer_origin(const OTTransaction& receipt) const
+    -> std::optional<std::int64_t>
+{
+    auto strReference = String::Factory();
+    receipt.GetReferenceString(strReference);
+    auto pOriginalItem{api_.Factory().InternalSession().Item(
+        strReference,
+        receipt.GetPurportedNotaryID(),
+        receipt.GetReferenceToNum())};
+
+    OT_ASSERT(pOriginalItem);
+
+    if (pOriginalItem->GetType() != itemType::acceptPending) {
+        LogError()(OT_PRETTY_CLASS())(
+            "Wrong item type attached to transferReceipt!")
+            .Flush();
+
+        return std::nullopt;
+    }
+
+    return pOriginalItem->GetNumberOfOrigin();
+}
+
 // This method loops through all the receipts in the ledger (inbox usually),
 // to see if there's a chequeReceipt for a given cheque. For each cheque
 // receipt,
@@ -1289,8 +1306,15 @@ auto Ledger::GetTransferReceipt(std::int64_t lNumberOfOrigin)
 auto Ledger::GetChequeReceipt(std::int64_t lChequeNum)
     -> std::shared_ptr<OTTransaction>
 {
-    for (auto& it : m_mapTransactions) {
-        auto pCurrentReceipt = it.second;
+    if (auto it = cheques_.find(lChequeNum); cheques_.end() != it) {
+
+        return GetTransaction(*it->second.begin());
+    }
+
+    // NOTE resolve() removes the current element from unresolved_
+    for (auto it = unresolved_.begin(); unresolved_.end() != it;) {
+        const auto number = *(it++);
+        auto pCurrentReceipt = GetTransaction(number);
         OT_ASSERT(nullptr != pCurrentReceipt);
 
         if ((pCurrentReceipt->GetType() != transactionType::chequeReceipt) &&
@@ -1298,69 +1322,74 @@ auto Ledger::GetChequeReceipt(std::int64_t lChequeNum)
             continue;
         }
 
-        auto strDepositChequeMsg = String::Factory();
-        pCurrentReceipt->GetReferenceString(strDepositChequeMsg);
+        const auto cheque = cheque_number(*pCurrentReceipt);
 
-        auto pOriginalItem{api_.Factory().InternalSession().Item(
-            strDepositChequeMsg,
-            GetPurportedNotaryID(),
-            pCurrentReceipt->GetReferenceToNum())};
+        if (false == cheque.has_value()) { continue; }
 
-        if (false == bool(pOriginalItem)) {
-            LogError()(OT_PRETTY_CLASS())(
-                "Expected original depositCheque request item to be "
-                "inside the chequeReceipt "
-                "(but failed to load it...).")
-                .Flush();
-        } else if (itemType::depositCheque != pOriginalItem->GetType()) {
-            auto strItemType = String::Factory();
-            pOriginalItem->GetTypeString(strItemType);
-            LogError()(OT_PRETTY_CLASS())(
-                "Expected original depositCheque request item to be "
-                "inside the chequeReceipt, "
-                "but somehow what we found instead was a ")(strItemType)("...")
-                .Flush();
-        } else {
-            // Get the cheque from the Item and load it up into a Cheque object.
-            //
-            auto strCheque = String::Factory();
-            pOriginalItem->GetAttachment(strCheque);
+        resolve(number, *pCurrentReceipt, cheque.value());
 
-            auto pCheque{api_.Factory().InternalSession().Cheque()};
-            OT_ASSERT(pCheque);
+        if (cheque.value() == lChequeNum) { return pCurrentReceipt; }
+    }
 
-            if (!((strCheque->GetLength() > 2) &&
-                  pCheque->LoadContractFromString(strCheque))) {
-                LogError()(OT_PRETTY_CLASS())(
-                    "Error loading cheque from string: ")(strCheque)(".")
-                    .Flush();
-            }
-            // NOTE: Technically we don'T NEED to load up the cheque anymore,
-            // since
-            // we could just check the NumberOfOrigin, which should already
-            // match the
-            // transaction number on the cheque.
-            // However, even that would have to load up the cheque once, if it
-            // wasn't
-            // already set, and this function already must RETURN a copy of the
-            // cheque
-            // (at least optionally), so we might as well just load it up,
-            // verify it,
-            // and return it. (That's why we are still loading the cheque here
-            // instead
-            // of checking the number of origin.)
-            else {
-                // Success loading the cheque.
-                // Let's see if it's the right cheque...
-                if (pCheque->GetTransactionNum() == lChequeNum) {
+    return nullptr;
+}
 
-                    return pCurrentReceipt;
-                }
-            }
-        }
+auto Ledger::cheque_number(const OTTransaction& receipt) const
+    -> std::optional<std::int64_t>
+{
+    auto strDepositChequeMsg = String::Factory();
+    receipt.GetReferenceString(strDepositChequeMsg);
+
+    auto pOriginalItem{api_.Factory().InternalSession().Item(
+        strDepositChequeMsg,
+        GetPurportedNotaryID(),
+        receipt.GetReferenceToNum())};
+
+    if (false == bool(pOriginalItem)) {
+        LogError()(OT_PRETTY_CLASS())(
+            "Expected original depositCheque request item to be "
+            "inside the chequeReceipt "
+            "(but failed to load it...).")
+            .Flush();
+
+        return std::nullopt;
     }
 
-    return nullptr;
+    if (itemType::depositCheque != pOriginalItem->GetType()) {
+        auto strItemType = String::Factory();
+        pOriginalItem->GetTypeString(strItemType);
+        LogError()(OT_PRETTY_CLASS())(
+            "Expected original depositCheque request item to be "
+            "inside the chequeReceipt, "
+            "but somehow what we found instead was a ")(strItemType)("...")
+            .Flush();
+
+        return std::nullopt;
+    }
+
+    // Get the cheque from the Item and load it up into a Cheque object.
+    //
+    // NOTE: Technically we don't NEED to load up the cheque, since we could
+    // just check the NumberOfOrigin, which should already match the
+    // transaction number on the cheque. However, even that would have to load
+    // up the cheque once if it wasn't already set, and the result is cached
+    // by the caller anyway.
+    auto strCheque = String::Factory();
+    pOriginalItem->GetAttachment(strCheque);
+    auto pCheque{api_.Factory().InternalSession().Cheque()};
+
+    OT_ASSERT(pCheque);
+
+    if (!((strCheque->GetLength() > 2) &&
+          pCheque->LoadContractFromString(strCheque))) {
+        LogError()(OT_PRETTY_CLASS())("Error loading cheque from string: ")(
+            strCheque)(".")
+            .Flush();
+
+        return std::nullopt;
+    }
+
+    return pCheque->GetTransactionNum();
 }
 
 // Find the finalReceipt in this Inbox, that has lTransactionNum as its "in
@@ -1380,17 +1409,15 @@ auto Ledger::GetChequeReceipt(std::int64_t lChequeNum)
 auto Ledger::GetFinalReceipt(std::int64_t lReferenceNum)
     -> std::shared_ptr<OTTransaction>
 {
-    // loop through the transactions that make up this ledger.
-    for (auto& it : m_mapTransactions) {
-        auto pTransaction = it.second;
-        OT_ASSERT(pTransaction);
+    const auto references = by_reference_.find(lReferenceNum);
 
-        if (transactionType::finalReceipt !=
-            pTransaction->GetType()) {  // <=======
-            continue;
-        }
+    if (by_reference_.end() == references) { return nullptr; }
+
+    for (const auto number : references->second) {
+        auto pTransaction = GetTransaction(number);
+        OT_ASSERT(pTransaction);
 
-        if (pTransaction->GetReferenceToNum() == lReferenceNum) {
+        if (transactionType::finalReceipt == pTransaction->GetType()) {
             return pTransaction;
         }
     }
@@ -1398,6 +1425,73 @@ auto Ledger::GetFinalReceipt(std::int64_t lReferenceNum)
     return nullptr;
 }
 
+auto Ledger::index(const OTTransaction& transaction) -> void
+{
+    const auto number = transaction.GetTransactionNum();
+    by_reference_[transaction.GetReferenceToNum()].emplace(number);
+    by_type_[transaction.GetType()].emplace(number);
+
+    switch (transaction.GetType()) {
+        case transactionType::transferReceipt:
+        case transactionType::chequeReceipt:
+        case transactionType::voucherReceipt: {
+            unresolved_.emplace(number);
+        } break;
+        default: {
+        }
+    }
+}
+
+auto Ledger::insert(std::shared_ptr<OTTransaction> transaction) -> void
+{
+    auto& existing = m_mapTransactions[transaction->GetTransactionNum()];
+
+    if (existing) { unindex(*existing); }
+
+    existing = transaction;
+    index(*transaction);
+}
+
+auto Ledger::resolve(
+    const TransactionNumber number,
+    const OTTransaction& receipt,
+    std::int64_t key) -> void
+{
+    unresolved_.erase(number);
+    resolved_[number] = key;
+
+    if (transactionType::transferReceipt == receipt.GetType()) {
+        transfers_[key].emplace(number);
+    } else {
+        cheques_[key].emplace(number);
+    }
+}
+
+auto Ledger::unindex(const OTTransaction& transaction) -> void
+{
+    const auto number = transaction.GetTransactionNum();
+    const auto erase = [&](auto& map, const auto& key) {
+        if (auto it = map.find(key); map.end() != it) {
+            it->second.erase(number);
+
+            if (it->second.empty()) { map.erase(it); }
+        }
+    };
+    erase(by_reference_, transaction.GetReferenceToNum());
+    erase(by_type_, transaction.GetType());
+    unresolved_.erase(number);
+
+    if (auto it = resolved_.find(number); resolved_.end() != it) {
+        if (transactionType::transferReceipt == transaction.GetType()) {
+            erase(transfers_, it->second);
+        } else {
+            erase(cheques_, it->second);
+        }
+
+        resolved_.erase(it);
+    }
+}
+
 /// Only if it is an inbox, a ledger will loop through the transactions
 /// and produce the XML output for the report that's necessary during
 /// a balance agreement. (Any balance agreement for an account must
@@ -2123,8 +2217,7 @@ auto Ledger::ProcessXMLNode(irr::io::IrrXMLReader*& xml) -> std::int32_t
                         //
                         std::shared_ptr<OTTransaction> transaction{
                             pTransaction.release()};
-                        m_mapTransactions[transaction->GetTransactionNum()] =
-                            transaction;
+                        insert(transaction);
                         transaction->SetParent(*this);
                     } else {
                         LogError()(OT_PRETTY_CLASS())(
@@ -2288,8 +2381,7 @@ auto Ledger::ProcessXMLNode(irr::io::IrrXMLReader*& xml) -> std::int32_t
                 // It's not already there on this ledger -- so add it!
                 std::shared_ptr<OTTransaction> transaction{
                     pTransaction.release()};
-                m_mapTransactions[transaction->GetTransactionNum()] =
-                    transaction;
+                insert(transaction);
                 transaction->SetParent(*this);
 
                 switch (GetType()) {
@@ -2390,6 +2482,12 @@ void Ledger::ReleaseTransactions()
     // If there were any dynamically allocated objects, clean them up here.
 
     m_mapTransactions.clear();
+    by_reference_.clear();
+    by_type_.clear();
+    unresolved_.clear();
+    resolved_.clear();
+    transfers_.clear();
+    cheques_.clear();
 }
 
 void Ledger::Release_Ledger() { ReleaseTransactions(); }
@@ -0,0 +1,94 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "internal/otx/common/cron/CronSchedule.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <utility>
+
+namespace opentxs
+{
+CronSchedule::CronSchedule() noexcept
+    : deadlines_()
+    , index_()
+    , sequence_(0)
+    , next_(Time::max())
+    , wakeup_()
+{
+}
+
+auto CronSchedule::Add(const std::int64_t number, const Time added) noexcept
+    -> void
+{
+    const auto previous = next_.load();
+    Schedule(Item{added, sequence_++, number}, Time{});
+
+    if ((next_.load() < previous) && wakeup_) { wakeup_(); }
+}
+
+auto CronSchedule::Due(const Time now) noexcept -> UnallocatedVector<Item>
+{
+    auto out = UnallocatedVector<Item>{};
+
+    for (auto it = deadlines_.begin();
+         (deadlines_.end() != it) && (it->first <= now);) {
+        out.emplace_back(it->second);
+        index_.erase(it->second.number_);
+        it = deadlines_.erase(it);
+    }
+
+    std::sort(out.begin(), out.end(), [](const auto& lhs, const auto& rhs) {
+        return std::make_pair(lhs.added_, lhs.sequence_) <
+               std::make_pair(rhs.added_, rhs.sequence_);
+    });
+    update();
+
+    return out;
+}
+
+auto CronSchedule::IsScheduled(const std::int64_t number) const noexcept
+    -> bool
+{
+    return 0 < index_.count(number);
+}
+
+auto CronSchedule::Next() const noexcept -> Time { return next_.load(); }
+
+auto CronSchedule::Remove(const std::int64_t number) noexcept -> void
+{
+    unschedule(number);
+    update();
+}
+
+auto CronSchedule::Schedule(const Item& item, const Time deadline) noexcept
+    -> void
+{
+    unschedule(item.number_);
+    index_.emplace(item.number_, deadlines_.emplace(deadline, item));
+    update();
+}
+
+auto CronSchedule::SetWakeup(std::function<void()> callback) noexcept -> void
+{
+    wakeup_ = std::move(callback);
+}
+
+auto CronSchedule::unschedule(const std::int64_t number) noexcept -> void
+{
+    auto it = index_.find(number);
+
+    if (index_.end() == it) { return; }
+
+    deadlines_.erase(it->second);
+    index_.erase(it);
+}
+
+auto CronSchedule::update() noexcept -> void
+{
+    next_.store(deadlines_.empty() ? Time::max() : deadlines_.begin()->first);
+}
+}  // namespace opentxs
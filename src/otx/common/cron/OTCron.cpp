@@ -7,6 +7,8 @@
 #include "1_Internal.hpp"                       // IWYU pragma: associated
 #include "internal/otx/common/cron/OTCron.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -53,6 +55,10 @@ std::chrono::milliseconds OTCron::_cron_ms_between_process{10000};
 // time.
 std::int32_t OTCron::_cron_max_items_per_nym{10};
 
+// Whether market offers are matched every time they are processed, or only
+// when the market has changed since they were last matched.
+bool OTCron::_event_driven_matching{false};
+
 Time OTCron::last_executed_{};
 
 OTCron::OTCron(const api::Session& server)
@@ -60,6 +66,7 @@ OTCron::OTCron(const api::Session& server)
     , m_mapMarkets()
     , m_mapCronItems()
     , m_multimapCronItems()
+    , m_Schedule()
     , m_NOTARY_ID(api_.Factory().ServerID())
     , m_listTransactionNumbers()
     , m_bIsActivated(false)
@@ -267,8 +274,8 @@ auto OTCron::GetMarketList(Armored& ascOutput, std::int32_t& nMarketCount)
 
         pMarketData->last_sale_date = pMarket->GetLastSaleDate();
 
-        const mapOfOffers::size_type theBidCount = pMarket->GetBidCount();
-        const mapOfOffers::size_type theAskCount = pMarket->GetAskCount();
+        const std::size_t theBidCount = pMarket->GetBidCount();
+        const std::size_t theAskCount = pMarket->GetAskCount();
 
         pMarketData->number_bids = std::to_string(theBidCount);
         pMarketData->number_asks = std::to_string(theAskCount);
@@ -608,11 +615,22 @@ void OTCron::UpdateContents(const PasswordPrompt& reason)
     m_xmlUnsigned->Concatenate(String::Factory(str_result));
 }
 
-auto OTCron::computeTimeout() -> std::chrono::milliseconds
+auto OTCron::computeTimeout() const -> std::chrono::milliseconds
 {
-    return GetCronMsBetweenProcess() -
-           std::chrono::duration_cast<std::chrono::milliseconds>(
-               Clock::now() - last_executed_);
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+    const auto now = Clock::now();
+    const auto beat = GetCronMsBetweenProcess() -
+                      duration_cast<milliseconds>(now - last_executed_);
+    const auto deadline = m_Schedule.Next();
+
+    // NOTE with nothing scheduled there is nothing to do until an item is
+    // added
+    if (Time::max() == deadline) { return milliseconds::max(); }
+
+    if (deadline <= now) { return beat; }
+
+    return std::max(beat, duration_cast<milliseconds>(deadline - now));
 }
 
 // Make sure to call this regularly so the CronItems get a chance to process and
@@ -645,12 +663,22 @@ void OTCron::ProcessCronItems()
         return;
     }
     bool bNeedToSave = false;
-
-    // loop through the cron items and tell each one to ProcessCron().
+    const auto now = last_executed_;
+
+    // Items which were added to cron earlier are processed first, just as if
+    // every item was processed.
+    const auto due = m_Schedule.Due(now);
+    // NOTE processing an item may remove other items from cron, and those
+    // items may even be added again with a new deadline
+    const auto current = [this](const auto& item) {
+        return (m_mapCronItems.end() != FindItemOnMap(item.number_)) &&
+               (false == m_Schedule.IsScheduled(item.number_));
+    };
+
+    // loop through the due cron items and tell each one to ProcessCron().
     // If the item returns true, that means leave it on the list. Otherwise,
     // if it returns false, that means "it's done: remove it."
-    for (auto it = m_multimapCronItems.begin();
-         it != m_multimapCronItems.end();) {
+    for (auto next = due.begin(); next != due.end(); ++next) {
         if (GetTransactionCount() <= nTwentyPercent) {
             LogError()(OT_PRETTY_CLASS())(
                 "WARNING: Cron has fewer than 20 percent of its normal "
@@ -665,16 +693,26 @@ void OTCron::ProcessCronItems()
                 "SKIPPING THE REMAINDER OF THE CRON ITEMS THAT WERE "
                 "SCHEDULED FOR THIS ROUND!!!")
                 .Flush();
+
+            // NOTE the skipped items remain due for the next round
+            for (; next != due.end(); ++next) {
+                if (current(*next)) { m_Schedule.Schedule(*next, Time{}); }
+            }
+
             break;
         }
-        auto pItem = it->second;
+
+        if (false == current(*next)) { continue; }
+
+        auto it_map = FindItemOnMap(next->number_);
+        auto pItem = it_map->second;
         OT_ASSERT(false != bool(pItem));
         LogVerbose()(OT_PRETTY_CLASS())("Processing item number: ")(
             pItem->GetTransactionNum())
             .Flush();
 
         if (pItem->ProcessCron(reason)) {
-            it++;
+            m_Schedule.Schedule(*next, pItem->GetCronDeadline());
             continue;
         }
         pItem->HookRemovalFromCron(
@@ -682,13 +720,14 @@ void OTCron::ProcessCronItems()
         LogConsole()(OT_PRETTY_CLASS())("Removing cron item: ")(
             pItem->GetTransactionNum())(".")
             .Flush();
-        it = m_multimapCronItems.erase(it);
-        auto it_map = FindItemOnMap(pItem->GetTransactionNum());
-        OT_ASSERT(m_mapCronItems.end() != it_map);
+        auto it_multimap = FindItemOnMultimap(next->number_);
+        OT_ASSERT(m_multimapCronItems.end() != it_multimap);
+        m_multimapCronItems.erase(it_multimap);
         m_mapCronItems.erase(it_map);
 
         bNeedToSave = true;
     }
+
     if (bNeedToSave) { SaveCron(); }
 }
 
@@ -749,6 +788,9 @@ auto OTCron::AddCronItem(
             m_multimapCronItems.upper_bound(tDateAdded),
             std::pair<Time, std::shared_ptr<OTCronItem>>(tDateAdded, theItem));
 
+        // New items are due in the next round.
+        m_Schedule.Add(theItem->GetTransactionNum(), tDateAdded);
+
         theItem->SetCronPointer(*this);
         theItem->setServerNym(m_pServerNym);
         theItem->setNotaryID(m_NOTARY_ID);
@@ -847,6 +889,7 @@ auto OTCron::RemoveCronItem(
 
         m_mapCronItems.erase(it_map);            // Remove from MAP.
         m_multimapCronItems.erase(it_multimap);  // Remove from MULTIMAP.
+        m_Schedule.Remove(lTransactionNum);
 
         // An item has been removed from Cron. SAVE.
         return SaveCron();
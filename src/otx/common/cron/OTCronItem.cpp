@@ -752,6 +752,18 @@ auto OTCronItem::ProcessCron(const PasswordPrompt& reason) -> bool
     return true;
 }
 
+// Items which throttle their own processing record the last time they were
+// processed, and do nothing until the process interval has elapsed since then.
+// Calling ProcessCron any sooner than this is a waste of time.
+auto OTCronItem::GetCronDeadline() const -> Time
+{
+    const auto lastProcessed = GetLastProcessDate();
+
+    if (Time{} == lastProcessed) { return Time{}; }
+
+    return lastProcessed + GetProcessInterval();
+}
+
 // OTCron calls this when a cron item is added.
 // bForTheFirstTime=true means that this cron item is being
 // activated for the very first time. (Versus being re-added
@@ -10,7 +10,6 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
-#include <iterator>
 #include <memory>
 #include <utility>
 
@@ -58,9 +57,7 @@ OTMarket::OTMarket(const api::Session& api, const char* szFilename)
     : Contract(api)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
-    , m_mapBids()
-    , m_mapAsks()
-    , m_mapOffers()
+    , book_()
     , m_NOTARY_ID(identifier::Notary::Factory())
     , m_INSTRUMENT_DEFINITION_ID(identifier::UnitDefinition::Factory())
     , m_CURRENCY_TYPE_ID(identifier::UnitDefinition::Factory())
@@ -79,9 +76,7 @@ OTMarket::OTMarket(const api::Session& api)
     : Contract(api)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
-    , m_mapBids()
-    , m_mapAsks()
-    , m_mapOffers()
+    , book_()
     , m_NOTARY_ID(identifier::Notary::Factory())
     , m_INSTRUMENT_DEFINITION_ID(identifier::UnitDefinition::Factory())
     , m_CURRENCY_TYPE_ID(identifier::UnitDefinition::Factory())
@@ -101,9 +96,7 @@ OTMarket::OTMarket(
     : Contract(api)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
-    , m_mapBids()
-    , m_mapAsks()
-    , m_mapOffers()
+    , book_()
     , m_NOTARY_ID(NOTARY_ID)
     , m_INSTRUMENT_DEFINITION_ID(INSTRUMENT_DEFINITION_ID)
     , m_CURRENCY_TYPE_ID(CURRENCY_TYPE_ID)
@@ -238,8 +231,7 @@ void OTMarket::UpdateContents(const PasswordPrompt& reason)
     }());
 
     // Save the offers for sale.
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
+    for (auto* pOffer : book_.Asks()) {
         OT_ASSERT(nullptr != pOffer);
 
         auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
@@ -254,8 +246,7 @@ void OTMarket::UpdateContents(const PasswordPrompt& reason)
     }
 
     // Save the bids.
-    for (auto& it : m_mapBids) {
-        OTOffer* pOffer = it.second;
+    for (auto* pOffer : book_.Bids()) {
         OT_ASSERT(nullptr != pOffer);
 
         auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
@@ -279,8 +270,7 @@ auto OTMarket::GetTotalAvailableAssets() -> Amount
 {
     Amount lTotal = 0;
 
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
+    for (auto* pOffer : book_.Asks()) {
         OT_ASSERT(nullptr != pOffer);
 
         lTotal += pOffer->GetAmountAvailable();
@@ -302,8 +292,8 @@ auto OTMarket::GetNym_OfferList(
     // Loop through the offers, up to some maximum depth, and then add each
     // as a data member to an offer list, then pack it into ascOutput.
     //
-    for (auto& it : m_mapOffers) {
-        OTOffer* pOffer = it.second;
+    for (const auto& [number, entry] : book_.Offers()) {
+        OTOffer* pOffer = entry.offer_;
         OT_ASSERT(nullptr != pOffer);
 
         OTTrade* pTrade = pOffer->GetTrade();
@@ -504,17 +494,11 @@ auto OTMarket::GetOfferList(
         dynamic_cast<OTDB::OfferListMarket*>(
             OTDB::CreateObject(OTDB::STORED_OBJ_OFFER_LIST_MARKET)));
 
-    //    mapOfOffers            m_mapBids;        // The buyers, ordered by
-    // price limit
-    //    mapOfOffers            m_mapAsks;        // The sellers, ordered by
-    // price limit
-
     std::int32_t nTempDepth = 0;
 
-    for (auto& it : m_mapBids) {
+    for (auto* pOffer : book_.Bids()) {
         if (nTempDepth++ > lDepth) { break; }
 
-        OTOffer* pOffer = it.second;
         OT_ASSERT(nullptr != pOffer);
 
         const Amount& lPriceLimit = pOffer->GetPriceLimit();
@@ -560,10 +544,9 @@ auto OTMarket::GetOfferList(
 
     nTempDepth = 0;
 
-    for (auto& it : m_mapAsks) {
+    for (auto* pOffer : book_.Asks()) {
         if (nTempDepth++ > lDepth) { break; }
 
-        OTOffer* pOffer = it.second;
         OT_ASSERT(nullptr != pOffer);
 
         // OfferDataMarket"
@@ -648,43 +631,22 @@ auto OTMarket::GetOfferList(
     return false;
 }
 
-// To insure that offers of a specific price are always inserted at the upper
-// bound,
-// use this:  my_mmap.insert(my_mmap.upper_bound(key), my_mmap::value_type(key,
-// val));
-// This way I can read them from the lower bound later, and always get them in
-// the
-// order received for that price.
-//
-// typedef UnallocatedMultimap<std::int64_t, OTOffer *>    mapOfOffers;
-// mapOfOffers    m_mapBids; // The buyers, ordered
-// mapOfOffers    m_mapAsks; // The sellers, ordered
-
 auto OTMarket::GetOffer(const std::int64_t& lTransactionNum) -> OTOffer*
 {
     // See if there's something there with that transaction number.
-    auto it = m_mapOffers.find(lTransactionNum);
+    OTOffer* pOffer = book_.Find(lTransactionNum);
 
-    if (it == m_mapOffers.end()) {
+    if (nullptr == pOffer) {
         // nothing found.
         return nullptr;
     }
-    // Found it!
-    else {
-        OTOffer* pOffer = it->second;
 
-        OT_ASSERT((nullptr != pOffer));
+    if (pOffer->GetTransactionNum() == lTransactionNum) { return pOffer; }
 
-        if (pOffer->GetTransactionNum() == lTransactionNum) {
-            return pOffer;
-        } else {
-            LogError()(OT_PRETTY_CLASS())(
-                "Expected Offer with transaction number ")(
-                lTransactionNum)(", but found ")(pOffer->GetTransactionNum())(
-                " inside. Bad data?")
-                .Flush();
-        }
-    }
+    LogError()(OT_PRETTY_CLASS())("Expected Offer with transaction number ")(
+        lTransactionNum)(", but found ")(pOffer->GetTransactionNum())(
+        " inside. Bad data?")
+        .Flush();
 
     return nullptr;
 }
@@ -694,89 +656,23 @@ auto OTMarket::RemoveOffer(
     const std::int64_t& lTransactionNum,
     const PasswordPrompt& reason) -> bool
 {
-    bool bReturnValue = false;
-
-    // See if there's something there with that transaction number.
-    auto it = m_mapOffers.find(lTransactionNum);
+    // This removes it from the transaction number index and from the bid or
+    // ask list at the same time.
+    OTOffer* pOffer = book_.Remove(lTransactionNum);
 
     // If it's not already on the list, then there's nothing to remove.
-    if (it == m_mapOffers.end()) {
+    if (nullptr == pOffer) {
         LogError()(OT_PRETTY_CLASS())(
             "Attempt to remove non-existent Offer from Market. "
             "Transaction #: ")(lTransactionNum)(".")
             .Flush();
         return false;
     }
-    // Otherwise, if it WAS already there, remove it properly.
-    else {
-        OTOffer* pOffer = it->second;
-
-        OT_ASSERT(nullptr != pOffer);
-
-        // This removes it from one list (the one indexed by transaction
-        // number.)
-        // But it's still on one of the other lists...
-        m_mapOffers.erase(it);
 
-        // The code operates the same whether ask or bid. Just use a pointer.
-        mapOfOffers* pMap = (pOffer->IsBid() ? &m_mapBids : &m_mapAsks);
+    delete pOffer;
+    pOffer = nullptr;
 
-        // Future solution here: instead of looping through all the offers and
-        // finding it,
-        // I could just have each Offer store a copy of the iterator that's
-        // returned when
-        // it's first inserted. Later I just erase that iterator from the right
-        // list to remove. Todo.
-        OTOffer* pSameOffer = nullptr;
-
-        for (auto iii = pMap->begin(); iii != pMap->end(); ++iii) {
-            pSameOffer = iii->second;
-
-            OT_ASSERT_MSG(
-                nullptr != pSameOffer,
-                "nullptr offer pointer in OTMarket::RemoveOffer.\n");
-
-            // found it!
-            if (lTransactionNum == pSameOffer->GetTransactionNum()) {
-                pMap->erase(iii);
-                break;
-            }
-
-            // Later on, below this loop, this pointer will be nullptr or not,
-            // and
-            // I will know if it was removed.
-            pSameOffer = nullptr;
-        }
-
-        if (nullptr == pSameOffer) {
-            LogError()(OT_PRETTY_CLASS())(
-                "Removed offer from offers list, but not found on bid/ask "
-                "list.")
-                .Flush();
-        } else  // This means it was found and removed from the second list as
-                // well.
-        {
-            bReturnValue = true;  // Success.
-        }
-
-        // pOffer was found on the Offers list.
-        // pSameOffer was found on the Bid or Ask list, with the same
-        // transaction ID.
-        // They SHOULD be pointers to the SAME object.
-        // Therefore I CANNOT delete them both.
-        //
-        OT_ASSERT(pOffer == pSameOffer);
-
-        delete pOffer;
-        pOffer = nullptr;
-        pSameOffer = nullptr;
-    }
-
-    if (bReturnValue) {
-        return SaveMarket(reason);  // <====== SAVE since an offer was removed.
-    } else {
-        return false;
-    }
+    return SaveMarket(reason);  // <====== SAVE since an offer was removed.
 }
 
 // This method demands an Offer reference in order to verify that it really
@@ -794,7 +690,6 @@ auto OTMarket::AddOffer(
     const Time tDateAddedToMarket) -> bool
 {
     const std::int64_t lTransactionNum = theOffer.GetTransactionNum();
-    const Amount& lPriceLimit = theOffer.GetPriceLimit();
 
     // Make sure the offer is even appropriate for this market...
     if (!ValidateOfferForMarket(theOffer)) {
@@ -804,24 +699,10 @@ auto OTMarket::AddOffer(
 
         if (nullptr != pTrade) { pTrade->FlagForRemoval(); }
     } else {
-        // I store duplicate lists of offer pointers. Two multimaps ordered by
-        // price,
-        // (for buyers and sellers) and one map ordered by transaction number.
-
-        // See if there's something else already there with the same transaction
-        // number.
-        //
-        auto it = m_mapOffers.find(lTransactionNum);
-
-        // If it's not already on the list, then add it...
-        if (it == m_mapOffers.end()) {
-            m_mapOffers[lTransactionNum] = &theOffer;
-            LogTrace()(OT_PRETTY_CLASS())(
-                "Offer added as an offer to the market.")
-                .Flush();
-        }
-        // Otherwise, if it was already there, log an error.
-        else {
+        // The order book indexes the offer by transaction number and adds
+        // it to the back of the bid or ask list for its price, so offers at
+        // the same price are traded in the order they were received.
+        if (false == book_.Add(theOffer)) {
             LogError()(OT_PRETTY_CLASS())(
                 "Attempt to add Offer to Market with pre-existing "
                 "transaction number: ")(lTransactionNum)(".")
@@ -829,31 +710,10 @@ auto OTMarket::AddOffer(
             return false;
         }
 
-        // Okay so we successfully added it to one list (indexed by Transaction
-        // Num) and we
-        // know it validated as an offer, AND we know it wasn't already on the
-        // market.
-        //
-        // So next, let's add it to the lists that are indexed by price:
-
-        // Determine if it's a buy or sell, and add it to the right list.
         if (theOffer.IsBid()) {
-            // No bother checking if the offer is already on this list,
-            // since the code above basically already verifies that for us.
-
-            m_mapBids.insert(
-                m_mapBids.lower_bound(lPriceLimit),  // highest bidders go
-                                                     // first, so I am last in
-                                                     // line at lower bound.
-                std::pair<Amount, OTOffer*>(lPriceLimit, &theOffer));
             LogTrace()(OT_PRETTY_CLASS())("Offer added as a bid to the market.")
                 .Flush();
         } else {
-            m_mapAsks.insert(
-                m_mapAsks.upper_bound(lPriceLimit),  // lowest price sells
-                                                     // first, so I am last in
-                                                     // line at upper bound.
-                std::pair<Amount, OTOffer*>(lPriceLimit, &theOffer));
             LogTrace()(OT_PRETTY_CLASS())(
                 "Offer added as an ask to the market.")
                 .Flush();
@@ -1009,46 +869,59 @@ void OTMarket::GetIdentifier(Identifier& theIdentifier) const
 
 // returns 0 if there are no bids. Otherwise returns the value of the highest
 // bid on the market.
-auto OTMarket::GetHighestBidPrice() -> Amount
-{
-    Amount lPrice = 0;
-
-    auto rr = m_mapBids.rbegin();
-
-    if (rr != m_mapBids.rend()) { lPrice = rr->first; }
-
-    return lPrice;
-}
+auto OTMarket::GetHighestBidPrice() -> Amount { return book_.BestBid(); }
 
 // returns 0 if there are no asks. Otherwise returns the value of the lowest ask
-// on the market.
-auto OTMarket::GetLowestAskPrice() -> Amount
+// on the market. Market orders have a 0 price, so they are skipped.
+auto OTMarket::GetLowestAskPrice() -> Amount { return book_.BestAsk(); }
+
+void OTMarket::record_trade(
+    const std::int64_t& lTransactionNum,
+    const Amount& lPrice,
+    const Amount& lAmountSold)
 {
-    Amount lPrice = 0;
+    if (nullptr == m_pTradeList) {
+        m_pTradeList = dynamic_cast<OTDB::TradeListMarket*>(
+            OTDB::CreateObject(OTDB::STORED_OBJ_TRADE_LIST_MARKET));
+    }
 
-    auto it = m_mapAsks.begin();
+    std::unique_ptr<OTDB::TradeDataMarket> pTradeData(
+        dynamic_cast<OTDB::TradeDataMarket*>(
+            OTDB::CreateObject(OTDB::STORED_OBJ_TRADE_DATA_MARKET)));
 
-    if (it != m_mapAsks.end()) {
-        lPrice = it->first;
+    const auto theDate = Clock::now();
 
-        // Market orders have a 0 price, so we need to skip any if they are
-        // here.
-        //
-        // Note that we don't have to do this with the highest bid price (above
-        // function) but in the case of asks, a "0 price" will undercut the
-        // other
-        // actual prices, so we need to skip any that have a 0 price.
-        //
-        while (0 == lPrice) {
-            ++it;
+    pTradeData->transaction_id = std::to_string(lTransactionNum);
+    pTradeData->date = std::to_string(Clock::to_time_t(theDate));
+    pTradeData->price = [&] {
+        auto buf = UnallocatedCString{};
+        lPrice.Serialize(writer(buf));
+        return buf;
+    }();  // Priced per scale.
+    pTradeData->amount_sold = [&] {
+        auto buf = UnallocatedCString{};
+        lAmountSold.Serialize(writer(buf));
+        return buf;
+    }();
 
-            if (it == m_mapAsks.end()) { break; }
+    m_strLastSaleDate = pTradeData->date;
 
-            lPrice = it->first;
-        }
+    // *pTradeData is CLONED at this time (I'm still responsible to delete.)
+    // That's also why I add it here, after all the above: So the data is set
+    // right BEFORE the cloning occurs.
+    //
+    m_pTradeList->AddTradeDataMarket(*pTradeData);
+
+    // Here we erase the oldest elements so the list never exceeds 50 elements
+    // total.
+    //
+    while (m_pTradeList->GetTradeDataMarketCount() > MAX_MARKET_QUERY_DEPTH) {
+        m_pTradeList->RemoveTradeDataMarket(0);
     }
 
-    return lPrice;
+    // The amounts available on both offers have changed, so any offers which
+    // were previously unable to trade must be matched again.
+    book_.Touch();
 }
 
 // This utility function is used directly below (only).
@@ -1966,53 +1839,10 @@ void OTMarket::ProcessTrade(
 
                 // Here we save this trade in a list of the most recent
                 // 50 trades.
-                {
-                    if (nullptr == m_pTradeList) {
-                        m_pTradeList = dynamic_cast<OTDB::TradeListMarket*>(
-                            OTDB::CreateObject(
-                                OTDB::STORED_OBJ_TRADE_LIST_MARKET));
-                    }
-
-                    std::unique_ptr<OTDB::TradeDataMarket> pTradeData(
-                        dynamic_cast<OTDB::TradeDataMarket*>(OTDB::CreateObject(
-                            OTDB::STORED_OBJ_TRADE_DATA_MARKET)));
-
-                    const std::int64_t& lTransactionNum =
-                        theOffer.GetTransactionNum();
-                    const auto theDate = Clock::now();
-
-                    pTradeData->transaction_id =
-                        std::to_string(lTransactionNum);
-                    pTradeData->date =
-                        std::to_string(Clock::to_time_t(theDate));
-                    pTradeData->price = [&] {
-                        auto buf = UnallocatedCString{};
-                        theOtherOffer.GetPriceLimit().Serialize(writer(buf));
-                        return buf;
-                    }();  // Priced per scale.
-                    pTradeData->amount_sold = [&] {
-                        auto buf = UnallocatedCString{};
-                        lOfferFinished.Serialize(writer(buf));
-                        return buf;
-                    }();
-
-                    m_strLastSaleDate = pTradeData->date;
-
-                    // *pTradeData is CLONED at this time (I'm still
-                    // responsible to delete.) That's also why I add it
-                    // here, after all the above: So the data is set
-                    // right BEFORE the cloning occurs.
-                    //
-                    m_pTradeList->AddTradeDataMarket(*pTradeData);
-
-                    // Here we erase the oldest elements so the list
-                    // never exceeds 50 elements total.
-                    //
-                    while (m_pTradeList->GetTradeDataMarketCount() >
-                           MAX_MARKET_QUERY_DEPTH) {
-                        m_pTradeList->RemoveTradeDataMarket(0);
-                    }
-                }
+                record_trade(
+                    theOffer.GetTransactionNum(),
+                    theOtherOffer.GetPriceLimit(),  // Priced per scale.
+                    lOfferFinished);
 
                 // Account balances have changed based on these trades
                 // that we just processed. Make sure to save the Market
@@ -2498,217 +2328,69 @@ auto OTMarket::ProcessTrade(
         return true;
     }
 
+    // If nothing has changed on the market since this offer was last
+    // matched, then it can't trade now either. (Market orders only
+    // process once, so they are never skipped.)
+    if (OTCron::GetEventDrivenMatching() &&
+        (false == book_.Stale(theOffer))) {
+        return true;
+    }
+
     // If I got this far, that means there ARE bidders or sellers
     // (whichever the current trade cares about) in the market WITHIN
     // THIS TRADE'S PRICE LIMITS. So we're going to go up the list of
     // what's available, and trade.
-
-    if (theOffer.IsAsk())  // If I'm selling,
-    {
-        // rbegin puts us on the upper bound of the highest bidder (any
-        // new bidders at the same price would be added at the lower
-        // bound, where they are last in line.) The upper bound, on the
-        // other hand, is first in line.  So we start there, and loop
-        // backwards until there are no other bids within my price
-        // range.
-        for (auto rr = m_mapBids.rbegin(); rr != m_mapBids.rend(); ++rr) {
-            // then I want to start at the highest bidder and loop DOWN
-            // until hitting my price limit.
-            OTOffer* pBid = rr->second;
-            OT_ASSERT(nullptr != pBid);
-
-            // NOTE: Market orders only process once, and they are
-            // processed in the order they were added to the market.
-            //
-            // If BOTH offers are market orders, we just skip this bid.
-            //
-            // But FURTHERMORE: We ONLY process a market order as
-            // theOffer, not as pBid! Imagine if pBid is a market order
-            // and theOffer isn't -- that would mean pBid hasn't been
-            // processed yet (since it will only process once.) So it
-            // needs to wait its turn! It will get its one shot WHEN ITS
-            // TURN comes.
-            //
-            if (pBid->IsMarketOrder()) {
-                //          if (theOffer.IsMarketOrder() &&
-                // pBid->IsMarketOrder())
-                //              continue;
-                break;
-            }
-            // NOTE: Why break, instead of continue? Because since we
-            // are looping through the bids, from the HIGHEST down to
-            // the LOWEST, and since market orders have a ZERO price, we
-            // know for a fact that there are not any other non-zero
-            // bids. (So we might as well break.)
-
-            // I'm selling.
-            //
-            // If the bid is larger than, or equal to, my
-            // low-side-limit, and the amount available is at least my
-            // minimum increment, (and vice versa),
-            // ...then let's trade!
-            //
-            if (theOffer.IsMarketOrder() ||  // If I don't care about
-                                             // price...
-                (pBid->GetPriceLimit() >=
-                 theOffer.GetPriceLimit()))  // Or if this bid is within
-                                             // my price range...
-            {
-                // Notice the above "if" is ONLY based on price...
-                // because the "else" returns! (Once I am out of my
-                // price range, no point to continue looping.)
-                //
-                // ...So all the other "if"s have to go INSIDE the block
-                // here:
-                //
-                if ((pBid->GetAmountAvailable() >=
-                     theOffer.GetMinimumIncrement()) &&
-                    (theOffer.GetAmountAvailable() >=
-                     pBid->GetMinimumIncrement()) &&
-                    (nullptr != pBid->GetTrade()) &&
-                    !pBid->GetTrade()->IsFlaggedForRemoval()) {
-
-                    ProcessTrade(
-                        wallet,
-                        theTrade,
-                        theOffer,
-                        *pBid,
-                        reason);  // <========
-                }
-            }
-
-            // Else, the bid is lower than I am willing to sell. (And
-            // all the remaining bids are even lower.)
-            //
-            else if (theOffer.IsLimitOrder()) {
-                pBid = nullptr;
-                return true;  // stay on cron for more processing (for
-                              // now.)
-            }
-
-            // The offer has no more trading to do--it's done.
-            if (theTrade.IsFlaggedForRemoval() ||  // during processing,
-                                                   // the trade may have
-                                                   // gotten flagged.
-                (theOffer.GetMinimumIncrement() >
-                 theOffer.GetAmountAvailable())) {
-
-                const auto unittype = wallet.CurrencyTypeBasedOnUnitType(
-                    GetInstrumentDefinitionID());
-                LogVerbose()(OT_PRETTY_CLASS())("Removing market order: ")(
-                    theTrade.GetOpeningNum())(". IsFlaggedForRemoval: ")(
-                    theTrade.IsFlaggedForRemoval())(". Minimum increment: ")(
-                    theOffer.GetMinimumIncrement(),
-                    unittype)(" is larger than Amount available: ")(
-                    theOffer.GetAmountAvailable(), unittype)
-                    .Flush();
-
-                return false;  // remove this trade from cron
-            }
-
-            pBid = nullptr;
+    //
+    // The order book visits the highest bidders (or the lowest
+    // sellers) first, and offers at the same price in the order they
+    // were added to the market, until there are no other offers
+    // within my price range.
+    //
+    // NOTE: Market orders only process once, and they are processed in
+    // the order they were added to the market. We ONLY process a market
+    // order as theOffer, not as the other offer! If the other offer is
+    // a market order, that means it hasn't been processed yet (since it
+    // will only process once.) So it needs to wait its turn, and the
+    // order book never visits it.
+    const auto fill = [&](OTOffer& theOtherOffer) {
+        const auto* pOtherTrade = theOtherOffer.GetTrade();
+
+        if ((nullptr == pOtherTrade) || pOtherTrade->IsFlaggedForRemoval()) {
+            return;
         }
-    }
-    // I'm buying
-    else {
-        // Begin puts us on the lower bound of the lowest seller (any
-        // new sellers at the same price would be added at the upper
-        // bound for that price, where they are last in line.) The lower
-        // bound, on the other hand, is first in line.  So we start
-        // there, and loop forwards until there are no other asks within
-        // my price range.
-        //
-        for (auto& it : m_mapAsks) {
-            // then I want to start at the lowest seller and loop UP
-            // until hitting my price limit.
-            OTOffer* pAsk = it.second;
-            OT_ASSERT(nullptr != pAsk);
-
-            // NOTE: Market orders only process once, and they are
-            // processed in the order they were added to the market.
-            //
-            // If BOTH offers are market orders, we just skip this ask.
-            //
-            // But FURTHERMORE: We ONLY process a market order as
-            // theOffer, not as pAsk! Imagine if pAsk is a market order
-            // and theOffer isn't -- that would mean pAsk hasn't been
-            // processed yet (since it will only process once.) So it
-            // needs to wait its turn! It will get its one shot WHEN ITS
-            // TURN comes.
-            //
-            if (pAsk->IsMarketOrder()) {
-                //          if (theOffer.IsMarketOrder() &&
-                // pAsk->IsMarketOrder())
-                continue;
-            }
 
-            // I'm buying.
-            // If the ask price is less than, or equal to, my price
-            // limit, and the amount available for purchase is at least
-            // my minimum increment, (and vice versa),
-            // ...then let's trade!
-            //
-            if (theOffer.IsMarketOrder() ||  // If I don't care about
-                                             // price...
-                (pAsk->GetPriceLimit() <=
-                 theOffer.GetPriceLimit()))  // Or if this ask is within
-                                             // my price range...
-            {
-                // Notice the above "if" is ONLY based on price...
-                // because the "else" returns! (Once I am out of my
-                // price range, no point to continue looping.) So all
-                // the other "if"s have to go INSIDE the block here:
-                //
-                if ((pAsk->GetAmountAvailable() >=
-                     theOffer.GetMinimumIncrement()) &&
-                    (theOffer.GetAmountAvailable() >=
-                     pAsk->GetMinimumIncrement()) &&
-                    (nullptr != pAsk->GetTrade()) &&
-                    !pAsk->GetTrade()->IsFlaggedForRemoval()) {
-
-                    ProcessTrade(
-                        wallet, theTrade, theOffer, *pAsk, reason);  // <======
-                }
-            }
-            // Else, the ask price is higher than I am willing to pay.
-            // (And all the remaining sellers are even HIGHER.)
-            else if (theOffer.IsLimitOrder()) {
-                pAsk = nullptr;
-                return true;  // stay on the market for now.
-            }
+        ProcessTrade(wallet, theTrade, theOffer, theOtherOffer, reason);
+    };
+    // The offer has no more trading to do--it's done.
+    const auto done = [&] {
+        if (theTrade.IsFlaggedForRemoval() ||  // during processing, the
+                                               // trade may have gotten
+                                               // flagged.
+            (theOffer.GetMinimumIncrement() > theOffer.GetAmountAvailable())) {
+
+            const auto unittype =
+                wallet.CurrencyTypeBasedOnUnitType(GetInstrumentDefinitionID());
+            LogVerbose()(OT_PRETTY_CLASS())("Removing market order: ")(
+                theTrade.GetOpeningNum())(". IsFlaggedForRemoval: ")(
+                theTrade.IsFlaggedForRemoval())(". Minimum increment: ")(
+                theOffer.GetMinimumIncrement(),
+                unittype)(" is larger than Amount available: ")(
+                theOffer.GetAmountAvailable(), unittype)
+                .Flush();
 
-            // The offer has no more trading to do--it's done.
-            if (theTrade.IsFlaggedForRemoval() ||  // during processing,
-                                                   // the trade may have
-                                                   // gotten flagged.
-                (theOffer.GetMinimumIncrement() >
-                 theOffer.GetAmountAvailable())) {
-
-                const auto unittype = wallet.CurrencyTypeBasedOnUnitType(
-                    GetInstrumentDefinitionID());
-                LogVerbose()(OT_PRETTY_CLASS())("Removing market order: ")(
-                    theTrade.GetOpeningNum())(". IsFlaggedForRemoval: ")(
-                    theTrade.IsFlaggedForRemoval())(". Minimum increment: ")(
-                    theOffer.GetMinimumIncrement(),
-                    unittype)(" is larger than Amount available: ")(
-                    theOffer.GetAmountAvailable(), unittype)
-                    .Flush();
+            return true;
+        }
 
-                return false;  // remove this trade from the market.
-            }
+        return false;
+    };
 
-            pAsk = nullptr;
-        }
-    }
+    // Returns false if the offer should be removed from the market.
+    // (Market orders only process once, so they are always removed.)
+    const auto stay = book_.Match(theOffer, fill, done);
 
-    // Market orders only process once.
-    // (So tell the caller to remove it.)
-    //
-    if (theOffer.IsMarketOrder()) {
-        return false;  // remove from market.
-    }
+    if (stay) { book_.Evaluated(theOffer); }
 
-    return true;  // stay on the market for now.
+    return stay;
 }
 
 // Make sure the offer is for the right instrument definition, the right
@@ -2873,18 +2555,7 @@ void OTMarket::Release_Market()
 
     // If there were any dynamically allocated objects, clean them up
     // here.
-    while (!m_mapBids.empty()) {
-        OTOffer* pOffer = m_mapBids.begin()->second;
-        m_mapBids.erase(m_mapBids.begin());
-        delete pOffer;
-        pOffer = nullptr;
-    }
-    while (!m_mapAsks.empty()) {
-        OTOffer* pOffer = m_mapAsks.begin()->second;
-        m_mapAsks.erase(m_mapAsks.begin());
-        delete pOffer;
-        pOffer = nullptr;
-    }
+    for (auto* pOffer : book_.Clear()) { delete pOffer; }
 }
 
 void OTMarket::Release()
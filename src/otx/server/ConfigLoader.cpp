@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"               // IWYU pragma: associated
 #include "otx/server/ConfigLoader.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 
@@ -125,6 +126,25 @@ auto ConfigLoader::load(
         OTCron::SetCronMaxItemsPerNym(static_cast<std::int32_t>(lValue));
     }
 
+    {
+        const char* szComment = "; event_driven_matching skips market offers "
+                                "which can not have\n"
+                                "; become tradable since they were last "
+                                "matched, instead of matching\n"
+                                "; every offer on every cron beat.\n";
+
+        bool bIsNewKey = false;
+        bool bValue = false;
+        config.CheckSet_bool(
+            String::Factory("cron"),
+            String::Factory("event_driven_matching"),
+            false,
+            bValue,
+            bIsNewKey,
+            String::Factory(szComment));
+        OTCron::SetEventDrivenMatching(bValue);
+    }
+
     // HEARTBEAT
 
     {
@@ -235,6 +255,29 @@ auto ConfigLoader::load(
         ServerSettings::SetMinMarketScale(lValue);
     }
 
+    // PROCESSING
+
+    {
+        const char* szComment =
+            "; request_threads is the number of threads which execute client "
+            "requests.\n"
+            "; 0 : requests are processed one at a time.\n"
+            "; Requests which affect different nyms and accounts may execute "
+            "concurrently when this is greater than zero.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        config.CheckSet_long(
+            String::Factory("processing"),
+            String::Factory("request_threads"),
+            ServerSettings::GetRequestThreads(),
+            lValue,
+            bIsNewKey,
+            String::Factory(szComment));
+        ServerSettings::SetRequestThreads(static_cast<std::int32_t>(
+            std::max<std::int64_t>(0, std::min<std::int64_t>(lValue, 256))));
+    }
+
     // SECURITY (beginnings of..)
 
     // Master Key Timeout
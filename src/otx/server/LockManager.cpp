@@ -0,0 +1,188 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                // IWYU pragma: associated
+#include "1_Internal.hpp"              // IWYU pragma: associated
+#include "otx/server/LockManager.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <utility>
+
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/Mutex.hpp"
+
+namespace opentxs::server
+{
+LockManager::Guard::Guard(
+    LockManager& parent,
+    bool exclusive,
+    Keys&& keys) noexcept
+    : parent_(&parent)
+    , exclusive_(exclusive)
+    , keys_(std::move(keys))
+{
+}
+
+LockManager::Guard::Guard(Guard&& rhs) noexcept
+    : parent_(rhs.parent_)
+    , exclusive_(rhs.exclusive_)
+    , keys_(std::move(rhs.keys_))
+{
+    rhs.parent_ = nullptr;
+}
+
+LockManager::Guard::~Guard()
+{
+    if (nullptr != parent_) { parent_->release(exclusive_, keys_); }
+}
+
+LockManager::LockManager() noexcept
+    : lock_()
+    , scope_()
+    , readers_(0)
+    , writers_waiting_(0)
+    , writer_(false)
+    , objects_()
+    , acquired_(0)
+    , contended_(0)
+    , exclusive_(0)
+    , wait_(0)
+    , max_wait_(0)
+{
+}
+
+auto LockManager::Account(const UnallocatedCString& id) noexcept
+    -> UnallocatedCString
+{
+    return "account:" + id;
+}
+
+auto LockManager::Exclusive() noexcept -> Guard
+{
+    const auto start = std::chrono::steady_clock::now();
+    auto lock = std::unique_lock<std::mutex>{lock_};
+    const auto contended = writer_ || (0 < readers_);
+    ++writers_waiting_;
+    scope_.wait(lock, [this] { return (false == writer_) && (0 == readers_); });
+    --writers_waiting_;
+    writer_ = true;
+    lock.unlock();
+    ++exclusive_;
+    record(start, contended);
+
+    return Guard{*this, true, {}};
+}
+
+auto LockManager::GetStats() const noexcept -> Stats
+{
+    using std::chrono::microseconds;
+    auto out = Stats{};
+    out.acquired_ = acquired_.load();
+    out.contended_ = contended_.load();
+    out.exclusive_ = exclusive_.load();
+    out.wait_ = microseconds{wait_.load()};
+    out.max_wait_ = microseconds{max_wait_.load()};
+
+    return out;
+}
+
+auto LockManager::Nym(const UnallocatedCString& id) noexcept
+    -> UnallocatedCString
+{
+    return "nym:" + id;
+}
+
+auto LockManager::record(
+    std::chrono::steady_clock::time_point start,
+    bool contended) noexcept -> void
+{
+    const auto wait = std::chrono::duration_cast<std::chrono::microseconds>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+    ++acquired_;
+
+    if (false == contended) { return; }
+
+    ++contended_;
+    wait_ += wait;
+    auto max = max_wait_.load();
+
+    while ((max < wait) && (false == max_wait_.compare_exchange_weak(
+                                         max, static_cast<std::int64_t>(wait))))
+        ;
+}
+
+auto LockManager::release(bool exclusive, const Keys& keys) noexcept -> void
+{
+    auto lock = Lock{lock_};
+
+    for (const auto& key : keys) {
+        auto it = objects_.find(key);
+
+        OT_ASSERT(objects_.end() != it);
+
+        it->second->lock_.unlock();
+
+        if (0 == --(it->second->users_)) { objects_.erase(it); }
+    }
+
+    if (exclusive) {
+        writer_ = false;
+    } else {
+        --readers_;
+    }
+
+    if ((false == writer_) && (0 == readers_)) { scope_.notify_all(); }
+}
+
+auto LockManager::Shared(Keys keys) noexcept -> Guard
+{
+    const auto start = std::chrono::steady_clock::now();
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    auto objects = UnallocatedVector<Object*>{};
+    objects.reserve(keys.size());
+    auto contended = false;
+
+    {
+        auto lock = std::unique_lock<std::mutex>{lock_};
+        contended = writer_ || (0 < writers_waiting_);
+        scope_.wait(lock, [this] {
+            return (false == writer_) && (0 == writers_waiting_);
+        });
+        ++readers_;
+
+        for (const auto& key : keys) {
+            auto& object = objects_[key];
+
+            if (false == bool(object)) { object = std::make_unique<Object>(); }
+
+            ++(object->users_);
+            objects.emplace_back(object.get());
+        }
+    }
+
+    // NOTE objects are locked in key order without holding lock_ so other
+    // operations may proceed while this one waits
+    for (auto* object : objects) {
+        if (false == object->lock_.try_lock()) {
+            contended = true;
+            object->lock_.lock();
+        }
+    }
+
+    record(start, contended);
+
+    return Guard{*this, false, std::move(keys)};
+}
+
+auto LockManager::Unit(const UnallocatedCString& id) noexcept
+    -> UnallocatedCString
+{
+    return "unit:" + id;
+}
+
+LockManager::~LockManager() = default;
+}  // namespace opentxs::server
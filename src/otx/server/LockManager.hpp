@@ -0,0 +1,116 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::server
+{
+/// Serializes notary operations by the objects they affect
+///
+/// Operations which only affect known nyms, accounts and unit definitions
+/// hold the server scope in shared mode and lock each affected object.
+/// Operations whose effects can not be determined in advance, such as
+/// smart contracts and cron, hold the server scope exclusively. Object locks are
+/// acquired in sorted order so overlapping operations can not deadlock, and
+/// waiting exclusive operations block new shared operations so they are not
+/// starved under load.
+class LockManager
+{
+public:
+    using Keys = UnallocatedVector<UnallocatedCString>;
+
+    struct Stats {
+        /// completed lock requests
+        std::uint64_t acquired_{};
+        /// lock requests which had to wait
+        std::uint64_t contended_{};
+        /// lock requests for the exclusive server scope
+        std::uint64_t exclusive_{};
+        /// total time spent waiting
+        std::chrono::microseconds wait_{};
+        /// longest single wait
+        std::chrono::microseconds max_wait_{};
+    };
+
+    /// Releases the acquired locks when destroyed
+    class Guard
+    {
+    public:
+        Guard(Guard&& rhs) noexcept;
+        Guard() = delete;
+        Guard(const Guard&) = delete;
+        auto operator=(const Guard&) -> Guard& = delete;
+        auto operator=(Guard&&) -> Guard& = delete;
+
+        ~Guard();
+
+    private:
+        friend LockManager;
+
+        LockManager* parent_;
+        bool exclusive_;
+        Keys keys_;
+
+        Guard(LockManager& parent, bool exclusive, Keys&& keys) noexcept;
+    };
+
+    static auto Account(const UnallocatedCString& id) noexcept
+        -> UnallocatedCString;
+    static auto Nym(const UnallocatedCString& id) noexcept
+        -> UnallocatedCString;
+    static auto Unit(const UnallocatedCString& id) noexcept
+        -> UnallocatedCString;
+
+    auto GetStats() const noexcept -> Stats;
+
+    /// Lock the entire server
+    auto Exclusive() noexcept -> Guard;
+    /// Lock the specified objects
+    auto Shared(Keys keys) noexcept -> Guard;
+
+    LockManager() noexcept;
+    LockManager(const LockManager&) = delete;
+    LockManager(LockManager&&) = delete;
+    auto operator=(const LockManager&) -> LockManager& = delete;
+    auto operator=(LockManager&&) -> LockManager& = delete;
+
+    ~LockManager();
+
+private:
+    struct Object {
+        std::mutex lock_{};
+        std::size_t users_{};
+    };
+
+    using Objects = UnallocatedMap<UnallocatedCString, std::unique_ptr<Object>>;
+
+    mutable std::mutex lock_;
+    std::condition_variable scope_;
+    std::size_t readers_;
+    std::size_t writers_waiting_;
+    bool writer_;
+    Objects objects_;
+    std::atomic<std::uint64_t> acquired_;
+    std::atomic<std::uint64_t> contended_;
+    std::atomic<std::uint64_t> exclusive_;
+    std::atomic<std::int64_t> wait_;
+    std::atomic<std::int64_t> max_wait_;
+
+    auto record(
+        std::chrono::steady_clock::time_point start,
+        bool contended) noexcept -> void;
+    auto release(bool exclusive, const Keys& keys) noexcept -> void;
+};
+}  // namespace opentxs::server
@@ -20,6 +20,7 @@
 #include "internal/otx/common/cron/OTCron.hpp"
 #include "internal/otx/common/util/Tag.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/Mutex.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Notary.hpp"
 #include "opentxs/api/session/Wallet.hpp"
@@ -47,6 +48,9 @@ MainFile::MainFile(Server& server, const PasswordPrompt& reason)
 
 auto MainFile::SaveMainFileToString(String& strMainFile) -> bool
 {
+    // NOTE the transactor is locked for the duration so the transaction
+    // number and basket maps are saved in a consistent state
+    auto lock = rLock{server_.GetTransactor().lock_};
     Tag tag("notaryServer");
 
     tag.add_attribute("version", "3.0");
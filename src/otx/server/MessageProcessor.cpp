@@ -8,9 +8,12 @@
 #include "otx/server/MessageProcessor.hpp"  // IWYU pragma: associated
 
 #include <chrono>
+#include <algorithm>
 #include <cstdint>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string_view>
@@ -28,7 +31,11 @@
 #include "internal/network/zeromq/Types.hpp"
 #include "internal/network/zeromq/message/Message.hpp"  // IWYU pragma: keep
 #include "internal/network/zeromq/socket/Raw.hpp"
+#include "internal/otx/Types.hpp"
+#include "internal/otx/common/Item.hpp"
+#include "internal/otx/common/Ledger.hpp"
 #include "internal/otx/common/Message.hpp"
+#include "internal/otx/common/OTTransaction.hpp"
 #include "internal/otx/server/Types.hpp"
 #include "internal/serialization/protobuf/Check.hpp"
 #include "internal/serialization/protobuf/verify/ServerRequest.hpp"
@@ -44,6 +51,8 @@
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Secret.hpp"
 #include "opentxs/core/String.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/core/identifier/Notary.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/identity/Nym.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
@@ -60,7 +69,9 @@
 #include "opentxs/util/Pimpl.hpp"
 #include "opentxs/util/Time.hpp"
 #include "opentxs/util/WorkType.hpp"
+#include "otx/server/LockManager.hpp"
 #include "otx/server/Server.hpp"
+#include "otx/server/ServerSettings.hpp"
 #include "otx/server/UserCommandProcessor.hpp"
 #include "serialization/protobuf/OTXPush.pb.h"
 #include "serialization/protobuf/ServerReply.pb.h"
@@ -121,6 +132,18 @@ MessageProcessor::Imp::Imp(
     , drop_outgoing_(0)
     , active_connections_()
     , connection_map_lock_()
+    , locks_()
+    , concurrent_(false)
+    , queue_lock_()
+    , queue_cv_()
+    , queue_()
+    , active_(0)
+    , processed_(0)
+    , overflow_(0)
+    , workers_()
+    , cron_lock_()
+    , cron_cv_()
+    , cron_wake_(false)
 {
     zmq_batch_.listen_callbacks_.emplace_back(zmq::ListenCallback::Factory(
         [this](auto&& m) { old_pipeline(std::move(m)); }));
@@ -197,7 +220,19 @@ auto MessageProcessor::Imp::associate_connection(
 auto MessageProcessor::Imp::cleanup() noexcept -> void
 {
     running_ = false;
+
+    {
+        auto lock = Lock{queue_lock_};
+        queue_cv_.notify_all();
+    }
+
+    for (auto& worker : workers_) {
+        if (worker.joinable()) { worker.join(); }
+    }
+
     zmq_handle_.Release();
+    server_.Cron().SetWakeup({});
+    wake_cron();
 }
 
 auto MessageProcessor::Imp::DropIncoming(const int count) const noexcept -> void
@@ -232,6 +267,28 @@ auto MessageProcessor::Imp::get_connection(
     return output;
 }
 
+auto MessageProcessor::Imp::GetStats() const noexcept -> Stats
+{
+    const auto locks = locks_.GetStats();
+    auto out = Stats{};
+
+    {
+        auto lock = Lock{queue_lock_};
+        out.queued_ = queue_.size();
+    }
+
+    out.active_ = active_.load();
+    out.processed_ = processed_.load();
+    out.overflow_ = overflow_.load();
+    out.locks_ = locks.acquired_;
+    out.contended_ = locks.contended_;
+    out.exclusive_ = locks.exclusive_;
+    out.lock_wait_ = locks.wait_;
+    out.max_lock_wait_ = locks.max_wait_;
+
+    return out;
+}
+
 auto MessageProcessor::Imp::init(
     const bool inproc,
     const int port,
@@ -272,6 +329,123 @@ auto MessageProcessor::Imp::init(
     OT_ASSERT(queued);
 }
 
+auto MessageProcessor::Imp::lock_request(
+    const opentxs::Message& request) noexcept -> LockManager::Guard
+{
+    using Type = opentxs::MessageType;
+    const auto type = opentxs::Message::Type(request.m_strCommand->Get());
+
+    // NOTE without worker threads requests are executed one at a time on the
+    // socket thread so they only need to be serialized with cron, which does
+    // not require parsing the request for the objects it affects
+    if (false == concurrent_.load()) { return locks_.Shared({}); }
+
+    auto keys = LockManager::Keys{};
+    keys.emplace_back(LockManager::Nym(request.m_strNymID->Get()));
+
+    switch (type) {
+        // NOTE baskets and smart contracts may affect accounts and nyms which
+        // can not be identified until the request has been executed
+        case Type::unregisterNym:
+        case Type::registerInstrumentDefinition:
+        case Type::issueBasket:
+        case Type::triggerClause:
+        case Type::registerContract:
+        case Type::requestAdmin:
+        case Type::addClaim: {
+
+            return locks_.Exclusive();
+        }
+        case Type::notarizeTransaction:
+        case Type::processInbox: {
+            keys.emplace_back(LockManager::Account(request.m_strAcctID->Get()));
+
+            if (false == transaction_keys(request, keys)) {
+
+                return locks_.Exclusive();
+            }
+        } break;
+        case Type::sendNymMessage:
+        case Type::usageCredits: {
+            keys.emplace_back(LockManager::Nym(request.m_strNymID2->Get()));
+        } break;
+        case Type::unregisterAccount:
+        case Type::getBoxReceipt:
+        case Type::getAccountData: {
+            keys.emplace_back(LockManager::Account(request.m_strAcctID->Get()));
+        } break;
+        case Type::registerAccount: {
+            keys.emplace_back(
+                LockManager::Unit(request.m_strInstrumentDefinitionID->Get()));
+        } break;
+        default: {
+        }
+    }
+
+    return locks_.Shared(std::move(keys));
+}
+
+auto MessageProcessor::Imp::transaction_keys(
+    const opentxs::Message& request,
+    LockManager::Keys& keys) const noexcept -> bool
+{
+    const auto nymID = identifier::Nym::Factory(request.m_strNymID->Get());
+    const auto accountID = Identifier::Factory(request.m_strAcctID);
+    auto ledger{api_.Factory().InternalSession().Ledger(
+        nymID, accountID, server_.GetServerID())};
+
+    OT_ASSERT(ledger);
+
+    if (false ==
+        ledger->LoadLedgerFromString(String::Factory(request.m_ascPayload))) {
+
+        return false;
+    }
+
+    for (const auto& [number, transaction] : ledger->GetTransactionMap()) {
+        if (false == bool(transaction)) { return false; }
+
+        switch (transaction->GetType()) {
+            case transactionType::transfer:
+            case transactionType::processInbox: {
+            } break;
+            // NOTE deposits and withdrawals touch the accounts of cheque
+            // drawers and the internal server accounts, and the remaining
+            // transaction types are executed by cron
+            default: {
+
+                return false;
+            }
+        }
+
+        for (const auto& item : transaction->GetItemList()) {
+            if (false == bool(item)) { return false; }
+
+            switch (item->GetType()) {
+                case itemType::transfer: {
+                    keys.emplace_back(LockManager::Account(
+                        item->GetDestinationAcctID().str()));
+                } break;
+                case itemType::acceptCronReceipt:
+                case itemType::acceptItemReceipt:
+                case itemType::acceptFinalReceipt:
+                case itemType::acceptBasketReceipt:
+                case itemType::balanceStatement:
+                case itemType::transactionStatement: {
+                } break;
+                // NOTE resolving a pending transfer updates the boxes of the
+                // sender, which are only known to the inbox receipt
+                default: {
+
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
 auto MessageProcessor::Imp::old_pipeline(zmq::Message&& message) noexcept
     -> void
 {
@@ -299,8 +473,6 @@ auto MessageProcessor::Imp::process_backend(
 {
     auto reply = UnallocatedCString{};
     const auto error = [&] {
-        // ProcessCron and process_backend must not run simultaneously
-        auto lock = Lock{lock_};
         const auto request = [&] {
             auto out = UnallocatedCString{};
             const auto body = incoming.Body();
@@ -452,6 +624,22 @@ auto MessageProcessor::Imp::process_legacy(
 {
     LogTrace()(OT_PRETTY_CLASS())("Processing request via ")(id.asHex())
         .Flush();
+
+    if (concurrent_.load()) {
+        auto lock = Lock{queue_lock_};
+
+        if (queue_per_worker_ * workers_.size() > queue_.size()) {
+            queue_.push_back({tagged, std::move(incoming)});
+            queue_cv_.notify_one();
+
+            return;
+        }
+
+        // NOTE executing the request here stops the socket thread from
+        // reading further requests until the workers catch up
+        ++overflow_;
+    }
+
     process_internal(process_backend(tagged, std::move(incoming)));
 }
 
@@ -489,8 +677,13 @@ auto MessageProcessor::Imp::process_message(
 
     OT_ASSERT(false != bool(replymsg));
 
-    const bool processed =
-        server_.CommandProcessor().ProcessUserCommand(*request, *replymsg);
+    const bool processed = [&] {
+        const auto lock = lock_request(*request);
+
+        return server_.CommandProcessor().ProcessUserCommand(
+            *request, *replymsg);
+    }();
+    ++processed_;
 
     if (false == processed) {
         LogDetail()(OT_PRETTY_CLASS())("Failed to process user command ")(
@@ -658,21 +851,85 @@ auto MessageProcessor::Imp::run() noexcept -> void
 
     while (running_.load()) {
         // timeout is the time left until the next cron should execute.
-        const auto timeout = server_.ComputeTimeout();
-
-        if (timeout.count() <= 0) {
-            // ProcessCron and process_backend must not run simultaneously
-            auto lock = Lock{lock_};
+        if (server_.ComputeTimeout().count() <= 0) {
+            // NOTE cron items may affect any account on the notary
+            const auto lock = locks_.Exclusive();
             server_.ProcessCron();
         }
 
-        Sleep(50ms);
+        // NOTE sleep until the next cron item is due or a new item is added.
+        // The wait is never shorter than 50ms so an inactive cron can not
+        // cause a busy loop, and never longer than a minute so a change to the
+        // system clock can not stall cron indefinitely.
+        const auto timeout = std::clamp<std::chrono::milliseconds>(
+            server_.ComputeTimeout(), 50ms, 1min);
+        auto lock = std::unique_lock<std::mutex>{cron_lock_};
+        cron_cv_.wait_for(
+            lock, timeout, [this] { return cron_wake_ || !running_; });
+        cron_wake_ = false;
     }
 }
 
 auto MessageProcessor::Imp::Start() noexcept -> void
 {
+    server_.Cron().SetWakeup([this] { wake_cron(); });
     thread_ = std::thread(&Imp::run, this);
+    const auto threads = ServerSettings::GetRequestThreads();
+
+    if (0 < threads) {
+        LogConsole()("Processing requests with ")(threads)(" threads").Flush();
+        workers_.reserve(static_cast<std::size_t>(threads));
+
+        for (auto n = 0; n < threads; ++n) {
+            workers_.emplace_back(&Imp::work, this);
+        }
+
+        concurrent_ = true;
+    }
+}
+
+auto MessageProcessor::Imp::wake_cron() noexcept -> void
+{
+    auto lock = Lock{cron_lock_};
+    cron_wake_ = true;
+    cron_cv_.notify_all();
+}
+
+auto MessageProcessor::Imp::work() noexcept -> void
+{
+    SetThisThreadsName("OTX worker");
+
+    while (true) {
+        auto job = [&]() -> std::optional<Job> {
+            auto lock = Lock{queue_lock_};
+            queue_cv_.wait(lock, [&] {
+                return (false == running_) || (false == queue_.empty());
+            });
+
+            if (false == running_) { return std::nullopt; }
+
+            auto out = std::make_optional<Job>(std::move(queue_.front()));
+            queue_.pop_front();
+
+            return out;
+        }();
+
+        if (false == job.has_value()) { break; }
+
+        ++active_;
+        // NOTE replies must be sent by the thread which owns the socket
+        auto reply = std::make_shared<zmq::Message>(
+            process_backend(job->tagged_, std::move(job->message_)));
+        const auto [queued, promise] = zmq_thread_->Modify(
+            frontend_id_,
+            [this, reply](auto&) { process_internal(std::move(*reply)); });
+        --active_;
+
+        if (false == queued) {
+            LogError()(OT_PRETTY_CLASS())("Failed to queue reply message.")
+                .Flush();
+        }
+    }
 }
 
 MessageProcessor::Imp::~Imp()
@@ -705,6 +962,11 @@ auto MessageProcessor::DropOutgoing(const int count) const noexcept -> void
     imp_->DropOutgoing(count);
 }
 
+auto MessageProcessor::GetStats() const noexcept -> Stats
+{
+    return imp_->GetStats();
+}
+
 auto MessageProcessor::init(
     const bool inproc,
     const int port,
@@ -6,7 +6,10 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -17,7 +20,6 @@
 #include "internal/network/zeromq/Handle.hpp"
 #include "internal/otx/server/MessageProcessor.hpp"
 #include "internal/otx/server/Types.hpp"
-#include "internal/util/Lockable.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/core/ByteArray.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
@@ -32,6 +34,7 @@
 #include "opentxs/network/zeromq/socket/Sender.hpp"
 #include "opentxs/network/zeromq/socket/Socket.hpp"
 #include "opentxs/util/Container.hpp"
+#include "otx/server/LockManager.hpp"
 #include "serialization/protobuf/ServerRequest.pb.h"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -77,6 +80,7 @@ class Server;
 }  // namespace server
 
 class Data;
+class Message;
 class PasswordPrompt;
 class Secret;
 // }  // namespace v1
@@ -87,11 +91,12 @@ namespace zmq = opentxs::network::zeromq;
 
 namespace opentxs::server
 {
-class MessageProcessor::Imp final : Lockable
+class MessageProcessor::Imp final
 {
 public:
     auto DropIncoming(const int count) const noexcept -> void;
     auto DropOutgoing(const int count) const noexcept -> void;
+    auto GetStats() const noexcept -> Stats;
 
     auto cleanup() noexcept -> void;
     auto init(
@@ -113,7 +118,15 @@ private:
     // connection identifier, old format
     using ConnectionData = std::pair<ByteArray, bool>;
 
+    struct Job {
+        bool tagged_;
+        zmq::Message message_;
+    };
+
     static constexpr auto zap_domain_{"opentxs-otx"};
+    // NOTE requests waiting per worker thread before new requests are
+    // executed on the socket thread instead
+    static constexpr auto queue_per_worker_ = std::size_t{64};
 
     const api::session::Notary& api_;
     Server& server_;
@@ -131,17 +144,36 @@ private:
     mutable int drop_outgoing_;
     UnallocatedMap<OTNymID, ConnectionData> active_connections_;
     mutable std::shared_mutex connection_map_lock_;
+    LockManager locks_;
+    std::atomic<bool> concurrent_;
+    mutable std::mutex queue_lock_;
+    std::condition_variable queue_cv_;
+    std::deque<Job> queue_;
+    std::atomic<std::size_t> active_;
+    std::atomic<std::uint64_t> processed_;
+    std::atomic<std::uint64_t> overflow_;
+    UnallocatedVector<std::thread> workers_;
+    mutable std::mutex cron_lock_;
+    std::condition_variable cron_cv_;
+    bool cron_wake_;
 
     static auto get_connection(
         const network::zeromq::Message& incoming) noexcept -> ByteArray;
 
     auto extract_proto(const network::zeromq::Frame& incoming) const noexcept
         -> proto::ServerRequest;
+    /// Add the accounts affected by a transaction request, returns false if
+    /// they can not be determined without executing the request
+    auto transaction_keys(
+        const opentxs::Message& request,
+        LockManager::Keys& keys) const noexcept -> bool;
 
     auto associate_connection(
         const bool oldFormat,
         const identifier::Nym& nymID,
         const Data& connection) noexcept -> void;
+    auto lock_request(const opentxs::Message& request) noexcept
+        -> LockManager::Guard;
     auto old_pipeline(zmq::Message&& message) noexcept -> void;
     auto process_backend(
         const bool tagged,
@@ -151,6 +183,7 @@ private:
         const proto::ServerRequest& request,
         identifier::Nym& nymID) noexcept -> bool;
     auto process_frontend(network::zeromq::Message&& incoming) noexcept -> void;
+    auto wake_cron() noexcept -> void;
     auto process_internal(network::zeromq::Message&& incoming) noexcept -> void;
     auto process_legacy(
         const Data& id,
@@ -168,5 +201,6 @@ private:
     auto query_connection(const identifier::Nym& nymID) noexcept
         -> const ConnectionData&;
     auto run() noexcept -> void;
+    auto work() noexcept -> void;
 };
 }  // namespace opentxs::server
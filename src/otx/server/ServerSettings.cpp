@@ -21,6 +21,8 @@ std::int64_t ServerSettings::_min_market_scale = 1;
 std::int32_t ServerSettings::_heartbeat_no_requests = 10;
 // number of ms between each heartbeat.
 std::int32_t ServerSettings::_heartbeat_ms_between_beats = 100;
+// number of threads executing client requests (0 = serial)
+std::int32_t ServerSettings::_request_threads = 0;
 // The Nym who's allowed to do certain
 // commands even if they are turned off.
 UnallocatedCString ServerSettings::_override_nym_id;
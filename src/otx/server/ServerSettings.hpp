@@ -42,6 +42,16 @@ struct ServerSettings {
         _heartbeat_ms_between_beats = value;
     }
 
+    static auto GetRequestThreads() -> std::int32_t
+    {
+        return _request_threads;
+    }
+
+    static void SetRequestThreads(std::int32_t value)
+    {
+        _request_threads = value;
+    }
+
     static auto GetOverrideNymID() -> const UnallocatedCString&
     {
         return _override_nym_id;
@@ -56,6 +66,9 @@ struct ServerSettings {
 
     static std::int32_t _heartbeat_no_requests;
     static std::int32_t _heartbeat_ms_between_beats;
+    // Number of threads which execute client requests. Zero processes
+    // requests one at a time on the socket thread.
+    static std::int32_t _request_threads;
 
     // The Nym who's allowed to do certain commands even if they are turned off.
     static UnallocatedCString _override_nym_id;
@@ -14,6 +14,7 @@
 #include "internal/otx/common/Account.hpp"
 #include "internal/util/Exclusive.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/Mutex.hpp"
 #include "opentxs/api/session/Notary.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
@@ -31,6 +32,7 @@ namespace opentxs::server
 Transactor::Transactor(Server& server, const PasswordPrompt& reason)
     : server_(server)
     , reason_(reason)
+    , lock_()
     , transactionNumber_(0)
     , idToBasketMap_()
     , contractIdToBasketAccountId_()
@@ -49,6 +51,7 @@ Transactor::Transactor(Server& server, const PasswordPrompt& reason)
 auto Transactor::issueNextTransactionNumber(
     TransactionNumber& lTransactionNumber) -> bool
 {
+    auto lock = rLock{lock_};
     // transactionNumber_ stores the last VALID AND ISSUED transaction number.
     // So first, we increment that, since we don't want to issue the same number
     // twice.
@@ -72,6 +75,8 @@ auto Transactor::issueNextTransactionNumberToNym(
     otx::context::Client& context,
     TransactionNumber& lTransactionNumber) -> bool
 {
+    auto lock = rLock{lock_};
+
     if (!issueNextTransactionNumber(lTransactionNumber)) { return false; }
 
     // Each Nym stores the transaction numbers that have been issued to it.
@@ -107,6 +112,7 @@ auto Transactor::addBasketAccountID(
     const Identifier& BASKET_ACCOUNT_ID,
     const Identifier& BASKET_CONTRACT_ID) -> bool
 {
+    auto lock = rLock{lock_};
     auto theBasketAcctID = Identifier::Factory();
 
     if (lookupBasketAccountID(BASKET_ID, theBasketAcctID)) {
@@ -138,6 +144,8 @@ auto Transactor::lookupBasketAccountIDByContractID(
     const Identifier& BASKET_CONTRACT_ID,
     Identifier& BASKET_ACCOUNT_ID) -> bool
 {
+    auto lock = rLock{lock_};
+
     // Server stores a map of BASKET_ID to BASKET_ACCOUNT_ID. Let's iterate
     // through that map...
     for (auto& it : contractIdToBasketAccountId_) {
@@ -166,6 +174,8 @@ auto Transactor::lookupBasketContractIDByAccountID(
     const Identifier& BASKET_ACCOUNT_ID,
     Identifier& BASKET_CONTRACT_ID) -> bool
 {
+    auto lock = rLock{lock_};
+
     // Server stores a map of BASKET_ID to BASKET_ACCOUNT_ID. Let's iterate
     // through that map...
     for (auto& it : contractIdToBasketAccountId_) {
@@ -194,6 +204,8 @@ auto Transactor::lookupBasketAccountID(
     const Identifier& BASKET_ID,
     Identifier& BASKET_ACCOUNT_ID) -> bool
 {
+    auto lock = rLock{lock_};
+
     // Server stores a map of BASKET_ID to BASKET_ACCOUNT_ID. Let's iterate
     // through that map...
     for (auto& it : idToBasketMap_) {
@@ -222,6 +234,7 @@ auto Transactor::getVoucherAccount(
     const identifier::UnitDefinition& INSTRUMENT_DEFINITION_ID)
     -> ExclusiveAccount
 {
+    auto lock = rLock{lock_};
     const auto& NOTARY_NYM_ID = server_.GetServerNym().ID();
     const auto& NOTARY_ID = server_.GetServerID();
     bool bWasAcctCreated = false;
@@ -7,10 +7,12 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 
 #include "internal/api/session/Wallet.hpp"
 #include "internal/otx/AccountList.hpp"
 #include "internal/otx/common/Account.hpp"
+#include "internal/util/Mutex.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Numbers.hpp"
 
@@ -56,11 +58,14 @@ public:
 
     auto transactionNumber() const -> TransactionNumber
     {
+        auto lock = rLock{lock_};
+
         return transactionNumber_;
     }
 
     void transactionNumber(TransactionNumber value)
     {
+        auto lock = rLock{lock_};
         transactionNumber_ = value;
     }
 
@@ -104,6 +109,9 @@ private:
 
     Server& server_;
     const PasswordPrompt& reason_;
+    // Requests for different nyms may execute concurrently, and all of them
+    // share the state below
+    mutable std::recursive_mutex lock_;
     // This stores the last VALID AND ISSUED transaction number.
     TransactionNumber transactionNumber_;
     // maps basketId with basketAccountId
@@ -11,13 +11,16 @@ extern "C" {
 #include <lmdb.h>
 }
 
+#include <algorithm>
 #include <cstddef>
 #include <limits>
 #include <mutex>
+#include <numeric>
 #include <stdexcept>
 #include <tuple>
 
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/Types.hpp"
 #include "util/FileSize.hpp"
@@ -257,6 +260,88 @@ struct LMDB::Imp {
             return false;
         }
     }
+    auto LoadBatch(
+        const Table table,
+        const Vector<ReadView>& keys,
+        const BatchCallback cb,
+        const Mode multiple) const noexcept -> std::size_t
+    {
+        try {
+            auto tx = TransactionRO();
+
+            return LoadBatch(table, keys, cb, multiple, tx);
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return 0_uz;
+        }
+    }
+    auto LoadBatch(
+        const Table table,
+        const Vector<ReadView>& keys,
+        const BatchCallback cb,
+        const Mode multiple,
+        MDB_txn* tx) const noexcept -> std::size_t
+    {
+        auto found = 0_uz;
+
+        try {
+            MDB_cursor* cursor{nullptr};
+            auto post = ScopeGuard{[&] {
+                if (nullptr != cursor) {
+                    ::mdb_cursor_close(cursor);
+                    cursor = nullptr;
+                }
+            }};
+            const auto dbi = db_.at(table);
+
+            if (0 != ::mdb_cursor_open(tx, dbi, &cursor)) {
+                throw std::runtime_error{"Failed to get cursor"};
+            }
+
+            // NOTE visiting keys in the same order lmdb stores them means
+            // consecutive searches mostly touch pages which are already hot
+            const auto order = [&] {
+                auto out = Vector<std::size_t>{keys.get_allocator()};
+                out.resize(keys.size());
+                std::iota(out.begin(), out.end(), 0_uz);
+                std::sort(out.begin(), out.end(), [&](auto lhs, auto rhs) {
+                    return keys[lhs] < keys[rhs];
+                });
+
+                return out;
+            }();
+
+            for (const auto i : order) {
+                const auto& index = keys[i];
+
+                if (false == valid(index)) { continue; }
+
+                auto key =
+                    MDB_val{index.size(), const_cast<char*>(index.data())};
+                auto value = MDB_val{};
+
+                if (0 != ::mdb_cursor_get(cursor, &key, &value, MDB_SET_KEY)) {
+                    continue;
+                }
+
+                ++found;
+                cb(i, {static_cast<char*>(value.mv_data), value.mv_size});
+
+                if (static_cast<bool>(multiple)) {
+                    while (0 == ::mdb_cursor_get(
+                                    cursor, &key, &value, MDB_NEXT_DUP)) {
+                        cb(i,
+                           {static_cast<char*>(value.mv_data), value.mv_size});
+                    }
+                }
+            }
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+        }
+
+        return found;
+    }
     auto Queue(
         const Table table,
         const ReadView key,
@@ -434,6 +519,26 @@ struct LMDB::Imp {
             return false;
         }
     }
+    auto Size(const Table table) const noexcept -> std::size_t
+    {
+        try {
+            auto tx = TransactionRO();
+            auto stat = MDB_stat{};
+
+            if (const auto rc = ::mdb_stat(tx, db_.at(table), &stat); 0 != rc) {
+                throw std::runtime_error{::mdb_strerror(rc)};
+            }
+
+            const auto pages = stat.ms_branch_pages + stat.ms_leaf_pages +
+                               stat.ms_overflow_pages;
+
+            return pages * stat.ms_psize;
+        } catch (const std::exception& e) {
+            LogTrace()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return 0;
+        }
+    }
     auto Store(
         const Table table,
         const ReadView index,
@@ -821,6 +926,42 @@ auto LMDB::Load(
         mode);
 }
 
+auto LMDB::LoadBatch(
+    const Table table,
+    const Vector<ReadView>& keys,
+    const BatchCallback cb,
+    const Mode mode) const noexcept -> std::size_t
+{
+    return imp_->LoadBatch(table, keys, cb, mode);
+}
+
+auto LMDB::LoadBatch(
+    const Table table,
+    const Vector<ReadView>& keys,
+    const BatchCallback cb,
+    Transaction& tx,
+    const Mode mode) const noexcept -> std::size_t
+{
+    return imp_->LoadBatch(table, keys, cb, mode, tx);
+}
+
+auto LMDB::LoadBatch(
+    const Table table,
+    const Vector<ReadView>& keys,
+    Vector<Space>& output) const noexcept -> std::size_t
+{
+    output.clear();
+    output.resize(keys.size());
+
+    return imp_->LoadBatch(
+        table,
+        keys,
+        [&](const auto index, const auto data) {
+            output[index] = space(data);
+        },
+        Mode::One);
+}
+
 auto LMDB::Queue(
     const Table table,
     const ReadView key,
@@ -876,6 +1017,11 @@ auto LMDB::ReadFrom(
         dir);
 }
 
+auto LMDB::Size(const Table table) const noexcept -> std::size_t
+{
+    return imp_->Size(table);
+}
+
 auto LMDB::Store(
     const Table table,
     const ReadView index,
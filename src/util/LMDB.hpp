@@ -27,6 +27,8 @@ using MDB_dbi = unsigned int;
 
 namespace opentxs::storage::lmdb
 {
+using BatchCallback =
+    std::function<void(const std::size_t index, const ReadView data)>;
 using Callback = std::function<void(const ReadView data)>;
 using Flags = unsigned int;
 using ReadCallback =
@@ -115,6 +117,27 @@ public:
         const std::size_t key,
         const Callback cb,
         const Mode mode = Mode::One) const noexcept -> bool;
+    // Load the values for every key from a single transaction and cursor.
+    // Keys are visited in sorted order rather than the order supplied. The
+    // callback receives the position of the key in the keys argument. Returns
+    // the number of keys which were found.
+    auto LoadBatch(
+        const Table table,
+        const Vector<ReadView>& keys,
+        const BatchCallback cb,
+        const Mode mode = Mode::One) const noexcept -> std::size_t;
+    auto LoadBatch(
+        const Table table,
+        const Vector<ReadView>& keys,
+        const BatchCallback cb,
+        Transaction& tx,
+        const Mode mode = Mode::One) const noexcept -> std::size_t;
+    // The first value for each key is copied into the corresponding element
+    // of output. Elements for missing keys are left empty.
+    auto LoadBatch(
+        const Table table,
+        const Vector<ReadView>& keys,
+        Vector<Space>& output) const noexcept -> std::size_t;
     auto Queue(
         const Table table,
         const ReadView key,
@@ -142,6 +165,8 @@ public:
         const std::size_t key,
         const ReadCallback cb,
         const Dir dir) const noexcept -> bool;
+    // Number of bytes occupied by the pages of a table
+    auto Size(const Table table) const noexcept -> std::size_t;
     auto Store(
         const Table table,
         const ReadView key,
@@ -11,7 +11,9 @@
 #include <boost/iostreams/device/mapped_file.hpp>
 #include <algorithm>
 #include <cstring>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 
@@ -47,16 +49,205 @@ constexpr auto get_start_position(const std::size_t file) noexcept
     return file * mapped_file_size();
 }
 
+// NOTE free extents are grouped by the position of their most significant bit
+constexpr auto get_size_class(std::size_t bytes) noexcept -> std::size_t
+{
+    auto output = 0_uz;
+
+    while (1_uz < bytes) {
+        bytes >>= 1_uz;
+        ++output;
+    }
+
+    return output;
+}
+
+// NOTE the smallest size class whose extents are all at least this large
+constexpr auto get_fit_class(std::size_t bytes) noexcept -> std::size_t
+{
+    const auto exact = (0_uz == (bytes & (bytes - 1_uz)));
+
+    return get_size_class(bytes) + (exact ? 0_uz : 1_uz);
+}
+
 struct MappedFileStorage::Imp {
     using FileCounter = std::size_t;
+    using Positions = UnallocatedSet<IndexData::MemoryPosition>;
+    using Region = std::size_t;
+
+    struct FreeExtent {
+        std::size_t state_{};
+        IndexData extent_{};
+    };
+    struct CompactState {
+        Region region_{};
+        IndexData::MemoryPosition next_{};
+    };
+    struct Item {
+        int table_{};
+        Space key_{};
+        IndexData index_{};
+    };
+
+    // NOTE remainders smaller than this are not worth tracking
+    static constexpr auto min_extent_ = 64_uz;
+    static constexpr auto size_classes_ =
+        std::numeric_limits<std::size_t>::digits;
+    // NOTE reusable extents sort before quarantined extents in each size class
+    // since duplicate values are ordered by memcmp
+    static constexpr auto reusable_ = 0_uz;
+    // NOTE extents released during this session may still be referenced by
+    // outstanding views so they are not reused or discarded until restart
+    static constexpr auto quarantined_ = 1_uz;
+    // NOTE extents reused during this session may still be being written
+    static constexpr auto fresh_key_ = size_classes_;
+    static constexpr auto compact_key_ = size_classes_ + 1_uz;
+    static constexpr auto compacted_key_ = size_classes_ + 2_uz;
+    static constexpr auto compact_batch_ = 256_uz;
 
     LMDB& lmdb_;
     const UnallocatedCString path_prefix_;
     const UnallocatedCString filename_prefix_;
     const int table_;
     const std::size_t key_;
+    const MappedFileParams params_;
+    mutable AccessPattern pattern_;
     mutable IndexData::MemoryPosition next_position_;
     mutable UnallocatedVector<boost::iostreams::mapped_file> files_;
+    // NOTE each pin holds a copy of the segment which shares the mapping
+    mutable UnallocatedVector<Pin> pins_;
+    const IndexData::MemoryPosition session_start_;
+    const std::size_t region_size_;
+    // NOTE the items in the region being compacted, sorted by position
+    mutable std::optional<std::pair<Region, UnallocatedVector<Item>>> scanned_;
+
+    auto add_free(
+        LMDB::Transaction& tx,
+        const IndexData& extent,
+        bool quarantine) noexcept -> bool
+    {
+        if (false == params_.free_table_.has_value()) { return true; }
+
+        if (min_extent_ > extent.size_) { return true; }
+
+        const auto table = params_.free_table_.value();
+        const auto sizeClass = get_size_class(extent.size_);
+        const auto value =
+            FreeExtent{quarantine ? quarantined_ : reusable_, extent};
+        const auto result = lmdb_.Store(table, tsv(sizeClass), tsv(value), tx);
+
+        if (false == result.first) {
+            LogError()(OT_PRETTY_CLASS())("Failed to record free extent")
+                .Flush();
+
+            return false;
+        }
+
+        if (quarantine) {
+            // NOTE a compacted region must be considered again once space
+            // inside it is released
+            const auto region = get_region(extent.position_);
+            lmdb_.Delete(table, tsv(compacted_key_), tsv(region), tx);
+        }
+
+        return true;
+    }
+    auto allocate(
+        LMDB::Transaction& tx,
+        std::size_t bytes,
+        std::optional<Region> exclude = std::nullopt) noexcept
+        -> std::optional<IndexData>
+    {
+        if (false == params_.free_table_.has_value()) { return std::nullopt; }
+
+        const auto table = params_.free_table_.value();
+
+        // NOTE every extent in these size classes is large enough so only the
+        // first extent of each class must be examined
+        for (auto c = get_fit_class(bytes); c < size_classes_; ++c) {
+            auto found = std::optional<FreeExtent>{};
+            auto cb = [&](const ReadView in) {
+                if (sizeof(FreeExtent) != in.size()) { return; }
+
+                auto& value = found.emplace();
+                std::memcpy(static_cast<void*>(&value), in.data(), in.size());
+            };
+            lmdb_.Load(table, tsv(c), cb, tx, LMDB::Mode::One);
+
+            if (false == found.has_value()) { continue; }
+
+            const auto& [state, extent] = found.value();
+
+            if ((reusable_ != state) || (bytes > extent.size_)) { continue; }
+
+            if (exclude.has_value() &&
+                (get_region(extent.position_) == exclude.value())) {
+                continue;
+            }
+
+            if (false == lmdb_.Delete(table, tsv(c), tsv(found.value()), tx)) {
+                LogError()(OT_PRETTY_CLASS())("Failed to claim free extent")
+                    .Flush();
+
+                return std::nullopt;
+            }
+
+            const auto remainder = IndexData{
+                extent.position_ + bytes, extent.size_ - bytes};
+
+            if (false == add_free(tx, remainder, false)) {
+
+                return std::nullopt;
+            }
+
+            const auto out = IndexData{extent.position_, bytes};
+            const auto result =
+                lmdb_.Store(table, tsv(fresh_key_), tsv(out), tx);
+
+            if (false == result.first) {
+                LogError()(OT_PRETTY_CLASS())("Failed to record reused extent")
+                    .Flush();
+
+                return std::nullopt;
+            }
+
+            LogDebug()(OT_PRETTY_CLASS())("Reusing free extent at position ")(
+                extent.position_)
+                .Flush();
+
+            return out;
+        }
+
+        return std::nullopt;
+    }
+    auto append(
+        LMDB::Transaction& tx,
+        IndexData& index,
+        std::size_t bytes) noexcept -> bool
+    {
+        const auto start = next_position_;
+        increment_index(index, bytes);
+        LogDebug()(OT_PRETTY_CLASS())("Storing new item at position ")(
+            index.position_)
+            .Flush();
+
+        if (start != index.position_) {
+            // NOTE the unused tail of the previous file
+            const auto gap = IndexData{start, index.position_ - start};
+
+            if (false == add_free(tx, gap, false)) { return false; }
+        }
+
+        if (false == update_next_position(index.position_ + bytes, tx)) {
+            LogError()(OT_PRETTY_CLASS())(
+                "Failed to update next write position")
+                .Flush();
+
+            return false;
+        }
+
+        return true;
+    }
 
     auto calculate_file_name(
         const UnallocatedCString& prefix,
@@ -78,6 +269,123 @@ struct MappedFileStorage::Imp {
             create_or_load(path_prefix_, files_.size(), files_);
         }
     }
+    auto compact(
+        LMDB::Transaction& tx,
+        const UnallocatedVector<int>& tables) noexcept -> bool
+    {
+        if (false == params_.free_table_.has_value()) { return false; }
+
+        const auto table = params_.free_table_.value();
+        auto state = load_compact_state(tx);
+
+        if (false == state.has_value()) {
+            // NOTE prefer the region already read by compact_scan()
+            const auto region = scanned_.has_value()
+                                    ? std::make_optional(scanned_->first)
+                                    : select_region(tx);
+
+            if (false == region.has_value()) {
+                LogTrace()(OT_PRETTY_CLASS())("no region needs compaction")
+                    .Flush();
+
+                return false;
+            }
+
+            state = CompactState{region.value(), get_region_start(*region)};
+            LogVerbose()(OT_PRETTY_CLASS())("compacting region ")(*region)
+                .Flush();
+        }
+
+        const auto& [region, next] = state.value();
+        const auto& items = scan_region(tx, tables, region);
+        const auto fresh = load_fresh(tx);
+        auto i = std::lower_bound(
+            items.begin(), items.end(), next, [](const auto& item, auto pos) {
+                return item.index_.position_ < pos;
+            });
+        auto moved = 0_uz;
+
+        for (; (items.end() != i) && (compact_batch_ > moved); ++i) {
+            const auto& [source, key, from] = *i;
+
+            if (0_uz < fresh.count(from.position_)) { continue; }
+
+            // NOTE the item may have been replaced since the region was scanned
+            if (false == is_current(tx, source, key, from)) { continue; }
+
+            auto to = IndexData{};
+
+            if (auto reused = allocate(tx, from.size_, region);
+                reused.has_value()) {
+                to = reused.value();
+            } else if (false == append(tx, to, from.size_)) {
+
+                return false;
+            }
+
+            std::memcpy(
+                write_view(to).data(), read_view(from).data(), from.size_);
+            const auto result = lmdb_.Store(source, reader(key), tsv(to), tx);
+
+            if (false == result.first) {
+                LogError()(OT_PRETTY_CLASS())("Failed to update index").Flush();
+
+                return false;
+            }
+
+            if (false == release(tx, from)) { return false; }
+
+            ++moved;
+        }
+
+        LogTrace()(OT_PRETTY_CLASS())("moved ")(moved)(" items out of region ")(
+            region)
+            .Flush();
+        lmdb_.Delete(table, tsv(compact_key_), tx);
+
+        if (items.end() == i) {
+            LogVerbose()(OT_PRETTY_CLASS())("finished compacting region ")(
+                region)
+                .Flush();
+            scanned_.reset();
+            const auto result =
+                lmdb_.Store(table, tsv(compacted_key_), tsv(region), tx);
+
+            return result.first;
+        }
+
+        const auto progress = CompactState{region, i->index_.position_};
+        const auto result =
+            lmdb_.Store(table, tsv(compact_key_), tsv(progress), tx);
+
+        return result.first;
+    }
+    auto compact_scan(const UnallocatedVector<int>& tables) noexcept -> bool
+    {
+        if (false == params_.free_table_.has_value()) { return false; }
+
+        try {
+            auto tx = lmdb_.TransactionRO();
+            const auto region = [&]() -> std::optional<Region> {
+                if (auto state = load_compact_state(tx); state.has_value()) {
+
+                    return state->region_;
+                }
+
+                return select_region(tx);
+            }();
+
+            if (false == region.has_value()) { return false; }
+
+            scan_region(tx, tables, region.value());
+
+            return true;
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return false;
+        }
+    }
     auto create_or_load(
         const UnallocatedCString& prefix,
         const FileCounter file,
@@ -87,6 +395,11 @@ struct MappedFileStorage::Imp {
         auto params = boost::iostreams::mapped_file_params{
             calculate_file_name(prefix, file)};
         params.flags = boost::iostreams::mapped_file::readwrite;
+
+        if (params_.hugepages_) {
+            params.hint = HugepageAlignedHint(mapped_file_size());
+        }
+
         const auto& path = params.path;
         LogTrace()(OT_PRETTY_CLASS())("initializing file ")(path).Flush();
 
@@ -113,19 +426,38 @@ struct MappedFileStorage::Imp {
             .Flush();
 
         try {
-            output.emplace_back(params);
+            const auto& segment = output.emplace_back(params);
+            AdviseMappedRegion(segment.const_data(), segment.size(), pattern_);
+
+            if (params_.hugepages_) {
+                EnableHugepages(segment.const_data(), segment.size());
+            }
         } catch (const std::exception& e) {
             LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
 
             OT_FAIL;
         }
     }
-    auto get_read_view(const IndexData& index) noexcept -> ReadView
+    auto get_pinned_view(const IndexData& index) noexcept
+        -> std::pair<ReadView, Pin>
     {
-        const auto [file, offset] = get_offset(index.position_);
-        check_file(file);
+        const auto view = read_view(index);
+        const auto file = get_offset(index.position_).first;
 
-        return ReadView{files_.at(file).const_data() + offset, index.size_};
+        if (pins_.size() <= file) { pins_.resize(file + 1_uz); }
+
+        auto& pin = pins_[file];
+
+        if (false == bool(pin)) {
+            using Segment = boost::iostreams::mapped_file;
+            pin = std::make_shared<const Segment>(files_.at(file));
+        }
+
+        return std::make_pair(view, pin);
+    }
+    auto get_read_view(const IndexData& index) noexcept -> ReadView
+    {
+        return read_view(index);
     }
     auto get_write_view(
         LMDB::Transaction& tx,
@@ -136,36 +468,40 @@ struct MappedFileStorage::Imp {
         if (0 == bytes) { return {}; }
 
         const auto replace = bytes == index.size_;
-        const auto output = [&] {
-            const auto [file, offset] = get_offset(index.position_);
-            check_file(file);
-
-            return WritableView{files_.at(file).data() + offset, index.size_};
-        };
 
         if (replace) {
             LogVerbose()(OT_PRETTY_CLASS())("Replacing existing item").Flush();
 
-            return output();
+            return write_view(index);
         }
 
-        increment_index(index, bytes);
-        LogDebug()(OT_PRETTY_CLASS())("Storing new item at position ")(
-            index.position_)
-            .Flush();
-        const auto nextPosition = index.position_ + bytes;
+        const auto previous = index;
+
+        if (auto reused = allocate(tx, bytes); reused.has_value()) {
+            index = reused.value();
+        } else if (false == append(tx, index, bytes)) {
+
+            return {};
+        }
 
         if (cb && (false == cb(tx))) { return {}; }
 
-        if (false == update_next_position(nextPosition, tx)) {
-            LogError()(OT_PRETTY_CLASS())(
-                "Failed to update next write position")
-                .Flush();
+        if ((0_uz < previous.size_) && (false == release(tx, previous))) {
 
             return {};
         }
 
-        return output();
+        return write_view(index);
+    }
+    auto get_region(IndexData::MemoryPosition position) const noexcept
+        -> Region
+    {
+        return position / region_size_;
+    }
+    auto get_region_start(Region region) const noexcept
+        -> IndexData::MemoryPosition
+    {
+        return region * region_size_;
     }
     auto increment_index(IndexData& index, std::size_t bytes) noexcept -> void
     {
@@ -200,6 +536,81 @@ struct MappedFileStorage::Imp {
 
         return output;
     }
+    auto prefetch() const noexcept -> void
+    {
+        // NOTE segments are sparse and much larger than the data they hold so
+        // only the written range immediately before the write position is
+        // faulted in
+        const auto bytes = std::min(params_.prefetch_, next_position_);
+
+        if (0_uz == bytes) { return; }
+
+        auto position = next_position_ - bytes;
+
+        while (position < next_position_) {
+            const auto [file, offset] = get_offset(position);
+            const auto end =
+                std::min(next_position_, get_start_position(file + 1_uz));
+            const auto& segment = files_.at(file);
+            LogTrace()(OT_PRETTY_CLASS())("prefetching ")(end - position)(
+                " bytes of segment ")(file)
+                .Flush();
+            PrefetchMappedRegion(segment.const_data() + offset, end - position);
+            position = end;
+        }
+    }
+    auto is_current(
+        LMDB::Transaction& tx,
+        int table,
+        const Space& key,
+        const IndexData& expected) noexcept -> bool
+    {
+        auto out{false};
+        auto cb = [&](const ReadView in) {
+            if (sizeof(IndexData) != in.size()) { return; }
+
+            auto index = IndexData{};
+            std::memcpy(static_cast<void*>(&index), in.data(), in.size());
+            out = (index.position_ == expected.position_) &&
+                  (index.size_ == expected.size_);
+        };
+        lmdb_.Load(table, reader(key), cb, tx);
+
+        return out;
+    }
+    auto load_compact_state(LMDB::Transaction& tx) noexcept
+        -> std::optional<CompactState>
+    {
+        auto out = std::optional<CompactState>{};
+        auto cb = [&](const ReadView in) {
+            if (sizeof(CompactState) != in.size()) { return; }
+
+            auto& state = out.emplace();
+            std::memcpy(static_cast<void*>(&state), in.data(), in.size());
+        };
+        lmdb_.Load(params_.free_table_.value(), tsv(compact_key_), cb, tx);
+
+        return out;
+    }
+    auto load_fresh(LMDB::Transaction& tx) noexcept -> Positions
+    {
+        auto out = Positions{};
+        auto cb = [&](const ReadView in) {
+            if (sizeof(IndexData) != in.size()) { return; }
+
+            auto index = IndexData{};
+            std::memcpy(static_cast<void*>(&index), in.data(), in.size());
+            out.emplace(index.position_);
+        };
+        lmdb_.Load(
+            params_.free_table_.value(),
+            tsv(fresh_key_),
+            cb,
+            tx,
+            LMDB::Mode::Multiple);
+
+        return out;
+    }
     auto load_position(opentxs::storage::lmdb::LMDB& db) noexcept
         -> IndexData::MemoryPosition
     {
@@ -238,19 +649,218 @@ struct MappedFileStorage::Imp {
 
         return true;
     }
+    auto recycle_free() noexcept -> void
+    {
+        if (false == params_.free_table_.has_value()) { return; }
+
+        // NOTE every extent released in a previous session can no longer be
+        // referenced so it is returned to the filesystem and made reusable
+        const auto table = params_.free_table_.value();
+        auto released = UnallocatedVector<std::pair<std::size_t, FreeExtent>>{};
+        auto stale = UnallocatedVector<std::pair<std::size_t, Space>>{};
+        auto cb = [&](const ReadView key, const ReadView value) {
+            auto sizeClass = std::size_t{};
+
+            if (sizeof(sizeClass) != key.size()) { return true; }
+
+            std::memcpy(&sizeClass, key.data(), key.size());
+
+            if (fresh_key_ == sizeClass) {
+                stale.emplace_back(sizeClass, space(value));
+            } else if (size_classes_ > sizeClass) {
+                if (sizeof(FreeExtent) != value.size()) {
+                    stale.emplace_back(sizeClass, space(value));
+
+                    return true;
+                }
+
+                auto extent = FreeExtent{};
+                std::memcpy(
+                    static_cast<void*>(&extent), value.data(), value.size());
+
+                if (quarantined_ == extent.state_) {
+                    released.emplace_back(sizeClass, extent);
+                }
+            }
+
+            return true;
+        };
+        auto tx = lmdb_.TransactionRW();
+        lmdb_.Read(table, cb, LMDB::Dir::Forward, tx);
+
+        for (const auto& [sizeClass, value] : stale) {
+            lmdb_.Delete(table, tsv(sizeClass), reader(value), tx);
+        }
+
+        for (auto& [sizeClass, value] : released) {
+            const auto view = read_view(value.extent_);
+            ReleaseMappedRegion(view.data(), view.size());
+            lmdb_.Delete(table, tsv(sizeClass), tsv(value), tx);
+            value.state_ = reusable_;
+            lmdb_.Store(table, tsv(sizeClass), tsv(value), tx);
+        }
+
+        if (false == tx.Finalize(true)) {
+            LogError()(OT_PRETTY_CLASS())("Failed to recycle free extents")
+                .Flush();
+
+            return;
+        }
+
+        LogTrace()(OT_PRETTY_CLASS())("recycled ")(released.size())(
+            " free extents")
+            .Flush();
+    }
+    auto read_view(const IndexData& index) noexcept -> ReadView
+    {
+        const auto [file, offset] = get_offset(index.position_);
+        check_file(file);
+
+        return ReadView{files_.at(file).const_data() + offset, index.size_};
+    }
+    auto release(LMDB::Transaction& tx, const IndexData& index) noexcept
+        -> bool
+    {
+        return add_free(tx, index, true);
+    }
+    auto scan_region(
+        LMDB::Transaction& tx,
+        const UnallocatedVector<int>& tables,
+        Region region) noexcept -> const UnallocatedVector<Item>&
+    {
+        if (scanned_.has_value() && (region == scanned_->first)) {
+
+            return scanned_->second;
+        }
+
+        auto& [id, items] = scanned_.emplace(region, UnallocatedVector<Item>{});
+
+        for (const auto table : tables) {
+            auto cb = [&](const ReadView key, const ReadView value) {
+                if (sizeof(IndexData) != value.size()) { return true; }
+
+                auto index = IndexData{};
+                std::memcpy(
+                    static_cast<void*>(&index), value.data(), value.size());
+
+                if ((0_uz < index.size_) &&
+                    (get_region(index.position_) == region)) {
+                    items.emplace_back(Item{table, space(key), index});
+                }
+
+                return true;
+            };
+
+            if (false == lmdb_.Read(table, cb, LMDB::Dir::Forward, tx)) {
+                LogError()(OT_PRETTY_CLASS())("Failed to read table ")(table)
+                    .Flush();
+            }
+        }
+
+        std::sort(items.begin(), items.end(), [](const auto& l, const auto& r) {
+            return l.index_.position_ < r.index_.position_;
+        });
+
+        return items;
+    }
+    auto select_region(LMDB::Transaction& tx) noexcept -> std::optional<Region>
+    {
+        const auto table = params_.free_table_.value();
+        auto compacted = UnallocatedSet<Region>{};
+        auto free = UnallocatedMap<Region, std::size_t>{};
+        auto cb = [&](const ReadView key, const ReadView value) {
+            auto sizeClass = std::size_t{};
+
+            if (sizeof(sizeClass) != key.size()) { return true; }
+
+            std::memcpy(&sizeClass, key.data(), key.size());
+
+            if (compacted_key_ == sizeClass) {
+                if (sizeof(Region) != value.size()) { return true; }
+
+                auto region = Region{};
+                std::memcpy(&region, value.data(), value.size());
+                compacted.emplace(region);
+            } else if (size_classes_ > sizeClass) {
+                if (sizeof(FreeExtent) != value.size()) { return true; }
+
+                auto entry = FreeExtent{};
+                std::memcpy(
+                    static_cast<void*>(&entry), value.data(), value.size());
+                const auto& extent = entry.extent_;
+                const auto end = extent.position_ + extent.size_;
+
+                // NOTE the unused tail of a segment was never written
+                if (0_uz == get_offset(end).second) { return true; }
+
+                free[get_region(extent.position_)] += extent.size_;
+            }
+
+            return true;
+        };
+        lmdb_.Read(table, cb, LMDB::Dir::Forward, tx);
+        auto output = std::optional<Region>{};
+        auto best = params_.compact_threshold_;
+
+        for (const auto& [region, bytes] : free) {
+            // NOTE regions written during this session are never compacted
+            if (get_region_start(region + 1_uz) > session_start_) { continue; }
+
+            if (0_uz < compacted.count(region)) { continue; }
+
+            const auto fraction = static_cast<double>(bytes) /
+                                  static_cast<double>(region_size_);
+
+            if (fraction >= best) {
+                output = region;
+                best = fraction;
+            }
+        }
+
+        return output;
+    }
+    auto set_access_pattern(AccessPattern pattern) noexcept -> AccessPattern
+    {
+        const auto previous = pattern_;
+
+        if (pattern == previous) { return previous; }
+
+        pattern_ = pattern;
+
+        for (const auto& segment : files_) {
+            AdviseMappedRegion(segment.const_data(), segment.size(), pattern_);
+        }
+
+        return previous;
+    }
+
+    auto write_view(const IndexData& index) noexcept -> WritableView
+    {
+        const auto [file, offset] = get_offset(index.position_);
+        check_file(file);
+
+        return WritableView{files_.at(file).data() + offset, index.size_};
+    }
 
     Imp(opentxs::storage::lmdb::LMDB& lmdb,
         const UnallocatedCString& basePath,
         const UnallocatedCString filenamePrefix,
         int table,
-        std::size_t key) noexcept(false)
+        std::size_t key,
+        MappedFileParams params) noexcept(false)
         : lmdb_(lmdb)
         , path_prefix_(basePath)
         , filename_prefix_(filenamePrefix)
         , table_(table)
         , key_(key)
+        , params_(params)
+        , pattern_(params_.pattern_)
         , next_position_(load_position(lmdb_))
         , files_(init_files(path_prefix_, next_position_))
+        , pins_()
+        , session_start_(next_position_)
+        , region_size_(std::max(params_.compact_region_, min_extent_))
+        , scanned_()
     {
         static_assert(1 == get_file_count(0));
         static_assert(1 == get_file_count(1));
@@ -276,6 +886,9 @@ struct MappedFileStorage::Imp {
 
             OT_ASSERT(files_.size() == (offset.first + 1));
         }
+
+        recycle_free();
+        prefetch();
     }
 };
 
@@ -284,14 +897,40 @@ MappedFileStorage::MappedFileStorage(
     const UnallocatedCString& basePath,
     const UnallocatedCString filenamePrefix,
     int table,
-    std::size_t key) noexcept(false)
+    std::size_t key,
+    MappedFileParams params) noexcept(false)
     : lmdb_(lmdb)
-    , imp_p_(std::make_unique<Imp>(lmdb, basePath, filenamePrefix, table, key))
+    , imp_p_(std::make_unique<Imp>(
+          lmdb,
+          basePath,
+          filenamePrefix,
+          table,
+          key,
+          params))
     , imp_(*imp_p_)
 {
     OT_ASSERT(imp_p_);
 }
 
+auto MappedFileStorage::compact(
+    LMDB::Transaction& tx,
+    const UnallocatedVector<int>& tables) const noexcept -> bool
+{
+    return imp_.compact(tx, tables);
+}
+
+auto MappedFileStorage::compact_scan(
+    const UnallocatedVector<int>& tables) const noexcept -> bool
+{
+    return imp_.compact_scan(tables);
+}
+
+auto MappedFileStorage::get_pinned_view(const IndexData& index) const noexcept
+    -> std::pair<ReadView, Pin>
+{
+    return imp_.get_pinned_view(index);
+}
+
 auto MappedFileStorage::get_read_view(const IndexData& index) const noexcept
     -> ReadView
 {
@@ -315,5 +954,17 @@ auto MappedFileStorage::get_write_view(
     return imp_.get_write_view(tx, index, {}, size);
 }
 
+auto MappedFileStorage::release(LMDB::Transaction& tx, const IndexData& index)
+    const noexcept -> bool
+{
+    return imp_.release(tx, index);
+}
+
+auto MappedFileStorage::set_access_pattern(AccessPattern pattern) const noexcept
+    -> AccessPattern
+{
+    return imp_.set_access_pattern(pattern);
+}
+
 MappedFileStorage::~MappedFileStorage() = default;
 }  // namespace opentxs::util
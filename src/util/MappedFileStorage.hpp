@@ -6,8 +6,11 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <utility>
 
 #include "opentxs/Version.hpp"
 #include "opentxs/util/Bytes.hpp"
@@ -25,23 +28,102 @@ struct IndexData {
     ItemSize size_{};
 };
 
+// Hint passed to the kernel describing how a segment will be accessed
+enum class AccessPattern : std::uint8_t {
+    normal = 0,
+    sequential = 1,
+    random = 2,
+};
+
+struct MappedFileParams {
+    // Applied to every segment when it is mapped
+    AccessPattern pattern_{AccessPattern::normal};
+    // Request transparent hugepages and try to map segments at hugepage
+    // aligned addresses
+    bool hugepages_{false};
+    // Number of bytes, counting back from the current write position, to
+    // fault into memory at startup. Nothing is prefetched by default.
+    std::size_t prefetch_{0};
+    // LMDB table (MDB_DUPSORT | MDB_INTEGERKEY) in which released extents and
+    // compaction progress are recorded. Space is never reclaimed if this is not
+    // set.
+    std::optional<int> free_table_{};
+    // Space is compacted one region of this many bytes at a time
+    std::size_t compact_region_{std::size_t{64} * 1024 * 1024};
+    // A region is compacted once at least this fraction of its bytes have been
+    // released
+    double compact_threshold_{0.5};
+};
+
+// Platform specific functions which operate on a mapped segment. Failures are
+// logged and otherwise ignored since these are only hints.
+auto AdviseMappedRegion(
+    const void* address,
+    std::size_t bytes,
+    AccessPattern pattern) noexcept -> void;
+auto EnableHugepages(const void* address, std::size_t bytes) noexcept -> void;
+// Returns an address suitable for use as a mapping hint which is aligned to
+// the hugepage size, or nullptr if no such address could be found
+auto HugepageAlignedHint(std::size_t bytes) noexcept -> const char*;
+auto PrefetchMappedRegion(const void* address, std::size_t bytes) noexcept
+    -> void;
+// Return the pages wholly contained in the region to the filesystem
+auto ReleaseMappedRegion(const void* address, std::size_t bytes) noexcept
+    -> void;
+
 class MappedFileStorage
 {
 protected:
     using LMDB = opentxs::storage::lmdb::LMDB;
     using UpdateCallback = std::function<bool(LMDB::Transaction&)>;
+    // Keeps the segment containing a view mapped for as long as it is held
+    using Pin = std::shared_ptr<const void>;
 
     LMDB& lmdb_;
 
     // NOTE: this class performs no locking. Inheritors must ensure these
     // functions are not called simultaneously from multiple threads.
+
+    // Move one batch of the items referenced by the supplied tables out of the
+    // region with the largest fraction of released space and update the
+    // references. The values in each table must be IndexData. Items not
+    // referenced by any of the tables are assumed to be dead.
+    //
+    // Progress is recorded in the transaction so the same batch is attempted
+    // again if it is aborted. Only regions written before this object was
+    // constructed are compacted.
+    //
+    // Returns false if no region needs to be compacted.
+    //
+    // The index tables are read inside tx unless compact_scan() already read
+    // the items in the region.
+    auto compact(LMDB::Transaction& tx, const UnallocatedVector<int>& tables)
+        const noexcept -> bool;
+    // Select the region the next call to compact() will work on and read the
+    // items referenced by the supplied tables in a read-only transaction, so
+    // that compact() only needs a short write transaction per batch. Must not
+    // be called while the calling thread has a transaction open, nor
+    // concurrently with compact(). Returns false if no region needs to be
+    // compacted.
+    auto compact_scan(const UnallocatedVector<int>& tables) const noexcept
+        -> bool;
     auto get_read_view(const IndexData& index) const noexcept -> ReadView;
+    // The returned view remains valid as long as the pin is held, even after
+    // this object has been destroyed. Pins are shared by every view of the
+    // same segment.
+    auto get_pinned_view(const IndexData& index) const noexcept
+        -> std::pair<ReadView, Pin>;
+    // Change the access pattern hint for all current and future segments. The
+    // previous value is returned so that callers can restore it.
+    auto set_access_pattern(AccessPattern pattern) const noexcept
+        -> AccessPattern;
     // Default construct an IndexData if you just want to append a new item, or
     // supply an existing IndexData if you want to (potentially) replace the
     // existing item. An existing item will be overwritten if the size of the
     // old items matches the size of the new item; to do otherwise would be
-    // madness. If the size doesn't match then space will be allocated at the
-    // end of the file and we just forget about the old data.
+    // madness. If the size doesn't match then space will be taken from a
+    // previously released extent if possible, otherwise allocated at the end of
+    // the file, and the old item will be released.
     //
     // Regardless after this function is called the supplied index will be
     // updated to the location at which the return value points so you should
@@ -57,13 +139,18 @@ protected:
         LMDB::Transaction& tx,
         IndexData& index,
         std::size_t size) const noexcept -> WritableView;
+    // Mark the space occupied by an item as free. The space will be available
+    // for reuse after the next restart.
+    auto release(LMDB::Transaction& tx, const IndexData& index) const noexcept
+        -> bool;
 
     MappedFileStorage(
         opentxs::storage::lmdb::LMDB& lmdb,
         const UnallocatedCString& basePath,
         const UnallocatedCString filenamePrefix,
         int table,
-        std::size_t key) noexcept(false);
+        std::size_t key,
+        MappedFileParams params = {}) noexcept(false);
 
     virtual ~MappedFileStorage();
 
@@ -35,6 +35,10 @@ namespace opentxs
 struct Options::Imp::Parser {
     using Multistring = UnallocatedVector<UnallocatedCString>;
 
+    static constexpr auto blockchain_block_cache_bytes_{
+        "blockchain_block_cache_bytes"};
+    static constexpr auto blockchain_cfilter_cache_bytes_{
+        "blockchain_cfilter_cache_bytes"};
     static constexpr auto blockchain_disable_{"disable_blockchain"};
     static constexpr auto blockchain_ipv4_bind_{"blockchain_bind_ipv4"};
     static constexpr auto blockchain_ipv6_bind_{"blockchain_bind_ipv6"};
@@ -60,6 +64,7 @@ struct Options::Imp::Parser {
     static constexpr auto notary_public_port_{"notary_command_port"};
     static constexpr auto notary_terms_{"notary_terms"};
     static constexpr auto storage_plugin_{"ot_storage_plugin"};
+    static constexpr auto zmq_work_stealing_{"zmq_work_stealing"};
 
     po::variables_map variables_;
 
@@ -68,6 +73,16 @@ struct Options::Imp::Parser {
         static const auto out = [] {
             auto out = po::options_description{"libopentxs options"};
 
+            out.add_options()(
+                blockchain_block_cache_bytes_,
+                po::value<std::size_t>(),
+                "Memory budget in bytes for each chain's in-memory block cache "
+                "(0 selects the default)");
+            out.add_options()(
+                blockchain_cfilter_cache_bytes_,
+                po::value<std::size_t>(),
+                "Memory budget in bytes for decoded cfilter elements shared "
+                "by all chains (0 disables the cache)");
             out.add_options()(
                 blockchain_disable_,
                 po::value<Multistring>()->multitoken()->composing(),
@@ -181,6 +196,11 @@ struct Options::Imp::Parser {
                 experimental_,
                 po::value<bool>()->implicit_value(false),
                 "Enable experimental opentxs features");
+            out.add_options()(
+                zmq_work_stealing_,
+                po::value<bool>()->implicit_value(true),
+                "Handle zeromq messages on a work stealing thread pool "
+                "instead of the thread which polls the socket");
 
             return out;
         }();
@@ -203,7 +223,9 @@ struct Options::Imp::Parser {
 };
 
 Options::Imp::Imp() noexcept
-    : blockchain_disabled_chains_()
+    : blockchain_block_cache_bytes_(std::nullopt)
+    , blockchain_cfilter_cache_bytes_(std::nullopt)
+    , blockchain_disabled_chains_()
     , blockchain_ipv4_bind_()
     , blockchain_ipv6_bind_()
     , blockchain_profile_(std::nullopt)
@@ -230,6 +252,7 @@ Options::Imp::Imp() noexcept
     , qt_root_object_(std::nullopt)
     , storage_primary_plugin_(std::nullopt)
     , test_mode_(std::nullopt)
+    , zmq_work_stealing_(std::nullopt)
 {
 }
 
@@ -301,7 +324,11 @@ auto Options::Imp::import_value(
     const auto sValue = UnallocatedCString{value};
 
     try {
-        if (0 == key.compare(Parser::blockchain_disable_)) {
+        if (0 == key.compare(Parser::blockchain_block_cache_bytes_)) {
+            blockchain_block_cache_bytes_ = std::stoull(sValue);
+        } else if (0 == key.compare(Parser::blockchain_cfilter_cache_bytes_)) {
+            blockchain_cfilter_cache_bytes_ = std::stoull(sValue);
+        } else if (0 == key.compare(Parser::blockchain_disable_)) {
             blockchain_disabled_chains_.emplace(convert(value));
         } else if (0 == key.compare(Parser::blockchain_ipv4_bind_)) {
             blockchain_ipv4_bind_.emplace(value);
@@ -374,6 +401,8 @@ auto Options::Imp::import_value(
             notary_terms_ = value;
         } else if (0 == key.compare(Parser::storage_plugin_)) {
             storage_primary_plugin_ = value;
+        } else if (0 == key.compare(Parser::zmq_work_stealing_)) {
+            zmq_work_stealing_ = to_bool(value);
         }
     } catch (...) {
     }
@@ -406,7 +435,17 @@ auto Options::Imp::parse(int argc, char** argv) noexcept(false) -> void
     }
 
     for (const auto& [name, value] : parser.variables_) {
-        if (name == Parser::blockchain_disable_) {
+        if (name == Parser::blockchain_block_cache_bytes_) {
+            try {
+                blockchain_block_cache_bytes_ = value.as<std::size_t>();
+            } catch (...) {
+            }
+        } else if (name == Parser::blockchain_cfilter_cache_bytes_) {
+            try {
+                blockchain_cfilter_cache_bytes_ = value.as<std::size_t>();
+            } catch (...) {
+            }
+        } else if (name == Parser::blockchain_disable_) {
             try {
                 const auto& chains = value.as<Parser::Multistring>();
 
@@ -587,6 +626,11 @@ auto Options::Imp::parse(int argc, char** argv) noexcept(false) -> void
                     value.as<UnallocatedCString>().c_str();
             } catch (...) {
             }
+        } else if (name == Parser::zmq_work_stealing_) {
+            try {
+                zmq_work_stealing_ = value.as<bool>();
+            } catch (...) {
+            }
         }
     }
 }
@@ -627,6 +671,14 @@ auto operator+(const Options& lhs, const Options& rhs) noexcept -> Options
     auto& l = *out.imp_;
     const auto& r = *rhs.imp_;
 
+    if (const auto& v = r.blockchain_block_cache_bytes_; v.has_value()) {
+        l.blockchain_block_cache_bytes_ = v.value();
+    }
+
+    if (const auto& v = r.blockchain_cfilter_cache_bytes_; v.has_value()) {
+        l.blockchain_cfilter_cache_bytes_ = v.value();
+    }
+
     std::copy(
         r.blockchain_disabled_chains_.begin(),
         r.blockchain_disabled_chains_.end(),
@@ -739,6 +791,10 @@ auto operator+(const Options& lhs, const Options& rhs) noexcept -> Options
         l.test_mode_ = v.value();
     }
 
+    if (const auto& v = r.zmq_work_stealing_; v.has_value()) {
+        l.zmq_work_stealing_ = v.value();
+    }
+
     return out;
 }
 
@@ -830,6 +886,16 @@ auto Options::BlockchainBindIpv6() const noexcept -> const Set<CString>&
     return imp_->blockchain_ipv6_bind_;
 }
 
+auto Options::BlockchainBlockCacheBytes() const noexcept -> std::size_t
+{
+    return Imp::get(imp_->blockchain_block_cache_bytes_);
+}
+
+auto Options::BlockchainCfilterCacheBytes() const noexcept -> std::size_t
+{
+    return Imp::get(imp_->blockchain_cfilter_cache_bytes_);
+}
+
 auto Options::BlockchainProfile() const noexcept -> opentxs::BlockchainProfile
 {
     return Imp::get(
@@ -982,6 +1048,22 @@ auto Options::RemoteLogEndpoint() const noexcept -> std::string_view
     return Imp::get(imp_->log_endpoint_);
 }
 
+auto Options::SetBlockchainBlockCacheBytes(std::size_t bytes) noexcept
+    -> Options&
+{
+    imp_->blockchain_block_cache_bytes_ = bytes;
+
+    return *this;
+}
+
+auto Options::SetBlockchainCfilterCacheBytes(std::size_t bytes) noexcept
+    -> Options&
+{
+    imp_->blockchain_cfilter_cache_bytes_ = bytes;
+
+    return *this;
+}
+
 auto Options::SetBlockchainProfile(opentxs::BlockchainProfile value) noexcept
     -> Options&
 {
@@ -1117,6 +1199,13 @@ auto Options::SetTestMode(bool test) noexcept -> Options&
     return *this;
 }
 
+auto Options::SetZMQWorkStealing(bool enabled) noexcept -> Options&
+{
+    imp_->zmq_work_stealing_ = enabled;
+
+    return *this;
+}
+
 auto Options::StoragePrimaryPlugin() const noexcept -> std::string_view
 {
     return Imp::get(imp_->storage_primary_plugin_);
@@ -1127,6 +1216,11 @@ auto Options::TestMode() const noexcept -> bool
     return Imp::get(imp_->test_mode_);
 }
 
+auto Options::ZMQWorkStealing() const noexcept -> bool
+{
+    return Imp::get(imp_->zmq_work_stealing_, false);
+}
+
 Options::~Options()
 {
     if (nullptr != imp_) {
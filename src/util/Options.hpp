@@ -23,6 +23,8 @@ namespace opentxs
 {
 // NOLINTBEGIN(clang-analyzer-optin.performance.Padding)
 struct Options::Imp final {
+    std::optional<std::size_t> blockchain_block_cache_bytes_;
+    std::optional<std::size_t> blockchain_cfilter_cache_bytes_;
     Set<blockchain::Type> blockchain_disabled_chains_;
     Set<CString> blockchain_ipv4_bind_;
     Set<CString> blockchain_ipv6_bind_;
@@ -50,6 +52,7 @@ struct Options::Imp final {
     std::optional<QObject*> qt_root_object_;
     std::optional<CString> storage_primary_plugin_;
     std::optional<bool> test_mode_;
+    std::optional<bool> zmq_work_stealing_;
 
     template <typename T>
     static auto get(const std::optional<T>& data, T defaultValue = {}) noexcept
@@ -3,15 +3,17 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
-#include "0_stdafx.hpp"               // IWYU pragma: associated
-#include "1_Internal.hpp"             // IWYU pragma: associated
-#include "api/Legacy.hpp"             // IWYU pragma: associated
-#include "api/context/Context.hpp"    // IWYU pragma: associated
-#include "core/String.hpp"            // IWYU pragma: associated
-#include "internal/util/Signals.hpp"  // IWYU pragma: associated
+#include "0_stdafx.hpp"                // IWYU pragma: associated
+#include "1_Internal.hpp"              // IWYU pragma: associated
+#include "api/Legacy.hpp"              // IWYU pragma: associated
+#include "api/context/Context.hpp"     // IWYU pragma: associated
+#include "core/String.hpp"             // IWYU pragma: associated
+#include "internal/util/Signals.hpp"   // IWYU pragma: associated
+#include "util/MappedFileStorage.hpp"  // IWYU pragma: associated
 
 extern "C" {
 #include <pwd.h>
+#include <sys/mman.h>
 #include <sys/resource.h>
 #include <unistd.h>
 #if __has_include(<wordexp.h>)
@@ -21,12 +23,14 @@ extern "C" {
 
 #include <cerrno>
 #include <csignal>
+#include <cstdint>
 #include <cstring>
 #include <utility>
 
 #include "internal/util/Flag.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/util/Log.hpp"
+#include "util/ByteLiterals.hpp"
 
 namespace opentxs
 {
@@ -250,3 +254,125 @@ auto Legacy::get_home_platform() noexcept -> UnallocatedCString
     return {};
 }
 }  // namespace opentxs::api::imp
+
+namespace opentxs::util
+{
+auto AdviseMappedRegion(
+    const void* address,
+    std::size_t bytes,
+    AccessPattern pattern) noexcept -> void
+{
+    if ((nullptr == address) || (0u == bytes)) { return; }
+
+    const auto advice = [&] {
+        switch (pattern) {
+            case AccessPattern::sequential: {
+
+                return POSIX_MADV_SEQUENTIAL;
+            }
+            case AccessPattern::random: {
+
+                return POSIX_MADV_RANDOM;
+            }
+            case AccessPattern::normal:
+            default: {
+
+                return POSIX_MADV_NORMAL;
+            }
+        }
+    }();
+    const auto rc = ::posix_madvise(const_cast<void*>(address), bytes, advice);
+
+    if (0 != rc) {
+        LogError()(__func__)(": posix_madvise failed: ")(std::strerror(rc))
+            .Flush();
+    }
+}
+
+auto EnableHugepages(const void* address, std::size_t bytes) noexcept -> void
+{
+#ifdef MADV_HUGEPAGE
+    if ((nullptr == address) || (0u == bytes)) { return; }
+
+    // NOTE the kernel may only honor this for file backed mappings on some
+    // filesystems. EINVAL means transparent hugepages are not available.
+    if (0 != ::madvise(const_cast<void*>(address), bytes, MADV_HUGEPAGE)) {
+        if (EINVAL != errno) {
+            LogError()(__func__)(": madvise failed: ")(std::strerror(errno))
+                .Flush();
+        }
+    }
+#endif
+}
+
+auto HugepageAlignedHint(std::size_t bytes) noexcept -> const char*
+{
+    static constexpr auto alignment = std::uintptr_t{2_MiB};
+    // NOTE reserve enough address space to guarantee an aligned start
+    // position, then release it so the real mapping can be placed there. The
+    // address is only used as a hint so losing a race with another mapping is
+    // harmless.
+    const auto reserve = bytes + alignment;
+    auto* region =
+        ::mmap(nullptr, reserve, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (MAP_FAILED == region) { return nullptr; }
+
+    ::munmap(region, reserve);
+    const auto start = reinterpret_cast<std::uintptr_t>(region);
+    const auto aligned = (start + alignment - 1u) & ~(alignment - 1u);
+
+    return reinterpret_cast<const char*>(aligned);
+}
+
+auto PrefetchMappedRegion(const void* address, std::size_t bytes) noexcept
+    -> void
+{
+    if ((nullptr == address) || (0u == bytes)) { return; }
+
+    static const auto page =
+        static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+    // NOTE madvise requires a page aligned start address
+    const auto begin = reinterpret_cast<std::uintptr_t>(address);
+    const auto first = begin & ~(page - 1u);
+    const auto length = static_cast<std::size_t>(begin + bytes - first);
+    auto* ptr = reinterpret_cast<void*>(first);
+#ifdef MADV_POPULATE_READ
+    // NOTE equivalent to MAP_POPULATE for a mapping which already exists
+    if (0 == ::madvise(ptr, length, MADV_POPULATE_READ)) { return; }
+#endif
+    const auto rc = ::posix_madvise(ptr, length, POSIX_MADV_WILLNEED);
+
+    if (0 != rc) {
+        LogError()(__func__)(": posix_madvise failed: ")(std::strerror(rc))
+            .Flush();
+    }
+}
+
+auto ReleaseMappedRegion(const void* address, std::size_t bytes) noexcept
+    -> void
+{
+#ifdef MADV_REMOVE
+    if ((nullptr == address) || (0u == bytes)) { return; }
+
+    static const auto page =
+        static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+    const auto begin = reinterpret_cast<std::uintptr_t>(address);
+    const auto first = (begin + page - 1u) & ~(page - 1u);
+    const auto last = (begin + bytes) & ~(page - 1u);
+
+    if (last <= first) { return; }
+
+    // NOTE punches a hole in the backing file. EOPNOTSUPP means the filesystem
+    // does not support sparse files.
+    auto* ptr = reinterpret_cast<void*>(first);
+
+    if (0 != ::madvise(ptr, last - first, MADV_REMOVE)) {
+        if (EOPNOTSUPP != errno) {
+            LogError()(__func__)(": madvise failed: ")(std::strerror(errno))
+                .Flush();
+        }
+    }
+#endif
+}
+}  // namespace opentxs::util
@@ -3,13 +3,14 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
-#include "0_stdafx.hpp"               // IWYU pragma: associated
-#include "1_Internal.hpp"             // IWYU pragma: associated
-#include "api/Legacy.hpp"             // IWYU pragma: associated
-#include "api/context/Context.hpp"    // IWYU pragma: associated
-#include "core/String.hpp"            // IWYU pragma: associated
-#include "internal/util/Signals.hpp"  // IWYU pragma: associated
-#include "util/Thread.hpp"            // IWYU pragma: associated
+#include "0_stdafx.hpp"                // IWYU pragma: associated
+#include "1_Internal.hpp"              // IWYU pragma: associated
+#include "api/Legacy.hpp"              // IWYU pragma: associated
+#include "api/context/Context.hpp"     // IWYU pragma: associated
+#include "core/String.hpp"             // IWYU pragma: associated
+#include "internal/util/Signals.hpp"   // IWYU pragma: associated
+#include "util/MappedFileStorage.hpp"  // IWYU pragma: associated
+#include "util/Thread.hpp"             // IWYU pragma: associated
 
 #include <Windows.h>  // IWYU pragma: associated
 
@@ -172,3 +173,32 @@ auto Legacy::prepend() noexcept -> UnallocatedCString { return {}; }
 
 auto Legacy::use_dot() noexcept -> bool { return false; }
 }  // namespace opentxs::api::imp
+
+namespace opentxs::util
+{
+auto AdviseMappedRegion(const void*, std::size_t, AccessPattern) noexcept
+    -> void
+{
+}
+
+auto EnableHugepages(const void*, std::size_t) noexcept -> void {}
+
+auto HugepageAlignedHint(std::size_t) noexcept -> const char*
+{
+    return nullptr;
+}
+
+auto PrefetchMappedRegion(const void* address, std::size_t bytes) noexcept
+    -> void
+{
+    if ((nullptr == address) || (0u == bytes)) { return; }
+
+    auto range = WIN32_MEMORY_RANGE_ENTRY{const_cast<void*>(address), bytes};
+
+    if (FALSE == PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0)) {
+        LogError()(__func__)(": PrefetchVirtualMemory failed").Flush();
+    }
+}
+
+auto ReleaseMappedRegion(const void*, std::size_t) noexcept -> void {}
+}  // namespace opentxs::util
@@ -55,6 +55,7 @@ namespace opentxs::storage::implementation
 class Plugin : virtual public storage::Plugin
 {
 public:
+    auto BucketSize(const bool bucket) const -> std::size_t override = 0;
     auto EmptyBucket(const bool bucket) const -> bool override = 0;
 
     auto Load(
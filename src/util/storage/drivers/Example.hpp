@@ -180,6 +180,15 @@ public:
         const bool bucket,
         std::promise<bool>& promise) const -> void override;
 
+    /** Measure the space occupied by the specified bucket
+     *
+     *  \param[in] bucket measure either the primary (true) or
+     *                    secondary (false) bucket
+     *  \returns the approximate number of bytes which would be released by
+     *           \ref EmptyBucket
+     */
+    auto BucketSize(const bool bucket) const -> std::size_t override;
+
     /** Completely erase the contents of the specified bucket
      *
      *  \param[in] bucket empty either the primary (true) or
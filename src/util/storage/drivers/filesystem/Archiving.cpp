@@ -111,6 +111,9 @@ void Archiving::Cleanup_Archiving()
     // future cleanup actions go here
 }
 
+// NOTE archived objects are never deleted so no space is ever reclaimed
+auto Archiving::BucketSize(const bool) const -> std::size_t { return 0; }
+
 auto Archiving::EmptyBucket(const bool) const -> bool { return true; }
 
 void Archiving::Init_Archiving()
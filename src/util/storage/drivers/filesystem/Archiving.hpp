@@ -58,6 +58,7 @@ private:
     using ot_super = Common;
 
 public:
+    auto BucketSize(const bool bucket) const -> std::size_t final;
     auto EmptyBucket(const bool bucket) const -> bool final;
 
     void Cleanup() final;
@@ -54,6 +54,25 @@ auto GarbageCollected::bucket_name(const bool bucket) const
     return bucket ? config_.fs_secondary_bucket_ : config_.fs_primary_bucket_;
 }
 
+auto GarbageCollected::BucketSize(const bool bucket) const -> std::size_t
+{
+    auto directory = UnallocatedCString{};
+    calculate_path("", bucket, directory);
+    using Iterator = boost::filesystem::recursive_directory_iterator;
+    auto ec = boost::system::error_code{};
+    auto output = std::size_t{0};
+
+    for (auto i = Iterator{directory, ec}; i != Iterator{}; i.increment(ec)) {
+        if (ec) { break; }
+
+        if (boost::filesystem::is_regular_file(i->status())) {
+            output += boost::filesystem::file_size(i->path(), ec);
+        }
+    }
+
+    return output;
+}
+
 auto GarbageCollected::calculate_path(
     const UnallocatedCString& key,
     const bool bucket,
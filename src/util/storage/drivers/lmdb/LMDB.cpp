@@ -63,6 +63,11 @@ void LMDB::Cleanup() { Cleanup_LMDB(); }
 
 void LMDB::Cleanup_LMDB() {}
 
+auto LMDB::BucketSize(const bool bucket) const -> std::size_t
+{
+    return lmdb_.Size(get_table(bucket));
+}
+
 auto LMDB::EmptyBucket(const bool bucket) const -> bool
 {
     return lmdb_.Delete(get_table(bucket));
@@ -52,6 +52,7 @@ class LMDB final : public virtual implementation::Plugin,
                    public virtual storage::Driver
 {
 public:
+    auto BucketSize(const bool bucket) const -> std::size_t final;
     auto EmptyBucket(const bool bucket) const -> bool final;
     auto LoadFromBucket(
         const UnallocatedCString& key,
@@ -44,6 +44,19 @@ MemDB::MemDB(
 {
 }
 
+auto MemDB::BucketSize(const bool bucket) const -> std::size_t
+{
+    sLock lock(shared_lock_);
+    const auto& map = bucket ? a_ : b_;
+    auto output = std::size_t{0};
+
+    for (const auto& [key, value] : map) {
+        output += key.size() + value.size();
+    }
+
+    return output;
+}
+
 auto MemDB::EmptyBucket(const bool bucket) const -> bool
 {
     eLock lock(shared_lock_);
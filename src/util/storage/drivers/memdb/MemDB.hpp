@@ -52,6 +52,7 @@ class MemDB final : public implementation::Plugin,
                     Lockable
 {
 public:
+    auto BucketSize(const bool bucket) const -> std::size_t final;
     auto EmptyBucket(const bool bucket) const -> bool final;
     auto LoadFromBucket(
         const UnallocatedCString& key,
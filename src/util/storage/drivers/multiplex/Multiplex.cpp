@@ -132,6 +132,13 @@ void Multiplex::Cleanup() { Cleanup_Multiplex(); }
 
 void Multiplex::Cleanup_Multiplex() {}
 
+auto Multiplex::BucketSize(const bool bucket) const -> std::size_t
+{
+    OT_ASSERT(primary_plugin_);
+
+    return primary_plugin_->BucketSize(bucket);
+}
+
 auto Multiplex::EmptyBucket(const bool bucket) const -> bool
 {
     OT_ASSERT(primary_plugin_);
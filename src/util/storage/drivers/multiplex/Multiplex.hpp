@@ -54,6 +54,7 @@ namespace opentxs::storage::driver
 class Multiplex final : virtual public internal::Multiplex
 {
 public:
+    auto BucketSize(const bool bucket) const -> std::size_t final;
     auto EmptyBucket(const bool bucket) const -> bool final;
     auto LoadFromBucket(
         const UnallocatedCString& key,
@@ -110,6 +110,23 @@ auto Sqlite3::Create(const UnallocatedCString& tablename) const -> bool
         SQLITE_OK == sqlite3_exec(db_, sql.c_str(), nullptr, nullptr, nullptr));
 }
 
+auto Sqlite3::BucketSize(const bool bucket) const -> std::size_t
+{
+    sqlite3_stmt* statement{nullptr};
+    const UnallocatedCString sql = "SELECT SUM(LENGTH(k) + LENGTH(v)) FROM '" +
+                                   GetTableName(bucket) + "';";
+    sqlite3_prepare_v2(db_, sql.c_str(), -1, &statement, nullptr);
+    auto output = std::size_t{0};
+
+    if (SQLITE_ROW == sqlite3_step(statement)) {
+        output = static_cast<std::size_t>(sqlite3_column_int64(statement, 0));
+    }
+
+    sqlite3_finalize(statement);
+
+    return output;
+}
+
 auto Sqlite3::EmptyBucket(const bool bucket) const -> bool
 {
     return Purge(GetTableName(bucket));
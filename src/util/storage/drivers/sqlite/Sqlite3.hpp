@@ -58,6 +58,7 @@ class Sqlite3 final : public virtual implementation::Plugin,
                       public virtual storage::Driver
 {
 public:
+    auto BucketSize(const bool bucket) const -> std::size_t final;
     auto EmptyBucket(const bool bucket) const -> bool final;
     auto LoadFromBucket(
         const UnallocatedCString& key,
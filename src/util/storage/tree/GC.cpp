@@ -7,7 +7,13 @@
 #include "1_Internal.hpp"              // IWYU pragma: associated
 #include "util/storage/tree/Root.hpp"  // IWYU pragma: associated
 
+#include <atomic>
+#include <chrono>
 #include <ctime>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
 #include <utility>
 
 #include "internal/api/network/Asio.hpp"
@@ -18,6 +24,7 @@
 #include "serialization/protobuf/StorageRoot.pb.h"
 #include "util/ScopeGuard.hpp"
 #include "util/storage/tree/Node.hpp"
+#include "util/storage/tree/Slicer.hpp"
 #include "util/storage/tree/Tree.hpp"
 
 namespace opentxs::storage
@@ -38,6 +45,12 @@ Root::GC::GC(
     , last_(static_cast<std::int64_t>(std::time(nullptr)))
     , promise_()
     , future_(promise_.get_future())
+    , progress_()
+    , from_(false)
+    , to_(nullptr)
+    , done_()
+    , start_()
+    , slicer_()
 {
     promise_.set_value(true);
 }
@@ -87,23 +100,63 @@ auto Root::GC::Check(const UnallocatedCString root) noexcept -> CheckState
     }
 }
 
-auto Root::GC::collect_garbage(
-    const bool from,
-    const Driver* to,
-    const SimpleCallback done) noexcept -> void
+auto Root::GC::collect_garbage() noexcept -> void
 {
     LogVerbose()(OT_PRETTY_CLASS())("Beginning garbage collection.").Flush();
-    auto success{false};
-    auto postcondition = ScopeGuard{[&] { promise_.set_value(success); }};
-    auto temp = storage::Tree{factory_, driver_, root_};
-    success = temp.Migrate(*to);
+    progress_.Reset();
+    start_ = std::chrono::steady_clock::now();
+    slicer_ = std::make_unique<gc::Slicer>(driver_, from_, progress_);
+    // NOTE the walk only loads the index nodes of the tree. Every object it
+    // reaches is recorded by the slicer and copied later in slices.
+    const auto marked = storage::Tree{factory_, *slicer_, root_}.Migrate(*to_);
+
+    if (false == marked) {
+        finish(false);
+
+        return;
+    }
+
+    copy();
+}
+
+auto Root::GC::copy() noexcept -> void
+{
+    const auto done = slicer_->Copy(*to_, slice_);
+
+    if (done.has_value()) {
+        finish(done.value());
+
+        return;
+    }
 
+    // NOTE each slice is a separate task so that the thread pool is free to
+    // run storage writers between slices
+    ++progress_.slices_;
+    post(&GC::copy);
+}
+
+auto Root::GC::finish(bool success) noexcept -> void
+{
     if (success) {
-        driver_.EmptyBucket(from);
+        slicer_->Reclaim();
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start_);
+        const auto stats = progress_.Snapshot(false);
+        LogVerbose()(OT_PRETTY_CLASS())("Copied ")(stats.objects_)(
+            " live objects (")(stats.bytes_)(" bytes) in ")(elapsed.count())(
+            " ms over ")(stats.slices_ + 1u)(" slices and reclaimed ")(
+            stats.reclaimed_)(" bytes. Skipped ")(stats.duplicates_)(
+            " duplicate references and ")(stats.current_)(
+            " objects written since the collection began.")
+            .Flush();
     } else {
         LogVerbose()(OT_PRETTY_CLASS())("Garbage collection failed").Flush();
     }
 
+    slicer_.reset();
+    auto done = std::move(done_);
+
     {
         auto lock = Lock{lock_};
         running_->Off();
@@ -116,6 +169,7 @@ auto Root::GC::collect_garbage(
 
     done();
     LogVerbose()(OT_PRETTY_CLASS())("Finished garbage collection.").Flush();
+    promise_.set_value(success);
 }
 
 auto Root::GC::Init(
@@ -130,17 +184,40 @@ auto Root::GC::Init(
     last_.store(last);
 }
 
+auto Root::GC::post(void (GC::*job)() noexcept) noexcept -> bool
+{
+    auto ran = std::make_shared<std::atomic_bool>(false);
+    // NOTE the pool may refuse the task or discard it without running it, for
+    // example during shutdown. In either case the guard finishes the
+    // collection so that Cleanup() does not wait forever on promise_.
+    auto guard = std::make_shared<ScopeGuard>([this, ran] {
+        if (false == ran->load()) { finish(false); }
+    });
+
+    return asio_.Internal().Post(
+        ThreadPool::Storage,
+        [this, job, ran, guard] {
+            ran->store(true);
+            std::invoke(job, this);
+        },
+        name_);
+}
+
+auto Root::GC::Progress() const noexcept -> gc::Progress
+{
+    return progress_.Snapshot(running_.get());
+}
+
 auto Root::GC::Run(
     const bool from,
     const Driver& to,
     SimpleCallback cb) noexcept -> bool
 {
-    asio_.Internal().Post(
-        ThreadPool::General,
-        [=, driver = &to] { collect_garbage(from, driver, std::move(cb)); },
-        "Storage gc");
+    from_ = from;
+    to_ = &to;
+    done_ = std::move(cb);
 
-    return true;
+    return post(&GC::collect_garbage);
 }
 
 auto Root::GC::Serialize(proto::StorageRoot& out) const noexcept -> void
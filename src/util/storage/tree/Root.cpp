@@ -57,6 +57,11 @@ void Root::blank(const VersionNumber version)
 
 void Root::cleanup() const { gc_.Cleanup(); }
 
+auto Root::GarbageCollection() const noexcept -> gc::Progress
+{
+    return gc_.Progress();
+}
+
 void Root::init(const UnallocatedCString& hash)
 {
     auto data = std::shared_ptr<proto::StorageRoot>{};
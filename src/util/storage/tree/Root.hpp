@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <future>
 #include <limits>
@@ -20,8 +21,10 @@
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Numbers.hpp"
 #include "opentxs/util/Types.hpp"
+#include "opentxs/util/storage/Driver.hpp"
 #include "serialization/protobuf/StorageRoot.pb.h"
 #include "util/storage/tree/Node.hpp"
+#include "util/storage/tree/Slicer.hpp"
 #include "util/storage/tree/Tree.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -71,6 +74,7 @@ namespace opentxs::storage
 class Root final : public Node
 {
 public:
+    auto GarbageCollection() const noexcept -> gc::Progress;
     auto Tree() const -> const storage::Tree&;
 
     auto mutable_Tree() -> Editor<storage::Tree>;
@@ -101,6 +105,7 @@ private:
             Start,
         };
 
+        auto Progress() const noexcept -> gc::Progress;
         auto Serialize(proto::StorageRoot& out) const noexcept -> void;
 
         auto Check(const UnallocatedCString root) noexcept -> CheckState;
@@ -123,6 +128,9 @@ private:
         ~GC();
 
     private:
+        static constexpr auto slice_ = std::chrono::milliseconds{20};
+        static constexpr auto name_ = "Storage gc";
+
         const api::network::Asio& asio_;
         const api::session::Factory& factory_;
         const Driver& driver_;
@@ -134,11 +142,17 @@ private:
         std::atomic<std::uint64_t> last_;
         std::promise<bool> promise_;
         std::shared_future<bool> future_;
-
-        auto collect_garbage(
-            const bool from,
-            const Driver* to,
-            const SimpleCallback done) noexcept -> void;
+        gc::Counters progress_;
+        bool from_;
+        const Driver* to_;
+        SimpleCallback done_;
+        std::chrono::steady_clock::time_point start_;
+        std::unique_ptr<gc::Slicer> slicer_;
+
+        auto collect_garbage() noexcept -> void;
+        auto copy() noexcept -> void;
+        auto finish(bool success) noexcept -> void;
+        auto post(void (GC::*job)() noexcept) noexcept -> bool;
     };
 
     static constexpr auto current_version_ = VersionNumber{2};
@@ -0,0 +1,209 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                  // IWYU pragma: associated
+#include "1_Internal.hpp"                // IWYU pragma: associated
+#include "util/storage/tree/Slicer.hpp"  // IWYU pragma: associated
+
+#include <utility>
+
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/util/Log.hpp"
+
+namespace opentxs::storage::gc
+{
+auto Counters::Reset() noexcept -> void
+{
+    objects_.store(0);
+    bytes_.store(0);
+    duplicates_.store(0);
+    current_.store(0);
+    pending_.store(0);
+    slices_.store(0);
+    reclaimed_.store(0);
+}
+
+auto Counters::Snapshot(bool running) const noexcept -> Progress
+{
+    return {
+        running,
+        objects_.load(),
+        bytes_.load(),
+        duplicates_.load(),
+        current_.load(),
+        pending_.load(),
+        slices_.load(),
+        reclaimed_.load()};
+}
+}  // namespace opentxs::storage::gc
+
+namespace opentxs::storage::gc
+{
+Slicer::Slicer(
+    const Driver& driver,
+    const bool from,
+    Counters& progress) noexcept
+    : driver_(driver)
+    , from_(from)
+    , progress_(progress)
+    , migrated_()
+    , pending_()
+{
+}
+
+auto Slicer::BucketSize(const bool bucket) const -> std::size_t
+{
+    return driver_.BucketSize(bucket);
+}
+
+auto Slicer::Copy(const Driver& to, std::chrono::nanoseconds budget)
+    const noexcept -> std::optional<bool>
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    while (false == pending_.empty()) {
+        const auto key = std::move(pending_.front());
+        pending_.pop_front();
+        --progress_.pending_;
+
+        if (false == copy(key, to)) { return false; }
+
+        if ((std::chrono::steady_clock::now() - start) >= budget) { break; }
+    }
+
+    if (pending_.empty()) { return true; }
+
+    return std::nullopt;
+}
+
+auto Slicer::copy(const UnallocatedCString& key, const Driver& to)
+    const noexcept -> bool
+{
+    const auto target = !from_;
+    auto value = UnallocatedCString{};
+
+    if (driver_.LoadFromBucket(key, value, from_)) {
+        if (false == to.Store(false, key, value, target)) {
+            LogError()(OT_PRETTY_CLASS())("Save failure.").Flush();
+
+            return false;
+        }
+
+        progress_.bytes_ += value.size();
+
+        if (const auto count = ++progress_.objects_;
+            0u == (count % report_interval_)) {
+            LogVerbose()(OT_PRETTY_CLASS())("Copied ")(count)(" objects (")(
+                progress_.bytes_.load())(" bytes)")
+                .Flush();
+        }
+
+        return true;
+    }
+
+    // NOTE objects committed after the collection began were written to the
+    // target bucket and need not be copied
+    if (to.LoadFromBucket(key, value, target)) {
+        ++progress_.current_;
+
+        return true;
+    }
+
+    LogVerbose()(OT_PRETTY_CLASS())("Missing key.").Flush();
+
+    return false;
+}
+
+auto Slicer::EmptyBucket(const bool bucket) const -> bool
+{
+    return driver_.EmptyBucket(bucket);
+}
+
+auto Slicer::Load(
+    const UnallocatedCString& key,
+    const bool checking,
+    UnallocatedCString& value) const -> bool
+{
+    return driver_.Load(key, checking, value);
+}
+
+auto Slicer::LoadFromBucket(
+    const UnallocatedCString& key,
+    UnallocatedCString& value,
+    const bool bucket) const -> bool
+{
+    return driver_.LoadFromBucket(key, value, bucket);
+}
+
+auto Slicer::LoadRoot() const -> UnallocatedCString
+{
+    return driver_.LoadRoot();
+}
+
+auto Slicer::Migrate(const UnallocatedCString& key, const Driver&) const
+    -> bool
+{
+    if (key.empty()) { return false; }
+
+    // NOTE content addressed objects are frequently referenced from more than
+    // one place in the tree
+    if (false == migrated_.emplace(key).second) {
+        ++progress_.duplicates_;
+
+        return true;
+    }
+
+    pending_.emplace_back(key);
+    ++progress_.pending_;
+
+    return true;
+}
+
+auto Slicer::Reclaim() const noexcept -> bool
+{
+    const auto size = driver_.BucketSize(from_);
+    const auto live = progress_.bytes_.load();
+
+    if (false == driver_.EmptyBucket(from_)) { return false; }
+
+    // NOTE the live objects now also occupy the target bucket
+    progress_.reclaimed_.store((size > live) ? (size - live) : 0u);
+
+    return true;
+}
+
+auto Slicer::Store(
+    const bool isTransaction,
+    const UnallocatedCString& key,
+    const UnallocatedCString& value,
+    const bool bucket) const -> bool
+{
+    return driver_.Store(isTransaction, key, value, bucket);
+}
+
+void Slicer::Store(
+    const bool isTransaction,
+    const UnallocatedCString& key,
+    const UnallocatedCString& value,
+    const bool bucket,
+    std::promise<bool>& promise) const
+{
+    driver_.Store(isTransaction, key, value, bucket, promise);
+}
+
+auto Slicer::Store(
+    const bool isTransaction,
+    const UnallocatedCString& value,
+    UnallocatedCString& key) const -> bool
+{
+    return driver_.Store(isTransaction, value, key);
+}
+
+auto Slicer::StoreRoot(const bool commit, const UnallocatedCString& hash) const
+    -> bool
+{
+    return driver_.StoreRoot(commit, hash);
+}
+}  // namespace opentxs::storage::gc
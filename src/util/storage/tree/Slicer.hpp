@@ -0,0 +1,119 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <optional>
+
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/storage/Driver.hpp"
+
+namespace opentxs::storage::gc
+{
+/// Progress of the current or most recent garbage collection
+struct Progress {
+    bool running_{};
+    /// objects copied into the active bucket
+    std::uint64_t objects_{};
+    /// bytes copied into the active bucket
+    std::uint64_t bytes_{};
+    /// references to objects which were already copied
+    std::uint64_t duplicates_{};
+    /// objects written by the session after the collection began
+    std::uint64_t current_{};
+    /// reachable objects which have not been copied yet
+    std::uint64_t pending_{};
+    /// number of slices the copy has been divided into
+    std::uint64_t slices_{};
+    /// bytes released when the inactive bucket was emptied
+    std::uint64_t reclaimed_{};
+};
+
+/// Counters for a collection which may be read while it is running
+struct Counters {
+    std::atomic<std::uint64_t> objects_{};
+    std::atomic<std::uint64_t> bytes_{};
+    std::atomic<std::uint64_t> duplicates_{};
+    std::atomic<std::uint64_t> current_{};
+    std::atomic<std::uint64_t> pending_{};
+    std::atomic<std::uint64_t> slices_{};
+    std::atomic<std::uint64_t> reclaimed_{};
+
+    auto Reset() noexcept -> void;
+    auto Snapshot(bool running) const noexcept -> Progress;
+};
+
+/// Reads the tree being collected and records every object reachable from it
+/// exactly once. The recorded objects are then copied into the active bucket
+/// by repeated calls to Copy so that the caller can yield between slices.
+class Slicer final : public Driver
+{
+public:
+    /// Copy recorded objects until the budget is exhausted. Returns nullopt if
+    /// objects remain, otherwise whether every object was copied.
+    auto Copy(const Driver& to, std::chrono::nanoseconds budget) const noexcept
+        -> std::optional<bool>;
+    /// Empty the bucket being collected once every object has been copied and
+    /// record the number of bytes reclaimed
+    auto Reclaim() const noexcept -> bool;
+
+    auto BucketSize(const bool bucket) const -> std::size_t final;
+    auto EmptyBucket(const bool bucket) const -> bool final;
+    auto Load(
+        const UnallocatedCString& key,
+        const bool checking,
+        UnallocatedCString& value) const -> bool final;
+    auto LoadFromBucket(
+        const UnallocatedCString& key,
+        UnallocatedCString& value,
+        const bool bucket) const -> bool final;
+    auto LoadRoot() const -> UnallocatedCString final;
+    auto Migrate(const UnallocatedCString& key, const Driver& to) const
+        -> bool final;
+    auto Store(
+        const bool isTransaction,
+        const UnallocatedCString& key,
+        const UnallocatedCString& value,
+        const bool bucket) const -> bool final;
+    void Store(
+        const bool isTransaction,
+        const UnallocatedCString& key,
+        const UnallocatedCString& value,
+        const bool bucket,
+        std::promise<bool>& promise) const final;
+    auto Store(
+        const bool isTransaction,
+        const UnallocatedCString& value,
+        UnallocatedCString& key) const -> bool final;
+    auto StoreRoot(const bool commit, const UnallocatedCString& hash) const
+        -> bool final;
+
+    Slicer(const Driver& driver, const bool from, Counters& progress) noexcept;
+    Slicer() = delete;
+    Slicer(const Slicer&) = delete;
+    Slicer(Slicer&&) = delete;
+    auto operator=(const Slicer&) -> Slicer& = delete;
+    auto operator=(Slicer&&) -> Slicer& = delete;
+
+    ~Slicer() final = default;
+
+private:
+    static constexpr auto report_interval_ = std::uint64_t{4096};
+
+    const Driver& driver_;
+    const bool from_;
+    Counters& progress_;
+    mutable UnallocatedSet<UnallocatedCString> migrated_;
+    mutable UnallocatedDeque<UnallocatedCString> pending_;
+
+    auto copy(const UnallocatedCString& key, const Driver& to) const noexcept
+        -> bool;
+};
+}  // namespace opentxs::storage::gc
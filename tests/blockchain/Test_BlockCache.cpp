@@ -0,0 +1,242 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <utility>
+
+#include "blockchain/node/blockoracle/MemDB.hpp"
+#include "internal/blockchain/Params.hpp"
+#include "internal/blockchain/block/Block.hpp"
+#include "internal/util/P0330.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+using MemDB = ot::blockchain::node::blockoracle::MemDB;
+using Block = ot::blockchain::bitcoin::block::Block;
+
+// NOTE every budget used here is small enough to select a single shard so
+// the eviction order is deterministic
+class Test_BlockCache : public ::testing::Test
+{
+protected:
+    static constexpr auto chain_ = ot::blockchain::Type::Bitcoin;
+
+    const ot::api::session::Client& api_;
+    const ot::Space genesis_;
+    const std::size_t size_;
+
+    static auto id(char c) noexcept -> ot::blockchain::block::Hash
+    {
+        return ot::blockchain::block::Hash{ot::UnallocatedCString(32_uz, c)};
+    }
+    static auto total(const MemDB& cache) noexcept -> MemDB::Stats
+    {
+        auto out = MemDB::Stats{};
+
+        for (const auto& shard : cache.GetStats()) {
+            out.hits_ += shard.hits_;
+            out.misses_ += shard.misses_;
+            out.evictions_ += shard.evictions_;
+            out.entries_ += shard.entries_;
+            out.pinned_ += shard.pinned_;
+            out.bytes_ += shard.bytes_;
+            out.budget_ += shard.budget_;
+        }
+
+        return out;
+    }
+
+    // NOTE each call parses a separate copy of the block so the only
+    // reference to it belongs to the cache unless the caller keeps one
+    auto block() const noexcept -> std::shared_ptr<const Block>
+    {
+        return api_.Factory().BitcoinBlock(chain_, ot::reader(genesis_));
+    }
+    auto push(
+        MemDB& cache,
+        char c,
+        std::shared_ptr<const Block> pBlock = {}) const noexcept -> void
+    {
+        if (false == bool(pBlock)) { pBlock = block(); }
+
+        auto promise = std::promise<std::shared_ptr<const Block>>{};
+        promise.set_value(std::move(pBlock));
+        cache.push(id(c), promise.get_future().share());
+    }
+    static auto cached(const MemDB& cache, char c) noexcept -> bool
+    {
+        return cache.find(id(c)).valid();
+    }
+
+    Test_BlockCache()
+        : api_(ot::Context().StartClientSession(0))
+        , genesis_([&] {
+            const auto& hex =
+                ot::blockchain::params::Chains().at(chain_).genesis_block_hex_;
+            const auto data = api_.Factory().DataFromHex(hex);
+
+            return ot::space(data.Bytes());
+        }())
+        , size_([&] {
+            const auto pBlock = block();
+
+            return pBlock ? pBlock->Internal().CalculateSize() : 0_uz;
+        }())
+    {
+    }
+};
+
+TEST_F(Test_BlockCache, budget)
+{
+    ASSERT_LT(0_uz, size_);
+
+    auto cache = MemDB{3_uz * size_, {}};
+
+    for (auto c = 'a'; c < 'k'; ++c) {
+        push(cache, c);
+        const auto stats = total(cache);
+
+        EXPECT_LE(stats.bytes_, 3_uz * size_);
+        EXPECT_EQ(stats.bytes_, stats.entries_ * size_);
+    }
+
+    const auto stats = total(cache);
+
+    EXPECT_EQ(stats.budget_, 3_uz * size_);
+    EXPECT_EQ(stats.entries_, 3_uz);
+    EXPECT_EQ(stats.evictions_, 7u);
+
+    cache.clear();
+
+    EXPECT_EQ(total(cache).entries_, 0_uz);
+    EXPECT_EQ(total(cache).bytes_, 0_uz);
+}
+
+TEST_F(Test_BlockCache, second_chance)
+{
+    ASSERT_LT(0_uz, size_);
+
+    auto cache = MemDB{3_uz * size_, {}};
+    push(cache, 'a');
+    push(cache, 'b');
+    push(cache, 'c');
+
+    ASSERT_TRUE(cached(cache, 'a'));
+
+    // NOTE the hand clears the reference bit of a and evicts b instead
+    push(cache, 'd');
+
+    EXPECT_TRUE(cached(cache, 'a'));
+    EXPECT_FALSE(cached(cache, 'b'));
+    EXPECT_TRUE(cached(cache, 'c'));
+    EXPECT_TRUE(cached(cache, 'd'));
+
+    // NOTE every remaining entry was just referenced so the hand clears all
+    // of them and evicts c, the first entry it returns to
+    push(cache, 'e');
+
+    EXPECT_FALSE(cached(cache, 'c'));
+    EXPECT_TRUE(cached(cache, 'a'));
+    EXPECT_TRUE(cached(cache, 'd'));
+    EXPECT_TRUE(cached(cache, 'e'));
+    EXPECT_EQ(total(cache).evictions_, 2u);
+}
+
+TEST_F(Test_BlockCache, pinned)
+{
+    ASSERT_LT(0_uz, size_);
+
+    auto cache = MemDB{2_uz * size_, {}};
+    auto held = block();
+    push(cache, 'a', held);
+
+    EXPECT_EQ(total(cache).pinned_, 1_uz);
+
+    // NOTE a is never looked up so only the pin protects it from eviction
+    for (auto c = 'b'; c < 'h'; ++c) {
+        push(cache, c);
+
+        EXPECT_EQ(total(cache).pinned_, 1_uz);
+        EXPECT_EQ(total(cache).entries_, 2_uz);
+    }
+
+    EXPECT_EQ(total(cache).evictions_, 5u);
+
+    // NOTE once the job holding the block is finished it can be evicted like
+    // any other entry
+    held.reset();
+
+    EXPECT_EQ(total(cache).pinned_, 0_uz);
+
+    push(cache, 'h');
+
+    ASSERT_TRUE(cached(cache, 'h'));
+
+    // NOTE the reference bit of h sends the hand around to a
+    push(cache, 'i');
+
+    EXPECT_FALSE(cached(cache, 'a'));
+    EXPECT_TRUE(cached(cache, 'h'));
+    EXPECT_TRUE(cached(cache, 'i'));
+    EXPECT_EQ(total(cache).entries_, 2_uz);
+}
+
+TEST_F(Test_BlockCache, pinned_over_budget)
+{
+    ASSERT_LT(0_uz, size_);
+
+    auto cache = MemDB{2_uz * size_, {}};
+    auto a = block();
+    auto b = block();
+    auto c = block();
+    push(cache, 'a', a);
+    push(cache, 'b', b);
+    push(cache, 'c', c);
+
+    // NOTE nothing can be evicted so the cache temporarily exceeds its budget
+    const auto stats = total(cache);
+
+    EXPECT_EQ(stats.entries_, 3_uz);
+    EXPECT_EQ(stats.pinned_, 3_uz);
+    EXPECT_EQ(stats.evictions_, 0u);
+    EXPECT_GT(stats.bytes_, stats.budget_);
+}
+
+TEST_F(Test_BlockCache, stats)
+{
+    ASSERT_LT(0_uz, size_);
+
+    auto cache = MemDB{4_uz * size_, {}};
+    push(cache, 'a');
+    push(cache, 'b');
+
+    EXPECT_TRUE(cached(cache, 'a'));
+    EXPECT_FALSE(cached(cache, 'z'));
+    EXPECT_EQ(total(cache).hits_, 1u);
+    EXPECT_EQ(total(cache).misses_, 1u);
+
+    auto output = ot::blockchain::node::BitcoinBlockResults{};
+
+    EXPECT_TRUE(cache.find({id('a'), id('b')}, output));
+    EXPECT_EQ(output.size(), 2_uz);
+    EXPECT_EQ(total(cache).hits_, 3u);
+    EXPECT_EQ(total(cache).misses_, 1u);
+
+    // NOTE a partial match leaves the output and the statistics unchanged
+    output.clear();
+
+    EXPECT_FALSE(cache.find({id('a'), id('z')}, output));
+    EXPECT_TRUE(output.empty());
+    EXPECT_EQ(total(cache).hits_, 3u);
+    EXPECT_EQ(total(cache).misses_, 1u);
+}
+}  // namespace ottest
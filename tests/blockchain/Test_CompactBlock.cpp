@@ -0,0 +1,306 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include "internal/util/P0330.hpp"
+#include "network/blockchain/bitcoin/CompactBlock.hpp"
+#include "ottest/data/blockchain/Bip158.hpp"
+
+namespace ottest
+{
+using namespace opentxs::literals;
+using CompactBlock = ot::network::blockchain::bitcoin::CompactBlock;
+
+class Test_CompactBlock : public ::testing::Test
+{
+protected:
+    static constexpr auto chain_ = ot::blockchain::Type::Bitcoin_testnet3;
+    static constexpr auto version_ = std::uint64_t{2};
+    static constexpr auto nonce_ = std::uint64_t{0x0123456789abcdef};
+    // NOTE block header and nonce
+    static constexpr auto prefix_ = 88_uz;
+
+    const ot::api::session::Client& api_;
+    ot::ByteArray raw_;
+    std::shared_ptr<const ot::blockchain::bitcoin::block::Block> block_;
+
+    auto encode() const noexcept -> ot::ByteArray
+    {
+        auto out = api_.Factory().Data();
+
+        EXPECT_TRUE(CompactBlock::Encode(
+            api_, *block_, version_, nonce_, out.WriteInto()));
+
+        return out;
+    }
+    // NOTE position of the prefilled transaction count
+    auto prefilled() const noexcept -> std::size_t
+    {
+        return short_ids() +
+               ((block_->size() - 1_uz) * CompactBlock::short_id_bytes_);
+    }
+    auto short_ids() const noexcept -> std::size_t
+    {
+        using CompactSize = ot::network::blockchain::bitcoin::CompactSize;
+
+        return prefix_ + CompactSize(block_->size() - 1_uz).Size();
+    }
+    auto mempool(bool odd, bool even) const noexcept
+        -> CompactBlock::Transactions
+    {
+        auto out = CompactBlock::Transactions{};
+
+        for (auto i = 1_uz; i < block_->size(); ++i) {
+            if ((0_uz == i % 2_uz) ? even : odd) {
+                out.emplace_back(block_->at(i));
+            }
+        }
+
+        return out;
+    }
+    auto parse(const ot::ReadView payload) const noexcept(false)
+        -> CompactBlock
+    {
+        return CompactBlock{api_, chain_, version_, payload};
+    }
+    auto serialize(const CompactBlock& block) const noexcept -> ot::ByteArray
+    {
+        auto out = api_.Factory().Data();
+
+        EXPECT_TRUE(block.Serialize(out.WriteInto()));
+
+        return out;
+    }
+
+    Test_CompactBlock()
+        : api_(ot::Context().StartClientSession(
+              ot::Options{}.SetBlockchainWalletEnabled(false),
+              0))
+        , raw_()
+        , block_()
+    {
+        // NOTE use the vector with the most transactions
+        for (const auto& vector : GetBip158Vectors()) {
+            auto raw = vector.Block(api_);
+            auto block = api_.Factory().BitcoinBlock(chain_, raw.Bytes());
+
+            if (false == block.operator bool()) { continue; }
+
+            if ((false == block_.operator bool()) ||
+                (block->size() > block_->size())) {
+                raw_ = std::move(raw);
+                block_ = std::move(block);
+            }
+        }
+    }
+};
+
+TEST_F(Test_CompactBlock, round_trip)
+{
+    ASSERT_TRUE(block_);
+    ASSERT_GT(block_->size(), 2_uz);
+
+    const auto payload = encode();
+    const auto block = parse(payload.Bytes());
+    auto expected = CompactBlock::Indices{};
+
+    for (auto i = 1_uz; i < block_->size(); ++i) { expected.emplace_back(i); }
+
+    EXPECT_EQ(block.Hash(), block_->ID());
+    EXPECT_EQ(block.Size(), block_->size());
+    EXPECT_EQ(block.Prefilled(), 1_uz);
+    EXPECT_FALSE(block.IsComplete());
+    EXPECT_EQ(block.Missing(), expected);
+    EXPECT_FALSE(block.Serialize(api_.Factory().Data().WriteInto()));
+}
+
+TEST_F(Test_CompactBlock, reconstruct)
+{
+    ASSERT_TRUE(block_);
+
+    auto block = parse(encode().Bytes());
+    const auto matched = block.Reconstruct(mempool(true, true));
+
+    EXPECT_EQ(matched, block_->size() - 1_uz);
+    EXPECT_TRUE(block.IsComplete());
+    EXPECT_TRUE(block.Missing().empty());
+    EXPECT_EQ(serialize(block), raw_);
+}
+
+TEST_F(Test_CompactBlock, fill)
+{
+    ASSERT_TRUE(block_);
+
+    auto block = parse(encode().Bytes());
+    const auto matched = block.Reconstruct(mempool(true, false));
+    const auto missing = block.Missing();
+
+    EXPECT_EQ(matched, block_->size() / 2_uz);
+    EXPECT_EQ(missing.size(), block_->size() - 1_uz - matched);
+    EXPECT_FALSE(block.IsComplete());
+
+    for (const auto index : missing) { EXPECT_EQ(index % 2_uz, 0_uz); }
+
+    auto blocktxn = api_.Factory().Data();
+
+    ASSERT_TRUE(CompactBlock::EncodeTransactions(
+        *block_, missing, blocktxn.WriteInto()));
+
+    block.Fill(blocktxn.Bytes());
+
+    EXPECT_TRUE(block.IsComplete());
+    EXPECT_EQ(serialize(block), raw_);
+}
+
+TEST_F(Test_CompactBlock, fill_mismatch)
+{
+    ASSERT_TRUE(block_);
+
+    auto block = parse(encode().Bytes());
+    auto blocktxn = api_.Factory().Data();
+
+    ASSERT_TRUE(CompactBlock::EncodeTransactions(
+        *block_, {1_uz}, blocktxn.WriteInto()));
+    EXPECT_THROW(block.Fill(blocktxn.Bytes()), std::runtime_error);
+}
+
+TEST_F(Test_CompactBlock, mempool_collision)
+{
+    ASSERT_TRUE(block_);
+
+    // NOTE two mempool transactions with the same short id are ambiguous so
+    // the slot must be requested from the peer
+    auto block = parse(encode().Bytes());
+    auto pool = mempool(true, true);
+    pool.emplace_back(block_->at(1_uz));
+    const auto matched = block.Reconstruct(pool);
+
+    EXPECT_EQ(matched, block_->size() - 2_uz);
+    EXPECT_EQ(block.Missing(), CompactBlock::Indices{1_uz});
+}
+
+TEST_F(Test_CompactBlock, duplicate_short_ids)
+{
+    ASSERT_TRUE(block_);
+
+    auto payload = ot::space(encode().Bytes());
+    auto* ids = payload.data() + short_ids();
+
+    for (auto i = 0_uz; i < CompactBlock::short_id_bytes_; ++i) {
+        ids[CompactBlock::short_id_bytes_ + i] = ids[i];
+    }
+
+    EXPECT_THROW(parse(ot::reader(payload)), std::runtime_error);
+}
+
+TEST_F(Test_CompactBlock, malformed_counts)
+{
+    ASSERT_TRUE(block_);
+
+    const auto payload = encode();
+    static constexpr auto huge = std::byte{0xff};
+    const auto append_huge = [](auto& data) {
+        for (auto i = 0_uz; i < 9_uz; ++i) { data.emplace_back(huge); }
+    };
+
+    {
+        // NOTE short id count
+        auto data = ot::space(payload.Bytes().substr(0_uz, prefix_));
+        append_huge(data);
+
+        EXPECT_THROW(parse(ot::reader(data)), std::runtime_error);
+    }
+
+    {
+        // NOTE prefilled count
+        auto data = ot::space(payload.Bytes().substr(0_uz, prefilled()));
+        append_huge(data);
+
+        EXPECT_THROW(parse(ot::reader(data)), std::runtime_error);
+    }
+
+    {
+        // NOTE a prefilled index beyond the end of the block
+        auto data = ot::space(payload.Bytes());
+        data.at(prefilled() + 1_uz) = std::byte{0xfc};
+
+        EXPECT_THROW(parse(ot::reader(data)), std::runtime_error);
+    }
+}
+
+TEST(CompactBlock, differential_indices)
+{
+    const auto absolute = CompactBlock::Indices{0, 1, 5, 6, 10};
+    const auto encoded = CompactBlock::Indices{0, 0, 3, 0, 3};
+
+    EXPECT_EQ(CompactBlock::EncodeIndices(absolute), encoded);
+    EXPECT_EQ(CompactBlock::DecodeIndices(encoded, 11_uz), absolute);
+    EXPECT_TRUE(CompactBlock::EncodeIndices({}).empty());
+    EXPECT_TRUE(CompactBlock::DecodeIndices({}, 0_uz).empty());
+}
+
+TEST(CompactBlock, indices_out_of_range)
+{
+    constexpr auto max = std::numeric_limits<std::size_t>::max();
+
+    EXPECT_THROW(
+        CompactBlock::DecodeIndices({0, 0, 3, 0, 3}, 10_uz),
+        std::runtime_error);
+    EXPECT_THROW(CompactBlock::DecodeIndices({0}, 0_uz), std::runtime_error);
+    EXPECT_THROW(CompactBlock::DecodeIndices({max}, 10_uz), std::runtime_error);
+    EXPECT_THROW(
+        CompactBlock::DecodeIndices({5, max}, 10_uz), std::runtime_error);
+}
+
+TEST(CompactBlock, high_bandwidth)
+{
+    constexpr auto chain = ot::blockchain::Type::UnitTest;
+    auto claimed = 0_uz;
+
+    for (auto i = 0_uz; i < 2_uz * CompactBlock::max_high_bandwidth_; ++i) {
+        if (CompactBlock::ClaimHighBandwidth(chain)) { ++claimed; }
+    }
+
+    EXPECT_EQ(claimed, CompactBlock::max_high_bandwidth_);
+
+    CompactBlock::ReleaseHighBandwidth(chain);
+
+    EXPECT_TRUE(CompactBlock::ClaimHighBandwidth(chain));
+    EXPECT_FALSE(CompactBlock::ClaimHighBandwidth(chain));
+
+    for (auto i = 0_uz; i < claimed; ++i) {
+        CompactBlock::ReleaseHighBandwidth(chain);
+    }
+}
+
+TEST(CompactBlock, stats)
+{
+    constexpr auto chain = ot::blockchain::Type::UnitTest;
+    using Stats = CompactBlock::Stats;
+    const auto& totals = CompactBlock::GetStats(chain);
+    const auto received = totals.received_.load();
+    const auto mempool = totals.mempool_.load();
+    auto first = CompactBlock::Counters{chain};
+    auto second = CompactBlock::Counters{chain};
+    first.Add(&Stats::received_);
+    first.Add(&Stats::mempool_, 7u);
+    second.Add(&Stats::received_);
+
+    EXPECT_EQ(first.Peer().received_.load(), 1u);
+    EXPECT_EQ(first.Peer().mempool_.load(), 7u);
+    EXPECT_EQ(second.Peer().received_.load(), 1u);
+    EXPECT_EQ(second.Peer().mempool_.load(), 0u);
+    EXPECT_EQ(&first.Totals(), &totals);
+    EXPECT_EQ(totals.received_.load(), received + 2u);
+    EXPECT_EQ(totals.mempool_.load(), mempool + 7u);
+}
+}  // namespace ottest
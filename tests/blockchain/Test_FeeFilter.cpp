@@ -0,0 +1,87 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+#include "network/blockchain/bitcoin/FeeFilter.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/util/Time.hpp"
+
+namespace ottest
+{
+using namespace std::literals;
+using FeeFilter = opentxs::network::blockchain::bitcoin::FeeFilter;
+
+constexpr auto chain_ = opentxs::blockchain::Type::UnitTest;
+
+TEST(FeeFilter, rate)
+{
+    EXPECT_EQ(FeeFilter::Rate(1000u, 250u), 4000u);
+    EXPECT_EQ(FeeFilter::Rate(141u, 141u), 1000u);
+    EXPECT_EQ(FeeFilter::Rate(1u, 3u), 333u);
+    EXPECT_EQ(FeeFilter::Rate(5u, 0u), 5000u);
+}
+
+TEST(FeeFilter, permits)
+{
+    auto filter = FeeFilter{chain_};
+
+    EXPECT_TRUE(filter.Permits(0u));
+    EXPECT_TRUE(filter.Permits(std::nullopt));
+
+    filter.SetRemote(1000u);
+
+    EXPECT_EQ(filter.Remote(), 1000u);
+    EXPECT_FALSE(filter.Permits(999u));
+    EXPECT_TRUE(filter.Permits(1000u));
+    EXPECT_TRUE(filter.Permits(std::nullopt));
+
+    const auto& stats = filter.Counters();
+
+    EXPECT_EQ(stats.received_.load(), 1u);
+    EXPECT_EQ(stats.announced_.load(), 4u);
+    EXPECT_EQ(stats.suppressed_.load(), 1u);
+    EXPECT_EQ(stats.unknown_.load(), 2u);
+}
+
+TEST(FeeFilter, totals)
+{
+    auto& totals = FeeFilter::GetStats(chain_);
+    const auto before = totals.suppressed_.load();
+    auto first = FeeFilter{chain_};
+    auto second = FeeFilter{chain_};
+    first.SetRemote(1000u);
+    second.SetRemote(1000u);
+    first.Permits(1u);
+    second.Permits(1u);
+
+    EXPECT_EQ(first.Counters().suppressed_.load(), 1u);
+    EXPECT_EQ(totals.suppressed_.load(), before + 2u);
+}
+
+TEST(FeeFilter, update)
+{
+    auto filter = FeeFilter{chain_};
+    const auto start = opentxs::Clock::now();
+
+    EXPECT_EQ(filter.Update(1000u, start), 1000u);
+    EXPECT_EQ(filter.Local(), 1000u);
+    EXPECT_FALSE(filter.Update(1000u, start + 1h).has_value());
+    EXPECT_FALSE(filter.Update(1100u, start + 1min).has_value());
+    EXPECT_EQ(filter.Update(2000u, start + 1min), 2000u);
+    EXPECT_FALSE(filter.Update(1600u, start + 2min).has_value());
+    EXPECT_EQ(filter.Update(1600u, start + 11min), 1600u);
+
+    // NOTE the threshold is a quarter of the current rate in either direction
+    EXPECT_FALSE(filter.Update(1200u, start + 12min).has_value());
+    EXPECT_FALSE(filter.Update(2000u, start + 12min).has_value());
+    EXPECT_EQ(filter.Update(1199u, start + 12min), 1199u);
+    EXPECT_EQ(filter.Update(1500u, start + 13min), 1500u);
+    EXPECT_EQ(filter.Counters().sent_.load(), 5u);
+}
+}  // namespace ottest
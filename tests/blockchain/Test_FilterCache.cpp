@@ -0,0 +1,180 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+
+#include "blockchain/database/common/FilterCache.hpp"
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "internal/util/P0330.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+using FilterCache = ot::blockchain::database::common::FilterCache;
+using Hash = ot::blockchain::block::Hash;
+using Type = ot::blockchain::cfilter::Type;
+
+class Test_FilterCache : public ::testing::Test
+{
+protected:
+    static constexpr auto type_ = Type::Basic_BIP158;
+    static constexpr auto count_ = 100_uz;
+
+    // NOTE every entry created by elements() has the same cost
+    const std::size_t entry_;
+
+    static auto elements(ot::blockchain::gcs::Element value) noexcept
+        -> ot::blockchain::gcs::Elements
+    {
+        return ot::blockchain::gcs::Elements(count_, value);
+    }
+    static auto hash(char value) noexcept -> Hash
+    {
+        return Hash{ot::UnallocatedCString(32_uz, value)};
+    }
+    static auto measure() noexcept -> std::size_t
+    {
+        auto cache = FilterCache{1_uz << 20_uz};
+        cache.Insert(type_, hash('a'), elements(1u));
+
+        return cache.GetStats().bytes_;
+    }
+
+    Test_FilterCache()
+        : entry_(measure())
+    {
+    }
+};
+
+TEST_F(Test_FilterCache, disabled)
+{
+    auto cache = FilterCache{0_uz};
+
+    EXPECT_FALSE(cache.Enabled());
+
+    const auto inserted = cache.Insert(type_, hash('a'), elements(1u));
+
+    // NOTE the decoded elements are still returned to the caller
+    ASSERT_TRUE(inserted);
+    EXPECT_EQ(inserted->size(), count_);
+    EXPECT_FALSE(cache.Find(type_, hash('a')));
+
+    const auto stats = cache.GetStats();
+
+    EXPECT_EQ(stats.entries_, 0_uz);
+    EXPECT_EQ(stats.bytes_, 0_uz);
+    EXPECT_EQ(stats.hits_, 0u);
+    EXPECT_EQ(stats.misses_, 0u);
+}
+
+TEST_F(Test_FilterCache, hits_and_misses)
+{
+    auto cache = FilterCache{4_uz * entry_};
+
+    EXPECT_FALSE(cache.Find(type_, hash('a')));
+
+    const auto inserted = cache.Insert(type_, hash('a'), elements(7u));
+    const auto found = cache.Find(type_, hash('a'));
+
+    ASSERT_TRUE(found);
+    EXPECT_EQ(found.get(), inserted.get());
+    EXPECT_EQ(found->at(0), 7u);
+
+    // NOTE the filter type is part of the key
+    EXPECT_FALSE(cache.Find(Type::ES, hash('a')));
+
+    const auto stats = cache.GetStats();
+
+    EXPECT_EQ(stats.hits_, 1u);
+    EXPECT_EQ(stats.misses_, 2u);
+    EXPECT_EQ(stats.entries_, 1_uz);
+    EXPECT_EQ(stats.bytes_, entry_);
+    EXPECT_EQ(stats.budget_, 4_uz * entry_);
+}
+
+TEST_F(Test_FilterCache, duplicate_insert)
+{
+    auto cache = FilterCache{4_uz * entry_};
+    const auto first = cache.Insert(type_, hash('a'), elements(1u));
+    const auto second = cache.Insert(type_, hash('a'), elements(2u));
+
+    // NOTE the entry which was cached first is kept
+    EXPECT_EQ(second.get(), first.get());
+    EXPECT_EQ(cache.GetStats().entries_, 1_uz);
+    EXPECT_EQ(cache.GetStats().bytes_, entry_);
+}
+
+TEST_F(Test_FilterCache, byte_budget)
+{
+    auto cache = FilterCache{(3_uz * entry_) - 1_uz};
+
+    cache.Insert(type_, hash('a'), elements(1u));
+    cache.Insert(type_, hash('b'), elements(2u));
+    cache.Insert(type_, hash('c'), elements(3u));
+
+    const auto stats = cache.GetStats();
+
+    EXPECT_EQ(stats.entries_, 2_uz);
+    EXPECT_EQ(stats.bytes_, 2_uz * entry_);
+    EXPECT_LE(stats.bytes_, stats.budget_);
+    EXPECT_EQ(stats.evictions_, 1u);
+    EXPECT_FALSE(cache.Find(type_, hash('a')));
+    EXPECT_TRUE(cache.Find(type_, hash('b')));
+    EXPECT_TRUE(cache.Find(type_, hash('c')));
+}
+
+TEST_F(Test_FilterCache, lru_order)
+{
+    auto cache = FilterCache{2_uz * entry_};
+
+    cache.Insert(type_, hash('a'), elements(1u));
+    cache.Insert(type_, hash('b'), elements(2u));
+
+    // NOTE a lookup makes the oldest entry the most recently used
+    ASSERT_TRUE(cache.Find(type_, hash('a')));
+
+    cache.Insert(type_, hash('c'), elements(3u));
+
+    EXPECT_TRUE(cache.Find(type_, hash('a')));
+    EXPECT_FALSE(cache.Find(type_, hash('b')));
+    EXPECT_TRUE(cache.Find(type_, hash('c')));
+
+    // NOTE and so does a duplicate insert
+    cache.Insert(type_, hash('a'), elements(1u));
+    cache.Insert(type_, hash('d'), elements(4u));
+
+    EXPECT_TRUE(cache.Find(type_, hash('a')));
+    EXPECT_FALSE(cache.Find(type_, hash('c')));
+    EXPECT_TRUE(cache.Find(type_, hash('d')));
+    EXPECT_EQ(cache.GetStats().evictions_, 2u);
+}
+
+TEST_F(Test_FilterCache, oversized)
+{
+    auto cache = FilterCache{entry_ - 1_uz};
+    const auto inserted = cache.Insert(type_, hash('a'), elements(1u));
+
+    ASSERT_TRUE(inserted);
+    EXPECT_FALSE(cache.Find(type_, hash('a')));
+    EXPECT_EQ(cache.GetStats().entries_, 0_uz);
+    EXPECT_EQ(cache.GetStats().evictions_, 0u);
+}
+
+TEST_F(Test_FilterCache, clear)
+{
+    auto cache = FilterCache{4_uz * entry_};
+    cache.Insert(type_, hash('a'), elements(1u));
+    cache.Insert(type_, hash('b'), elements(2u));
+    cache.Clear();
+
+    EXPECT_EQ(cache.GetStats().entries_, 0_uz);
+    EXPECT_EQ(cache.GetStats().bytes_, 0_uz);
+    EXPECT_FALSE(cache.Find(type_, hash('a')));
+}
+}  // namespace ottest
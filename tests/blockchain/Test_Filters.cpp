@@ -343,6 +343,32 @@ TEST_F(Test_Filters, golomb_coding)
     }
 }
 
+TEST_F(Test_Filters, golomb_match)
+{
+    const auto elements = ot::Vector<std::uint64_t>{
+        2, 3, 5, 8, 13, 21, 34, 55, 89, 144, 233, 377, 610, 987, 1597};
+    const auto N = static_cast<std::uint32_t>(elements.size());
+    const auto P = std::uint8_t{3};
+    const auto encoded = ot::gcs::GolombEncode(P, elements, {});
+    const auto decoded = ot::gcs::GolombDecode(N, P, encoded, {});
+
+    EXPECT_EQ(elements, decoded);
+
+    const auto targets = ot::Vector<std::uint64_t>{1, 5, 6, 89, 600, 1597};
+    const auto expected = ot::Vector<std::uint64_t>{5, 89, 1597};
+    auto all = ot::Vector<std::uint64_t>{};
+    auto first = ot::Vector<std::uint64_t>{};
+    auto none = ot::Vector<std::uint64_t>{};
+    ot::gcs::GolombMatch(N, P, ot::reader(encoded), targets, false, all);
+    ot::gcs::GolombMatch(N, P, ot::reader(encoded), targets, true, first);
+    ot::gcs::GolombMatch(N, P, ot::reader(encoded), {4, 7, 2000}, false, none);
+
+    EXPECT_EQ(all, expected);
+    ASSERT_EQ(first.size(), 1);
+    EXPECT_EQ(first.front(), expected.front());
+    EXPECT_TRUE(none.empty());
+}
+
 TEST_F(Test_Filters, gcs)
 {
     const auto s1 = ot::UnallocatedCString{"blah"};
@@ -389,6 +415,45 @@ TEST_F(Test_Filters, gcs)
     }
 }
 
+TEST_F(Test_Filters, siphash)
+{
+    const auto key = ot::UnallocatedCString{"0123456789abcdef"};
+    auto items = ot::Vector<ot::UnallocatedCString>{};
+
+    for (auto i = 0_uz; i < 67_uz; ++i) {
+        auto& item = items.emplace_back(i, '\0');
+
+        ASSERT_TRUE(
+            api_.Crypto().Util().RandomizeMemory(item.data(), item.size()));
+    }
+
+    const auto targets = [&] {
+        auto out = ot::blockchain::GCS::Targets{};
+        std::transform(
+            items.begin(),
+            items.end(),
+            std::back_inserter(out),
+            [](const auto& i) { return ot::ReadView{i}; });
+
+        return out;
+    }();
+    const auto hashes = ot::gcs::Siphash(key, targets, {});
+
+    ASSERT_EQ(hashes.size(), targets.size());
+
+    for (auto i = 0_uz; i < targets.size(); ++i) {
+        auto expected = ot::gcs::Hash{};
+
+        ASSERT_TRUE(api_.Crypto().Hash().HMAC(
+            ot::crypto::HashType::SipHash24,
+            key,
+            targets.at(i),
+            ot::preallocated(sizeof(expected), &expected)));
+        EXPECT_EQ(hashes.at(i), expected);
+        EXPECT_EQ(ot::gcs::Siphash(key, targets.at(i)), expected);
+    }
+}
+
 TEST_F(Test_Filters, bip158_case_0) { EXPECT_TRUE(TestGCSBlock(0)); }
 
 TEST_F(Test_Filters, bip158_case_49291) { EXPECT_TRUE(TestGCSBlock(49291)); }
@@ -0,0 +1,249 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+extern "C" {
+#include <lmdb.h>
+}
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "internal/util/P0330.hpp"
+#include "internal/util/TSV.hpp"
+#include "ottest/Basic.hpp"
+#include "util/LMDB.hpp"
+#include "util/MappedFileStorage.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+
+class Storage final : public ot::util::MappedFileStorage
+{
+public:
+    auto Compact(const ot::UnallocatedVector<int>& tables, bool commit)
+        const noexcept -> bool
+    {
+        if (false == compact_scan(tables)) { return false; }
+
+        auto tx = lmdb_.TransactionRW();
+        const auto out = compact(tx, tables);
+
+        EXPECT_TRUE(tx.Finalize(commit));
+
+        return out;
+    }
+    auto Read(const ot::util::IndexData& index) const noexcept -> ot::ReadView
+    {
+        return get_read_view(index);
+    }
+    auto Release(const ot::util::IndexData& index) const noexcept -> bool
+    {
+        auto tx = lmdb_.TransactionRW();
+
+        if (false == release(tx, index)) { return false; }
+
+        return tx.Finalize(true);
+    }
+    auto Write(std::size_t bytes, std::uint8_t fill) noexcept
+        -> ot::util::IndexData
+    {
+        auto index = ot::util::IndexData{};
+        auto tx = lmdb_.TransactionRW();
+        auto view = get_write_view(tx, index, bytes);
+
+        EXPECT_TRUE(view.valid(bytes));
+
+        std::memset(view.data(), fill, bytes);
+
+        EXPECT_TRUE(tx.Finalize(true));
+
+        return index;
+    }
+    auto Write(std::size_t bytes, std::uint8_t fill, int table, std::size_t key)
+        -> ot::util::IndexData
+    {
+        auto index = ot::util::IndexData{};
+        auto tx = lmdb_.TransactionRW();
+        auto view = get_write_view(
+            tx,
+            index,
+            [&](auto& inner) {
+                return lmdb_.Store(table, ot::tsv(key), ot::tsv(index), inner)
+                    .first;
+            },
+            bytes);
+
+        EXPECT_TRUE(view.valid(bytes));
+
+        std::memset(view.data(), fill, bytes);
+
+        EXPECT_TRUE(tx.Finalize(true));
+
+        return index;
+    }
+
+    Storage(
+        ot::storage::lmdb::LMDB& lmdb,
+        const ot::UnallocatedCString& folder,
+        ot::util::MappedFileParams params)
+        : MappedFileStorage(lmdb, folder, "bench", 0, 0, params)
+    {
+    }
+};
+
+class Test_MappedFileStorage : public ::testing::Test
+{
+protected:
+    static constexpr auto item_size_ = 64_uz * 1024_uz;
+    static constexpr auto free_table_ = 1;
+    static constexpr auto index_table_ = 2;
+
+    const ot::UnallocatedCString folder_;
+    ot::storage::lmdb::LMDB lmdb_;
+
+    auto load_index(std::size_t key) const noexcept -> ot::util::IndexData
+    {
+        auto out = ot::util::IndexData{};
+        lmdb_.Load(index_table_, ot::tsv(key), [&](const auto in) {
+            if (sizeof(out) == in.size()) {
+                std::memcpy(static_cast<void*>(&out), in.data(), in.size());
+            }
+        });
+
+        return out;
+    }
+
+    Test_MappedFileStorage()
+        : folder_(ScratchFolder())
+        , lmdb_(
+              {{0, "config"}, {free_table_, "free"}, {index_table_, "index"}},
+              folder_,
+              {{0, 0u},
+               {free_table_, MDB_DUPSORT | MDB_INTEGERKEY},
+               {index_table_, MDB_INTEGERKEY}},
+              0,
+              0)
+    {
+    }
+};
+
+TEST_F(Test_MappedFileStorage, reuse_released_space)
+{
+    constexpr auto count = 8_uz;
+    constexpr auto released = count / 2_uz;
+    auto params = ot::util::MappedFileParams{};
+    params.free_table_ = free_table_;
+    auto original = ot::UnallocatedVector<ot::util::IndexData>{};
+    auto end = std::size_t{};
+
+    {
+        auto storage = Storage{lmdb_, folder_, params};
+
+        for (auto i = 0_uz; i < count; ++i) {
+            original.emplace_back(
+                storage.Write(item_size_, static_cast<std::uint8_t>(i)));
+        }
+
+        for (auto i = 0_uz; i < released; ++i) {
+            EXPECT_TRUE(storage.Release(original[i]));
+        }
+
+        // NOTE released space must not be reused before a restart since
+        // readers may still hold views of it
+        const auto index = storage.Write(item_size_, 0xff);
+        end = index.position_ + index.size_;
+
+        EXPECT_GT(index.position_, original.back().position_);
+    }
+
+    auto storage = Storage{lmdb_, folder_, params};
+
+    for (auto i = 0_uz; i < released; ++i) {
+        const auto index = storage.Write(item_size_, 0xee);
+
+        EXPECT_LT(index.position_ + index.size_, end);
+    }
+
+    for (auto i = released; i < count; ++i) {
+        const auto view = storage.Read(original[i]);
+
+        ASSERT_EQ(view.size(), item_size_);
+        EXPECT_EQ(
+            static_cast<std::uint8_t>(view.data()[0]),
+            static_cast<std::uint8_t>(i));
+    }
+
+    const auto index = storage.Write(item_size_, 0xdd);
+
+    EXPECT_EQ(index.position_, end);
+}
+
+TEST_F(Test_MappedFileStorage, compact)
+{
+    constexpr auto count = 16_uz;
+    constexpr auto moved = 3_uz;
+    const auto tables = ot::UnallocatedVector<int>{index_table_};
+    auto params = ot::util::MappedFileParams{};
+    params.free_table_ = free_table_;
+    params.compact_region_ = 4_uz * item_size_;
+    const auto original = [&] {
+        auto storage = Storage{lmdb_, folder_, params};
+        auto out = ot::UnallocatedVector<ot::util::IndexData>{};
+
+        for (auto i = 0_uz; i < count; ++i) {
+            out.emplace_back(storage.Write(
+                item_size_, static_cast<std::uint8_t>(i), index_table_, i));
+        }
+
+        // NOTE three quarters of the first region and one quarter of the
+        // second region are released
+        for (const auto i : {0_uz, 1_uz, 2_uz, 4_uz}) {
+            EXPECT_TRUE(storage.Release(out[i]));
+            EXPECT_TRUE(lmdb_.Delete(index_table_, ot::tsv(i)));
+        }
+
+        // NOTE regions written during this session are never compacted
+        EXPECT_FALSE(storage.Compact(tables, true));
+
+        return out;
+    }();
+    auto storage = Storage{lmdb_, folder_, params};
+
+    EXPECT_TRUE(storage.Compact(tables, false));
+    EXPECT_EQ(load_index(moved).position_, original[moved].position_);
+
+    EXPECT_TRUE(storage.Compact(tables, true));
+
+    const auto relocated = load_index(moved);
+
+    EXPECT_EQ(relocated.size_, item_size_);
+    EXPECT_GE(relocated.position_, params.compact_region_);
+
+    // NOTE the second region has not released enough space
+    EXPECT_FALSE(storage.Compact(tables, true));
+
+    for (auto i = moved; i < count; ++i) {
+        if (4_uz == i) { continue; }
+
+        const auto view = storage.Read(load_index(i));
+
+        ASSERT_EQ(view.size(), item_size_);
+        EXPECT_EQ(
+            static_cast<std::uint8_t>(view.data()[0]),
+            static_cast<std::uint8_t>(i));
+        EXPECT_EQ(
+            static_cast<std::uint8_t>(view.data()[item_size_ - 1_uz]),
+            static_cast<std::uint8_t>(i));
+    }
+}
+}  // namespace ottest
@@ -0,0 +1,210 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+extern "C" {
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+}
+
+#include <boost/filesystem.hpp>
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <utility>
+
+#include "internal/util/P0330.hpp"
+#include "ottest/Basic.hpp"
+#include "util/LMDB.hpp"
+#include "util/MappedFileStorage.hpp"
+
+namespace fs = boost::filesystem;
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+
+class Storage final : public ot::util::MappedFileStorage
+{
+public:
+    auto Read(const ot::util::IndexData& index) const noexcept -> ot::ReadView
+    {
+        return get_read_view(index);
+    }
+    auto Write(std::size_t bytes, std::uint8_t fill) noexcept
+        -> ot::util::IndexData
+    {
+        auto index = ot::util::IndexData{};
+        auto tx = lmdb_.TransactionRW();
+        auto view = get_write_view(tx, index, bytes);
+
+        EXPECT_TRUE(view.valid(bytes));
+
+        std::memset(view.data(), fill, bytes);
+
+        EXPECT_TRUE(tx.Finalize(true));
+
+        return index;
+    }
+
+    Storage(
+        ot::storage::lmdb::LMDB& lmdb,
+        const ot::UnallocatedCString& folder,
+        ot::util::MappedFileParams params)
+        : MappedFileStorage(lmdb, folder, "bench", 0, 0, params)
+    {
+    }
+};
+
+class Test_MappedFileStorageBenchmark : public ::testing::Test
+{
+protected:
+    static constexpr auto item_size_ = 64_uz * 1024_uz;
+    static constexpr auto item_count_ = 512_uz;
+
+    struct Result {
+        long minor_faults_{};
+        long major_faults_{};
+        std::chrono::nanoseconds elapsed_{};
+        std::uint64_t checksum_{};
+    };
+
+    const ot::UnallocatedCString folder_;
+    ot::storage::lmdb::LMDB lmdb_;
+
+    // NOTE drop the backing files from the page cache so that every mode
+    // starts cold
+    auto evict() const noexcept -> void
+    {
+        for (const auto& entry : fs::directory_iterator{folder_}) {
+            if (".dat" != entry.path().extension()) { continue; }
+
+            const auto fd = ::open(entry.path().c_str(), O_RDONLY);
+
+            if (0 > fd) { continue; }
+
+            ::fdatasync(fd);
+            ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            ::close(fd);
+        }
+    }
+    static auto faults() noexcept -> std::pair<long, long>
+    {
+        auto usage = rusage{};
+        ::getrusage(RUSAGE_SELF, &usage);
+
+        return {usage.ru_minflt, usage.ru_majflt};
+    }
+
+    static auto print(const char* name, const Result& result) noexcept -> void
+    {
+        const auto perItem = result.elapsed_.count() / item_count_;
+        std::cout << name << ": " << result.minor_faults_ << " minor faults, "
+                  << result.major_faults_ << " major faults, " << perItem
+                  << " ns per item\n";
+    }
+
+    // NOTE the time and faults spent opening the storage are included so
+    // that prefetching is charged to the mode which performs it
+    auto read(
+        const ot::util::MappedFileParams& params,
+        const ot::UnallocatedVector<ot::util::IndexData>& indices) noexcept
+        -> Result
+    {
+        evict();
+        auto out = Result{};
+        const auto [minorBefore, majorBefore] = faults();
+        const auto start = std::chrono::steady_clock::now();
+        const auto storage = Storage{lmdb_, folder_, params};
+
+        for (const auto& index : indices) {
+            const auto view = storage.Read(index);
+            const auto* i = reinterpret_cast<const std::uint8_t*>(view.data());
+
+            // NOTE touch every page
+            for (auto n = 0_uz; n < view.size(); n += 4096_uz) {
+                out.checksum_ += i[n];
+            }
+        }
+
+        out.elapsed_ = std::chrono::steady_clock::now() - start;
+        const auto [minorAfter, majorAfter] = faults();
+        out.minor_faults_ = minorAfter - minorBefore;
+        out.major_faults_ = majorAfter - majorBefore;
+
+        return out;
+    }
+
+    Test_MappedFileStorageBenchmark()
+        : folder_(ScratchFolder())
+        , lmdb_({{0, "config"}}, folder_, {{0, 0u}}, 0, 0)
+    {
+    }
+};
+
+TEST_F(Test_MappedFileStorageBenchmark, access_patterns)
+{
+    using Pattern = ot::util::AccessPattern;
+    const auto sequential = [&] {
+        auto storage = Storage{lmdb_, folder_, {}};
+        auto out = ot::UnallocatedVector<ot::util::IndexData>{};
+        out.reserve(item_count_);
+
+        for (auto i = 0_uz; i < item_count_; ++i) {
+            out.emplace_back(
+                storage.Write(item_size_, static_cast<std::uint8_t>(i)));
+        }
+
+        return out;
+    }();
+    const auto random = [&] {
+        auto out = sequential;
+        std::shuffle(out.begin(), out.end(), std::mt19937_64{item_count_});
+
+        return out;
+    }();
+    const auto expected = [&] {
+        auto out = std::uint64_t{};
+
+        for (auto i = 0_uz; i < item_count_; ++i) {
+            out += (item_size_ / 4096_uz) * static_cast<std::uint8_t>(i);
+        }
+
+        return out;
+    }();
+    struct Mode {
+        const char* name_;
+        ot::util::MappedFileParams params_;
+        const ot::UnallocatedVector<ot::util::IndexData>& order_;
+    };
+    const auto modes = ot::UnallocatedVector<Mode>{
+        {"normal, sequential reads", {Pattern::normal, false, 0}, sequential},
+        {"sequential advice, sequential reads",
+         {Pattern::sequential, false, 0},
+         sequential},
+        {"normal, random reads", {Pattern::normal, false, 0}, random},
+        {"random advice, random reads", {Pattern::random, false, 0}, random},
+        {"hugepages, random reads", {Pattern::random, true, 0}, random},
+        {"prefetch, random reads",
+         {Pattern::random, false, item_count_ * item_size_},
+         random},
+    };
+
+    for (const auto& [name, params, order] : modes) {
+        // NOTE each mode gets a fresh mapping of the same files
+        const auto result = read(params, order);
+        print(name, result);
+
+        EXPECT_EQ(result.checksum_, expected);
+    }
+}
+}  // namespace ottest
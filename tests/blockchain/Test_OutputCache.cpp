@@ -0,0 +1,249 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+extern "C" {
+#include <lmdb.h>
+}
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include "blockchain/database/wallet/OutputCache.hpp"
+#include "internal/blockchain/bitcoin/block/Factory.hpp"
+#include "internal/blockchain/bitcoin/block/Output.hpp"
+#include "internal/blockchain/database/Types.hpp"
+#include "internal/util/P0330.hpp"
+#include "ottest/Basic.hpp"
+#include "util/LMDB.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+using Cache = ot::blockchain::database::wallet::OutputCache;
+using Outpoint = ot::blockchain::block::Outpoint;
+using Position = ot::blockchain::block::Position;
+using State = ot::blockchain::node::TxoState;
+using Table = ot::blockchain::database::Table;
+
+// NOTE the running totals maintained by the cache are compared against a
+// second cache populated from the same database, which calculates every
+// total from scratch
+class Test_OutputCache : public ::testing::Test
+{
+protected:
+    static constexpr auto chain_ = ot::blockchain::Type::UnitTest;
+
+    const ot::api::session::Client& api_;
+    const ot::UnallocatedCString folder_;
+    ot::storage::lmdb::LMDB lmdb_;
+    const Position blank_;
+    const Position mined_;
+    const ot::OTIdentifier account_;
+    const ot::OTIdentifier subchain_;
+    const ot::OTNymID nym_;
+    const ot::blockchain::crypto::Key key_;
+    Cache cache_;
+
+    static auto outpoint(char txid) noexcept -> Outpoint
+    {
+        return Outpoint{ot::UnallocatedCString(32_uz, txid), 0u};
+    }
+
+    auto add(char txid, std::int64_t value, State state, const Position& pos)
+        -> void
+    {
+        static constexpr auto script = std::string_view{"\x6a", 1u};
+        const auto id = outpoint(txid);
+        auto output = ot::factory::BitcoinTransactionOutput(
+            api_,
+            chain_,
+            0u,
+            value,
+            ot::network::blockchain::bitcoin::CompactSize{script.size()},
+            script);
+
+        ASSERT_TRUE(output);
+
+        auto tx = lmdb_.TransactionRW();
+
+        EXPECT_TRUE(cache_.AddOutput(
+            id, state, pos, account_, subchain_, tx, std::move(output)));
+        EXPECT_TRUE(cache_.AddToNym(nym_, id, tx));
+        EXPECT_TRUE(cache_.AddToKey(key_, id, tx));
+        EXPECT_TRUE(tx.Finalize(true));
+    }
+    auto change(char txid, State from, State to) -> void
+    {
+        auto tx = lmdb_.TransactionRW();
+
+        EXPECT_TRUE(cache_.ChangeState(from, to, outpoint(txid), tx));
+        EXPECT_TRUE(tx.Finalize(true));
+    }
+    auto check(const ot::blockchain::Balance& expected) -> void
+    {
+        auto recount = Cache{api_, lmdb_, chain_, blank_};
+        recount.Populate();
+
+        EXPECT_EQ(cache_.GetWalletBalance(), expected);
+        EXPECT_EQ(cache_.GetWalletBalance(), recount.GetWalletBalance());
+        EXPECT_EQ(
+            cache_.GetAccountBalance(account_),
+            recount.GetAccountBalance(account_));
+        EXPECT_EQ(cache_.GetAccountBalance(account_), expected);
+        EXPECT_EQ(
+            cache_.GetSubchainBalance(subchain_),
+            recount.GetSubchainBalance(subchain_));
+        EXPECT_EQ(cache_.GetNymBalance(nym_), recount.GetNymBalance(nym_));
+        EXPECT_EQ(cache_.GetNymBalance(nym_), expected);
+        EXPECT_EQ(cache_.GetKeyBalance(key_), recount.GetKeyBalance(key_));
+    }
+    static auto balance(std::int64_t confirmed, std::int64_t unconfirmed)
+        -> ot::blockchain::Balance
+    {
+        return {confirmed, unconfirmed};
+    }
+    static auto id(const ot::api::Session& api) noexcept -> ot::OTIdentifier
+    {
+        auto out = api.Factory().Identifier();
+        out->Randomize();
+
+        return out;
+    }
+    static auto nym(const ot::api::Session& api) noexcept -> ot::OTNymID
+    {
+        auto out = api.Factory().NymID();
+        out->Randomize();
+
+        return out;
+    }
+
+    Test_OutputCache()
+        : api_(ot::Context().StartClientSession(0))
+        , folder_(ScratchFolder())
+        , lmdb_(
+              {{Table::Config, "config"},
+               {Table::WalletOutputs, "wallet_outputs"},
+               {Table::AccountOutputs, "account_outputs"},
+               {Table::NymOutputs, "nym_outputs"},
+               {Table::PositionOutputs, "position_outputs"},
+               {Table::StateOutputs, "state_outputs"},
+               {Table::SubchainOutputs, "subchain_outputs"},
+               {Table::KeyOutputs, "key_outputs"}},
+              folder_,
+              {{Table::Config, MDB_INTEGERKEY},
+               {Table::WalletOutputs, 0},
+               {Table::AccountOutputs, MDB_DUPSORT},
+               {Table::NymOutputs, MDB_DUPSORT},
+               {Table::PositionOutputs, MDB_DUPSORT | MDB_DUPFIXED},
+               {Table::StateOutputs, MDB_DUPSORT | MDB_DUPFIXED},
+               {Table::SubchainOutputs, MDB_DUPSORT},
+               {Table::KeyOutputs, MDB_DUPSORT}})
+        , blank_()
+        , mined_(1, ot::UnallocatedCString(32_uz, 'm'))
+        , account_(id(api_))
+        , subchain_(id(api_))
+        , nym_(nym(api_))
+        , key_(account_->str(), ot::blockchain::crypto::Subchain::External, 7u)
+        , cache_(api_, lmdb_, chain_, blank_)
+    {
+        cache_.Populate();
+    }
+};
+
+TEST_F(Test_OutputCache, add)
+{
+    check(balance(0, 0));
+
+    add('a', 100, State::ConfirmedNew, mined_);
+    check(balance(100, 100));
+
+    add('b', 20, State::UnconfirmedNew, blank_);
+    check(balance(100, 120));
+
+    // NOTE outputs in other states do not contribute to the balance
+    add('c', 5, State::ConfirmedSpend, mined_);
+    check(balance(100, 120));
+}
+
+TEST_F(Test_OutputCache, change_state)
+{
+    add('a', 100, State::UnconfirmedNew, blank_);
+    add('b', 50, State::ConfirmedNew, mined_);
+    check(balance(50, 150));
+
+    // NOTE confirmation
+    change('a', State::UnconfirmedNew, State::ConfirmedNew);
+    check(balance(150, 150));
+
+    // NOTE a spend is still counted in the confirmed balance until the
+    // spending transaction confirms
+    change('b', State::ConfirmedNew, State::UnconfirmedSpend);
+    check(balance(150, 100));
+
+    change('b', State::UnconfirmedSpend, State::ConfirmedSpend);
+    check(balance(100, 100));
+
+    // NOTE unconfirm
+    change('a', State::ConfirmedNew, State::UnconfirmedNew);
+    check(balance(0, 100));
+
+    // NOTE repeating a transition does not count the output twice
+    change('a', State::UnconfirmedNew, State::UnconfirmedNew);
+    check(balance(0, 100));
+}
+
+TEST_F(Test_OutputCache, reorg)
+{
+    add('a', 100, State::ConfirmedNew, mined_);
+    add('b', 40, State::ConfirmedSpend, mined_);
+    add('c', 7, State::ConfirmedNew, mined_);
+    check(balance(107, 107));
+
+    // NOTE the rollback performed by Output::StartReorg for the outputs of
+    // a disconnected block
+    for (const auto& [txid, from, to] : {
+             std::make_tuple('a', State::ConfirmedNew, State::UnconfirmedNew),
+             std::make_tuple(
+                 'b', State::ConfirmedSpend, State::UnconfirmedSpend),
+             std::make_tuple('c', State::ConfirmedNew, State::UnconfirmedNew),
+         }) {
+        auto tx = lmdb_.TransactionRW();
+
+        EXPECT_TRUE(cache_.ChangeState(from, to, outpoint(txid), tx));
+        EXPECT_TRUE(
+            cache_.ChangePosition(mined_, blank_, outpoint(txid), tx));
+        EXPECT_TRUE(tx.Finalize(true));
+    }
+
+    check(balance(40, 107));
+}
+
+TEST_F(Test_OutputCache, clear)
+{
+    add('a', 100, State::ConfirmedNew, mined_);
+    add('b', 30, State::UnconfirmedSpend, mined_);
+    check(balance(130, 100));
+
+    cache_.Clear();
+
+    EXPECT_EQ(cache_.GetWalletBalance(), balance(0, 0));
+    EXPECT_EQ(cache_.GetAccountBalance(account_), balance(0, 0));
+
+    // NOTE totals are rebuilt when the cache is repopulated after an error
+    cache_.Populate();
+    check(balance(130, 100));
+
+    add('c', 1, State::UnconfirmedNew, blank_);
+    change('b', State::UnconfirmedSpend, State::ConfirmedSpend);
+    check(balance(100, 101));
+}
+}  // namespace ottest
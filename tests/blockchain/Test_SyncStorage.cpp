@@ -0,0 +1,225 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+extern "C" {
+#include <lmdb.h>
+}
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <memory>
+
+#include "blockchain/database/common/Sync.hpp"
+#include "internal/blockchain/database/common/Common.hpp"
+#include "internal/util/P0330.hpp"
+#include "ottest/Basic.hpp"
+#include "util/LMDB.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+using Height = ot::blockchain::block::Height;
+using Sync = ot::blockchain::database::common::Sync;
+using Table = ot::blockchain::database::common::Table;
+
+class Test_SyncStorage : public ::testing::Test
+{
+protected:
+    static constexpr auto chain_ = ot::blockchain::Type::UnitTest;
+
+    const ot::api::session::Client& api_;
+    const ot::UnallocatedCString folder_;
+    ot::storage::lmdb::LMDB lmdb_;
+    std::unique_ptr<Sync> sync_;
+
+    static auto item(Height height, char tag) noexcept
+        -> ot::network::p2p::Block
+    {
+        const auto header = ot::UnallocatedCString(80_uz, tag);
+        const auto filter = ot::UnallocatedCString(16_uz, tag);
+
+        return {
+            chain_,
+            height,
+            ot::blockchain::cfilter::Type::ES,
+            1u,
+            header,
+            filter};
+    }
+    static auto items(Height first, Height last, char tag) noexcept
+        -> ot::network::p2p::SyncData
+    {
+        auto out = ot::network::p2p::SyncData{};
+
+        for (auto height = first; height <= last; ++height) {
+            out.emplace_back(item(height, tag));
+        }
+
+        return out;
+    }
+    static auto serialize(Height height, char tag) noexcept -> ot::Space
+    {
+        auto out = ot::Space{};
+        item(height, tag).Serialize(ot::writer(out));
+
+        return out;
+    }
+
+    // NOTE expected contains the tag of every packet after start
+    auto check(Height start, const ot::UnallocatedCString& expected) const
+        noexcept -> void
+    {
+        auto message = ot::network::zeromq::Message{};
+        const auto loaded = sync_->Load(chain_, start, message);
+
+        EXPECT_EQ(loaded, (false == expected.empty()));
+        ASSERT_EQ(message.size(), expected.size());
+
+        for (auto i = 0_uz; i < expected.size(); ++i) {
+            const auto height = start + 1 + static_cast<Height>(i);
+
+            EXPECT_EQ(
+                message.at(i).Bytes(),
+                ot::reader(serialize(height, expected[i])));
+        }
+    }
+    auto corrupt(Height height) noexcept -> void
+    {
+        const auto table = ot::blockchain::database::common::ChainToSyncTable(
+            chain_);
+        const auto key = static_cast<std::size_t>(height);
+        auto value = ot::Space{};
+        lmdb_.Load(table, key, [&](const auto in) {
+            value = ot::space(in);
+        });
+
+        ASSERT_FALSE(value.empty());
+
+        // NOTE the checksum is stored after the index data
+        value.back() = ~value.back();
+
+        EXPECT_TRUE(lmdb_.Store(table, key, ot::reader(value)).first);
+    }
+    // NOTE packets written by an instance are known to be valid so only a
+    // new instance has to verify them against their checksums
+    auto reopen() noexcept -> void
+    {
+        sync_.reset();
+        sync_ = std::make_unique<Sync>(api_, lmdb_, folder_);
+    }
+
+    Test_SyncStorage()
+        : api_(ot::Context().StartClientSession(0))
+        , folder_(ScratchFolder())
+        , lmdb_(
+              [] {
+                  auto out = ot::storage::lmdb::TableNames{
+                      {Table::Config, "config"},
+                      {Table::SyncTips, "sync_tips"}};
+
+                  for (const auto& [table, name] :
+                       ot::blockchain::database::common::SyncTables()) {
+                      out.emplace(table, name);
+                  }
+
+                  return out;
+              }(),
+              folder_,
+              [] {
+                  auto out = ot::storage::lmdb::TablesToInit{
+                      {Table::Config, MDB_INTEGERKEY},
+                      {Table::SyncTips, MDB_INTEGERKEY}};
+
+                  for (const auto& [table, name] :
+                       ot::blockchain::database::common::SyncTables()) {
+                      out.emplace_back(table, MDB_INTEGERKEY);
+                  }
+
+                  return out;
+              }())
+        , sync_(std::make_unique<Sync>(api_, lmdb_, folder_))
+    {
+    }
+};
+
+TEST_F(Test_SyncStorage, store_invalidates_ranges)
+{
+    ASSERT_TRUE(sync_->Store(chain_, items(1, 10, 'a')));
+
+    check(0, "aaaaaaaaaa");
+    check(4, "aaaaaa");
+
+    // NOTE extending the chain must not serve the shorter cached ranges
+    ASSERT_TRUE(sync_->Store(chain_, items(11, 12, 'b')));
+
+    check(0, "aaaaaaaaaabb");
+    check(4, "aaaaaabb");
+
+    // NOTE replacing stored packets implies a reorg
+    ASSERT_TRUE(sync_->Store(chain_, items(6, 8, 'c')));
+
+    EXPECT_EQ(sync_->Tip(chain_), 8);
+
+    check(0, "aaaaaccc");
+    check(4, "accc");
+    check(8, "");
+    check(10, "");
+}
+
+TEST_F(Test_SyncStorage, reorg_invalidates_ranges)
+{
+    ASSERT_TRUE(sync_->Store(chain_, items(1, 10, 'a')));
+
+    check(0, "aaaaaaaaaa");
+    check(2, "aaaaaaaa");
+    check(7, "aaa");
+
+    ASSERT_TRUE(sync_->Reorg(chain_, 5));
+
+    EXPECT_EQ(sync_->Tip(chain_), 5);
+
+    check(0, "aaaaa");
+    check(2, "aaa");
+    check(7, "");
+
+    ASSERT_TRUE(sync_->Store(chain_, items(6, 7, 'b')));
+
+    check(0, "aaaaabb");
+    check(2, "aaabb");
+}
+
+TEST_F(Test_SyncStorage, corrupt_packet)
+{
+    ASSERT_TRUE(sync_->Store(chain_, items(1, 10, 'a')));
+
+    check(0, "aaaaaaaaaa");
+
+    reopen();
+    corrupt(6);
+
+    // NOTE the first packet which fails verification and everything after it
+    // is discarded
+    check(0, "aaaaa");
+
+    EXPECT_EQ(sync_->Tip(chain_), 5);
+
+    // NOTE later requests neither serve the rejected packet from the range
+    // cache nor treat its height as verified
+    check(0, "aaaaa");
+    check(3, "aa");
+    check(5, "");
+
+    ASSERT_TRUE(sync_->Store(chain_, items(6, 6, 'b')));
+
+    check(0, "aaaaab");
+
+    reopen();
+
+    check(0, "aaaaab");
+}
+}  // namespace ottest
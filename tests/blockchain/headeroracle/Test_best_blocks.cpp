@@ -0,0 +1,232 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+extern "C" {
+#include <lmdb.h>
+}
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <optional>
+
+#include "blockchain/database/Headers.hpp"
+#include "internal/api/network/Blockchain.hpp"
+#include "internal/blockchain/database/Types.hpp"
+#include "internal/util/P0330.hpp"
+#include "internal/util/TSV.hpp"
+#include "ottest/Basic.hpp"
+#include "ottest/fixtures/blockchain/HeaderOracle.hpp"
+#include "util/LMDB.hpp"
+
+namespace ottest
+{
+using namespace opentxs::literals;
+namespace db = ot::blockchain::database;
+using Mode = ot::storage::lmdb::LMDB::Mode;
+
+// NOTE batch loads are compared against the same keys loaded one at a time.
+// The best chain table is filled directly so heights past tip_ and the
+// height at gap_ have no entry.
+class Test_BestBlocks : public Test_HeaderOracle
+{
+protected:
+    static constexpr auto tip_ = 40_uz;
+    static constexpr auto gap_ = 30_uz;
+
+    const ot::UnallocatedCString folder_;
+    ot::storage::lmdb::LMDB lmdb_;
+    const db::Headers headers_;
+
+    static auto hash(std::size_t height) noexcept -> bb::Hash
+    {
+        auto out = ot::UnallocatedCString(32_uz, 'x');
+        out[0] = static_cast<char>(height);
+
+        return bb::Hash{out};
+    }
+    auto single(std::size_t height) const noexcept -> std::optional<bb::Hash>
+    {
+        auto out = std::optional<bb::Hash>{};
+        lmdb_.Load(db::BlockHeaderBest, height, [&](const auto in) {
+            out.emplace(in);
+        });
+
+        return out;
+    }
+
+    Test_BestBlocks()
+        : Test_HeaderOracle()
+        , folder_(ScratchFolder())
+        , lmdb_(
+              {{db::Config, "config"},
+               {db::BlockHeaderMetadata, "block_header_metadata"},
+               {db::BlockHeaderBest, "best_header_chain"},
+               {db::ChainData, "block_header_data"},
+               {db::BlockHeaderSiblings, "block_siblings"},
+               {db::BlockHeaderDisconnected, "disconnected_block_headers"}},
+              folder_,
+              {{db::Config, MDB_INTEGERKEY},
+               {db::BlockHeaderMetadata, 0},
+               {db::BlockHeaderBest, MDB_INTEGERKEY},
+               {db::ChainData, MDB_INTEGERKEY},
+               {db::BlockHeaderSiblings, 0},
+               {db::BlockHeaderDisconnected, MDB_DUPSORT}})
+        , headers_(
+              api_,
+              network_->Internal(),
+              api_.Network().Blockchain().Internal().Database(),
+              lmdb_,
+              type_)
+    {
+        for (auto height = 1_uz; height <= tip_; ++height) {
+            if (gap_ == height) { continue; }
+
+            const auto id = hash(height);
+            lmdb_.Store(db::BlockHeaderBest, height, id.Bytes());
+        }
+    }
+};
+
+TEST_F(Test_BestBlocks, load_batch)
+{
+    auto heights = ot::Vector<std::size_t>{5, 0, gap_, 17, tip_ + 1, 3, 17};
+    auto keys = ot::Vector<ot::ReadView>{};
+
+    for (const auto& height : heights) { keys.emplace_back(ot::tsv(height)); }
+
+    // NOTE invalid keys are skipped
+    keys.emplace_back();
+    auto output = ot::Vector<ot::Space>{};
+    const auto found = lmdb_.LoadBatch(db::BlockHeaderBest, keys, output);
+
+    ASSERT_EQ(output.size(), keys.size());
+    EXPECT_EQ(found, 5_uz);
+
+    for (auto i = 0_uz; i < heights.size(); ++i) {
+        const auto expected = single(heights[i]);
+
+        if (expected.has_value()) {
+            EXPECT_EQ(ot::reader(output[i]), expected->Bytes());
+        } else {
+            EXPECT_TRUE(output[i].empty());
+        }
+    }
+
+    EXPECT_TRUE(output.back().empty());
+}
+
+TEST_F(Test_BestBlocks, load_batch_transaction)
+{
+    auto heights = ot::Vector<std::size_t>{tip_, gap_, 1};
+    auto keys = ot::Vector<ot::ReadView>{};
+
+    for (const auto& height : heights) { keys.emplace_back(ot::tsv(height)); }
+
+    auto tx = lmdb_.TransactionRW();
+    const auto extra = hash(gap_);
+
+    // NOTE uncommitted writes are visible to a batch in the same transaction
+    const auto stored =
+        lmdb_.Store(db::BlockHeaderBest, gap_, extra.Bytes(), tx);
+
+    ASSERT_TRUE(stored.first);
+
+    auto loaded = ot::Vector<ot::Vector<ot::Space>>(heights.size());
+    const auto found = lmdb_.LoadBatch(
+        db::BlockHeaderBest,
+        keys,
+        [&](const auto i, const auto in) {
+            loaded[i].emplace_back(ot::space(in));
+        },
+        tx);
+
+    EXPECT_EQ(found, 3_uz);
+
+    for (auto i = 0_uz; i < heights.size(); ++i) {
+        ASSERT_EQ(loaded[i].size(), 1_uz);
+        EXPECT_EQ(ot::reader(loaded[i][0]), hash(heights[i]).Bytes());
+    }
+
+    EXPECT_TRUE(tx.Finalize(false));
+    EXPECT_FALSE(single(gap_).has_value());
+}
+
+TEST_F(Test_BestBlocks, load_batch_multiple)
+{
+    const auto first = ot::UnallocatedCString{"first"};
+    const auto second = ot::UnallocatedCString{"second"};
+    const auto other = ot::UnallocatedCString{"other"};
+    const auto values = ot::UnallocatedVector<ot::UnallocatedCString>{
+        "value 1", "value 2", "value 3"};
+
+    for (const auto& value : values) {
+        lmdb_.Store(db::BlockHeaderDisconnected, first, value);
+    }
+
+    lmdb_.Store(db::BlockHeaderDisconnected, second, values.front());
+    const auto keys = ot::Vector<ot::ReadView>{first, other, second};
+    auto batch =
+        ot::Vector<ot::UnallocatedVector<ot::UnallocatedCString>>(keys.size());
+    const auto found = lmdb_.LoadBatch(
+        db::BlockHeaderDisconnected,
+        keys,
+        [&](const auto i, const auto in) { batch[i].emplace_back(in); },
+        Mode::Multiple);
+
+    EXPECT_EQ(found, 2_uz);
+
+    for (auto i = 0_uz; i < keys.size(); ++i) {
+        auto expected = ot::UnallocatedVector<ot::UnallocatedCString>{};
+        lmdb_.Load(
+            db::BlockHeaderDisconnected,
+            keys[i],
+            [&](const auto in) { expected.emplace_back(in); },
+            Mode::Multiple);
+
+        EXPECT_EQ(batch[i], expected);
+    }
+}
+
+TEST_F(Test_BestBlocks, best_blocks)
+{
+    constexpr auto gap = static_cast<bb::Height>(gap_);
+    constexpr auto tip = static_cast<bb::Height>(tip_);
+    const auto check = [this](bb::Height start, std::size_t count) {
+        const auto batch =
+            headers_.BestBlocks(start, count, ot::alloc::System());
+        auto expected = ot::Vector<bb::Hash>{};
+
+        for (auto height = start; 0 <= height; ++height) {
+            if (expected.size() == count) { break; }
+
+            const auto id = headers_.BestBlock(height);
+
+            if (id.IsNull()) { break; }
+
+            expected.emplace_back(id);
+        }
+
+        EXPECT_EQ(batch, expected);
+
+        return batch.size();
+    };
+
+    EXPECT_EQ(check(0, 10), 10_uz);
+    EXPECT_EQ(check(7, 1), 1_uz);
+    EXPECT_EQ(check(0, 0), 0_uz);
+    EXPECT_EQ(check(-1, 5), 0_uz);
+
+    // NOTE the batch stops at the first missing height
+    EXPECT_EQ(check(0, 100), gap_);
+    EXPECT_EQ(check(gap - 2, 5), 2_uz);
+    EXPECT_EQ(check(gap, 5), 0_uz);
+
+    // NOTE a count past the tip returns only the heights which exist
+    EXPECT_EQ(check(gap + 1, 100), tip_ - gap_);
+    EXPECT_EQ(check(tip, 3), 1_uz);
+    EXPECT_EQ(check(tip + 1, 3), 0_uz);
+}
+}  // namespace ottest
@@ -0,0 +1,118 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <chrono>
+#include <memory>
+
+#include "internal/blockchain/node/filteroracle/FilterOracle.hpp"
+#include "internal/blockchain/node/filteroracle/Types.hpp"
+#include "ottest/fixtures/blockchain/Regtest.hpp"
+
+namespace ottest
+{
+using namespace std::literals::chrono_literals;
+
+// NOTE the miner runs with the server profile so its filter oracle indexes
+// every mined block through the batched BlockIndexer pipeline. The expected
+// cfheader chain is recalculated one block at a time through the serial path.
+class Regtest_block_indexer : public Regtest_fixture_single
+{
+protected:
+    auto chain() const noexcept -> const ot::blockchain::node::Manager&
+    {
+        return miner_.Network().Blockchain().GetChain(test_chain_);
+    }
+
+    auto WaitForFilters() const noexcept -> bool
+    {
+        const auto& header = chain().HeaderOracle();
+        const auto& filter = chain().FilterOracle();
+        const auto type = filter.DefaultType();
+        const auto start = ot::Clock::now();
+        const auto limit = 2min;
+
+        while ((ot::Clock::now() - start) < limit) {
+            if (filter.FilterTip(type) == header.BestChain()) { return true; }
+
+            ot::Sleep(100ms);
+        }
+
+        return false;
+    }
+
+    auto CompareWithSerial() const noexcept -> void
+    {
+        const auto& header = chain().HeaderOracle();
+        const auto& block = chain().BlockOracle();
+        const auto& filter = chain().FilterOracle();
+        const auto type = filter.DefaultType();
+        const auto best = header.BestChain();
+        auto previous = filter.LoadFilterHeader(
+            type, ot::blockchain::node::HeaderOracle::GenesisBlockHash(
+                      test_chain_));
+
+        ASSERT_FALSE(previous.IsNull());
+
+        for (auto height = Height{1}; height <= best.height_; ++height) {
+            const auto hash = header.BestHash(height);
+            const auto pBlock = block.LoadBitcoin(hash).get();
+
+            ASSERT_TRUE(pBlock);
+
+            const auto expected =
+                filter.Internal().ProcessBlock(type, *pBlock, {});
+
+            ASSERT_TRUE(expected.IsValid());
+
+            const auto cfheader = expected.Header(previous);
+            const auto stored = filter.LoadFilter(type, hash, {});
+
+            ASSERT_TRUE(stored.IsValid());
+            EXPECT_EQ(stored.Hash().asHex(), expected.Hash().asHex());
+            EXPECT_EQ(
+                filter.LoadFilterHeader(type, hash).asHex(), cfheader.asHex());
+
+            previous = cfheader;
+        }
+    }
+};
+
+TEST_F(Regtest_block_indexer, init_opentxs) {}
+
+TEST_F(Regtest_block_indexer, start_chains) { EXPECT_TRUE(Start()); }
+
+TEST_F(Regtest_block_indexer, batched_matches_serial)
+{
+    constexpr auto count{600};
+
+    ASSERT_TRUE(Mine(0, count));
+    ASSERT_TRUE(WaitForFilters());
+
+    CompareWithSerial();
+
+    EXPECT_GT(chain().FilterOracle().Internal().IndexerStats().batches_, 0);
+}
+
+TEST_F(Regtest_block_indexer, partial_batch_reorg)
+{
+    const auto before = chain().FilterOracle().Internal().IndexerStats();
+
+    // NOTE replace the last few blocks of the previous run and extend past
+    // them so the indexer has to roll back part of an already indexed batch
+    ASSERT_TRUE(Mine(height_ - 5, 12));
+    ASSERT_TRUE(WaitForFilters());
+
+    CompareWithSerial();
+
+    const auto after = chain().FilterOracle().Internal().IndexerStats();
+
+    EXPECT_GT(after.batches_, before.batches_);
+    EXPECT_GE(after.store_.blocks_, before.store_.blocks_ + 12u);
+}
+
+TEST_F(Regtest_block_indexer, shutdown) { Shutdown(); }
+}  // namespace ottest
@@ -7,8 +7,12 @@
 #include <boost/multiprecision/cpp_int.hpp>
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <limits>
 #include <memory>
+#include <new>
 #include <stdexcept>
 #include <utility>
 
@@ -18,6 +22,28 @@
 namespace ot = opentxs;
 namespace bmp = boost::multiprecision;
 
+namespace ottest
+{
+// NOTE only allocations made by the test thread are counted
+thread_local std::size_t allocations_{0};
+}  // namespace ottest
+
+auto operator new(std::size_t size) -> void*
+{
+    ++ottest::allocations_;
+
+    if (auto* out = std::malloc(size); nullptr != out) { return out; }
+
+    throw std::bad_alloc{};
+}
+
+auto operator delete(void* ptr) noexcept -> void { std::free(ptr); }
+
+auto operator delete(void* ptr, std::size_t) noexcept -> void
+{
+    std::free(ptr);
+}
+
 namespace ottest
 {
 constexpr auto int_max = std::numeric_limits<int>::max();
@@ -35,6 +61,28 @@ constexpr auto ulonglong_max =
 constexpr auto ulonglong_min =
     std::numeric_limits<unsigned long long int>::min();
 
+auto serialize(const ot::Amount& amount) -> ot::UnallocatedCString
+{
+    auto out = ot::UnallocatedCString{};
+    amount.Serialize(ot::writer(out));
+
+    return out;
+}
+
+// NOTE fixed point multiplication as performed by the big integer backend
+auto multiply(const ot::amount::Integer& lhs, const ot::amount::Integer& rhs)
+    -> ot::amount::Integer
+{
+    const auto product = ot::amount::Integer{lhs * rhs};
+
+    if (product < 0) {
+
+        return -ot::amount::Integer{-product >> ot::amount::fractional_bits_};
+    }
+
+    return product >> ot::amount::fractional_bits_;
+}
+
 TEST(Amount, limits)
 {
     try {
@@ -63,6 +111,76 @@ TEST(Amount, limits)
     }
 }
 
+TEST(Amount, inline_limits)
+{
+    // NOTE the largest and smallest values which are stored without
+    // allocating are -2^127 and 2^127 - 1 in fixed point
+    const auto limit = ot::amount::Integer{1}
+                       << (2 * ot::amount::fractional_bits_ - 1);
+    const auto max = ot::factory::Amount(ot::amount::Integer{limit - 1}.str());
+    const auto min = ot::factory::Amount(ot::amount::Integer{-limit}.str());
+    const auto epsilon = ot::factory::Amount("1");
+
+    EXPECT_EQ(serialize(max), ot::amount::Integer{limit - 1}.str());
+    EXPECT_EQ(serialize(min), ot::amount::Integer{-limit}.str());
+    EXPECT_EQ(serialize(max + epsilon), limit.str());
+    EXPECT_EQ(serialize(min - epsilon), ot::amount::Integer{-limit - 1}.str());
+    EXPECT_EQ(serialize(-ot::Amount{min}), limit.str());
+    EXPECT_EQ(max + epsilon - epsilon, max);
+    EXPECT_EQ(min - epsilon + epsilon, min);
+    EXPECT_LT(max, max + epsilon);
+    EXPECT_GT(min, min - epsilon);
+    EXPECT_EQ(-(-ot::Amount{min}), min);
+    EXPECT_EQ(min / -1, -ot::Amount{min});
+    EXPECT_EQ(max * 2, max + max);
+
+    const auto big = static_cast<unsigned long long>(longlong_max) + 1u;
+    const auto first = ot::Amount{longlong_max} + ot::Amount{1};
+    const auto second = ot::Amount{longlong_min} - ot::Amount{1};
+
+    EXPECT_EQ(first, ot::Amount{big});
+    EXPECT_EQ(second - ot::Amount{longlong_min}, -1);
+    EXPECT_EQ(-ot::Amount{longlong_min}, first);
+    EXPECT_EQ(first.Internal().ExtractUInt64(), big);
+}
+
+TEST(Amount, inline_rounding)
+{
+    const auto values = ot::UnallocatedVector<ot::amount::Integer>{
+        ot::amount::Integer{0},
+        ot::amount::Integer{1},
+        ot::amount::Integer{-1},
+        ot::amount::Integer{"18446744073709551615"},
+        ot::amount::Integer{"-18446744073709551617"},
+        ot::amount::Integer{"55340232221128654848"},
+        ot::amount::Integer{"-92233720368547758085"},
+        ot::amount::Integer{"170141183460469231731687303715884105727"},
+        ot::amount::Integer{"-170141183460469231731687303715884105728"},
+    };
+
+    for (const auto& lhs : values) {
+        const auto amount = ot::factory::Amount(lhs.str());
+
+        EXPECT_EQ(serialize(amount * 3), ot::amount::Integer{lhs * 3}.str());
+        EXPECT_EQ(serialize(amount / 7), ot::amount::Integer{lhs / 7}.str());
+        EXPECT_EQ(serialize(amount / -2), ot::amount::Integer{lhs / -2}.str());
+
+        for (const auto& rhs : values) {
+            const auto other = ot::factory::Amount(rhs.str());
+
+            EXPECT_EQ(serialize(amount * other), multiply(lhs, rhs).str());
+            EXPECT_EQ(amount < other, lhs < rhs);
+            EXPECT_EQ(amount == other, lhs == rhs);
+        }
+    }
+
+    EXPECT_EQ(ot::signed_amount(-7, 5, 10) / ot::Amount{2}, -3);
+    EXPECT_EQ(ot::signed_amount(7, 5, 10) / ot::Amount{-2}, -3);
+    EXPECT_EQ(ot::Amount{-7} / ot::signed_amount(2, 5, 10), -2);
+    EXPECT_EQ(ot::signed_amount(-1, 5, 10).Internal().ExtractInt64(), -1);
+    EXPECT_EQ(ot::signed_amount(0, 5, 10).Internal().ExtractInt64(), 0);
+}
+
 TEST(Amount, default_constructor)
 {
     const auto amount = ot::Amount();
@@ -779,4 +897,37 @@ TEST(Amount, modulo)
 
     ASSERT_TRUE(ulonglong_amount % ot::Amount{2} == 1);
 }
+
+TEST(Amount, inline_allocations)
+{
+    auto bytes = ot::UnallocatedCString{};
+    bytes.reserve(ot::internal::Amount::SerializeBitcoinSize());
+    const auto rate = ot::signed_amount(0, 25, 100);
+    const auto before = allocations_;
+    auto value = ot::Amount{100000000};
+    auto copy = ot::Amount{value};
+    const auto moved = ot::Amount{std::move(copy)};
+    auto sum = value + moved;
+    sum -= rate;
+    const auto product = sum * rate;
+    const auto scaled = product * 3;
+    const auto quotient = scaled / ot::Amount{7};
+    auto divided = quotient / 2;
+    const auto negated = -divided;
+    const auto less = negated < value;
+    const auto equal = (value == 100000000);
+    const auto extracted = value.Internal().ExtractUInt64();
+    value.Internal().SerializeBitcoin(ot::writer(bytes));
+    const auto small = allocations_ - before;
+    const auto large = ot::Amount{std::numeric_limits<std::uint64_t>::max()};
+    const auto promoted = allocations_ - before - small;
+
+    // NOTE values which fit in the inline representation never allocate
+    EXPECT_EQ(small, 0u);
+    EXPECT_GT(promoted, 0u);
+    EXPECT_TRUE(less);
+    EXPECT_TRUE(equal);
+    EXPECT_EQ(extracted, 100000000u);
+    EXPECT_GT(large, value);
+}
 }  // namespace ottest
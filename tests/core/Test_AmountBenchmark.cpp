@@ -0,0 +1,195 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <string_view>
+
+#include "internal/core/Amount.hpp"
+#include "internal/core/Factory.hpp"
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+// NOTE only allocations made by the benchmark thread are counted
+thread_local std::size_t allocations_{0};
+}  // namespace ottest
+
+auto operator new(std::size_t size) -> void*
+{
+    ++ottest::allocations_;
+
+    if (auto* out = std::malloc(size); nullptr != out) { return out; }
+
+    throw std::bad_alloc{};
+}
+
+auto operator delete(void* ptr) noexcept -> void { std::free(ptr); }
+
+auto operator delete(void* ptr, std::size_t) noexcept -> void
+{
+    std::free(ptr);
+}
+
+namespace ottest
+{
+constexpr auto iterations_ = std::size_t{1000000};
+
+struct Result {
+    double nanoseconds_{};
+    std::size_t allocations_{};
+};
+
+template <typename Op>
+auto measure(std::string_view name, Op op) noexcept -> Result
+{
+    auto sink = ot::Amount{};
+    const auto allocations = allocations_;
+    const auto start = std::chrono::steady_clock::now();
+
+    for (auto i = std::size_t{0}; i < iterations_; ++i) { op(i, sink); }
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto out = Result{
+        static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                .count()) /
+            iterations_,
+        allocations_ - allocations};
+    std::cout << name << ": " << out.nanoseconds_ << " ns/op, "
+              << static_cast<double>(out.allocations_) / iterations_
+              << " allocations/op" << std::endl;
+
+    return out;
+}
+
+const auto large_ = ot::factory::Amount(
+    "115792089237316195423570985008687907853"
+    "269984665640564039457584007913129639935");
+
+TEST(AmountBenchmark, construct)
+{
+    const auto small = measure("construct small", [](auto i, auto& sink) {
+        sink = ot::Amount{static_cast<std::int64_t>(i)};
+    });
+    const auto large = measure("construct large", [](auto i, auto& sink) {
+        sink = ot::Amount{std::numeric_limits<std::uint64_t>::max() - i};
+    });
+
+    EXPECT_EQ(small.allocations_, 0u);
+    EXPECT_EQ(large.allocations_, iterations_);
+}
+
+TEST(AmountBenchmark, copy)
+{
+    const auto value = ot::Amount{100000000};
+    const auto small = measure(
+        "copy small", [&](auto, auto& sink) { sink = ot::Amount{value}; });
+    const auto large = measure(
+        "copy large", [&](auto, auto& sink) { sink = ot::Amount{large_}; });
+
+    EXPECT_EQ(small.allocations_, 0u);
+    EXPECT_EQ(large.allocations_, iterations_);
+}
+
+TEST(AmountBenchmark, add)
+{
+    const auto value = ot::signed_amount(0, 5, 10);
+    const auto small =
+        measure("add small", [&](auto, auto& sink) { sink += value; });
+    const auto large = measure("add large", [&](auto, auto& sink) {
+        sink = (large_ - value) + value;
+    });
+
+    EXPECT_EQ(small.allocations_, 0u);
+    EXPECT_GT(large.allocations_, 0u);
+}
+
+TEST(AmountBenchmark, compare)
+{
+    const auto value = ot::Amount{50000};
+    auto count = std::size_t{0};
+    const auto small = measure("compare small", [&](auto i, auto&) {
+        if (ot::Amount{static_cast<std::int64_t>(i)} < value) { ++count; }
+    });
+    const auto integral = measure("compare integral", [&](auto i, auto&) {
+        if (value < static_cast<std::int64_t>(i)) { ++count; }
+    });
+    const auto large = measure("compare large", [&](auto, auto&) {
+        if (value < large_) { ++count; }
+    });
+
+    EXPECT_EQ(count, 2u * iterations_ - 1u);
+    EXPECT_EQ(small.allocations_, 0u);
+    EXPECT_EQ(integral.allocations_, 0u);
+    EXPECT_EQ(large.allocations_, 0u);
+}
+
+TEST(AmountBenchmark, multiply)
+{
+    const auto rate = ot::signed_amount(0, 25, 100);
+    const auto small = measure("multiply small", [&](auto i, auto& sink) {
+        sink = ot::Amount{static_cast<std::int64_t>(i)} * rate;
+    });
+    const auto integral = measure("multiply integral", [&](auto i, auto& sink) {
+        sink = rate * static_cast<std::int64_t>(i);
+    });
+
+    EXPECT_EQ(small.allocations_, 0u);
+    EXPECT_EQ(integral.allocations_, 0u);
+}
+
+TEST(AmountBenchmark, divide)
+{
+    const auto value = ot::Amount{1000000};
+    const auto small = measure("divide small", [&](auto i, auto& sink) {
+        sink = value / ot::Amount{static_cast<std::int64_t>(i + 1u)};
+    });
+    const auto integral = measure("divide integral", [&](auto i, auto& sink) {
+        sink = value / static_cast<std::int64_t>(i + 1u);
+    });
+
+    EXPECT_EQ(small.allocations_, 0u);
+    EXPECT_EQ(integral.allocations_, 0u);
+}
+
+TEST(AmountBenchmark, extract)
+{
+    const auto value = ot::Amount{2100000000};
+    auto total = std::uint64_t{0};
+    const auto small = measure("extract small", [&](auto, auto&) {
+        total += value.Internal().ExtractUInt64();
+    });
+
+    EXPECT_EQ(total, 2100000000u * iterations_);
+    EXPECT_EQ(small.allocations_, 0u);
+}
+
+TEST(AmountBenchmark, serialize)
+{
+    const auto value = ot::Amount{2100000000000000};
+    auto bytes = ot::UnallocatedCString{};
+    auto text = ot::UnallocatedCString{};
+    bytes.reserve(ot::internal::Amount::SerializeBitcoinSize());
+    text.reserve(100);
+    const auto bitcoin = measure("serialize bitcoin", [&](auto, auto&) {
+        value.Internal().SerializeBitcoin(ot::writer(bytes));
+    });
+    measure("serialize", [&](auto, auto&) {
+        value.Serialize(ot::writer(text));
+    });
+
+    EXPECT_EQ(bitcoin.allocations_, 0u);
+}
+}  // namespace ottest
@@ -0,0 +1,260 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <optional>
+#include <string>
+
+#include "internal/api/session/Storage.hpp"
+#include "internal/util/P0330.hpp"
+#include "util/storage/tree/Slicer.hpp"
+
+namespace ottest
+{
+namespace ot = opentxs;
+
+using namespace opentxs::literals;
+using namespace std::literals;
+
+// NOTE an in-memory driver with two buckets
+class Buckets final : public ot::storage::Driver
+{
+public:
+    using Bucket =
+        ot::UnallocatedMap<ot::UnallocatedCString, ot::UnallocatedCString>;
+
+    Bucket primary_{};
+    Bucket secondary_{};
+
+    auto BucketSize(const bool bucket) const -> std::size_t final
+    {
+        auto out = 0_uz;
+
+        for (const auto& [key, value] : get(bucket)) {
+            out += key.size() + value.size();
+        }
+
+        return out;
+    }
+    auto EmptyBucket(const bool bucket) const -> bool final
+    {
+        get(bucket).clear();
+
+        return true;
+    }
+    auto Load(
+        const ot::UnallocatedCString& key,
+        const bool,
+        ot::UnallocatedCString& value) const -> bool final
+    {
+        return LoadFromBucket(key, value, false) ||
+               LoadFromBucket(key, value, true);
+    }
+    auto LoadFromBucket(
+        const ot::UnallocatedCString& key,
+        ot::UnallocatedCString& value,
+        const bool bucket) const -> bool final
+    {
+        const auto& map = get(bucket);
+
+        if (const auto i = map.find(key); map.end() != i) {
+            value = i->second;
+
+            return true;
+        }
+
+        return false;
+    }
+    auto LoadRoot() const -> ot::UnallocatedCString final { return {}; }
+    auto Migrate(const ot::UnallocatedCString&, const Driver&) const
+        -> bool final
+    {
+        return false;
+    }
+    auto Store(
+        const bool,
+        const ot::UnallocatedCString& key,
+        const ot::UnallocatedCString& value,
+        const bool bucket) const -> bool final
+    {
+        get(bucket)[key] = value;
+
+        return true;
+    }
+    void Store(
+        const bool isTransaction,
+        const ot::UnallocatedCString& key,
+        const ot::UnallocatedCString& value,
+        const bool bucket,
+        std::promise<bool>& promise) const final
+    {
+        promise.set_value(Store(isTransaction, key, value, bucket));
+    }
+    auto Store(
+        const bool,
+        const ot::UnallocatedCString&,
+        ot::UnallocatedCString&) const -> bool final
+    {
+        return false;
+    }
+    auto StoreRoot(const bool, const ot::UnallocatedCString&) const
+        -> bool final
+    {
+        return false;
+    }
+
+private:
+    auto get(bool bucket) const noexcept -> Bucket&
+    {
+        return const_cast<Bucket&>(bucket ? secondary_ : primary_);
+    }
+};
+
+class Test_GarbageCollection : public ::testing::Test
+{
+protected:
+    // NOTE objects are collected from the primary bucket into the secondary
+    static constexpr auto from_ = false;
+
+    Buckets driver_;
+    ot::storage::gc::Counters counters_;
+    ot::storage::gc::Slicer slicer_;
+
+    auto progress() const noexcept -> ot::storage::gc::Progress
+    {
+        return counters_.Snapshot(false);
+    }
+
+    Test_GarbageCollection()
+        : driver_()
+        , counters_()
+        , slicer_(driver_, from_, counters_)
+    {
+    }
+};
+
+TEST_F(Test_GarbageCollection, copy_once)
+{
+    driver_.primary_["a"] = "alpha";
+    driver_.primary_["b"] = "beta";
+    driver_.primary_["garbage"] = "unreachable";
+
+    EXPECT_TRUE(slicer_.Migrate("a", driver_));
+    EXPECT_TRUE(slicer_.Migrate("b", driver_));
+    EXPECT_TRUE(slicer_.Migrate("a", driver_));
+    EXPECT_FALSE(slicer_.Migrate("", driver_));
+
+    // NOTE nothing is copied while the tree is being walked
+    EXPECT_TRUE(driver_.secondary_.empty());
+    EXPECT_EQ(progress().pending_, 2u);
+    EXPECT_EQ(progress().duplicates_, 1u);
+
+    const auto done = slicer_.Copy(driver_, 1s);
+
+    ASSERT_TRUE(done.has_value());
+    EXPECT_TRUE(done.value());
+    EXPECT_EQ(driver_.secondary_.size(), 2_uz);
+    EXPECT_EQ(driver_.secondary_.at("a"), "alpha");
+    EXPECT_EQ(driver_.secondary_.at("b"), "beta");
+
+    const auto result = progress();
+
+    EXPECT_EQ(result.objects_, 2u);
+    EXPECT_EQ(result.bytes_, 9u);
+    EXPECT_EQ(result.pending_, 0u);
+    EXPECT_EQ(result.current_, 0u);
+
+    const auto size = driver_.BucketSize(from_);
+
+    EXPECT_TRUE(slicer_.Reclaim());
+    EXPECT_TRUE(driver_.primary_.empty());
+    EXPECT_EQ(driver_.secondary_.size(), 2_uz);
+    EXPECT_EQ(progress().reclaimed_, size - result.bytes_);
+}
+
+TEST_F(Test_GarbageCollection, slices)
+{
+    constexpr auto count = 16_uz;
+
+    for (auto i = 0_uz; i < count; ++i) {
+        const auto key = std::to_string(i);
+        driver_.primary_[key] = key;
+
+        ASSERT_TRUE(slicer_.Migrate(key, driver_));
+    }
+
+    // NOTE an exhausted budget still copies one object per slice so the
+    // collection always makes progress
+    auto slices = 0_uz;
+    auto done = std::optional<bool>{};
+
+    while (false == done.has_value()) {
+        done = slicer_.Copy(driver_, 0ns);
+        ++slices;
+
+        EXPECT_EQ(progress().objects_, slices);
+        EXPECT_EQ(progress().pending_, count - slices);
+    }
+
+    EXPECT_TRUE(done.value());
+    EXPECT_EQ(slices, count);
+    EXPECT_EQ(driver_.secondary_.size(), count);
+}
+
+TEST_F(Test_GarbageCollection, current_objects)
+{
+    // NOTE written to the active bucket after the collection began
+    driver_.secondary_["new"] = "value";
+
+    ASSERT_TRUE(slicer_.Migrate("new", driver_));
+
+    const auto done = slicer_.Copy(driver_, 1s);
+
+    ASSERT_TRUE(done.has_value());
+    EXPECT_TRUE(done.value());
+    EXPECT_EQ(progress().objects_, 0u);
+    EXPECT_EQ(progress().current_, 1u);
+}
+
+TEST_F(Test_GarbageCollection, missing_object)
+{
+    ASSERT_TRUE(slicer_.Migrate("missing", driver_));
+
+    const auto done = slicer_.Copy(driver_, 1s);
+
+    ASSERT_TRUE(done.has_value());
+    EXPECT_FALSE(done.value());
+}
+
+TEST_F(Test_GarbageCollection, reset)
+{
+    driver_.primary_["a"] = "alpha";
+
+    ASSERT_TRUE(slicer_.Migrate("a", driver_));
+    ASSERT_TRUE(slicer_.Copy(driver_, 1s).has_value());
+
+    counters_.Reset();
+    const auto result = counters_.Snapshot(true);
+
+    EXPECT_TRUE(result.running_);
+    EXPECT_EQ(result.objects_, 0u);
+    EXPECT_EQ(result.bytes_, 0u);
+    EXPECT_EQ(result.reclaimed_, 0u);
+}
+
+TEST(GarbageCollection, session_progress)
+{
+    const auto& api = ot::Context().StartClientSession(0);
+    const auto progress = api.Storage().Internal().GarbageCollection();
+
+    // NOTE collection is disabled unless a gc interval is configured
+    EXPECT_FALSE(progress.running_);
+    EXPECT_EQ(progress.pending_, 0u);
+}
+}  // namespace ottest
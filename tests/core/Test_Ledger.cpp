@@ -5,11 +5,18 @@
 
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <utility>
 
 #include "internal/api/session/FactoryAPI.hpp"
 #include "internal/otx/Types.hpp"
+#include "internal/otx/common/Cheque.hpp"
+#include "internal/otx/common/Contract.hpp"
+#include "internal/otx/common/Item.hpp"
 #include "internal/otx/common/Ledger.hpp"
+#include "internal/otx/common/OTTransaction.hpp"
 
 namespace ot = opentxs;
 
@@ -24,6 +31,99 @@ struct Ledger : public ::testing::Test {
     ot::OTPasswordPrompt reason_c_;
     ot::OTPasswordPrompt reason_s_;
 
+    auto inbox(const ot::Identifier& account) const
+        -> std::unique_ptr<ot::Ledger>
+    {
+        return client_.Factory().InternalSession().Ledger(
+            nym_id_, account, server_id_, ot::ledgerType::inbox, false);
+    }
+    // NOTE a transferReceipt carries the acceptPending item of the recipient
+    auto transfer_receipt(
+        const ot::Ledger& ledger,
+        std::int64_t number,
+        std::int64_t origin) const -> std::shared_ptr<ot::OTTransaction>
+    {
+        std::shared_ptr<ot::OTTransaction> receipt{
+            client_.Factory().InternalSession().Transaction(
+                ledger,
+                ot::transactionType::transferReceipt,
+                ot::originType::not_applicable,
+                number)};
+
+        EXPECT_TRUE(receipt);
+
+        auto item = client_.Factory().InternalSession().Item(
+            *receipt, ot::itemType::acceptPending, ot::Identifier::Factory());
+
+        EXPECT_TRUE(item);
+
+        item->SetNumberOfOrigin(origin);
+        sign(*item);
+        receipt->SetReferenceToNum(number + 1000);
+        receipt->SetReferenceString(ot::String::Factory(*item));
+        sign(*receipt);
+
+        return receipt;
+    }
+    // NOTE a chequeReceipt carries the depositCheque item of the recipient,
+    // which carries the cheque
+    auto cheque_receipt(
+        const ot::Ledger& ledger,
+        std::int64_t number,
+        std::int64_t cheque) const -> std::shared_ptr<ot::OTTransaction>
+    {
+        auto instrument = client_.Factory().InternalSession().Cheque(
+            server_id_, ot::identifier::UnitDefinition::Factory());
+
+        EXPECT_TRUE(instrument);
+
+        const auto now = ot::Clock::now();
+
+        EXPECT_TRUE(instrument->IssueCheque(
+            ot::Amount{100},
+            cheque,
+            now,
+            now + std::chrono::hours(24),
+            ledger.GetPurportedAccountID(),
+            nym_id_,
+            ot::String::Factory("cheque"),
+            nym_id_));
+
+        sign(*instrument);
+        std::shared_ptr<ot::OTTransaction> receipt{
+            client_.Factory().InternalSession().Transaction(
+                ledger,
+                ot::transactionType::chequeReceipt,
+                ot::originType::not_applicable,
+                number)};
+
+        EXPECT_TRUE(receipt);
+
+        auto item = client_.Factory().InternalSession().Item(
+            *receipt, ot::itemType::depositCheque, ot::Identifier::Factory());
+
+        EXPECT_TRUE(item);
+
+        item->SetAttachment(ot::String::Factory(*instrument));
+        sign(*item);
+        receipt->SetReferenceToNum(number + 1000);
+        receipt->SetReferenceString(ot::String::Factory(*item));
+        sign(*receipt);
+
+        return receipt;
+    }
+    auto sign(ot::Contract& contract) const -> void
+    {
+        const auto nym = client_.Wallet().Nym(nym_id_);
+
+        ASSERT_TRUE(nym);
+
+        contract.ReleaseSignatures();
+
+        EXPECT_TRUE(contract.SignContract(*nym, reason_c_));
+        EXPECT_TRUE(contract.SaveContract());
+    }
+
     Ledger()
         : client_(ot::Context().StartClientSession(0))
         , server_(ot::Context().StartNotarySession(0))
@@ -74,4 +174,152 @@ TEST_F(Ledger, load_nymbox)
     ASSERT_TRUE(nymbox);
     EXPECT_TRUE(nymbox->LoadNymbox());
 }
+
+TEST_F(Ledger, indices)
+{
+    auto ledger = client_.Factory().InternalSession().Ledger(
+        nym_id_, nym_id_, server_id_, ot::ledgerType::message, false);
+
+    ASSERT_TRUE(ledger);
+
+    const auto add = [&](ot::transactionType type, auto number, auto ref) {
+        auto transaction = client_.Factory().InternalSession().Transaction(
+            *ledger, type, ot::originType::not_applicable, number);
+
+        EXPECT_TRUE(transaction);
+
+        transaction->SetReferenceToNum(ref);
+
+        return ledger->AddTransaction(std::move(transaction));
+    };
+
+    EXPECT_TRUE(add(ot::transactionType::marketReceipt, 30, 7));
+    EXPECT_TRUE(add(ot::transactionType::finalReceipt, 20, 7));
+    EXPECT_TRUE(add(ot::transactionType::paymentReceipt, 10, 5));
+    EXPECT_FALSE(add(ot::transactionType::finalReceipt, 10, 9));
+    EXPECT_EQ(ledger->GetTransactionCountInRefTo(7), 2);
+    EXPECT_EQ(ledger->GetTransactionCountInRefTo(5), 1);
+    EXPECT_EQ(ledger->GetTransactionCountInRefTo(9), 0);
+    EXPECT_EQ(ledger->GetTransactionIndex(10), 0);
+    EXPECT_EQ(ledger->GetTransactionIndex(30), 2);
+    EXPECT_EQ(ledger->GetTransactionIndex(40), -1);
+
+    auto receipt = ledger->GetFinalReceipt(7);
+
+    ASSERT_TRUE(receipt);
+    EXPECT_EQ(receipt->GetTransactionNum(), 20);
+    EXPECT_FALSE(ledger->GetFinalReceipt(5));
+
+    auto payment = ledger->GetTransaction(ot::transactionType::paymentReceipt);
+
+    ASSERT_TRUE(payment);
+    EXPECT_EQ(payment->GetTransactionNum(), 10);
+    EXPECT_TRUE(ledger->RemoveTransaction(20));
+    EXPECT_FALSE(ledger->GetFinalReceipt(7));
+    EXPECT_FALSE(ledger->GetTransaction(ot::transactionType::finalReceipt));
+    EXPECT_EQ(ledger->GetTransactionCountInRefTo(7), 1);
+    EXPECT_EQ(ledger->GetTransactionIndex(30), 1);
+
+    ledger->ReleaseTransactions();
+
+    EXPECT_EQ(ledger->GetTransactionCountInRefTo(7), 0);
+    EXPECT_FALSE(ledger->GetTransaction(ot::transactionType::paymentReceipt));
+}
+
+TEST_F(Ledger, receipt_cache)
+{
+    const auto account = ot::Identifier::Random();
+    auto ledger = inbox(account);
+
+    ASSERT_TRUE(ledger);
+    ASSERT_TRUE(ledger->AddTransaction(transfer_receipt(*ledger, 101, 11)));
+    ASSERT_TRUE(ledger->AddTransaction(transfer_receipt(*ledger, 102, 12)));
+    ASSERT_TRUE(ledger->AddTransaction(cheque_receipt(*ledger, 103, 13)));
+
+    auto transfer = ledger->GetTransferReceipt(12);
+
+    ASSERT_TRUE(transfer);
+    EXPECT_EQ(transfer->GetTransactionNum(), 102);
+
+    // NOTE 101 was resolved while searching for 102, so this lookup is
+    // answered from the cache
+    transfer = ledger->GetTransferReceipt(11);
+
+    ASSERT_TRUE(transfer);
+    EXPECT_EQ(transfer->GetTransactionNum(), 101);
+
+    auto cheque = ledger->GetChequeReceipt(13);
+
+    ASSERT_TRUE(cheque);
+    EXPECT_EQ(cheque->GetTransactionNum(), 103);
+    EXPECT_FALSE(ledger->GetTransferReceipt(13));
+    EXPECT_FALSE(ledger->GetChequeReceipt(11));
+    EXPECT_FALSE(ledger->GetTransferReceipt(99));
+
+    // NOTE removing a receipt invalidates its cached key
+    EXPECT_TRUE(ledger->RemoveTransaction(101));
+    EXPECT_FALSE(ledger->GetTransferReceipt(11));
+    EXPECT_TRUE(ledger->GetTransferReceipt(12));
+    EXPECT_TRUE(ledger->RemoveTransaction(103));
+    EXPECT_FALSE(ledger->GetChequeReceipt(13));
+
+    // NOTE a new receipt reusing the number of a removed one is resolved
+    // from its own reference string
+    ASSERT_TRUE(ledger->AddTransaction(transfer_receipt(*ledger, 101, 14)));
+    EXPECT_FALSE(ledger->GetTransferReceipt(11));
+
+    transfer = ledger->GetTransferReceipt(14);
+
+    ASSERT_TRUE(transfer);
+    EXPECT_EQ(transfer->GetTransactionNum(), 101);
+
+    ledger->ReleaseTransactions();
+
+    EXPECT_FALSE(ledger->GetTransferReceipt(12));
+    EXPECT_FALSE(ledger->GetTransferReceipt(14));
+}
+
+TEST_F(Ledger, box_receipt_replacement)
+{
+    const auto account = ot::Identifier::Random();
+    auto original = inbox(account);
+
+    ASSERT_TRUE(original);
+    ASSERT_TRUE(original->AddTransaction(transfer_receipt(*original, 201, 21)));
+    ASSERT_TRUE(original->AddTransaction(cheque_receipt(*original, 202, 22)));
+    EXPECT_TRUE(original->SaveBoxReceipts());
+
+    sign(*original);
+
+    // NOTE inbox receipts are serialized in abbreviated form, without the
+    // reference string the cached keys are resolved from
+    auto ledger = inbox(account);
+
+    ASSERT_TRUE(ledger);
+    ASSERT_TRUE(ledger->LoadInboxFromString(ot::String::Factory(*original)));
+
+    auto abbreviated = ledger->GetTransaction(202);
+
+    ASSERT_TRUE(abbreviated);
+    EXPECT_TRUE(abbreviated->IsAbbreviated());
+    EXPECT_FALSE(ledger->GetChequeReceipt(22));
+
+    // NOTE replacing the abbreviated receipt with the box receipt makes it
+    // eligible for resolution again
+    ASSERT_TRUE(ledger->LoadBoxReceipt(202));
+
+    auto cheque = ledger->GetChequeReceipt(22);
+
+    ASSERT_TRUE(cheque);
+    EXPECT_EQ(cheque->GetTransactionNum(), 202);
+    EXPECT_FALSE(cheque->IsAbbreviated());
+    ASSERT_TRUE(ledger->LoadBoxReceipt(201));
+
+    auto transfer = ledger->GetTransferReceipt(21);
+
+    ASSERT_TRUE(transfer);
+    EXPECT_EQ(transfer->GetTransactionNum(), 201);
+    EXPECT_FALSE(transfer->IsAbbreviated());
+    EXPECT_EQ(ledger->GetChequeReceipt(22), cheque);
+}
 }  // namespace ottest
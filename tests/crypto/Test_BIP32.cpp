@@ -5,6 +5,7 @@
 
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
+#include <cstddef>
 #include <memory>
 
 #include "ottest/data/crypto/Bip32.hpp"
@@ -105,4 +106,41 @@ TEST_F(Test_BIP32, stress)
         EXPECT_EQ(child.xprv_, key.Xprv(reason_));
     }
 }
+
+TEST_F(Test_BIP32, batch)
+{
+    static constexpr auto first = ot::Bip32Index{5u};
+    static constexpr auto count = std::size_t{40u};
+    const auto& item = Bip32TestCases().at(0u);
+    const auto& child = item.children_.at(2u);
+    const auto seedID = [&] {
+        const auto bytes = api_.Factory().DataFromHex(item.seed_);
+        const auto seed = api_.Factory().SecretFromBytes(bytes.Bytes());
+
+        return api_.Crypto().Seed().ImportRaw(seed, reason_);
+    }();
+
+    ASSERT_FALSE(seedID.empty());
+
+    auto id{seedID};
+    const auto pParent = api_.Crypto().Seed().GetHDKey(
+        id, ot::crypto::EcdsaCurve::secp256k1, make_path(child.path_), reason_);
+
+    ASSERT_TRUE(pParent);
+
+    const auto& parent = *pParent;
+    const auto keys = parent.ChildKeys(first, count, reason_);
+
+    ASSERT_EQ(keys.size(), count);
+
+    for (auto i = std::size_t{0u}; i < count; ++i) {
+        const auto index = static_cast<ot::Bip32Index>(first + i);
+        const auto expected = parent.ChildKey(index, reason_);
+
+        ASSERT_TRUE(expected);
+        ASSERT_TRUE(keys.at(i));
+        EXPECT_EQ(keys.at(i)->Xpub(reason_), expected->Xpub(reason_));
+        EXPECT_EQ(keys.at(i)->Xprv(reason_), expected->Xprv(reason_));
+    }
+}
 }  // namespace ottest
@@ -6,8 +6,12 @@
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
 #include <zmq.h>
+#include <memory>
 #include <string_view>
 
+#include "internal/network/zeromq/message/Factory.hpp"
+#include "network/zeromq/message/FramePool.hpp"
+
 namespace ot = opentxs;
 namespace zmq = opentxs::network::zeromq;
 
@@ -73,6 +77,68 @@ TEST_F(Frame, size)
     }
 }
 
+TEST_F(Frame, pinned)
+{
+    auto pin = std::make_shared<const ot::UnallocatedCString>(test_string_);
+    const auto weak = std::weak_ptr<const ot::UnallocatedCString>{pin};
+    const auto view = ot::ReadView{*pin};
+
+    {
+        auto message = zmq::Message{};
+        message.AddFrame(ot::factory::ZMQFrame(view, pin));
+        pin.reset();
+        const auto& frame = message.at(0);
+
+        EXPECT_FALSE(weak.expired());
+        EXPECT_EQ(frame.data(), view.data());
+        EXPECT_EQ(frame.Bytes(), view);
+    }
+
+    EXPECT_TRUE(weak.expired());
+}
+
+TEST_F(Frame, pooled)
+{
+    const auto payload = ot::UnallocatedCString(1000u, 'x');
+    const auto before = zmq::FramePool::GetStats();
+
+    {
+        const auto pool = zmq::FramePool::Binding{};
+
+        for (auto n = 0; n < 10; ++n) {
+            auto message = zmq::Message{};
+            const auto& frame =
+                message.AddFrame(payload.data(), payload.size());
+
+            EXPECT_EQ(frame.Bytes(), payload);
+        }
+    }
+
+    const auto after = zmq::FramePool::GetStats();
+
+    // NOTE only the frame objects are pooled, not the payloads
+    EXPECT_GE(after.pooled_ - before.pooled_, 10u);
+    EXPECT_GE(after.recycled_ - before.recycled_, 9u);
+    EXPECT_EQ(after.unpooled_, before.unpooled_);
+}
+
+TEST_F(Frame, pooled_remote_release)
+{
+    const auto payload = ot::UnallocatedCString(1000u, 'x');
+    auto message = zmq::Message{};
+
+    {
+        const auto pool = zmq::FramePool::Binding{};
+        message.AddFrame(payload.data(), payload.size());
+    }
+
+    const auto before = zmq::FramePool::GetStats();
+    message = zmq::Message{};
+    const auto after = zmq::FramePool::GetStats();
+
+    EXPECT_GE(after.remote_ - before.remote_, 1u);
+}
+
 TEST_F(Frame, zmq_msg_t)
 {
     auto& frame = message_.AddFrame();
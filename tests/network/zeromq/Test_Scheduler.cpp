@@ -0,0 +1,302 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "internal/util/P0330.hpp"
+#include "network/zeromq/context/Scheduler.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+using namespace std::literals;
+using Scheduler = ot::network::zeromq::context::Scheduler;
+using Strand = ot::network::zeromq::context::Strand;
+
+class Test_Scheduler : public ::testing::Test
+{
+protected:
+    static constexpr auto timeout_ = 10s;
+
+    // NOTE records the order in which a strand handled its messages and
+    // counts the number of times the strand became idle
+    struct Recorder {
+        std::mutex lock_{};
+        std::condition_variable cv_{};
+        ot::UnallocatedVector<int> received_{};
+        std::size_t idle_{};
+
+        auto Count() noexcept -> std::size_t
+        {
+            auto lock = std::lock_guard<std::mutex>{lock_};
+
+            return idle_;
+        }
+        auto Idle() noexcept -> void
+        {
+            // NOTE notify while locked so the test can not destroy the
+            // recorder before the worker is finished with it
+            auto lock = std::lock_guard<std::mutex>{lock_};
+            ++idle_;
+            cv_.notify_all();
+        }
+        auto Received() noexcept -> ot::UnallocatedVector<int>
+        {
+            auto lock = std::lock_guard<std::mutex>{lock_};
+
+            return received_;
+        }
+        auto WaitIdle(std::size_t count) noexcept -> bool
+        {
+            auto lock = std::unique_lock<std::mutex>{lock_};
+
+            return cv_.wait_for(
+                lock, timeout_, [&] { return idle_ >= count; });
+        }
+    };
+
+    Scheduler scheduler_;
+
+    static auto make_strand(
+        Recorder& recorder,
+        std::function<void()> block = {}) noexcept -> std::shared_ptr<Strand>
+    {
+        auto callbacks = ot::Vector<ot::network::zeromq::ReceiveCallback>{};
+        callbacks.emplace_back([&recorder, block](auto&& message) {
+            if (block) { block(); }
+
+            auto lock = std::lock_guard<std::mutex>{recorder.lock_};
+            recorder.received_.emplace_back(message.at(0).template as<int>());
+        });
+
+        return std::make_shared<Strand>(
+            0_uz, std::move(callbacks), [&recorder] { recorder.Idle(); });
+    }
+    static auto message(int value) noexcept -> ot::network::zeromq::Message
+    {
+        auto out = ot::network::zeromq::Message{};
+        out.AddFrame(value);
+
+        return out;
+    }
+
+    Test_Scheduler()
+        : scheduler_(4u)
+    {
+    }
+};
+
+TEST(Scheduler, deque_order)
+{
+    auto deque = std::make_unique<Scheduler::Deque>();
+    auto strands = ot::UnallocatedVector<Strand*>{};
+
+    for (auto i = 1_uz; i <= 4_uz; ++i) {
+        strands.emplace_back(reinterpret_cast<Strand*>(i));
+    }
+
+    EXPECT_EQ(deque->Pop(), nullptr);
+    EXPECT_EQ(deque->Steal(), nullptr);
+
+    for (auto* strand : strands) { EXPECT_TRUE(deque->Push(strand)); }
+
+    // NOTE the owner works from the bottom and thieves from the top
+    EXPECT_EQ(deque->Pop(), strands.at(3));
+    EXPECT_EQ(deque->Steal(), strands.at(0));
+    EXPECT_EQ(deque->Steal(), strands.at(1));
+    EXPECT_EQ(deque->Pop(), strands.at(2));
+    EXPECT_EQ(deque->Pop(), nullptr);
+    EXPECT_EQ(deque->Steal(), nullptr);
+}
+
+TEST(Scheduler, deque_capacity)
+{
+    auto deque = std::make_unique<Scheduler::Deque>();
+    auto* strand = reinterpret_cast<Strand*>(1_uz);
+
+    for (auto i = 0; i < Scheduler::Deque::capacity_; ++i) {
+        ASSERT_TRUE(deque->Push(strand));
+    }
+
+    EXPECT_FALSE(deque->Push(strand));
+    EXPECT_EQ(deque->Steal(), strand);
+    EXPECT_TRUE(deque->Push(strand));
+}
+
+TEST(Scheduler, deque_concurrent_steal)
+{
+    static constexpr auto count = 100000_uz;
+    static constexpr auto thieves = 3_uz;
+    auto deque = std::make_unique<Scheduler::Deque>();
+    auto taken = std::make_unique<std::atomic<int>[]>(count + 1_uz);
+    auto done = std::atomic<bool>{false};
+    auto threads = ot::UnallocatedVector<std::thread>{};
+    const auto take = [&](Strand* strand) {
+        if (nullptr != strand) {
+            ++taken[reinterpret_cast<std::size_t>(strand)];
+        }
+    };
+
+    for (auto t = 0_uz; t < thieves; ++t) {
+        threads.emplace_back([&] {
+            while (false == done.load()) { take(deque->Steal()); }
+        });
+    }
+
+    for (auto i = 1_uz; i <= count; ++i) {
+        while (false == deque->Push(reinterpret_cast<Strand*>(i))) {
+            take(deque->Pop());
+        }
+
+        if (0_uz == (i % 3_uz)) { take(deque->Pop()); }
+    }
+
+    while (auto* strand = deque->Pop()) { take(strand); }
+
+    done.store(true);
+
+    for (auto& thread : threads) { thread.join(); }
+
+    // NOTE every item is taken exactly once, either by the owner or a thief
+    for (auto i = 1_uz; i <= count; ++i) { ASSERT_EQ(taken[i].load(), 1); }
+}
+
+TEST_F(Test_Scheduler, strand_order)
+{
+    static constexpr auto count = 1000;
+    auto recorder = Recorder{};
+    auto strand = make_strand(recorder);
+
+    EXPECT_TRUE(strand->Idle());
+
+    for (auto i = 0; i < count; ++i) { strand->Push(0_uz, message(i)); }
+
+    EXPECT_TRUE(strand->HasPending());
+
+    strand->Submit(scheduler_);
+
+    ASSERT_TRUE(recorder.WaitIdle(1_uz));
+    EXPECT_TRUE(strand->Idle());
+    EXPECT_FALSE(strand->HasPending());
+
+    const auto received = recorder.Received();
+
+    ASSERT_EQ(received.size(), static_cast<std::size_t>(count));
+
+    for (auto i = 0; i < count; ++i) { EXPECT_EQ(received.at(i), i); }
+}
+
+TEST_F(Test_Scheduler, wakeup)
+{
+    // NOTE every submission must wake a parked worker. A lost wakeup leaves
+    // the strand pending until the timeout.
+    auto recorder = Recorder{};
+    auto strand = make_strand(recorder);
+
+    for (auto i = 1_uz; i <= 1000_uz; ++i) {
+        if (0_uz == (i % 100_uz)) { std::this_thread::sleep_for(10ms); }
+
+        strand->Push(0_uz, message(static_cast<int>(i)));
+        strand->Submit(scheduler_);
+
+        ASSERT_TRUE(recorder.WaitIdle(i));
+    }
+
+    EXPECT_EQ(recorder.Received().size(), 1000_uz);
+}
+
+TEST_F(Test_Scheduler, defer)
+{
+    auto release = std::promise<void>{};
+    auto started = std::promise<void>{};
+    auto blocked = release.get_future().share();
+    auto recorder = Recorder{};
+    auto strand = make_strand(recorder, [&, blocked] {
+        started.set_value();
+        blocked.wait();
+    });
+    auto ran = std::atomic<bool>{false};
+
+    // NOTE an idle strand runs modifications immediately on the poller
+    EXPECT_FALSE(strand->Defer([] {}));
+
+    strand->Push(0_uz, message(1));
+    strand->Submit(scheduler_);
+    started.get_future().wait();
+
+    EXPECT_TRUE(strand->Defer([&] {
+        // NOTE deferred tasks run after the pending messages
+        EXPECT_EQ(recorder.Received().size(), 1_uz);
+        ran.store(true);
+    }));
+
+    release.set_value();
+
+    ASSERT_TRUE(recorder.WaitIdle(1_uz));
+    EXPECT_TRUE(ran.load());
+    EXPECT_TRUE(strand->Idle());
+}
+
+TEST_F(Test_Scheduler, retire_idle)
+{
+    auto recorder = Recorder{};
+    auto strand = make_strand(recorder);
+    auto retired{false};
+
+    strand->Retire([&] { retired = true; });
+
+    EXPECT_TRUE(retired);
+    EXPECT_FALSE(strand->Idle());
+    EXPECT_FALSE(strand->Defer([] {}));
+}
+
+TEST_F(Test_Scheduler, retire_busy)
+{
+    auto release = std::promise<void>{};
+    auto started = std::promise<void>{};
+    auto blocked = release.get_future().share();
+    auto recorder = Recorder{};
+    auto retired = Recorder{};
+    auto strand = make_strand(recorder, [&, blocked] {
+        started.set_value();
+        blocked.wait();
+    });
+    auto deferred = std::atomic<bool>{false};
+
+    strand->Push(0_uz, message(1));
+    strand->Submit(scheduler_);
+    started.get_future().wait();
+    strand->Retire([&] { retired.Idle(); });
+
+    // NOTE modifications which arrive while the strand is retiring still run
+    // before the batch is released
+    EXPECT_TRUE(strand->Defer([&] { deferred.store(true); }));
+
+    std::this_thread::sleep_for(10ms);
+
+    EXPECT_EQ(retired.Count(), 0_uz);
+
+    release.set_value();
+
+    ASSERT_TRUE(retired.WaitIdle(1_uz));
+    EXPECT_TRUE(deferred.load());
+    EXPECT_EQ(recorder.Received().size(), 1_uz);
+    EXPECT_EQ(recorder.Count(), 0_uz);
+    EXPECT_FALSE(strand->Idle());
+    EXPECT_FALSE(strand->Defer([] {}));
+}
+}  // namespace ottest
@@ -59,6 +59,16 @@ auto Home() noexcept -> const ot::UnallocatedCString&
     return output;
 }
 
+auto ScratchFolder() noexcept -> ot::UnallocatedCString
+{
+    const auto path =
+        fs::path{Home()} / fs::unique_path("scratch-%%%%-%%%%-%%%%-%%%%");
+    auto ec = boost::system::error_code{};
+    fs::create_directories(path, ec);
+
+    return path.string();
+}
+
 auto WipeHome() noexcept -> void
 {
     try {
@@ -27,6 +27,9 @@ auto Args(bool lowlevel = false, int argc = 0, char** argv = nullptr) noexcept
     -> const ot::Options&;
 auto GetQT() noexcept -> QObject*;
 auto Home() noexcept -> const ot::UnallocatedCString&;
+// Creates a new empty folder inside Home() for tests which need their own
+// database files. The folder is removed along with Home().
+auto ScratchFolder() noexcept -> ot::UnallocatedCString;
 auto StartQT(bool lowlevel = false) noexcept -> void;
 auto StopQT() noexcept -> void;
 auto WipeHome() noexcept -> void;
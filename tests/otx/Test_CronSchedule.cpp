@@ -0,0 +1,163 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "internal/otx/common/cron/CronSchedule.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Time.hpp"
+
+namespace ottest
+{
+using namespace std::literals;
+using Time = opentxs::Time;
+
+class Test_CronSchedule : public ::testing::Test
+{
+protected:
+    const Time now_;
+    opentxs::CronSchedule schedule_;
+    std::size_t wakeups_;
+
+    auto numbers(const opentxs::UnallocatedVector<
+                 opentxs::CronSchedule::Item>& items) const noexcept
+        -> opentxs::UnallocatedVector<std::int64_t>
+    {
+        auto out = opentxs::UnallocatedVector<std::int64_t>{};
+
+        for (const auto& item : items) { out.emplace_back(item.number_); }
+
+        return out;
+    }
+
+    Test_CronSchedule()
+        : now_(opentxs::Clock::now())
+        , schedule_()
+        , wakeups_(0)
+    {
+        schedule_.SetWakeup([this] { ++wakeups_; });
+    }
+};
+
+TEST_F(Test_CronSchedule, empty)
+{
+    EXPECT_EQ(schedule_.Next(), Time::max());
+    EXPECT_TRUE(schedule_.Due(now_).empty());
+    EXPECT_FALSE(schedule_.IsScheduled(1));
+}
+
+TEST_F(Test_CronSchedule, added_order)
+{
+    // NOTE items loaded from disk are not added in date order
+    schedule_.Add(3, now_ - 1h);
+    schedule_.Add(1, now_ - 3h);
+    schedule_.Add(4, now_ - 1h);
+    schedule_.Add(2, now_ - 2h);
+
+    EXPECT_EQ(schedule_.Next(), Time{});
+
+    const auto due = schedule_.Due(now_);
+    const auto expected = opentxs::UnallocatedVector<std::int64_t>{1, 2, 3, 4};
+
+    EXPECT_EQ(numbers(due), expected);
+    EXPECT_EQ(schedule_.Next(), Time::max());
+
+    for (const auto number : expected) {
+        EXPECT_FALSE(schedule_.IsScheduled(number));
+    }
+}
+
+TEST_F(Test_CronSchedule, deadlines)
+{
+    schedule_.Add(1, now_);
+    schedule_.Add(2, now_);
+    schedule_.Add(3, now_);
+
+    const auto first = schedule_.Due(now_);
+
+    ASSERT_EQ(first.size(), 3u);
+
+    schedule_.Schedule(first.at(0), now_ + 2min);
+    schedule_.Schedule(first.at(1), now_ + 1min);
+    schedule_.Schedule(first.at(2), now_ + 3min);
+
+    EXPECT_EQ(schedule_.Next(), now_ + 1min);
+    EXPECT_TRUE(schedule_.Due(now_).empty());
+
+    // NOTE items which become due in the same round are still processed in
+    // the order they were added
+    const auto second = schedule_.Due(now_ + 2min);
+
+    EXPECT_EQ(
+        numbers(second), (opentxs::UnallocatedVector<std::int64_t>{1, 2}));
+    EXPECT_EQ(schedule_.Next(), now_ + 3min);
+    EXPECT_TRUE(schedule_.IsScheduled(3));
+}
+
+TEST_F(Test_CronSchedule, reschedule)
+{
+    schedule_.Add(1, now_);
+    const auto due = schedule_.Due(now_);
+
+    ASSERT_EQ(due.size(), 1u);
+
+    schedule_.Schedule(due.at(0), now_ + 1min);
+    schedule_.Schedule(due.at(0), now_ + 5min);
+
+    EXPECT_EQ(schedule_.Next(), now_ + 5min);
+    EXPECT_TRUE(schedule_.Due(now_ + 1min).empty());
+
+    const auto later = schedule_.Due(now_ + 5min);
+
+    ASSERT_EQ(later.size(), 1u);
+    EXPECT_EQ(later.at(0).number_, 1);
+    EXPECT_EQ(later.at(0).added_, now_);
+}
+
+TEST_F(Test_CronSchedule, remove)
+{
+    schedule_.Add(1, now_);
+    schedule_.Add(2, now_);
+    schedule_.Remove(1);
+    schedule_.Remove(5);
+
+    EXPECT_FALSE(schedule_.IsScheduled(1));
+    EXPECT_TRUE(schedule_.IsScheduled(2));
+    EXPECT_EQ(
+        numbers(schedule_.Due(now_)),
+        (opentxs::UnallocatedVector<std::int64_t>{2}));
+
+    schedule_.Remove(2);
+
+    EXPECT_EQ(schedule_.Next(), Time::max());
+}
+
+TEST_F(Test_CronSchedule, wakeup)
+{
+    schedule_.Add(1, now_);
+
+    EXPECT_EQ(wakeups_, 1u);
+
+    // NOTE an item is already due so the waiting thread will not sleep past
+    // the next beat
+    schedule_.Add(2, now_);
+
+    EXPECT_EQ(wakeups_, 1u);
+
+    for (const auto& item : schedule_.Due(now_)) {
+        schedule_.Schedule(item, now_ + 1h);
+    }
+
+    EXPECT_EQ(wakeups_, 1u);
+
+    schedule_.Add(3, now_);
+
+    EXPECT_EQ(wakeups_, 2u);
+    EXPECT_EQ(schedule_.Next(), Time{});
+}
+}  // namespace ottest
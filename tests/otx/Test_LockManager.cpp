@@ -0,0 +1,115 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+
+#include "otx/server/LockManager.hpp"
+
+namespace ottest
+{
+using namespace std::literals;
+using LockManager = opentxs::server::LockManager;
+
+TEST(LockManager, disjoint)
+{
+    auto manager = LockManager{};
+    const auto alice = manager.Shared({LockManager::Nym("alice")});
+    auto bob = std::async(std::launch::async, [&] {
+        const auto lock = manager.Shared(
+            {LockManager::Nym("bob"), LockManager::Account("bob")});
+
+        return true;
+    });
+
+    ASSERT_EQ(bob.wait_for(10s), std::future_status::ready);
+    EXPECT_TRUE(bob.get());
+    EXPECT_EQ(manager.GetStats().contended_, 0u);
+}
+
+TEST(LockManager, overlapping)
+{
+    auto manager = LockManager{};
+    auto entered = std::atomic<bool>{false};
+    auto alice = std::make_unique<LockManager::Guard>(manager.Shared(
+        {LockManager::Nym("alice"), LockManager::Account("shared")}));
+    auto bob = std::async(std::launch::async, [&] {
+        const auto lock = manager.Shared(
+            {LockManager::Account("shared"),
+             LockManager::Nym("bob"),
+             LockManager::Nym("bob")});
+        entered = true;
+    });
+
+    EXPECT_EQ(bob.wait_for(100ms), std::future_status::timeout);
+    EXPECT_FALSE(entered.load());
+
+    alice.reset();
+
+    ASSERT_EQ(bob.wait_for(10s), std::future_status::ready);
+    EXPECT_TRUE(entered.load());
+
+    const auto stats = manager.GetStats();
+
+    EXPECT_EQ(stats.acquired_, 2u);
+    EXPECT_EQ(stats.contended_, 1u);
+    EXPECT_GT(stats.max_wait_.count(), 0);
+}
+
+TEST(LockManager, exclusive)
+{
+    auto manager = LockManager{};
+    auto entered = std::atomic<bool>{false};
+    auto alice =
+        std::make_unique<LockManager::Guard>(manager.Shared({"nym:alice"}));
+    auto cron = std::async(std::launch::async, [&] {
+        const auto lock = manager.Exclusive();
+        entered = true;
+    });
+
+    EXPECT_EQ(cron.wait_for(100ms), std::future_status::timeout);
+    EXPECT_FALSE(entered.load());
+
+    alice.reset();
+
+    ASSERT_EQ(cron.wait_for(10s), std::future_status::ready);
+    EXPECT_TRUE(entered.load());
+    EXPECT_EQ(manager.GetStats().exclusive_, 1u);
+}
+
+TEST(LockManager, writer_preference)
+{
+    auto manager = LockManager{};
+    auto order = std::atomic<int>{0};
+    auto exclusiveAt = std::atomic<int>{-1};
+    auto sharedAt = std::atomic<int>{-1};
+    auto alice =
+        std::make_unique<LockManager::Guard>(manager.Shared({"nym:alice"}));
+    auto cron = std::async(std::launch::async, [&] {
+        const auto lock = manager.Exclusive();
+        exclusiveAt = order++;
+    });
+
+    // NOTE give the exclusive request time to start waiting
+    std::this_thread::sleep_for(100ms);
+    auto bob = std::async(std::launch::async, [&] {
+        const auto lock = manager.Shared({"nym:bob"});
+        sharedAt = order++;
+    });
+
+    EXPECT_EQ(bob.wait_for(100ms), std::future_status::timeout);
+
+    alice.reset();
+
+    ASSERT_EQ(cron.wait_for(10s), std::future_status::ready);
+    ASSERT_EQ(bob.wait_for(10s), std::future_status::ready);
+    EXPECT_EQ(exclusiveAt.load(), 0);
+    EXPECT_EQ(sharedAt.load(), 1);
+}
+}  // namespace ottest
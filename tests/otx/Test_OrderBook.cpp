@@ -0,0 +1,454 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <utility>
+
+#include "internal/otx/common/trade/OrderBook.hpp"
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace ottest
+{
+using Amount = opentxs::Amount;
+
+class FakeOffer
+{
+public:
+    std::int64_t number_;
+    bool bid_;
+    Amount price_;
+    Amount available_;
+    Amount increment_;
+
+    auto GetAmountAvailable() const -> Amount { return available_; }
+    auto GetMinimumIncrement() -> const Amount& { return increment_; }
+    auto GetPriceLimit() const -> const Amount& { return price_; }
+    auto GetTransactionNum() const -> const std::int64_t& { return number_; }
+    auto IsAsk() -> bool { return false == bid_; }
+    auto IsBid() -> bool { return bid_; }
+    auto IsLimitOrder() const -> bool { return 0 != price_; }
+    auto IsMarketOrder() const -> bool { return 0 == price_; }
+};
+
+using Book = opentxs::OrderBook<FakeOffer>;
+// tick, offer, counter offer, amount, price
+using Fill = std::tuple<int, std::int64_t, std::int64_t, Amount, Amount>;
+using Fills = opentxs::UnallocatedVector<Fill>;
+
+struct Order {
+    int tick_;
+    FakeOffer offer_;
+};
+
+// NOTE copy of the counter offer walk OTMarket performed before it used
+// OrderBook. Bids are inserted at the lower bound of their price and visited
+// from rbegin so the oldest bid at the best price trades first, and asks are
+// inserted at the upper bound and visited from begin.
+class ReferenceBook
+{
+public:
+    using Map = opentxs::UnallocatedMultimap<Amount, FakeOffer*>;
+
+    Map bids_{};
+    Map asks_{};
+
+    auto Add(FakeOffer& offer) -> bool
+    {
+        const auto& price = offer.GetPriceLimit();
+
+        if (offer.IsBid()) {
+            bids_.insert(
+                bids_.lower_bound(price), std::make_pair(price, &offer));
+        } else {
+            asks_.insert(
+                asks_.upper_bound(price), std::make_pair(price, &offer));
+        }
+
+        return true;
+    }
+    auto BestAsk() const -> Amount
+    {
+        for (const auto& [price, offer] : asks_) {
+            if (0 != price) { return price; }
+        }
+
+        return 0;
+    }
+    auto BestBid() const -> Amount
+    {
+        if (bids_.empty()) { return 0; }
+
+        return bids_.rbegin()->first;
+    }
+    auto Evaluated(FakeOffer&) -> void {}
+    auto Match(
+        FakeOffer& offer,
+        const Book::Fill& fill,
+        const Book::Done& done) -> bool
+    {
+        if (offer.IsAsk()) {
+            for (auto rr = bids_.rbegin(); rr != bids_.rend(); ++rr) {
+                auto* bid = rr->second;
+
+                if (bid->IsMarketOrder()) { break; }
+
+                if (offer.IsMarketOrder() ||
+                    (bid->GetPriceLimit() >= offer.GetPriceLimit())) {
+                    if ((bid->GetAmountAvailable() >=
+                         offer.GetMinimumIncrement()) &&
+                        (offer.GetAmountAvailable() >=
+                         bid->GetMinimumIncrement())) {
+                        fill(*bid);
+                    }
+                } else if (offer.IsLimitOrder()) {
+
+                    return true;
+                }
+
+                if (done()) { return false; }
+            }
+        } else {
+            for (auto& it : asks_) {
+                auto* ask = it.second;
+
+                if (ask->IsMarketOrder()) { continue; }
+
+                if (offer.IsMarketOrder() ||
+                    (ask->GetPriceLimit() <= offer.GetPriceLimit())) {
+                    if ((ask->GetAmountAvailable() >=
+                         offer.GetMinimumIncrement()) &&
+                        (offer.GetAmountAvailable() >=
+                         ask->GetMinimumIncrement())) {
+                        fill(*ask);
+                    }
+                } else if (offer.IsLimitOrder()) {
+
+                    return true;
+                }
+
+                if (done()) { return false; }
+            }
+        }
+
+        return false == offer.IsMarketOrder();
+    }
+    auto Remove(const std::int64_t number) -> FakeOffer*
+    {
+        for (auto* map : {&bids_, &asks_}) {
+            for (auto it = map->begin(); it != map->end(); ++it) {
+                if (it->second->GetTransactionNum() == number) {
+                    auto* out = it->second;
+                    map->erase(it);
+
+                    return out;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+    auto Stale(FakeOffer&) const -> bool { return true; }
+    auto Touch() -> void {}
+};
+
+// NOTE mirrors the way OTCron and OTMarket process trades: every offer is
+// processed once per tick in the order it was added, and an offer is only
+// removed from the market when it is processed
+template <typename BookType>
+class Replay
+{
+public:
+    std::size_t matched_{};
+
+    auto Run(const opentxs::UnallocatedVector<Order>& orders, int ticks)
+        -> Fills
+    {
+        auto out = Fills{};
+        auto next = orders.begin();
+
+        for (auto tick = 0; tick < ticks; ++tick) {
+            while ((orders.end() != next) && (next->tick_ <= tick)) {
+                auto& offer = offers_.emplace_back(
+                    std::make_unique<FakeOffer>(next->offer_));
+                book_.Add(*offer);
+                cron_.emplace_back(offer.get());
+                ++next;
+            }
+
+            auto items = cron_;
+
+            for (auto* offer : items) {
+                if (false == process(tick, *offer, out)) {
+                    book_.Remove(offer->GetTransactionNum());
+                    cron_.erase(std::find(cron_.begin(), cron_.end(), offer));
+                }
+            }
+        }
+
+        return out;
+    }
+
+    Replay(bool eventDriven)
+        : event_driven_(eventDriven)
+    {
+    }
+
+private:
+    const bool event_driven_;
+    BookType book_{};
+    opentxs::UnallocatedVector<std::unique_ptr<FakeOffer>> offers_{};
+    opentxs::UnallocatedVector<FakeOffer*> cron_{};
+
+    auto process(int tick, FakeOffer& offer, Fills& out) -> bool
+    {
+        if (offer.GetAmountAvailable() < offer.GetMinimumIncrement()) {
+            return false;
+        }
+
+        const auto price = offer.IsAsk() ? book_.BestBid() : book_.BestAsk();
+
+        if ((0 == price) && offer.IsMarketOrder()) { return false; }
+
+        if ((0 == price) ||
+            (offer.IsLimitOrder() &&
+             ((offer.IsAsk() && (price < offer.GetPriceLimit())) ||
+              (offer.IsBid() && (price > offer.GetPriceLimit()))))) {
+            return true;
+        }
+
+        if (event_driven_ && (false == book_.Stale(offer))) { return true; }
+
+        ++matched_;
+        const auto stay = book_.Match(
+            offer,
+            [&](FakeOffer& counter) {
+                const auto amount = std::min(
+                    offer.GetAmountAvailable(), counter.GetAmountAvailable());
+                offer.available_ -= amount;
+                counter.available_ -= amount;
+                out.emplace_back(
+                    tick,
+                    offer.GetTransactionNum(),
+                    counter.GetTransactionNum(),
+                    amount,
+                    counter.GetPriceLimit());
+                book_.Touch();
+            },
+            [&] {
+                return offer.GetMinimumIncrement() >
+                       offer.GetAmountAvailable();
+            });
+
+        if (stay) { book_.Evaluated(offer); }
+
+        return stay;
+    }
+};
+
+auto make_offer(
+    std::int64_t number,
+    bool bid,
+    int price,
+    int available,
+    int increment = 1) -> FakeOffer
+{
+    return FakeOffer{number, bid, price, available, increment};
+}
+
+TEST(OrderBook, best_price)
+{
+    auto book = Book{};
+    auto market = make_offer(1, false, 0, 10);
+    auto low = make_offer(2, false, 5, 10);
+    auto high = make_offer(3, false, 7, 10);
+    auto bid = make_offer(4, true, 4, 10);
+
+    EXPECT_EQ(book.BestAsk(), 0);
+    EXPECT_EQ(book.BestBid(), 0);
+    EXPECT_TRUE(book.Add(market));
+    EXPECT_EQ(book.BestAsk(), 0);
+    EXPECT_TRUE(book.Add(high));
+    EXPECT_TRUE(book.Add(low));
+    EXPECT_TRUE(book.Add(bid));
+    EXPECT_FALSE(book.Add(bid));
+    EXPECT_EQ(book.BestAsk(), 5);
+    EXPECT_EQ(book.BestBid(), 4);
+    EXPECT_EQ(book.AskCount(), 3u);
+    EXPECT_EQ(book.BidCount(), 1u);
+    EXPECT_EQ(book.Find(2), &low);
+    EXPECT_EQ(book.Remove(2), &low);
+    EXPECT_EQ(book.Remove(2), nullptr);
+    EXPECT_EQ(book.Find(2), nullptr);
+    EXPECT_EQ(book.BestAsk(), 7);
+    EXPECT_EQ(book.AskCount(), 2u);
+    EXPECT_EQ(book.Clear().size(), 3u);
+    EXPECT_EQ(book.BestAsk(), 0);
+    EXPECT_EQ(book.AskCount(), 0u);
+}
+
+TEST(OrderBook, fifo)
+{
+    auto book = Book{};
+    auto first = make_offer(10, true, 5, 10);
+    auto better = make_offer(11, true, 6, 10);
+    auto second = make_offer(12, true, 5, 10);
+    auto market = make_offer(13, true, 0, 10);
+    auto ask = make_offer(20, false, 5, 25);
+    book.Add(first);
+    book.Add(better);
+    book.Add(market);
+    book.Add(second);
+    auto visited = opentxs::UnallocatedVector<std::int64_t>{};
+    const auto stay = book.Match(
+        ask,
+        [&](FakeOffer& counter) {
+            visited.emplace_back(counter.GetTransactionNum());
+        },
+        [] { return false; });
+
+    EXPECT_TRUE(stay);
+    EXPECT_EQ(visited, (opentxs::UnallocatedVector<std::int64_t>{11, 10, 12}));
+
+    const auto bids = book.Bids();
+
+    ASSERT_EQ(bids.size(), 4u);
+    EXPECT_EQ(bids[0], &market);
+    EXPECT_EQ(bids[1], &first);
+    EXPECT_EQ(bids[2], &second);
+    EXPECT_EQ(bids[3], &better);
+}
+
+TEST(OrderBook, revision)
+{
+    auto book = Book{};
+    auto ask = make_offer(1, false, 10, 10);
+    auto bid = make_offer(2, true, 8, 10);
+    auto deeper = make_offer(3, true, 7, 10);
+    auto crossing = make_offer(4, true, 10, 10);
+    book.Add(ask);
+    book.Add(bid);
+    book.Evaluated(ask);
+
+    EXPECT_FALSE(book.Stale(ask));
+    EXPECT_TRUE(book.Stale(bid));
+
+    book.Add(deeper);
+
+    EXPECT_FALSE(book.Stale(ask));
+
+    book.Remove(bid.GetTransactionNum());
+
+    EXPECT_FALSE(book.Stale(ask));
+
+    book.Add(crossing);
+
+    EXPECT_TRUE(book.Stale(ask));
+
+    book.Evaluated(ask);
+    book.Touch();
+
+    EXPECT_TRUE(book.Stale(ask));
+}
+
+TEST(OrderBook, replay)
+{
+    auto generator = std::mt19937{7};
+    auto orders = opentxs::UnallocatedVector<Order>{};
+    // NOTE orders arrive during the first half of the replay so the second
+    // half exercises a quiet market with offers which can not trade
+    constexpr auto ticks = 200;
+
+    for (auto n = 0; n < 2000; ++n) {
+        const auto tick = static_cast<int>(generator() % (ticks / 2));
+        const auto bid = (0 == generator() % 2);
+        const auto market = (0 == generator() % 20);
+        const auto price =
+            market ? 0 : static_cast<int>(90 + (generator() % 21));
+        const auto available = static_cast<int>(1 + (generator() % 40));
+        const auto increment = static_cast<int>(1 + (generator() % 15));
+        orders.emplace_back(Order{
+            tick, make_offer(n + 1, bid, price, available, increment)});
+    }
+
+    std::stable_sort(orders.begin(), orders.end(), [](auto& l, auto& r) {
+        return l.tick_ < r.tick_;
+    });
+
+    auto reference = Replay<ReferenceBook>{false};
+    auto poll = Replay<Book>{false};
+    auto event = Replay<Book>{true};
+    const auto expected = reference.Run(orders, ticks);
+
+    ASSERT_FALSE(expected.empty());
+    EXPECT_EQ(poll.Run(orders, ticks), expected);
+    EXPECT_EQ(event.Run(orders, ticks), expected);
+    EXPECT_EQ(poll.matched_, reference.matched_);
+    EXPECT_LT(event.matched_, poll.matched_);
+}
+
+TEST(OrderBook, reload)
+{
+    // NOTE OTMarket saves the offers in the order returned by Asks() and
+    // Bids() and adds them back to a new book in the same order when the
+    // market is loaded
+    auto offers = opentxs::UnallocatedVector<FakeOffer>{
+        make_offer(1, true, 5, 10),
+        make_offer(2, true, 6, 10),
+        make_offer(3, true, 5, 10),
+        make_offer(4, true, 5, 10),
+        make_offer(5, false, 7, 10),
+        make_offer(6, false, 7, 10)};
+    auto book = Book{};
+
+    for (auto& offer : offers) { book.Add(offer); }
+
+    auto loaded = Book{};
+
+    for (auto* offer : book.Asks()) { loaded.Add(*offer); }
+
+    for (auto* offer : book.Bids()) { loaded.Add(*offer); }
+
+    EXPECT_EQ(loaded.Bids(), book.Bids());
+    EXPECT_EQ(loaded.Asks(), book.Asks());
+
+    auto ask = make_offer(7, false, 5, 40);
+    auto visited = opentxs::UnallocatedVector<std::int64_t>{};
+    loaded.Match(
+        ask,
+        [&](FakeOffer& counter) {
+            visited.emplace_back(counter.GetTransactionNum());
+        },
+        [] { return false; });
+
+    EXPECT_EQ(visited, (opentxs::UnallocatedVector<std::int64_t>{2, 1, 3, 4}));
+
+    // NOTE the previous implementation saved bids in multimap order, which
+    // is newest first within a price, and reversed time priority on reload
+    auto reference = ReferenceBook{};
+
+    for (auto& offer : offers) { reference.Add(offer); }
+
+    auto reloaded = ReferenceBook{};
+
+    for (auto& [price, offer] : reference.bids_) { reloaded.Add(*offer); }
+
+    visited.clear();
+    reloaded.Match(
+        ask,
+        [&](FakeOffer& counter) {
+            visited.emplace_back(counter.GetTransactionNum());
+        },
+        [] { return false; });
+
+    EXPECT_EQ(visited, (opentxs::UnallocatedVector<std::int64_t>{2, 4, 3, 1}));
+}
+}  // namespace ottest
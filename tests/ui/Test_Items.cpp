@@ -5,11 +5,15 @@
 
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
+#include <algorithm>
+#include <cstddef>
 #include <cstdlib>
 #include <functional>
 #include <iosfwd>
 #include <memory>
 #include <optional>
+#include <random>
+#include <string>
 #include <utility>
 
 #include "interface/ui/base/Items.hpp"
@@ -563,4 +567,59 @@ TEST(UI_items, reverse_sort)
     EXPECT_TRUE(test_row(items, 4, vector_.at(1)));
     EXPECT_TRUE(test_row(items, 5, vector_.at(0)));
 }
+
+TEST(UI_items, many_rows)
+{
+    constexpr auto count = ID{5000};
+    auto items = Type{1, false};
+    auto expected = ot::UnallocatedVector<std::pair<Key, ID>>{};
+    auto rng = std::mt19937{count};
+    const auto key = [&] { return std::to_string(rng() % 1000u); };
+
+    for (auto id = ID{0}; id < count; ++id) {
+        const auto k = key();
+        const auto [it, prev] = items.find_insert_position(k, id);
+        items.insert_before(it, k, id, std::make_shared<Value>("row"));
+        expected.emplace_back(k, id);
+    }
+
+    for (auto id = ID{0}; id < count; id += 3) {
+        const auto k = key();
+        auto move = items.find_move_position(id, k, id);
+
+        ASSERT_TRUE(move);
+
+        auto& [from, to] = move.value();
+        items.move_before(id, from.first, k, id, to.first);
+        auto i = std::find_if(expected.begin(), expected.end(), [&](auto& v) {
+            return v.second == id;
+        });
+        i->first = k;
+    }
+
+    for (auto id = ID{1}; id < count; id += 7) {
+        auto position = items.find_delete_position(id);
+
+        ASSERT_TRUE(position);
+
+        items.delete_row(id, position->first);
+        expected.erase(std::find_if(
+            expected.begin(), expected.end(), [&](auto& v) {
+                return v.second == id;
+            }));
+    }
+
+    std::sort(expected.begin(), expected.end());
+
+    ASSERT_EQ(items.size(), expected.size());
+
+    for (auto i = std::size_t{0}; i < expected.size(); ++i) {
+        const auto& [k, id] = expected[i];
+        const auto& row = items.at(i + 1u);
+
+        EXPECT_EQ(row.key_, k);
+        EXPECT_EQ(row.id_, id);
+        EXPECT_EQ(items.get_index(id).value_or(0u), i + 1u);
+    }
+}
 }  // namespace ottest
@@ -0,0 +1,239 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <set>
+
+#include "interface/ui/base/Viewport.hpp"
+
+namespace ottest
+{
+using Viewport = opentxs::ui::implementation::Viewport;
+using Range = Viewport::Range;
+
+constexpr auto rows_ = Viewport::default_rows_;
+constexpr auto prefetch_ = std::size_t{100};
+constexpr auto retain_ = std::size_t{400};
+constexpr auto size_ = std::size_t{50000};
+
+// NOTE constructs rows the same way as the list models which use Viewport
+class Model
+{
+public:
+    std::set<std::size_t> rows_{};
+    std::size_t constructed_{};
+
+    auto Load(const Viewport& viewport, bool refresh) noexcept -> void
+    {
+        auto active = std::set<std::size_t>{};
+        viewport.Update(
+            refresh,
+            [&](auto i) {
+                if (0u == rows_.count(i)) { return false; }
+
+                active.emplace(i);
+
+                return true;
+            },
+            [&](auto i) {
+                active.emplace(i);
+                ++constructed_;
+            });
+        rows_.swap(active);
+    }
+};
+
+auto width(const Range& range) noexcept -> std::size_t
+{
+    return range.second - range.first;
+}
+
+TEST(Viewport, empty)
+{
+    auto viewport = Viewport{true, prefetch_, retain_};
+
+    EXPECT_EQ(viewport.Size(), 0u);
+    EXPECT_EQ(viewport.Load(), Range(0, 0));
+    EXPECT_EQ(viewport.Retain(), Range(0, 0));
+}
+
+TEST(Viewport, small_list)
+{
+    auto viewport = Viewport{true, prefetch_, retain_};
+    viewport.Resize(10);
+
+    EXPECT_EQ(viewport.Load(), Range(0, 10));
+    EXPECT_EQ(viewport.Retain(), Range(0, 10));
+}
+
+TEST(Viewport, unbounded)
+{
+    auto viewport = Viewport{true, prefetch_, retain_};
+    viewport.Resize(size_);
+
+    EXPECT_EQ(viewport.Visible(), Range(0, size_));
+    EXPECT_EQ(viewport.Load(), Range(0, size_));
+    EXPECT_EQ(viewport.Retain(), Range(0, size_));
+}
+
+TEST(Viewport, follow_tail)
+{
+    auto viewport = Viewport{true, prefetch_, retain_};
+    viewport.Resize(size_);
+
+    EXPECT_TRUE(viewport.Set(size_ - rows_, rows_));
+    EXPECT_EQ(viewport.Visible(), Range(size_ - rows_, size_));
+    EXPECT_EQ(viewport.Load(), Range(size_ - rows_ - prefetch_, size_));
+
+    viewport.Resize(size_ + 1);
+
+    EXPECT_EQ(viewport.Visible(), Range(size_ + 1 - rows_, size_ + 1));
+}
+
+TEST(Viewport, follow_head)
+{
+    auto viewport = Viewport{false, prefetch_, retain_};
+    viewport.Resize(size_);
+
+    EXPECT_TRUE(viewport.Set(0, rows_));
+    EXPECT_EQ(viewport.Visible(), Range(0, rows_));
+    EXPECT_EQ(viewport.Load(), Range(0, rows_ + prefetch_));
+
+    viewport.Resize(size_ + 1);
+
+    EXPECT_EQ(viewport.Visible(), Range(0, rows_));
+}
+
+TEST(Viewport, scroll_direction)
+{
+    auto viewport = Viewport{true, prefetch_, retain_};
+    viewport.Resize(size_);
+
+    EXPECT_TRUE(viewport.Set(1000, 20));
+    EXPECT_EQ(viewport.Load(), Range(1000 - prefetch_, 1020 + prefetch_ / 4));
+    EXPECT_EQ(viewport.Retain(), Range(1000 - retain_, 1020 + retain_));
+
+    EXPECT_TRUE(viewport.Set(2000, 20));
+    EXPECT_EQ(viewport.Load(), Range(2000 - prefetch_ / 4, 2020 + prefetch_));
+
+    EXPECT_FALSE(viewport.Set(2000, 20));
+}
+
+TEST(Viewport, stop_following)
+{
+    auto viewport = Viewport{true, prefetch_, retain_};
+    viewport.Resize(size_);
+    viewport.Set(0, rows_);
+    viewport.Resize(size_ + 1);
+
+    EXPECT_EQ(viewport.Visible(), Range(0, rows_));
+
+    viewport.Set(size_ + 1 - rows_, rows_);
+    viewport.Resize(size_ + 2);
+
+    EXPECT_EQ(viewport.Visible(), Range(size_ + 2 - rows_, size_ + 2));
+}
+
+TEST(Viewport, shrink)
+{
+    auto viewport = Viewport{true, prefetch_, retain_};
+    viewport.Resize(size_);
+    viewport.Set(size_ / 2, rows_);
+    viewport.Resize(10);
+
+    EXPECT_EQ(viewport.Visible(), Range(10, 10));
+    EXPECT_EQ(viewport.Load(), Range(0, 10));
+}
+
+TEST(Viewport, model_unbounded)
+{
+    auto viewport = Viewport{true, prefetch_, retain_};
+    auto model = Model{};
+    viewport.Resize(size_);
+    model.Load(viewport, false);
+
+    EXPECT_EQ(model.rows_.size(), size_);
+    EXPECT_EQ(model.constructed_, size_);
+
+    model.Load(viewport, true);
+
+    EXPECT_EQ(model.rows_.size(), size_);
+    EXPECT_EQ(model.constructed_, 2u * size_);
+}
+
+TEST(Viewport, model_set_viewport)
+{
+    auto viewport = Viewport{true, prefetch_, retain_};
+    auto model = Model{};
+    viewport.Resize(size_);
+    model.Load(viewport, false);
+
+    ASSERT_TRUE(viewport.Set(size_ - rows_, rows_));
+
+    model.Load(viewport, false);
+    const auto retain = viewport.Retain();
+
+    EXPECT_EQ(model.constructed_, size_);
+    EXPECT_EQ(model.rows_.size(), width(retain));
+    EXPECT_EQ(*model.rows_.begin(), retain.first);
+    EXPECT_EQ(*model.rows_.rbegin(), retain.second - 1u);
+
+    model.Load(viewport, true);
+
+    EXPECT_EQ(model.constructed_, size_ + width(viewport.Load()));
+    EXPECT_EQ(model.rows_.size(), width(retain));
+}
+
+TEST(Viewport, model_scroll)
+{
+    auto viewport = Viewport{true, prefetch_, retain_};
+    auto model = Model{};
+    viewport.Resize(size_);
+    viewport.Set(size_ - rows_, rows_);
+    model.Load(viewport, false);
+    const auto initial = model.constructed_;
+
+    EXPECT_EQ(initial, width(viewport.Load()));
+
+    for (auto first = size_ - rows_; first >= rows_; first -= rows_) {
+        viewport.Set(first - rows_, rows_);
+        model.Load(viewport, false);
+        const auto visible = viewport.Visible();
+
+        ASSERT_LE(model.rows_.size(), width(viewport.Retain()));
+
+        for (auto i = visible.first; i < visible.second; ++i) {
+            ASSERT_EQ(model.rows_.count(i), 1u);
+        }
+    }
+
+    // NOTE every row is constructed once while scrolling in one direction
+    EXPECT_EQ(model.constructed_, size_);
+
+    const auto before = model.constructed_;
+    viewport.Set(rows_, rows_);
+    model.Load(viewport, false);
+
+    // NOTE a small reversal uses the retained rows
+    EXPECT_EQ(model.constructed_, before);
+}
+
+TEST(Viewport, model_insert)
+{
+    auto viewport = Viewport{true, prefetch_, retain_};
+    auto model = Model{};
+    viewport.Resize(size_);
+    viewport.Set(0, rows_);
+    model.Load(viewport, false);
+    const auto before = model.rows_;
+
+    // NOTE rows appended outside the retained range are not constructed
+    viewport.Resize(size_ + 1u);
+    model.Load(viewport, false);
+
+    EXPECT_EQ(model.rows_, before);
+}
+}  // namespace ottest